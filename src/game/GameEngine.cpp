@@ -1,6 +1,16 @@
 #include "GameEngine.hpp"
+#include "audio/AudioMixer.hpp"
+#include "diagnostics/GameplayJournal.hpp"
+#include "diagnostics/StartupProfiler.hpp"
+#include "ecs/Random.hpp"
+#include "ecs/SimulationLod.hpp"
+#include "ecs/SystemManager.hpp"
+#include "ecs/systems/RenderSystem.hpp"
+#include "resources/ResourceManager.hpp"
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <cmath>
+#include <future>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -17,11 +27,17 @@ GameEngine::GameEngine(const std::string &title, const std::string &assetsDir)
     : window(nullptr), renderer(nullptr), font(nullptr), textSurface(nullptr),
       textTexture(nullptr), width(800), height(600), title(title),
       assetsDirectory(assetsDir), running(false), timer(60),
-      hud(std::make_unique<HUD>(width, height, &timer)), gameWorld(nullptr){}
+      hud(std::make_unique<HUD>(width, height, &timer)), gameWorld(nullptr),
+      replaySeekSeconds(0.0), governor(&timer), fixedQualityLevel(-1),
+      randomSeed(0), hasRandomSeed(false), botEnabled(false), timeScale(1.0f),
+      resumeTimeScale(1.0f), simulationAccumulator(0.0) {}
 #else
     : window(nullptr), renderer(nullptr), width(800), height(600), title(title),
       assetsDirectory(assetsDir), running(false), timer(60),
-      hud(std::make_unique<HUD>(width, height, &timer)), gameWorld(nullptr) {
+      hud(std::make_unique<HUD>(width, height, &timer)), gameWorld(nullptr),
+      replaySeekSeconds(0.0), governor(&timer), fixedQualityLevel(-1),
+      randomSeed(0), hasRandomSeed(false), botEnabled(false), timeScale(1.0f),
+      resumeTimeScale(1.0f), simulationAccumulator(0.0) {
 }
 #endif
 
@@ -37,9 +53,28 @@ GameEngine::GameEngine(const std::string &title, const std::string &assetsDir)
  * @brief Initializes SDL and creates window" and renderer
  * Sets up all necessary SDL components for the game engine
  *
+ * Independent phases overlap: GameData.json is parsed while SDL starts, the
+ * font opens while the world is built, and images decode while the world,
+ * window and renderer come up. StartupProfiler records each phase.
+ *
  * @return true if initialization was successful, false otherwise
  */
 bool GameEngine::init() {
+  auto &startup = diagnostics::StartupProfiler::getInstance();
+  startup.start();
+  std::future<nlohmann::json> gameData =
+      std::async(std::launch::async, [dataPath = assetsDirectory +
+                                                  "/GameData.json"] {
+        try {
+          return GameWorld::readGameData(dataPath);
+        } catch (const std::exception &e) {
+          // GameWorld::initialize() reports it again below
+          SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Game data error: %s",
+                       e.what());
+          return nlohmann::json();
+        }
+      });
+
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Initializing SDL...");
 
   // Configure logging levels - default to WARN (shows nothing), ESC cycles to
@@ -51,34 +86,38 @@ bool GameEngine::init() {
               "Logging configured: Default=WARN (silent), ESC toggles to INFO "
               "for debugging");
 
-  if (!SDL_Init(SDL_INIT_VIDEO)) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "SDL_Init Error: %s", SDL_GetError());
-    return false;
+  {
+    diagnostics::StartupProfiler::Scope phase("SDL_Init");
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "SDL_Init Error: %s",
+                   SDL_GetError());
+      return false;
+    }
   }
 
 #ifdef USE_SDL3_TTF
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Initializing TTF...");
-  if (!TTF_Init()) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "TTF_Init Error: %s", SDL_GetError());
-    SDL_Quit();
-    return false;
+  {
+    diagnostics::StartupProfiler::Scope phase("TTF_Init");
+    if (!TTF_Init()) {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "TTF_Init Error: %s",
+                   SDL_GetError());
+      SDL_Quit();
+      return false;
+    }
   }
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Loading font...");
+  std::future<TTF_Font *> fontLoad = std::async(std::launch::async, [] {
+    diagnostics::StartupProfiler::Scope phase("open font");
 #ifdef __APPLE__
-  font = TTF_OpenFont("/System/Library/Fonts/Helvetica.ttc",
-                      24); // Use Helvetica on macOS
+    return TTF_OpenFont("/System/Library/Fonts/Helvetica.ttc",
+                        24); // Use Helvetica on macOS
 #else
-  font =
-      TTF_OpenFont("C:\\Windows\\Fonts\\arial.ttf", 24); // Use Arial on Windows
+    return TTF_OpenFont("C:\\Windows\\Fonts\\arial.ttf",
+                        24); // Use Arial on Windows
 #endif
-  if (!font) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Font Loading Error: %s",
-                 SDL_GetError());
-    TTF_Quit();
-    SDL_Quit();
-    return false;
-  }
+  });
 #endif
   // Initialize GameWorld
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Initializing GameWorld...");
@@ -87,18 +126,64 @@ bool GameEngine::init() {
               "[GameEngine] Setting renderer in GameWorld: %p", renderer);
 
   gameWorld->setAssetsDirectory(
-      assetsDirectory);    // Set assets directory before initialization
-  gameWorld->initialize(); // Initialize first
+      assetsDirectory); // Set assets directory before initialization
+  nlohmann::json data;
+  {
+    diagnostics::StartupProfiler::Scope phase("wait for GameData.json");
+    data = gameData.get();
+  }
+  // Joins the image decoders and frees their surfaces if init returns
+  // before finishPreload() takes them
+  struct PreloadGuard {
+    ~PreloadGuard() {
+      resources::ResourceManager::getInstance().cancelPreload();
+    }
+  } preloadGuard;
+  if (data.is_null()) {
+    gameWorld->initialize(); // Reports why the data could not be read
+  } else {
+    // Images decode on worker threads while the world, window and renderer
+    // come up; the textures are uploaded once the renderer exists
+    resources::ResourceManager::getInstance().preloadImages(
+        GameWorld::collectImageNames(data));
+    gameWorld->initialize(data);
+  }
+  if (hasRandomSeed) {
+    ecs::RandomService::getInstance().setSeed(randomSeed);
+  }
+  if (botEnabled) {
+    gameWorld->enableBot();
+  }
 
-  // Get world dimensions from GameWorld after initialization
-  width = gameWorld->getWorldWidth();
-  height = gameWorld->getWorldHeight();
+  // The window shows the camera view, which may be smaller than the world
+  width = gameWorld->getViewWidth();
+  height = gameWorld->getViewHeight();
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-              "[GameEngine] World dimensions from GameWorld: %dx%d", width,
-              height);
+              "[GameEngine] View dimensions from GameWorld: %dx%d (world "
+              "%dx%d)",
+              width, height, gameWorld->getWorldWidth(),
+              gameWorld->getWorldHeight());
+
+#ifdef USE_SDL3_TTF
+  {
+    diagnostics::StartupProfiler::Scope phase("wait for font");
+    font = fontLoad.get();
+  }
+  if (!font) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Font Loading Error: %s",
+                 SDL_GetError());
+    TTF_Quit();
+    SDL_Quit();
+    return false;
+  }
+#endif
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Creating window...");
-  window = SDL_CreateWindow(title.c_str(), width, height, SDL_WINDOW_RESIZABLE);
+  {
+    diagnostics::StartupProfiler::Scope phase("create window");
+    window =
+        SDL_CreateWindow(title.c_str(), width, height, SDL_WINDOW_RESIZABLE);
+  }
   if (!window) {
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Window Creation Error: %s",
                  SDL_GetError());
@@ -107,7 +192,10 @@ bool GameEngine::init() {
   }
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Creating renderer...");
-  renderer = SDL_CreateRenderer(window, nullptr);
+  {
+    diagnostics::StartupProfiler::Scope phase("create renderer");
+    renderer = SDL_CreateRenderer(window, nullptr);
+  }
   if (!renderer) {
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Renderer Creation Error: %s",
                  SDL_GetError());
@@ -116,6 +204,83 @@ bool GameEngine::init() {
     return false;
   }
   gameWorld->setRenderer(renderer); // Set renderer after creation
+  {
+    diagnostics::StartupProfiler::Scope phase("upload images");
+    size_t images =
+        resources::ResourceManager::getInstance().finishPreload(renderer);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameEngine] %zu images preloaded", images);
+  }
+
+  // Start the metrics stream once all systems are registered
+  if (!metricsPath.empty()) {
+    metrics = std::make_unique<diagnostics::MetricsRecorder>(metricsPath);
+    if (!metrics->isRecording()) {
+      metrics.reset();
+    }
+  }
+
+  if (!journalPath.empty()) {
+    diagnostics::GameplayJournal::getInstance().open(
+        journalPath, static_cast<float>(gameWorld->getWorldWidth()),
+        static_cast<float>(gameWorld->getWorldHeight()));
+  }
+
+  // A replay replaces the world just loaded; one being recorded starts here
+  const float replayStep = static_cast<float>(timer.getTargetFrameTime());
+  if (!replayInputPath.empty()) {
+    replayPlayer = std::make_unique<diagnostics::ReplayPlayer>();
+    if (replayPlayer->open(replayInputPath) &&
+        replayPlayer->seek(static_cast<uint32_t>(
+            replaySeekSeconds / replayPlayer->getTickSeconds()))) {
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                  "[GameEngine] Replay at tick %u of %u (seek took %.1f ms)",
+                  replayPlayer->getTick(), replayPlayer->getTickCount(),
+                  replayPlayer->getStats().lastSeekMs);
+    } else {
+      replayPlayer.reset();
+    }
+  }
+  if (!replayOutputPath.empty()) {
+    replayRecorder =
+        std::make_unique<diagnostics::ReplayRecorder>(replayOutputPath,
+                                                      replayStep);
+    if (!replayRecorder->isRecording()) {
+      replayRecorder.reset();
+    }
+  }
+
+  // Sound is optional: without an audio device the game runs silently
+  {
+    diagnostics::StartupProfiler::Scope phase("open audio");
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO)) {
+      audio::AudioMixer::getInstance().open();
+    } else {
+      SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO,
+                  "[GameEngine] Audio unavailable: %s", SDL_GetError());
+    }
+  }
+
+  // Apply quality levels chosen by the governor
+  if (fixedQualityLevel >= 0) {
+    governor.setLevel(fixedQualityLevel);
+    governor.setEnabled(false);
+  }
+  governor.addListener([this](const QualitySettings &settings) {
+    if (hud) {
+      hud->getGameHUD().setRefreshInterval(settings.hudRefreshInterval);
+    }
+    auto *renderSystem = ecs::SystemManager::getInstance()
+                             .getSystem<ecs::systems::RenderSystem>();
+    if (renderSystem) {
+      renderSystem->setSmoothScaling(settings.smoothScaling);
+      renderSystem->setInterpolation(settings.renderInterpolation);
+    }
+    gameWorld->getParticles().setMaxParticles(
+        static_cast<size_t>(settings.maxParticles));
+    ecs::SimulationLod::getInstance().setOffscreenInterval(
+        settings.offscreenInterval);
+  });
 
   // Set up HUD elements
   if (hud) {
@@ -145,8 +310,28 @@ void GameEngine::run() {
     handleEvents();
     update();
     display();
+    if (diagnostics::StartupProfiler::getInstance().isRecording()) {
+      reportStartup();
+    }
 
     timer.waitForFrameEnd();
+    governor.update();
+    if (metrics) {
+      metrics->recordFrame(timer);
+    }
+  }
+}
+
+/**
+ * @brief Log the startup timeline once the first frame is presented
+ * Also writes it as a trace file if setStartupTraceOutput() was called
+ */
+void GameEngine::reportStartup() {
+  auto &startup = diagnostics::StartupProfiler::getInstance();
+  startup.finishFirstFrame();
+  startup.report();
+  if (!startupTracePath.empty()) {
+    startup.writeTrace(startupTracePath);
   }
 }
 
@@ -161,33 +346,50 @@ void GameEngine::handleEvents() {
     if (event.type == SDL_EVENT_QUIT) {
       running = false;
     } else if (event.type == SDL_EVENT_KEY_DOWN) {
-      // Create and publish keyboard event for key press
-      const char *keyName = SDL_GetKeyName(event.key.key);
-      std::string keyNameLower = std::string(keyName);
-      std::transform(keyNameLower.begin(), keyNameLower.end(),
-                     keyNameLower.begin(), ::tolower);
+      // Letters and symbols typed into the entity inspector's name filter
+      // are not hotkeys
+      const bool typing = hud && hud->getDebugOverlay() &&
+                          hud->getDebugOverlay()->isCapturingText();
+
+      // Create and publish keyboard event for key press; pooled, with the
+      // key name interned, so held-key auto-repeat does not allocate
+      auto keyboardEvent = events::KeyboardEvent::create(
+          SDL_GetKeyName(event.key.key), true);
       SDL_LogInfo(SDL_LOG_CATEGORY_INPUT,
                   "[GameEngine] Key pressed: %s (SDL key code: %d)",
-                  keyNameLower.c_str(), event.key.key);
+                  keyboardEvent->getKey().c_str(), event.key.key);
+      events::EventManager::getInstance().publish(std::move(keyboardEvent));
 
-      auto keyboardEvent = std::make_shared<events::KeyboardEvent>(
-          keyNameLower, keyNameLower, true);
-      SDL_LogInfo(
-          SDL_LOG_CATEGORY_INPUT,
-          "[GameEngine] Publishing keyboard event - Key: %s, Pressed: true",
-          keyNameLower.c_str());
-      events::EventManager::getInstance().publish(keyboardEvent);
-
-      if (event.key.key == SDLK_Q) {
+      if (!typing && event.key.key == SDLK_Q) {
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                     "[GameEngine] Quit key (Q) pressed, stopping game loop");
         running = false;
-      } else if (event.key.key == SDLK_H) {
+      } else if (!typing && event.key.key == SDLK_H) {
         if (hud) {
           hud->toggleVisibility();
           SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                       "[GameEngine] HUD visibility toggled");
         }
+      } else if (event.key.key == SDLK_F5) {
+        gameWorld->requestDiagnosticsReport();
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                    "[GameEngine] World diagnostics report requested");
+      } else if (!typing && event.key.key == SDLK_P) {
+        setTimeScale(timeScale == 0.0f ? resumeTimeScale : 0.0f);
+      } else if (!typing && (event.key.key == SDLK_MINUS ||
+                             event.key.key == SDLK_EQUALS)) {
+        // Step to the next slower/faster level
+        const size_t levels = sizeof(TIME_SCALES) / sizeof(TIME_SCALES[0]);
+        size_t level = 0;
+        while (level + 1 < levels && TIME_SCALES[level] < timeScale) {
+          ++level;
+        }
+        if (event.key.key == SDLK_MINUS) {
+          level = level > 0 ? level - 1 : 0;
+        } else if (TIME_SCALES[level] <= timeScale) {
+          level = std::min(level + 1, levels - 1);
+        }
+        setTimeScale(TIME_SCALES[level]);
       } else if (event.key.key == SDLK_ESCAPE) {
         // Cycle through log levels
         static SDL_LogPriority logLevels[] = {
@@ -221,26 +423,22 @@ void GameEngine::handleEvents() {
                                (sizeof(logLevels) / sizeof(logLevels[0]));
       }
     } else if (event.type == SDL_EVENT_KEY_UP) {
-      // Create and publish keyboard event for key release
-      const char *keyName = SDL_GetKeyName(event.key.key);
-      std::string keyNameLower = std::string(keyName);
-      std::transform(keyNameLower.begin(), keyNameLower.end(),
-                     keyNameLower.begin(), ::tolower);
+      // Create and publish keyboard event for key release; pooled, with the
+      // key name interned, so held-key auto-repeat does not allocate
+      auto keyboardEvent = events::KeyboardEvent::create(
+          SDL_GetKeyName(event.key.key), false);
       SDL_LogInfo(SDL_LOG_CATEGORY_INPUT,
                   "[GameEngine] Key released: %s (SDL key code: %d)",
-                  keyNameLower.c_str(), event.key.key);
-
-      auto keyboardEvent = std::make_shared<events::KeyboardEvent>(
-          keyNameLower, keyNameLower, false);
-      SDL_LogInfo(
-          SDL_LOG_CATEGORY_INPUT,
-          "[GameEngine] Publishing keyboard event - Key: %s, Pressed: false",
-          keyNameLower.c_str());
-      events::EventManager::getInstance().publish(keyboardEvent);
+                  keyboardEvent->getKey().c_str(), event.key.key);
+      events::EventManager::getInstance().publish(std::move(keyboardEvent));
     }
   }
 
   // Process any queued events
+  if (metrics) {
+    metrics->setEventQueueDepth(
+        events::EventManager::getInstance().getQueueSize());
+  }
   events::EventManager::getInstance().update();
 }
 
@@ -249,12 +447,83 @@ void GameEngine::handleEvents() {
  * Updates all game objects and HUD elements
  */
 void GameEngine::update() {
-  // Update game objects through GameWorld
-  gameWorld->update(timer.getAverageFrameTime());
+  // The world advances in fixed steps of one target frame; the time scale
+  // decides how many steps this frame gets
+  const float step = static_cast<float>(timer.getTargetFrameTime());
+  const double frameTime = timer.getAverageFrameTime();
+  int steps = 0;
+  if (std::isinf(timeScale)) {
+    // Uncapped: simulate until the frame budget is spent
+    while (steps < MAX_UNCAPPED_STEPS &&
+           timer.getCurrentFrameTime() < step * 0.9) {
+      stepWorld(step, false);
+      ++steps;
+    }
+    simulationAccumulator = 0.0;
+    gameWorld->setRenderAlpha(1.0f);
+  } else {
+    simulationAccumulator += frameTime * timeScale;
+    steps = static_cast<int>(simulationAccumulator / step);
+    if (steps > MAX_STEPS_PER_FRAME) {
+      // Too far behind to catch up; drop the backlog
+      steps = MAX_STEPS_PER_FRAME;
+      simulationAccumulator = 0.0;
+    } else {
+      simulationAccumulator -= steps * step;
+    }
+    // The frame is drawn this far between the last two steps
+    gameWorld->setRenderAlpha(static_cast<float>(simulationAccumulator / step));
+    // Only the last step of a fast-forwarded frame is drawn
+    for (int i = 0; i < steps; ++i) {
+      stepWorld(step, i + 1 == steps);
+    }
+  }
+  if (steps == 0 || std::isinf(timeScale)) {
+    gameWorld->render();
+  }
 
-  // Update the HUD with deltaTime
+  // The HUD runs on real time
   if (hud) {
-    hud->update(timer.getAverageFrameTime());
+    hud->update(frameTime);
+  }
+}
+
+void GameEngine::stepWorld(float step, bool draw) {
+  if (replayPlayer && !replayPlayer->step(draw)) {
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameEngine] Replay ended at tick %u; keyboard takes over",
+                replayPlayer->getTick());
+    replayPlayer.reset();
+  }
+  if (!replayPlayer) {
+    gameWorld->update(step, draw);
+  }
+  // Replayed ticks are recorded too, so a replay can be cut from a replay
+  if (replayRecorder) {
+    replayRecorder->recordTick();
+  }
+}
+
+void GameEngine::setTimeScale(float scale) {
+  if (!(scale >= 0.0f)) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameEngine] Ignoring invalid time scale %f", scale);
+    return;
+  }
+  if (scale > 0.0f) {
+    resumeTimeScale = scale;
+  }
+  timeScale = scale;
+  simulationAccumulator = 0.0;
+  // Uncapped frames spend the whole budget on purpose; they must not
+  // push the governor down to minimum quality
+  governor.setPaused(std::isinf(scale));
+  if (std::isinf(scale)) {
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameEngine] Time scale: uncapped");
+  } else {
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[GameEngine] Time scale: %gx",
+                scale);
   }
 }
 
@@ -337,6 +606,12 @@ void GameEngine::quit() { running = false; }
  * Called by destructor to ensure proper cleanup
  */
 void GameEngine::destroy() {
+  // Flush the metrics capture, journal and replay before tearing anything
+  // else down
+  metrics.reset();
+  diagnostics::GameplayJournal::getInstance().close();
+  replayRecorder.reset();
+  replayPlayer.reset();
 #ifdef USE_SDL3_TTF
   if (font) {
     TTF_CloseFont(font);
@@ -352,6 +627,7 @@ void GameEngine::destroy() {
   }
   TTF_Quit();
 #endif
+  audio::AudioMixer::getInstance().close();
   if (renderer) {
     SDL_DestroyRenderer(renderer);
     renderer = nullptr;
@@ -8,14 +8,18 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <limits>
 #include <unordered_map>
 #include "GameColor.hpp"
 #include "Timer.hpp"
+#include "QualityGovernor.hpp"
 #include "ui/HUD.hpp"
 #include "GameWorld.hpp"
 #include "events/Event.hpp"
 #include "events/KeyboardEvent.hpp"
 #include "events/EventManager.hpp"
+#include "diagnostics/MetricsRecorder.hpp"
+#include "diagnostics/Replay.hpp"
 
 namespace game {
     /**
@@ -75,7 +79,102 @@ namespace game {
          */
         void quit();
 
+        /**
+         * Stream per-frame metrics to a binary file (see MetricsRecorder).
+         * Must be called before init(); an empty path disables recording.
+         *
+         * @param path Output file for the metrics capture
+         */
+        void setMetricsOutput(const std::string& path) { metricsPath = path; }
+
+        /**
+         * Journal gameplay events to a binary file (see GameplayJournal).
+         * Must be called before init(); an empty path disables the journal.
+         *
+         * @param path Output file for the journal
+         */
+        void setJournalOutput(const std::string& path) { journalPath = path; }
+
+        /**
+         * Write the startup timeline (see StartupProfiler) as Chrome trace
+         * events once the first frame is presented. An empty path only
+         * logs it.
+         *
+         * @param path Output file for the trace
+         */
+        void setStartupTraceOutput(const std::string& path) { startupTracePath = path; }
+
+        /**
+         * Pin the quality level and stop the governor from adapting it.
+         * A negative level (the default) leaves the governor in charge.
+         *
+         * @param level Quality level, 0 = highest (see QualityGovernor)
+         */
+        void setFixedQualityLevel(int level) { fixedQualityLevel = level; }
+
+        /**
+         * Use a fixed world seed instead of the one from GameData.json (or a
+         * random one), so a run can be reproduced. Must be called before init().
+         *
+         * @param seed World seed for the RandomService
+         */
+        void setRandomSeed(uint64_t seed) { randomSeed = seed; hasRandomSeed = true; }
+
+        /**
+         * Let a bot play instead of the keyboard (see BotControlSystem), e.g.
+         * for long unattended soak runs. Must be called before init().
+         *
+         * @param enabled Attach a Bot to the player
+         */
+        void setBotEnabled(bool enabled) { botEnabled = enabled; }
+
+        /**
+         * Record the session to a replay file (see ReplayRecorder). Must be
+         * called before init(); an empty path disables recording.
+         *
+         * @param path Output file for the replay
+         */
+        void setReplayOutput(const std::string& path) { replayOutputPath = path; }
+
+        /**
+         * Play a replay file back instead of taking input (see ReplayPlayer).
+         * Once the recording ends the keyboard takes over. Must be called
+         * before init().
+         *
+         * @param path Replay file to play
+         * @param seekSeconds Start this far into the recording
+         */
+        void setReplayInput(const std::string& path, double seekSeconds = 0.0) {
+            replayInputPath = path;
+            replaySeekSeconds = seekSeconds;
+        }
+
+        /**
+         * Set how fast simulated time runs relative to real time. The world
+         * advances in fixed steps of one target frame; at 8x eight steps run
+         * per frame and only the last one is drawn. 0 pauses the simulation
+         * (the frozen state is still drawn) and TIME_SCALE_UNCAPPED runs as
+         * many steps as fit into each frame, with the quality governor
+         * paused. P toggles pause, - and = step through TIME_SCALES (F6-F9
+         * belong to the entity inspector).
+         *
+         * @param scale Simulated seconds per real second (>= 0)
+         */
+        void setTimeScale(float scale);
+
+        /**
+         * @return Current time scale (TIME_SCALE_UNCAPPED when uncapped)
+         */
+        float getTimeScale() const { return timeScale; }
+
+        static constexpr float TIME_SCALE_UNCAPPED = std::numeric_limits<float>::infinity();
+        // Levels the - and = hotkeys step through
+        static constexpr float TIME_SCALES[] = {0.0f, 0.25f, 1.0f, 8.0f, TIME_SCALE_UNCAPPED};
+
     private:
+        static constexpr int MAX_STEPS_PER_FRAME = 32;    // Catch-up limit for scaled time
+        static constexpr int MAX_UNCAPPED_STEPS = 4096;   // Safety limit when uncapped
+
         SDL_Window* window;      // SDL window
         SDL_Renderer* renderer;  // SDL renderer
 #ifdef USE_SDL3_TTF
@@ -91,16 +190,47 @@ namespace game {
         std::unique_ptr<HUD> hud;  // Heads-up display
         GameWorld* gameWorld;    // Game world instance
         std::string assetsDirectory;   // Path to assets directory
+        std::string metricsPath;       // Metrics capture file (empty = off)
+        std::string journalPath;       // Gameplay journal file (empty = off)
+        std::string startupTracePath;  // Startup timeline trace (empty = log only)
+        std::unique_ptr<diagnostics::MetricsRecorder> metrics;  // Per-frame metrics stream
+        std::string replayOutputPath;  // Replay to record (empty = off)
+        std::string replayInputPath;   // Replay to play back (empty = off)
+        double replaySeekSeconds;      // Where playback starts
+        std::unique_ptr<diagnostics::ReplayRecorder> replayRecorder;
+        std::unique_ptr<diagnostics::ReplayPlayer> replayPlayer;
+        QualityGovernor governor;      // Adapts quality to the frame budget
+        int fixedQualityLevel;         // Pinned quality level (-1 = adaptive)
+        uint64_t randomSeed;           // World seed from the command line
+        bool hasRandomSeed;            // randomSeed overrides GameData.json
+        bool botEnabled;               // Bot plays for the player
+        float timeScale;               // Simulated seconds per real second
+        float resumeTimeScale;         // Time scale restored when unpausing
+        double simulationAccumulator;  // Simulated time not yet stepped
 
         /**
          * Process input events from SDL
          */
         void handleEvents();
+
+        /**
+         * Stop the startup timeline after the first frame and report it
+         */
+        void reportStartup();
         
         /**
          * Update game state
          */
         void update();
+
+        /**
+         * Advance the world one fixed step: the next replay tick while one is
+         * playing, otherwise a live update (recorded if enabled).
+         *
+         * @param step Step length in seconds
+         * @param draw Let RenderSystem draw this step
+         */
+        void stepWorld(float step, bool draw);
         
         /**
          * Render the current frame
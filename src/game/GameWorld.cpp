@@ -1,10 +1,17 @@
 #include "GameWorld.hpp"
 #include "GameColor.hpp"
 #include "Timer.hpp"
+#include "audio/AudioMixer.hpp"
+#include "diagnostics/StartupProfiler.hpp"
+#include "diagnostics/WorldDiagnostics.hpp"
+#include "ecs/Random.hpp"
+#include "ecs/SimulationLod.hpp"
+#include "ecs/Tweener.hpp"
 #include "ecs/components/Target.hpp"
 #include "ecs/systems/UIEventSystem.hpp"
 #include "resources/ResourceManager.hpp"
 #include <SDL3/SDL.h>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <nlohmann/json.hpp>
@@ -16,9 +23,11 @@ using json = nlohmann::json;
 namespace game {
 
 GameWorld::GameWorld()
-    : worldWidth(800), worldHeight(600), renderer(nullptr),
+    : worldWidth(800), worldHeight(600), viewWidth(800), viewHeight(600),
+      renderer(nullptr),
       componentManager(ecs::ComponentManager::getInstance()),
-      eventManager(events::EventManager::getInstance()) {
+      eventManager(events::EventManager::getInstance()),
+      renderSystem(nullptr) {
 
   // Initialize locale for Windows
 #ifdef _WIN32
@@ -73,6 +82,16 @@ void GameWorld::setRenderer(SDL_Renderer *renderer) {
 
 bool GameWorld::initialize() {
   try {
+    return initialize(readGameData(assetsDir + "/GameData.json"));
+  } catch (const std::exception &e) {
+    std::cerr << "Failed to initialize GameWorld: " << e.what() << std::endl;
+    return false;
+  }
+}
+
+bool GameWorld::initialize(const nlohmann::json &gameData) {
+  try {
+    diagnostics::StartupProfiler::Scope phase("GameWorld::initialize");
     // Create Timer instance for hardware-independent timing
     gameTimer = std::make_unique<Timer>(60); // 60 FPS default
     SDL_LogInfo(
@@ -81,6 +100,10 @@ bool GameWorld::initialize() {
 
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                 "[GameWorld] Initializing with renderer: %p", renderer);
+    // Read world and view dimensions first; several systems are sized from
+    // them at construction
+    readWorldSettings(gameData);
+
     // Get system manager instance
     auto &systemManager = ecs::SystemManager::getInstance();
 
@@ -90,44 +113,59 @@ bool GameWorld::initialize() {
     uiEventSystem =
         systemManager.addSystem<ecs::systems::UIEventSystem>(eventManager);
 
-    // 1. PlayerControlSystem - Input handling and shooting
+    // 1. BotControlSystem - Scripted input for Bot entities (soak tests)
+    botControlSystem =
+        systemManager.addSystem<ecs::systems::BotControlSystem>();
+
+    // 2. PlayerControlSystem - Input handling and shooting
     playerControlSystem =
         systemManager.addSystem<ecs::systems::PlayerControlSystem>(
             eventManager, worldWidth, worldHeight);
 
-    // 2. GameStateSystem - State and timer management
+    // 3. GameStateSystem - State and timer management
     gameStateSystem = systemManager.addSystem<ecs::systems::GameStateSystem>();
 
-    // 3. TargetSpawnSystem - Duck spawning with weighted templates
+    // 4. TargetSpawnSystem - Duck spawning with weighted templates
     targetSpawnSystem =
         systemManager.addSystem<ecs::systems::TargetSpawnSystem>(worldWidth,
                                                                  worldHeight);
 
-    // 4. DuckMovementSystem - Duck-specific movement patterns
+    // 5. DuckMovementSystem - Duck-specific movement patterns
     duckMovementSystem =
         systemManager.addSystem<ecs::systems::DuckMovementSystem>(worldWidth,
                                                                   worldHeight);
 
-    // 5. MovementSystem - General movement (projectiles)
+    // 6. MovementSystem - General movement (projectiles)
     movementSystem = systemManager.addSystem<ecs::systems::MovementSystem>();
 
-    // 6. ProjectileSystem - Projectile lifecycle management (pure ECS, no
+    // 7. TransformHierarchySystem - Attached entities follow their parents
+    transformHierarchySystem =
+        systemManager.addSystem<ecs::systems::TransformHierarchySystem>();
+
+    // 8. ProjectileSystem - Projectile lifecycle management (pure ECS, no
     // events)
     projectileSystem =
         systemManager.addSystem<ecs::systems::ProjectileSystem>();
 
-    // 7. CollisionSystem - Collision detection (pure ECS, no events)
+    // 9. CollisionSystem - Collision detection (pure ECS, no events)
     collisionSystem = systemManager.addSystem<ecs::systems::CollisionSystem>();
 
-    // 8. ExpiredEntitiesSystem - Entity cleanup (CRITICAL: Must come after all
+    // 10. ExpiredEntitiesSystem - Entity cleanup (CRITICAL: Must come after all
     // other systems)
     expiredEntitiesSystem =
         systemManager.addSystem<ecs::systems::ExpiredEntitiesSystem>();
     expiredEntitiesSystem->setSystemManager(&systemManager);
 
-    // 9. RenderSystem - Visual rendering (last)
+    // 11. CameraSystem - Follows the player and publishes the view
+    cameraSystem = systemManager.addSystem<ecs::systems::CameraSystem>(
+        worldWidth, worldHeight);
+
+    // 12. RenderSystem - Visual rendering through the camera (last)
     renderSystem =
         systemManager.addSystem<ecs::systems::RenderSystem>(renderer);
+    renderSystem->setCameraSystem(cameraSystem);
+    renderSystem->setParticleEmitter(&particles);
+    projectileSystem->setParticleEmitter(&particles);
 
     // Add EventSystem (not part of specification order but needed for events)
     eventSystem =
@@ -142,11 +180,12 @@ bool GameWorld::initialize() {
     SDL_LogInfo(
         SDL_LOG_CATEGORY_APPLICATION,
         "[GameWorld] Added all systems in pure ECS order: UIEvent (input "
-        "bridge), PlayerControl, GameState, TargetSpawn, DuckMovement, "
-        "Movement, Projectile, Collision, ExpiredEntities, Render, Event");
+        "bridge), BotControl, PlayerControl, GameState, TargetSpawn, DuckMovement, "
+        "Movement, Projectile, Collision, ExpiredEntities, Camera, Render, "
+        "Event");
 
     // Load game data from JSON
-    loadFromJson(assetsDir + "/GameData.json");
+    loadGameData(gameData);
     return true;
   } catch (const std::exception &e) {
     std::cerr << "Failed to initialize GameWorld: " << e.what() << std::endl;
@@ -157,6 +196,11 @@ bool GameWorld::initialize() {
 void GameWorld::loadFromJson(const std::string &filePath) {
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Loading game data from: %s",
               filePath.c_str());
+  loadGameData(readGameData(filePath));
+}
+
+nlohmann::json GameWorld::readGameData(const std::string &filePath) {
+  diagnostics::StartupProfiler::Scope phase("parse GameData.json");
   std::ifstream file(filePath);
   if (!file.is_open()) {
     throw std::runtime_error("Failed to open file: " + filePath);
@@ -167,15 +211,54 @@ void GameWorld::loadFromJson(const std::string &filePath) {
                       std::istreambuf_iterator<char>());
   file.close();
 
-  // Parse JSON
-  auto json = nlohmann::json::parse(content);
+  return nlohmann::json::parse(content);
+}
+
+std::vector<std::string>
+GameWorld::collectImageNames(const nlohmann::json &gameData) {
+  std::vector<std::string> names;
+  auto collect = [&names](const nlohmann::json &object) {
+    if (!object.contains("components") ||
+        !object["components"].contains("images")) {
+      return;
+    }
+    const auto &images = object["components"]["images"];
+    if (!images.contains("imageNames")) {
+      return;
+    }
+    for (const auto &name : images["imageNames"]) {
+      std::string imageName = name.get<std::string>();
+      if (std::find(names.begin(), names.end(), imageName) == names.end()) {
+        names.push_back(std::move(imageName));
+      }
+    }
+  };
+  if (gameData.contains("entities")) {
+    for (const auto &entity : gameData["entities"]) {
+      collect(entity);
+    }
+  }
+  if (gameData.contains("templates")) {
+    for (const auto &templateData : gameData["templates"]) {
+      collect(templateData);
+    }
+  }
+  return names;
+}
+
+void GameWorld::loadGameData(const nlohmann::json &json) {
+  diagnostics::StartupProfiler::Scope phase("load entities");
 
   // Load world dimensions from JSON
   if (json.contains("world")) {
-    worldWidth = json["world"]["width"].get<int>();
-    worldHeight = json["world"]["height"].get<int>();
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Loaded world dimensions: %dx%d",
-                worldWidth, worldHeight);
+    readWorldSettings(json);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "Loaded world dimensions: %dx%d (view %dx%d)", worldWidth,
+                worldHeight, viewWidth, viewHeight);
+    if (cameraSystem) {
+      cameraSystem->setWorldBounds(static_cast<float>(worldWidth),
+                                   static_cast<float>(worldHeight));
+    }
 
     // Set world size for systems that need it (but MovementSystem no longer
     // needs it)
@@ -209,6 +292,11 @@ void GameWorld::loadFromJson(const std::string &filePath) {
                 "not initialized");
   }
 
+  // Sound effects are decoded up front; GameEngine opens the device later
+  if (json.contains("audio")) {
+    loadAudio(json["audio"]);
+  }
+
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Found %zu entities in JSON",
               json["entities"].size());
 
@@ -219,10 +307,97 @@ void GameWorld::loadFromJson(const std::string &filePath) {
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Finished loading %zu entities",
               entities.size());
 
+  // The camera follows the player loaded above
+  createCamera();
+
+  // Scenery beyond the entity list is streamed from the scene by cell
+  if (!scenePath.empty()) {
+    if (!worldStreamer.open(assetsDir + "/" + scenePath)) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                  "[GameWorld] Scene %s could not be opened; streaming off",
+                  scenePath.c_str());
+    }
+  }
+
   // Log system states after loading
   logSystemStates();
 }
 
+void GameWorld::readWorldSettings(const nlohmann::json &json) {
+  if (!json.contains("world")) {
+    return;
+  }
+  const auto &world = json["world"];
+  worldWidth = world["width"].get<int>();
+  worldHeight = world["height"].get<int>();
+  viewWidth = world.value("viewWidth", worldWidth);
+  viewHeight = world.value("viewHeight", worldHeight);
+  scenePath = world.value("scene", std::string());
+  if (world.contains("seed")) {
+    ecs::RandomService::getInstance().setSeed(world["seed"].get<uint64_t>());
+  }
+}
+
+void GameWorld::loadAudio(const nlohmann::json &audio) {
+  auto &mixer = audio::AudioMixer::getInstance();
+  if (mixer.isOpen()) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO,
+                "[GameWorld] Audio already running; sounds not reloaded");
+    return;
+  }
+  mixer.setMaxVoices(
+      audio.value("maxVoices", audio::AudioMixer::DEFAULT_MAX_VOICES));
+  if (!audio.contains("sounds")) {
+    return;
+  }
+
+  auto &bank = mixer.getSoundBank();
+  for (auto it = audio["sounds"].begin(); it != audio["sounds"].end(); ++it) {
+    const auto &sound = it.value();
+    if (bank.find(it.key()) != audio::INVALID_SOUND) {
+      continue;
+    }
+    float volume = sound.value("volume", 1.0f);
+    uint8_t priority = static_cast<uint8_t>(sound.value("priority", 0));
+    if (sound.contains("file")) {
+      bank.loadWav(it.key(), assetsDir + "/" + sound["file"].get<std::string>(),
+                   volume, priority);
+    } else if (sound.contains("tone")) {
+      const auto &tone = sound["tone"];
+      bank.addTone(it.key(), tone.value("frequency", 440.0f),
+                   tone.value("duration", 0.1f), volume, priority);
+    } else {
+      SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO,
+                  "[GameWorld] Sound %s has neither a file nor a tone",
+                  it.key().c_str());
+    }
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+              "[GameWorld] Loaded %zu sounds (%zu bytes), %d voices",
+              bank.getSoundCount(), bank.getPoolBytes(),
+              mixer.getMaxVoices());
+}
+
+void GameWorld::createCamera() {
+  auto &systemManager = ecs::SystemManager::getInstance();
+  auto camera = ecs::Entity::create("camera");
+  entities.push_back(camera);
+  entityIndices["camera"] = entities.size() - 1;
+  systemManager.onEntityCreated(camera);
+  componentManager.addComponent<ecs::components::Camera>(
+      camera, static_cast<float>(viewWidth), static_cast<float>(viewHeight));
+
+  auto players =
+      componentManager.getEntitiesWithComponent<ecs::components::Player>();
+  if (!players.empty()) {
+    componentManager.getComponent<ecs::components::Camera>(camera)->follow(
+        players.front());
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[GameWorld] Camera %llu created with view %dx%d", camera.getId(),
+              viewWidth, viewHeight);
+}
+
 void GameWorld::createEntityFromJson(const nlohmann::json &data) {
   // Get system manager instance
   auto &systemManager = ecs::SystemManager::getInstance();
@@ -241,6 +416,9 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
   // Notify systems about the new entity BEFORE adding components
   systemManager.onEntityCreated(entity);
 
+  // Systems see the entity once, after all of its components are in
+  ecs::ComponentManager::Batch componentBatch(componentManager);
+
   // Log the components data
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Entity %s components data: %s",
               entityId.c_str(), data["components"].dump().c_str());
@@ -256,8 +434,6 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
         ecs::Vector2(t["position"]["x"].get<float>(),
                      t["position"]["y"].get<float>()),
         t["rotation"].get<float>());
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Transform)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Transform component added");
   }
 
@@ -270,8 +446,6 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
         entity, s["width"].get<float>(), s["height"].get<float>(),
         GameColor(s["color"]["r"].get<int>(), s["color"]["g"].get<int>(),
                   s["color"]["b"].get<int>()));
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Sprite)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Sprite component added");
   }
 
@@ -288,8 +462,6 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
                      velocityData["y"].get<float>()),
         ecs::Vector2(accelerationData["x"].get<float>(),
                      accelerationData["y"].get<float>()));
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Movement)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Movement component added");
   }
 
@@ -324,8 +496,6 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
         input->setKey("fire", keys["fire"].get<std::string>());
     }
 
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Input)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Input component added");
   }
 
@@ -357,8 +527,6 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
                   img["activeImage"].get<size_t>());
     }
 
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Images)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Images component added");
   }
 
@@ -372,8 +540,6 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
     float fireRate = p.contains("fireRate") ? p["fireRate"].get<float>() : 0.3f;
     componentManager.addComponent<ecs::components::Player>(
         entity, gameTimer.get(), fireRate);
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Player)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                 "Player component added with fireRate: %f using "
                 "hardware-independent timing",
@@ -386,12 +552,40 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
                 "Adding Collision component to player entity %s",
                 entityId.c_str());
     componentManager.addComponent<ecs::components::Collision>(entity);
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Collision)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                 "Collision component added to player");
   }
 
+  // Attach to a previously created entity (e.g. a gun on the player)
+  if (data.contains("components") && data["components"].contains("hierarchy")) {
+    const auto &h = data["components"]["hierarchy"];
+    std::string parentId = h["parent"].get<std::string>();
+    auto parent = entityIndices.find(parentId);
+    if (parent == entityIndices.end()) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                  "[GameWorld] Entity %s: unknown parent %s (parents must be "
+                  "listed first)",
+                  entityId.c_str(), parentId.c_str());
+    } else {
+      ecs::Vector2 localPosition;
+      if (h.contains("position")) {
+        localPosition = ecs::Vector2(h["position"].value("x", 0.0f),
+                                     h["position"].value("y", 0.0f));
+      }
+      ecs::Vector2 localScale(1.0f, 1.0f);
+      if (h.contains("scale")) {
+        localScale = ecs::Vector2(h["scale"].value("x", 1.0f),
+                                  h["scale"].value("y", 1.0f));
+      }
+      componentManager.addComponent<ecs::components::Hierarchy>(
+          entity, entities[parent->second], localPosition,
+          h.value("rotation", 0.0f), localScale);
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                  "Hierarchy component added with parent %s",
+                  parentId.c_str());
+    }
+  }
+
   // Create ShootingGalleryState component (matches Python/Java pattern)
   if (data.contains("components") &&
       data["components"].contains("shootingGalleryState")) {
@@ -404,8 +598,8 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
     // Create ShootingGalleryState singleton instance with Timer dependency
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                 "[GameWorld] About to create ShootingGalleryState instance");
-    ecs::components::ShootingGalleryState::createInstance(entity,
-                                                          gameTimer.get());
+    ecs::components::ShootingGalleryState::createInstance(
+        entity, gameTimer.get(), highScoreFile);
     auto &gameState = ecs::components::ShootingGalleryState::getInstance();
     SDL_LogInfo(
         SDL_LOG_CATEGORY_APPLICATION,
@@ -437,38 +631,189 @@ void GameWorld::createEntityFromJson(const nlohmann::json &data) {
                 "Adding Collision component to entity %s with data: %s",
                 entityId.c_str(), c.dump().c_str());
     componentManager.addComponent<ecs::components::Collision>(entity);
-    systemManager.onComponentAdded(
-        entity, std::type_index(typeid(ecs::components::Collision)));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Collision component added");
   }
 
+  // Scripted player for soak and load tests
+  if (data.contains("components") && data["components"].contains("bot")) {
+    addBot(entity, data["components"]["bot"]);
+  }
+
+  // Tweens start once the entity's components exist
+  if (data.contains("components") && data["components"].contains("tweens")) {
+    for (const auto &tw : data["components"]["tweens"]) {
+      createTweenFromJson(entity, entityId, tw);
+    }
+  }
+
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Finished creating entity %s",
               entityId.c_str());
 }
 
-void GameWorld::update(float deltaTime) {
+void GameWorld::addBot(const ecs::Entity &entity, const nlohmann::json &config) {
+  // The bot types on the entity's KeyboardInput
+  if (!componentManager.getComponent<ecs::components::KeyboardInput>(entity)) {
+    componentManager.addComponent<ecs::components::KeyboardInput>(entity);
+  }
+
+  auto *bot = componentManager.getComponent<ecs::components::Bot>(entity);
+  if (!bot) {
+    componentManager.addComponent<ecs::components::Bot>(entity);
+    bot = componentManager.getComponent<ecs::components::Bot>(entity);
+  }
+  bot->setShotsPerSecond(
+      config.value("shotsPerSecond", bot->getShotsPerSecond()));
+  bot->setAimTolerance(config.value("aimTolerance", bot->getAimTolerance()));
+  bot->setDangerRadius(config.value("dangerRadius", bot->getDangerRadius()));
+  bot->setWanderInterval(
+      config.value("wanderInterval", bot->getWanderInterval()));
+  bot->setRestartRounds(
+      config.value("restartRounds", bot->getRestartRounds()));
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[GameWorld] Bot attached to entity %llu (%s)", entity.getId(),
+              bot->toString().c_str());
+}
+
+bool GameWorld::enableBot(const nlohmann::json &config) {
+  bool attached = false;
+  for (const ecs::Entity &entity : entities) {
+    if (componentManager.getComponent<ecs::components::Player>(entity)) {
+      addBot(entity, config);
+      attached = true;
+    }
+  }
+  if (!attached) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameWorld] No player entity to attach a bot to");
+  }
+  return attached;
+}
+
+void GameWorld::disableBot() {
+  for (const ecs::Entity &entity :
+       componentManager.getEntitiesWithComponent<ecs::components::Bot>()) {
+    auto *bot = componentManager.getComponent<ecs::components::Bot>(entity);
+    if (auto *keyboard =
+            componentManager.getComponent<ecs::components::KeyboardInput>(
+                entity)) {
+      for (const char *key :
+           {"arrowleft", "arrowright", "arrowup", "arrowdown", "space"}) {
+        keyboard->releaseKey(key);
+      }
+    }
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameWorld] Bot detached from entity %llu (%s)",
+                entity.getId(), bot->toString().c_str());
+    componentManager.removeComponent<ecs::components::Bot>(entity);
+  }
+}
+
+void GameWorld::createTweenFromJson(const ecs::Entity &entity,
+                                    const std::string &entityId,
+                                    const nlohmann::json &data) {
+  ecs::TweenProperty property;
+  ecs::Easing easing = ecs::Easing::Linear;
+  ecs::TweenRepeat repeat = ecs::TweenRepeat::Once;
+  std::string propertyName = data.value("property", std::string());
+  if (!ecs::Tweener::parseProperty(propertyName, property) ||
+      property == ecs::TweenProperty::Value) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameWorld] Entity %s: unknown tween property '%s'",
+                entityId.c_str(), propertyName.c_str());
+    return;
+  }
+  // Replays do not store tweens, so a tween must not change anything the
+  // simulation reads: entities that collide, move or are steered may only
+  // fade
+  if (property != ecs::TweenProperty::Alpha &&
+      (componentManager.has<ecs::components::Collision>(entity) ||
+       componentManager.has<ecs::components::Movement>(entity) ||
+       componentManager.has<ecs::components::Player>(entity))) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameWorld] Entity %s: only alpha can be tweened on a "
+                "simulated entity, ignoring '%s' tween",
+                entityId.c_str(), propertyName.c_str());
+    return;
+  }
+  if (data.contains("easing") &&
+      !ecs::Tweener::parseEasing(data["easing"].get<std::string>(), easing)) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameWorld] Entity %s: unknown easing '%s', using linear",
+                entityId.c_str(), data["easing"].get<std::string>().c_str());
+  }
+  if (data.contains("repeat") &&
+      !ecs::Tweener::parseRepeat(data["repeat"].get<std::string>(), repeat)) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[GameWorld] Entity %s: unknown tween repeat '%s', using once",
+                entityId.c_str(), data["repeat"].get<std::string>().c_str());
+  }
+
+  auto &tweener = ecs::Tweener::getInstance();
+  float to = data["to"].get<float>();
+  float duration = data.value("duration", 1.0f);
+  float delay = data.value("delay", 0.0f);
+  ecs::Tweener::TweenId id =
+      data.contains("from")
+          ? tweener.tween(entity, property, data["from"].get<float>(), to,
+                          duration, easing, repeat, delay)
+          : tweener.tweenTo(entity, property, to, duration, easing, repeat,
+                            delay);
+  if (id != ecs::Tweener::INVALID_TWEEN) {
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "Tween %u added to entity %s: %s -> %.2f over %.2fs", id,
+                entityId.c_str(), propertyName.c_str(), to, duration);
+  }
+}
+
+void GameWorld::update(float deltaTime, bool draw) {
   // Update event manager first
   eventManager.update();
-  // Debug collision state periodically (every 60 frames = ~1 second at 60 FPS)
-  static int debugFrameCount = 0;
-  debugFrameCount++;
-  if (debugFrameCount % 60 == 0) {
-    debugCollisionAndPlayer();
+
+  // Cooldowns and spawn intervals run on simulated time, so they follow
+  // the engine's time scale
+  gameTimer->advanceClock(deltaTime);
+  renderSystem->setEnabled(draw);
+
+  // Off-screen LOD: the player stays in focus, and the viewport is this
+  // step's camera view
+  auto &lod = ecs::SimulationLod::getInstance();
+  lod.beginFrame();
+  cameraSystem->publishViewport();
+  for (const auto &player :
+       componentManager.getEntitiesWithComponent<ecs::components::Player>()) {
+    if (auto *transform =
+            componentManager.getComponent<ecs::components::Transform>(
+                player)) {
+      lod.addFocusPoint(transform->getPosition());
+    }
   }
 
-  // Then update all systems
+  // Tweens write their values before the systems read them
+  ecs::Tweener::getInstance().update(deltaTime);
+  particles.update(deltaTime);
+
+  // Then update all systems (SystemManager records per-system timings)
   auto &systemManager = ecs::SystemManager::getInstance();
-  const auto &systems = systemManager.getSystems();
-  for (const auto &systemPtr : systems) {
-    size_t entityCount = systemPtr->getEntities().size();
-    const std::type_info &type = typeid(systemPtr);
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-                "[GameWorld] System %s has %zu entities", type.name(),
-                entityCount);
-    systemPtr->update(deltaTime);
+  systemManager.update(deltaTime);
+
+  // Stream scene cells around the camera's new position
+  if (worldStreamer.isOpen()) {
+    if (const auto *camera = cameraSystem->getActiveCamera()) {
+      worldStreamer.update(camera->getPosition().x, camera->getPosition().y,
+                           camera->getViewWidth(), camera->getViewHeight());
+    }
+  }
+
+  // Diagnostics run only when asked for, once systems have settled
+  if (diagnosticsRequested) {
+    diagnosticsRequested = false;
+    diagnostics::WorldDiagnostics::logReport(
+        diagnostics::WorldDiagnostics::buildReport());
   }
 }
 
+void GameWorld::requestDiagnosticsReport() { diagnosticsRequested = true; }
+
 void GameWorld::render() {
   if (!renderer) {
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
@@ -476,28 +821,19 @@ void GameWorld::render() {
     return;
   }
 
-  // Log current state
-  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Rendering world with %zu entities",
-              entities.size());
-  for (const auto &entity : entities) {
-    auto *transform =
-        componentManager.getComponent<ecs::components::Transform>(entity);
-    auto *sprite =
-        componentManager.getComponent<ecs::components::Sprite>(entity);
-    if (transform && sprite) {
-      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-                  "Entity: pos=(%.1f, %.1f), size=(%.1fx%.1f), visible=%d",
-                  transform->getPosition().x, transform->getPosition().y,
-                  sprite->getWidth(), sprite->getHeight(), sprite->isVisible());
-    }
-  }
+  // Only the render system runs; the simulation stays where it is
+  renderSystem->draw();
+}
 
-  // Update render system
-  auto &systemManager = ecs::SystemManager::getInstance();
-  systemManager.update(0.0f); // Use 0.0f for rendering
+void GameWorld::setRenderAlpha(float alpha) {
+  if (renderSystem) {
+    renderSystem->setInterpolationAlpha(alpha);
+  }
 }
 
 void GameWorld::clear() {
+  ecs::Tweener::getInstance().clear();
+  particles.clear();
   entities.clear();
   entityIndices.clear();
   componentManager.reset();
@@ -548,133 +884,4 @@ GameWorld::getCollisionComponents() const {
 
   return collisionMap;
 }
-// Add this function to GameWorld.cpp (anywhere in the file, perhaps after the
-// constructor)
-
-// Add this function to GameWorld.cpp (anywhere in the file, perhaps after the
-// constructor)
-
-void GameWorld::debugCollisionAndPlayer() {
-  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-              "\n=== COMPREHENSIVE COLLISION & PLAYER DEBUG ===");
-
-  // 1. Find the player entity
-  ecs::Entity playerEntity;
-  bool foundPlayer = false;
-
-  // Check ALL entities by collecting from all systems
-  std::unordered_set<ecs::Entity> allEntities;
-  auto &sm = ecs::SystemManager::getInstance();
-  for (const auto &system : sm.getSystems()) {
-    for (const ecs::Entity &entity : system->getEntities()) {
-      allEntities.insert(entity);
-    }
-  }
-
-  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-              "Total unique entities in game: %zu", allEntities.size());
-
-  // Find player
-  for (const ecs::Entity &entity : allEntities) {
-    if (componentManager.getComponent<ecs::components::Player>(entity)) {
-      playerEntity = entity;
-      foundPlayer = true;
-
-      // Log player details
-      bool hasTransform =
-          componentManager.getComponent<ecs::components::Transform>(entity) !=
-          nullptr;
-      bool hasSprite = componentManager.getComponent<ecs::components::Sprite>(
-                           entity) != nullptr;
-      bool hasCollision =
-          componentManager.getComponent<ecs::components::Collision>(entity) !=
-          nullptr;
-      bool hasCollisionResult =
-          componentManager.getComponent<ecs::components::CollisionResult>(
-              entity) != nullptr;
-
-      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "PLAYER FOUND: Entity %llu",
-                  entity.getId());
-      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                  "  Components: Transform=%d, Sprite=%d, Collision=%d, "
-                  "CollisionResult=%d",
-                  hasTransform, hasSprite, hasCollision, hasCollisionResult);
-
-      if (hasCollisionResult) {
-        auto *cr =
-            componentManager.getComponent<ecs::components::CollisionResult>(
-                entity);
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "  Player has %zu collisions",
-                    cr->getCollisions().size());
-
-        for (const auto &collision : cr->getCollisions()) {
-          if (collision.otherEntity.has_value()) {
-            ecs::Entity other = collision.otherEntity.value();
-            bool otherIsTarget =
-                componentManager.getComponent<ecs::components::Target>(other) !=
-                nullptr;
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                        "    - Collision with entity %llu (Target=%d)",
-                        other.getId(), otherIsTarget);
-          }
-        }
-      }
-
-      // Check if player is in CollisionSystem
-      auto *collisionSystem = sm.getSystem<ecs::systems::CollisionSystem>();
-      if (collisionSystem) {
-        bool inSystem = false;
-        for (const auto &e : collisionSystem->getEntities()) {
-          if (e.getId() == entity.getId()) {
-            inSystem = true;
-            break;
-          }
-        }
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-                    "  Player in CollisionSystem: %s", inSystem ? "YES" : "NO");
-      }
-    }
-  }
-
-  if (!foundPlayer) {
-    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                 "NO PLAYER ENTITY FOUND IN GAME!");
-  }
-
-  // 2. List all entities with CollisionResult and their collisions
-  SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
-              "\nEntities with CollisionResult components:");
-
-  for (const ecs::Entity &entity : allEntities) {
-    auto *cr =
-        componentManager.getComponent<ecs::components::CollisionResult>(entity);
-    if (cr && !cr->getCollisions().empty()) {
-      bool isPlayer = componentManager.getComponent<ecs::components::Player>(
-                          entity) != nullptr;
-      bool isTarget = componentManager.getComponent<ecs::components::Target>(
-                          entity) != nullptr;
-      bool isProjectile =
-          componentManager.getComponent<ecs::components::Projectile>(entity) !=
-          nullptr;
-
-      SDL_LogWarn(
-          SDL_LOG_CATEGORY_APPLICATION,
-          "Entity %llu: Player=%d, Target=%d, Projectile=%d, Collisions=%zu",
-          entity.getId(), isPlayer, isTarget, isProjectile,
-          cr->getCollisions().size());
-    }
-  }
-
-  // 3. Check GameStateSystem
-  auto *gameStateSystem = sm.getSystem<ecs::systems::GameStateSystem>();
-  if (gameStateSystem) {
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "\nGameStateSystem:");
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "  Entities in system: %zu",
-                gameStateSystem->getEntities().size());
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "  Game state: %s",
-                gameStateSystem->isGameOver() ? "GAME_OVER" : "RUNNING");
-  }
-
-  SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "=== END DEBUG ===\n");
-}
 } // namespace game
\ No newline at end of file
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "Timer.hpp"
+#include "WorldStreamer.hpp"
 #include "ecs/ComponentManager.hpp"
 #include "ecs/Entity.hpp"
+#include "ecs/ParticleEmitter.hpp"
 #include "ecs/SystemManager.hpp"
+#include "ecs/WorldLocal.hpp"
+#include "ecs/components/Camera.hpp"
 #include "ecs/components/Collision.hpp"
+#include "ecs/components/Hierarchy.hpp"
 #include "ecs/components/Images.hpp"
 #include "ecs/components/Input.hpp"
 #include "ecs/components/Movement.hpp"
@@ -12,6 +17,8 @@
 #include "ecs/components/ShootingGalleryState.hpp"
 #include "ecs/components/Sprite.hpp"
 #include "ecs/components/Transform.hpp"
+#include "ecs/systems/BotControlSystem.hpp"
+#include "ecs/systems/CameraSystem.hpp"
 #include "ecs/systems/CollisionSystem.hpp"
 #include "ecs/systems/DuckMovementSystem.hpp"
 #include "ecs/systems/EventSystem.hpp"
@@ -22,6 +29,7 @@
 #include "ecs/systems/ProjectileSystem.hpp"
 #include "ecs/systems/RenderSystem.hpp"
 #include "ecs/systems/TargetSpawnSystem.hpp"
+#include "ecs/systems/TransformHierarchySystem.hpp"
 #include "ecs/systems/UIEventSystem.hpp"
 #include "events/EventManager.hpp"
 #include <SDL3/SDL.h>
@@ -39,28 +47,50 @@ namespace game {
 class GameWorld {
 public:
   static GameWorld &getInstance() {
+    if (GameWorld *local = ecs::WorldLocal<GameWorld>::get()) {
+      return *local;
+    }
     static GameWorld instance;
     return instance;
   }
 
+  ~GameWorld();
+
   // Delete copy constructor and assignment operator
   GameWorld(const GameWorld &) = delete;
   GameWorld &operator=(const GameWorld &) = delete;
 
   void setAssetsDirectory(const std::string &directory);
+  // High score file for ShootingGalleryState (empty = kept in memory only);
+  // takes effect on initialize()
+  void setHighScoreFile(const std::string &path) { highScoreFile = path; }
   void setRenderer(SDL_Renderer *renderer);
   SDL_Renderer *getRenderer() const {
     SDL_Log("[GameWorld] Getting renderer: %p", renderer);
     return renderer;
   }
   bool initialize();
-  void update(float deltaTime);
+  // Same, from GameData.json already parsed with readGameData() (GameEngine
+  // parses it on a worker thread while SDL starts)
+  bool initialize(const nlohmann::json &gameData);
+  // Advance the simulation by deltaTime; with draw = false RenderSystem is
+  // skipped (intermediate steps of a fast-forwarded frame)
+  void update(float deltaTime, bool draw = true);
+  // Draw the current state without simulating (paused or slowed down)
   void render();
+  // Where the next draw falls between the last two simulated steps
+  // (0 = previous, 1 = latest); RenderSystem interpolates positions by it
+  void setRenderAlpha(float alpha);
   void clear();
   size_t getEntityCount() const;
   const std::vector<ecs::Entity> &getEntities() const;
   ecs::Entity getEntityById(const std::string &id) const;
   void loadFromJson(const std::string &filePath);
+  // Read and parse a game data file; throws std::runtime_error if missing
+  static nlohmann::json readGameData(const std::string &filePath);
+  // Every image named by the entities and templates in game data
+  static std::vector<std::string>
+  collectImageNames(const nlohmann::json &gameData);
 
   // Debug methods
   std::unordered_map<std::string, ecs::components::Collision *>
@@ -69,17 +99,38 @@ public:
   // World dimension getters
   int getWorldWidth() const { return worldWidth; }
   int getWorldHeight() const { return worldHeight; }
-  // Debug method
-  void debugCollisionAndPlayer();
+  // Size of the camera view (the window); defaults to the world size
+  int getViewWidth() const { return viewWidth; }
+  int getViewHeight() const { return viewHeight; }
+  const WorldStreamer &getWorldStreamer() const { return worldStreamer; }
+  // Hit sparks, drawn on top of the entities
+  ecs::ParticleEmitter &getParticles() { return particles; }
+  // Game clock the systems read (advanced by update())
+  Timer &getGameTimer() { return *gameTimer; }
+  // Log a WorldDiagnostics report (archetypes, orphans, system membership)
+  // at the end of the next update
+  void requestDiagnosticsReport();
+  // Let BotControlSystem play for every player entity (soak and load tests);
+  // config uses the keys of the "bot" JSON component. Returns false if the
+  // world has no player.
+  bool enableBot(const nlohmann::json &config = nlohmann::json::object());
+  // Detach every Bot and release the keys it held
+  void disableBot();
 
 private:
-  GameWorld();  // Constructor declared here, defined in cpp
-  ~GameWorld(); // Destructor declared here, defined in cpp
+  GameWorld(); // Constructor declared here, defined in cpp
+  friend class ecs::WorldLocal<GameWorld>;
 
   std::string assetsDir;
   int worldWidth;
   int worldHeight;
+  int viewWidth;
+  int viewHeight;
+  std::string scenePath; // Streamed scene file, relative to assetsDir
+  std::string highScoreFile =
+      ecs::components::ShootingGalleryState::DEFAULT_HIGH_SCORE_FILE;
   SDL_Renderer *renderer;
+  bool diagnosticsRequested = false;
   std::unique_ptr<Timer>
       gameTimer; // Timer instance for hardware-independent timing
   std::vector<ecs::Entity> entities;           // Maintains insertion order
@@ -89,11 +140,14 @@ private:
 
   // Core systems
   ecs::systems::UIEventSystem *uiEventSystem;
+  ecs::systems::BotControlSystem *botControlSystem;
   ecs::systems::MovementSystem *movementSystem;
   ecs::systems::RenderSystem *renderSystem;
   ecs::systems::EventSystem *eventSystem;
   ecs::systems::CollisionSystem *collisionSystem;
   ecs::systems::PlayerControlSystem *playerControlSystem;
+  ecs::systems::CameraSystem *cameraSystem;
+  ecs::systems::TransformHierarchySystem *transformHierarchySystem;
 
   // Game-specific systems
   ecs::systems::TargetSpawnSystem *targetSpawnSystem;
@@ -102,9 +156,23 @@ private:
   ecs::systems::GameStateSystem *gameStateSystem;
   ecs::systems::ExpiredEntitiesSystem *expiredEntitiesSystem;
 
+  // Streams scene cells around the camera
+  WorldStreamer worldStreamer;
+
+  // Cosmetic particles (hit sparks)
+  ecs::ParticleEmitter particles;
+
   void logSystemStates();
+  void readWorldSettings(const nlohmann::json &json);
+  void loadGameData(const nlohmann::json &json);
+  void loadAudio(const nlohmann::json &audio);
+  void createCamera();
 
   void createEntityFromJson(const nlohmann::json &data);
+  void addBot(const ecs::Entity &entity, const nlohmann::json &config);
+  void createTweenFromJson(const ecs::Entity &entity,
+                           const std::string &entityId,
+                           const nlohmann::json &data);
 };
 
 } // namespace game
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "QualityGovernor.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+
+namespace game {
+
+namespace {
+
+// Quality levels from best to cheapest
+const QualitySettings LEVELS[] = {
+    {0, "high", 0.0f, true, 2, true, 1024},
+    {1, "medium", 0.1f, true, 3, true, 256},
+    {2, "low", 0.25f, false, 4, false, 64},
+    {3, "minimum", 0.5f, false, 6, false, 0},
+};
+constexpr int LEVEL_COUNT = static_cast<int>(sizeof(LEVELS) / sizeof(LEVELS[0]));
+
+} // namespace
+
+QualityGovernor::QualityGovernor(const Timer *timer)
+    : timer_(timer), settings_(LEVELS[0]), enabled_(true), paused_(false),
+      framesInWindow_(0), settleFrames_(SETTLE_FRAMES), overBudgetWindows_(0),
+      underBudgetWindows_(0) {}
+
+int QualityGovernor::getLevelCount() { return LEVEL_COUNT; }
+
+void QualityGovernor::addListener(Listener listener) {
+  listener(settings_);
+  listeners_.push_back(std::move(listener));
+}
+
+void QualityGovernor::update() {
+  if (!enabled_ || paused_ || !timer_) {
+    return;
+  }
+  if (settleFrames_ > 0) {
+    settleFrames_--;
+    return;
+  }
+  if (++framesInWindow_ < EVALUATION_FRAMES) {
+    return;
+  }
+  framesInWindow_ = 0;
+
+  double budget = timer_->getTargetFrameTime();
+  double p95 = timer_->getWorkTimePercentile(PERCENTILE);
+
+  if (p95 > budget * DEGRADE_RATIO) {
+    underBudgetWindows_ = 0;
+    if (++overBudgetWindows_ >= DEGRADE_WINDOWS &&
+        settings_.level + 1 < LEVEL_COUNT) {
+      applyLevel(settings_.level + 1, "over budget", p95 * 1000.0);
+    }
+  } else if (p95 < budget * RESTORE_RATIO) {
+    overBudgetWindows_ = 0;
+    if (++underBudgetWindows_ >= RESTORE_WINDOWS && settings_.level > 0) {
+      applyLevel(settings_.level - 1, "headroom", p95 * 1000.0);
+    }
+  } else {
+    // Inside the hysteresis band: hold the current level
+    overBudgetWindows_ = 0;
+    underBudgetWindows_ = 0;
+  }
+}
+
+void QualityGovernor::setPaused(bool paused) {
+  if (paused == paused_) {
+    return;
+  }
+  paused_ = paused;
+  // Frames from before the switch must not count toward either direction
+  overBudgetWindows_ = 0;
+  underBudgetWindows_ = 0;
+  framesInWindow_ = 0;
+  settleFrames_ = SETTLE_FRAMES;
+}
+
+void QualityGovernor::setLevel(int level) {
+  level = std::max(0, std::min(LEVEL_COUNT - 1, level));
+  if (level != settings_.level) {
+    double p95Ms = timer_ ? timer_->getWorkTimePercentile(PERCENTILE) * 1000.0 : 0.0;
+    applyLevel(level, "requested", p95Ms);
+  }
+}
+
+void QualityGovernor::applyLevel(int level, const char *reason,
+                                 double p95Ms) {
+  const char *previous = settings_.name;
+  settings_ = LEVELS[level];
+  overBudgetWindows_ = 0;
+  underBudgetWindows_ = 0;
+  framesInWindow_ = 0;
+  settleFrames_ = SETTLE_FRAMES;
+
+  SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+              "[QualityGovernor] %s -> %s (%s: p95 work %.2f ms, budget "
+              "%.2f ms; HUD refresh %.2fs, smooth scaling %s, off-screen "
+              "every %d frames, interpolation %s, %d particles)",
+              previous, settings_.name, reason, p95Ms,
+              timer_ ? timer_->getTargetFrameTime() * 1000.0 : 0.0,
+              settings_.hudRefreshInterval,
+              settings_.smoothScaling ? "on" : "off",
+              settings_.offscreenInterval,
+              settings_.renderInterpolation ? "on" : "off",
+              settings_.maxParticles);
+
+  for (const auto &listener : listeners_) {
+    listener(settings_);
+  }
+}
+
+} // namespace game
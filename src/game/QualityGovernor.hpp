@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Timer.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace game {
+
+/**
+ * What each quality level turns on or off. Subsystems receive a copy
+ * through QualityGovernor::addListener() whenever the level changes.
+ */
+struct QualitySettings {
+    int level = 0;                     // 0 = full quality
+    const char* name = "high";
+    float hudRefreshInterval = 0.0f;   // Seconds between HUD text updates (0 = every frame)
+    bool smoothScaling = true;         // Linear texture filtering for sprites
+    int offscreenInterval = 2;         // Frames per update for far entities (SimulationLod)
+    bool renderInterpolation = true;   // Draw between simulation steps (RenderSystem)
+    int maxParticles = 1024;           // Live hit sparks (ParticleEmitter)
+};
+
+/**
+ * Adaptive quality governor.
+ *
+ * Watches the Timer's work-time percentiles (time spent in a frame before
+ * the frame-limit sleep) against the frame budget. It steps quality down
+ * when the budget is exceeded and back up when there is headroom again.
+ *
+ * Hysteresis keeps it from oscillating:
+ * - Decisions are made once per evaluation window (EVALUATION_FRAMES).
+ * - Degrading needs DEGRADE_WINDOWS consecutive windows with p95 above
+ *   DEGRADE_RATIO of the budget.
+ * - Restoring needs RESTORE_WINDOWS consecutive windows with p95 below
+ *   RESTORE_RATIO of the budget, a wider and slower band.
+ * - After every change the governor waits for the Timer's frame history to
+ *   refill before it judges the new level.
+ *
+ * Every decision is logged with the percentile that triggered it.
+ */
+class QualityGovernor {
+public:
+    using Listener = std::function<void(const QualitySettings&)>;
+
+    static constexpr int EVALUATION_FRAMES = 30;
+    static constexpr int SETTLE_FRAMES = 60;   // Timer history length
+    static constexpr int DEGRADE_WINDOWS = 2;
+    static constexpr int RESTORE_WINDOWS = 4;
+    static constexpr double DEGRADE_RATIO = 0.90;
+    static constexpr double RESTORE_RATIO = 0.55;
+    static constexpr double PERCENTILE = 0.95;
+
+    /**
+     * @param timer Frame timer whose history drives the decisions
+     */
+    explicit QualityGovernor(const Timer* timer);
+
+    /**
+     * Register a callback that applies quality settings. It is called once
+     * immediately with the current settings and again on every level change.
+     * @param listener Callback receiving the new settings
+     */
+    void addListener(Listener listener);
+
+    /**
+     * Account for one finished frame; call after Timer::waitForFrameEnd().
+     */
+    void update();
+
+    /**
+     * Force a quality level (clamped), e.g. from a command-line option.
+     * @param level Level index, 0 = highest quality
+     */
+    void setLevel(int level);
+
+    /**
+     * Enable or disable automatic level changes (setLevel still works).
+     * @param enabled Whether the governor may change levels on its own
+     */
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+    bool isEnabled() const { return enabled_; }
+
+    /**
+     * Hold the current level while frames are saturated on purpose (the
+     * engine's uncapped time scale fills every frame's budget). Resuming
+     * waits for the Timer's history to refill before judging again.
+     * @param paused Whether to ignore frames until resumed
+     */
+    void setPaused(bool paused);
+    bool isPaused() const { return paused_; }
+
+    const QualitySettings& getSettings() const { return settings_; }
+    static int getLevelCount();
+
+private:
+    void applyLevel(int level, const char* reason, double p95Ms);
+
+    const Timer* timer_;
+    QualitySettings settings_;
+    std::vector<Listener> listeners_;
+    bool enabled_;
+    bool paused_;
+    int framesInWindow_;
+    int settleFrames_;
+    int overBudgetWindows_;
+    int underBudgetWindows_;
+};
+
+} // namespace game
@@ -0,0 +1,412 @@
+#include "RoomHost.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace game {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Weight of the newest tick in a room's smoothed tick time
+constexpr double LOAD_SMOOTHING = 0.1;
+
+/**
+ * Pin the calling thread to one core.
+ * @return false where the OS has no hard affinity (macOS) or refused
+ */
+bool pinCurrentThread(int core) {
+#if defined(_WIN32)
+  return SetThreadAffinityMask(GetCurrentThread(),
+                               static_cast<DWORD_PTR>(1) << core) != 0;
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)core;
+  return false;
+#endif
+}
+
+double millisecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+RoomHost::RoomHost(const Config &config)
+    : config_(config),
+      deltaTime_(config.tickRateHz > 0.0
+                     ? static_cast<float>(1.0 / config.tickRateHz)
+                     : 1.0f / 60.0f) {
+  size_t count = config_.shardCount;
+  if (count == 0) {
+    count = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (size_t i = 0; i < count; ++i) {
+    shards_.push_back(std::make_unique<Shard>());
+    shards_.back()->stats.index = i;
+  }
+}
+
+RoomHost::~RoomHost() {
+  stop();
+  // Worlds bind themselves while they tear down
+  for (auto &shard : shards_) {
+    shard->rooms.clear();
+  }
+}
+
+void RoomHost::start() {
+  if (running_.exchange(true)) {
+    return;
+  }
+  uint64_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(stepMutex_);
+    generation = stepGeneration_;
+  }
+  for (auto &shard : shards_) {
+    // Set before the thread exists, so a step() right after start() is not
+    // mistaken for one it has already run
+    shard->stepGeneration = generation;
+    Shard *target = shard.get();
+    shard->thread = std::thread([this, target] { runShard(*target); });
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[RoomHost] Started %zu shards (%s)", shards_.size(),
+              config_.tickRateHz > 0.0 ? "timed" : "stepped");
+}
+
+void RoomHost::stop() {
+  if (!running_.exchange(false)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(stepMutex_);
+    stepStarted_.notify_all();
+  }
+  for (auto &shard : shards_) {
+    if (shard->thread.joinable()) {
+      shard->thread.join();
+    }
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Stopped");
+}
+
+RoomHost::RoomId RoomHost::createRoom(const std::string &assetsDir,
+                                      double budgetMs, TickCallback onTick) {
+  // Loading is slow; keep it outside every lock
+  auto room = std::make_unique<Room>();
+  room->world = std::make_unique<WorldInstance>();
+  if (!room->world->initialize(assetsDir)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[RoomHost] Failed to load a room from %s", assetsDir.c_str());
+    return 0;
+  }
+  room->onTick = std::move(onTick);
+  room->stats.budgetMs = budgetMs > 0.0 ? budgetMs : config_.roomBudgetMs;
+
+  std::lock_guard<std::mutex> hostLock(hostMutex_);
+  room->stats.id = nextRoomId_++;
+
+  // Rooms that have not ticked yet are counted at the typical room's cost
+  double totalLoad = 0.0;
+  size_t tickedRooms = 0;
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    for (const auto &existing : shard->rooms) {
+      if (existing->stats.ticks > 0) {
+        totalLoad += existing->stats.meanTickMs;
+        ++tickedRooms;
+      }
+    }
+  }
+  const double typicalLoad = tickedRooms > 0 ? totalLoad / tickedRooms : 0.0;
+
+  Shard *best = nullptr;
+  double bestLoad = 0.0;
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    double load = 0.0;
+    for (const auto &existing : shard->rooms) {
+      load += existing->stats.ticks > 0 ? existing->stats.meanTickMs
+                                        : typicalLoad;
+    }
+    if (!best || load < bestLoad ||
+        (load == bestLoad && shard->rooms.size() < best->rooms.size())) {
+      best = shard.get();
+      bestLoad = load;
+    }
+  }
+
+  const RoomId id = room->stats.id;
+  std::lock_guard<std::mutex> lock(best->mutex);
+  room->stats.shard = best->stats.index;
+  best->rooms.push_back(std::move(room));
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[RoomHost] Room %u created on shard %zu", id, best->stats.index);
+  return id;
+}
+
+bool RoomHost::destroyRoom(RoomId id) {
+  std::unique_ptr<Room> removed;
+  {
+    std::lock_guard<std::mutex> hostLock(hostMutex_);
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      auto it = std::find_if(
+          shard->rooms.begin(), shard->rooms.end(),
+          [id](const std::unique_ptr<Room> &room) { return room->stats.id == id; });
+      if (it != shard->rooms.end()) {
+        removed = std::move(*it);
+        shard->rooms.erase(it);
+        break;
+      }
+    }
+  }
+  if (!removed) {
+    return false;
+  }
+  removed.reset();
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Room %u destroyed", id);
+  return true;
+}
+
+bool RoomHost::withRoom(RoomId id,
+                        const std::function<void(WorldInstance &)> &fn) {
+  std::lock_guard<std::mutex> hostLock(hostMutex_);
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    for (auto &room : shard->rooms) {
+      if (room->stats.id == id) {
+        WorldInstance::Scope scope(*room->world);
+        fn(*room->world);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void RoomHost::step() {
+  if (!running_.load()) {
+    for (auto &shard : shards_) {
+      tickShard(*shard);
+    }
+    return;
+  }
+  std::unique_lock<std::mutex> lock(stepMutex_);
+  shardsDone_ = 0;
+  ++stepGeneration_;
+  stepStarted_.notify_all();
+  stepFinished_.wait(lock, [this] {
+    return shardsDone_ == shards_.size() || !running_.load();
+  });
+}
+
+void RoomHost::runShard(Shard &shard) {
+  if (config_.pinThreads) {
+    const int cores =
+        static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int core = static_cast<int>(shard.stats.index) % cores;
+    if (pinCurrentThread(core)) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.stats.core = core;
+    } else {
+      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                  "[RoomHost] Could not pin shard %zu to core %d",
+                  shard.stats.index, core);
+    }
+  }
+
+  const bool timed = config_.tickRateHz > 0.0;
+  const auto period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(timed ? 1.0 / config_.tickRateHz : 0.0));
+  auto nextTick = Clock::now();
+
+  while (running_.load()) {
+    if (!timed) {
+      std::unique_lock<std::mutex> lock(stepMutex_);
+      stepStarted_.wait(lock, [&] {
+        return !running_.load() || stepGeneration_ != shard.stepGeneration;
+      });
+      if (!running_.load()) {
+        break;
+      }
+      shard.stepGeneration = stepGeneration_;
+    }
+
+    tickShard(shard);
+
+    if (!timed) {
+      std::lock_guard<std::mutex> lock(stepMutex_);
+      if (++shardsDone_ == shards_.size()) {
+        stepFinished_.notify_all();
+      }
+      continue;
+    }
+    nextTick += period;
+    const auto now = Clock::now();
+    if (nextTick > now) {
+      std::this_thread::sleep_until(nextTick);
+    } else if (now - nextTick > period * 10) {
+      nextTick = now; // Far behind: do not spiral
+    }
+  }
+}
+
+void RoomHost::tickShard(Shard &shard) {
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto passStart = Clock::now();
+  for (auto &room : shard.rooms) {
+    const auto start = Clock::now();
+    room->world->update(deltaTime_);
+    if (room->onTick) {
+      WorldInstance::Scope scope(*room->world);
+      room->onTick(room->stats.id, *room->world);
+    }
+    const double elapsedMs = millisecondsSince(start);
+
+    RoomStats &stats = room->stats;
+    stats.meanTickMs =
+        stats.ticks == 0
+            ? elapsedMs
+            : stats.meanTickMs + (elapsedMs - stats.meanTickMs) * LOAD_SMOOTHING;
+    stats.ticks++;
+    stats.lastTickMs = elapsedMs;
+    stats.worstTickMs = std::max(stats.worstTickMs, elapsedMs);
+    if (elapsedMs > stats.budgetMs) {
+      stats.overruns++;
+    }
+  }
+  shard.stats.lastPassMs = millisecondsSince(passStart);
+  shard.stats.passes++;
+  if (config_.tickRateHz > 0.0 &&
+      shard.stats.lastPassMs > 1000.0 / config_.tickRateHz) {
+    shard.stats.latePasses++;
+  }
+}
+
+double RoomHost::loadOf(const Shard &shard) {
+  double load = 0.0;
+  for (const auto &room : shard.rooms) {
+    load += room->stats.meanTickMs;
+  }
+  return load;
+}
+
+size_t RoomHost::rebalance() {
+  std::lock_guard<std::mutex> hostLock(hostMutex_);
+  // Always in index order, so this cannot deadlock with itself
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(shards_.size());
+  for (auto &shard : shards_) {
+    locks.emplace_back(shard->mutex);
+  }
+
+  std::vector<double> loads;
+  double total = 0.0;
+  for (const auto &shard : shards_) {
+    loads.push_back(loadOf(*shard));
+    total += loads.back();
+  }
+  const double mean = total / static_cast<double>(shards_.size());
+
+  size_t moved = 0;
+  while (moved < config_.maxMovesPerRebalance && mean > 0.0) {
+    const size_t busiest = static_cast<size_t>(
+        std::max_element(loads.begin(), loads.end()) - loads.begin());
+    const size_t idlest = static_cast<size_t>(
+        std::min_element(loads.begin(), loads.end()) - loads.begin());
+    const double gap = loads[busiest] - loads[idlest];
+    if (gap <= config_.rebalanceThreshold * mean) {
+      break;
+    }
+
+    // The room whose move leaves the pair closest to even; it must shrink
+    // the gap, or the rooms would just swap places next time
+    auto &from = shards_[busiest]->rooms;
+    auto best = from.end();
+    double bestResidual = gap;
+    for (auto it = from.begin(); it != from.end(); ++it) {
+      const double residual = std::abs(gap - 2.0 * (*it)->stats.meanTickMs);
+      if (residual < bestResidual) {
+        best = it;
+        bestResidual = residual;
+      }
+    }
+    if (best == from.end()) {
+      break;
+    }
+
+    const double roomLoad = (*best)->stats.meanTickMs;
+    (*best)->stats.shard = idlest;
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[RoomHost] Room %u moved from shard %zu (%.2f ms) to %zu "
+                "(%.2f ms)",
+                (*best)->stats.id, busiest, loads[busiest], idlest,
+                loads[idlest]);
+    shards_[idlest]->rooms.push_back(std::move(*best));
+    from.erase(best);
+    loads[busiest] -= roomLoad;
+    loads[idlest] += roomLoad;
+    ++moved;
+  }
+  migrations_ += moved;
+  return moved;
+}
+
+size_t RoomHost::getRoomCount() const {
+  size_t count = 0;
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    count += shard->rooms.size();
+  }
+  return count;
+}
+
+std::vector<RoomHost::RoomStats> RoomHost::getRoomStats() const {
+  std::vector<RoomStats> stats;
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    for (const auto &room : shard->rooms) {
+      stats.push_back(room->stats);
+    }
+  }
+  std::sort(stats.begin(), stats.end(),
+            [](const RoomStats &a, const RoomStats &b) { return a.id < b.id; });
+  return stats;
+}
+
+std::vector<RoomHost::ShardStats> RoomHost::getShardStats() const {
+  std::vector<ShardStats> stats;
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    ShardStats copy = shard->stats;
+    copy.rooms = shard->rooms.size();
+    copy.loadMs = loadOf(*shard);
+    stats.push_back(copy);
+  }
+  return stats;
+}
+
+} // namespace game
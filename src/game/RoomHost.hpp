@@ -0,0 +1,159 @@
+#pragma once
+
+#include "WorldInstance.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace game {
+
+/**
+ * RoomHost - runs many independent game rooms in one process.
+ *
+ * Each room is a WorldInstance. Rooms are spread over shard threads (one per
+ * hardware thread by default, pinned to its core where the OS allows), and
+ * a shard ticks its rooms one after another at the host's tick rate. Every
+ * room has a tick budget; ticks that take longer count as overruns.
+ * rebalance() moves rooms from the busiest shard to the least busy one while
+ * their loads (sum of smoothed room tick times) differ by more than
+ * rebalanceThreshold of the mean.
+ *
+ * With Config::tickRateHz = 0 the shards do not keep time: step() ticks
+ * every room once, all shards in parallel, and returns when they are done.
+ */
+class RoomHost {
+public:
+  using RoomId = uint32_t;
+
+  // Called on the shard thread after each room update, with the room bound
+  using TickCallback = std::function<void(RoomId, WorldInstance &)>;
+
+  struct Config {
+    size_t shardCount = 0;   // 0 = one per hardware thread
+    bool pinThreads = true;  // Pin shard i to core i % hardware threads
+    double tickRateHz = 60.0; // 0 = rooms only tick in step()
+    double roomBudgetMs = 2.0; // Default tick budget per room
+    double rebalanceThreshold = 0.25;
+    size_t maxMovesPerRebalance = 4;
+  };
+
+  struct RoomStats {
+    RoomId id = 0;
+    size_t shard = 0;
+    uint64_t ticks = 0;
+    uint64_t overruns = 0; // Ticks longer than budgetMs
+    double budgetMs = 0.0;
+    double lastTickMs = 0.0;
+    double meanTickMs = 0.0; // Smoothed; the load rebalance() balances
+    double worstTickMs = 0.0;
+  };
+
+  struct ShardStats {
+    size_t index = 0;
+    int core = -1; // Pinned core, or -1
+    size_t rooms = 0;
+    double loadMs = 0.0; // Sum of its rooms' meanTickMs
+    uint64_t passes = 0; // Times it ticked all its rooms
+    uint64_t latePasses = 0; // Passes longer than the tick period
+    double lastPassMs = 0.0;
+  };
+
+  explicit RoomHost(const Config &config);
+  RoomHost() : RoomHost(Config()) {}
+  ~RoomHost();
+
+  RoomHost(const RoomHost &) = delete;
+  RoomHost &operator=(const RoomHost &) = delete;
+
+  /**
+   * Start the shard threads.
+   */
+  void start();
+
+  /**
+   * Stop and join the shard threads; rooms are kept.
+   */
+  void stop();
+
+  bool isRunning() const { return running_.load(); }
+
+  /**
+   * Load a room from assetsDir/GameData.json (on the calling thread) and put
+   * it on the least loaded shard.
+   * @param budgetMs Tick budget, or 0 for Config::roomBudgetMs
+   * @param onTick Optional per-tick hook (e.g. a SnapshotServer)
+   * @return Room ID, or 0 if the world failed to load
+   */
+  RoomId createRoom(const std::string &assetsDir, double budgetMs = 0.0,
+                    TickCallback onTick = {});
+
+  bool destroyRoom(RoomId id);
+
+  /**
+   * Run fn with the room bound to the calling thread, between its ticks.
+   * @return false if there is no such room
+   */
+  bool withRoom(RoomId id, const std::function<void(WorldInstance &)> &fn);
+
+  /**
+   * Tick every room once, shards in parallel, and wait for them. Without
+   * running shard threads the rooms are ticked on the calling thread.
+   */
+  void step();
+
+  /**
+   * Move rooms between shards to even out their load.
+   * @return Number of rooms moved
+   */
+  size_t rebalance();
+
+  size_t getShardCount() const { return shards_.size(); }
+  size_t getRoomCount() const;
+  std::vector<RoomStats> getRoomStats() const;
+  std::vector<ShardStats> getShardStats() const;
+  uint64_t getMigrations() const { return migrations_.load(); }
+
+private:
+  struct Room {
+    std::unique_ptr<WorldInstance> world;
+    TickCallback onTick;
+    RoomStats stats;
+  };
+
+  struct Shard {
+    std::thread thread;
+    mutable std::mutex mutex; // Held while the shard ticks its rooms
+    std::vector<std::unique_ptr<Room>> rooms;
+    ShardStats stats;
+    uint64_t stepGeneration = 0; // Last step() it has run
+  };
+
+  void runShard(Shard &shard);
+  void tickShard(Shard &shard);
+  static double loadOf(const Shard &shard);
+
+  Config config_;
+  float deltaTime_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<bool> running_{false};
+  std::atomic<uint64_t> migrations_{0};
+
+  std::mutex hostMutex_; // Serializes room creation, removal and moves
+  RoomId nextRoomId_ = 1;
+
+  // step() handshake
+  std::mutex stepMutex_;
+  std::condition_variable stepStarted_;
+  std::condition_variable stepFinished_;
+  uint64_t stepGeneration_ = 0;
+  size_t shardsDone_ = 0;
+};
+
+} // namespace game
@@ -2,6 +2,18 @@
 #include <algorithm>
 #include <numeric>
 
+namespace {
+// Value at the given percentile of the first count entries of history
+template <size_t N>
+double historyPercentile(const std::array<double, N>& history, int count, double percentile) {
+    std::array<double, N> sorted = history;
+    int index = static_cast<int>(percentile * count + 0.5) - 1;
+    index = std::max(0, std::min(count - 1, index));
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + count);
+    return sorted[index];
+}
+} // namespace
+
 Timer::Timer(int targetFps)
     : creationTicks(SDL_GetTicks())  // Initialize creation time for getClock()
     , frameStartTicks(creationTicks)
@@ -13,9 +25,13 @@ Timer::Timer(int targetFps)
     , frameTimeIndex(0)
     , frameTimeCount(0)
     , lastFrameTime(0.0)
+    , frameStartNs(SDL_GetTicksNS())
+    , simulatedClock(0.0)
+    , clockAdvanced(false)
 {
     // Initialize frame times with target frame time
     frameTimes.fill(targetFrameTime);
+    workTimes.fill(0.0);
     
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
                "Timer initialized: target %d FPS (%.3fms per frame), using hardware-independent timing", 
@@ -24,6 +40,7 @@ Timer::Timer(int targetFps)
 
 void Timer::startFrame() {
     frameStartTicks = SDL_GetTicks();
+    frameStartNs = SDL_GetTicksNS();
     frames++;
 
     // Update FPS counter every second
@@ -40,6 +57,7 @@ void Timer::startFrame() {
 void Timer::waitForFrameEnd() {
     Uint32 currentTime = SDL_GetTicks();
     double elapsed = (currentTime - frameStartTicks) / 1000.0;
+    double workTime = (SDL_GetTicksNS() - frameStartNs) / 1.0e9;
     double remainingTime = targetFrameTime - elapsed - sleepError;
 
     if (remainingTime > 0) {
@@ -66,10 +84,15 @@ void Timer::waitForFrameEnd() {
     // Update frame time history and store last frame time
     lastFrameTime = (SDL_GetTicks() - frameStartTicks) / 1000.0;
     frameTimes[frameTimeIndex] = lastFrameTime;
+    workTimes[frameTimeIndex] = workTime;
     frameTimeIndex = (frameTimeIndex + 1) % MAX_FRAME_HISTORY;
     frameTimeCount = std::min(frameTimeCount + 1, MAX_FRAME_HISTORY);
 }
 
+double Timer::getCurrentFrameTime() const {
+    return (SDL_GetTicksNS() - frameStartNs) / 1.0e9;
+}
+
 double Timer::getElapsedTime() const {
     return lastFrameTime;
 }
@@ -87,10 +110,37 @@ double Timer::getAverageFrameTime() const {
     return sum / frameTimeCount;
 }
 
+double Timer::getFrameTimePercentile(double percentile) const {
+    if (frameTimeCount == 0) return targetFrameTime;
+    return historyPercentile(frameTimes, frameTimeCount, percentile);
+}
+
+double Timer::getWorkTimePercentile(double percentile) const {
+    if (frameTimeCount == 0) return 0.0;
+    return historyPercentile(workTimes, frameTimeCount, percentile);
+}
+
 double Timer::getClock() const {
+    if (clockAdvanced) {
+        return simulatedClock;
+    }
     return (SDL_GetTicks() - creationTicks) / 1000.0;
 }
 
+void Timer::advanceClock(double seconds) {
+    if (!clockAdvanced) {
+        // Continue from the wall time seen so far
+        simulatedClock = (SDL_GetTicks() - creationTicks) / 1000.0;
+        clockAdvanced = true;
+    }
+    simulatedClock += seconds;
+}
+
+void Timer::setClock(double seconds) {
+    simulatedClock = seconds;
+    clockAdvanced = true;
+}
+
 void Timer::setTargetFps(int fps) {
     targetFrameTime = 1.0 / fps;
 } 
\ No newline at end of file
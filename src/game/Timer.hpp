@@ -34,6 +34,14 @@ public:
      */
     void waitForFrameEnd();
 
+    /**
+     * Get the work time spent in the current frame so far, in seconds
+     * (time since startFrame()).
+     *
+     * @return Seconds since the current frame started
+     */
+    double getCurrentFrameTime() const;
+
     /**
      * Get the time elapsed since frame start in seconds.
      * 
@@ -55,6 +63,33 @@ public:
      */
     double getAverageFrameTime() const;
 
+    /**
+     * Get a percentile of the frame time over the last 60 frames.
+     * Frame time includes the sleep used for frame limiting, so it never
+     * drops below the target frame time.
+     * 
+     * @param percentile Fraction in [0, 1], e.g. 0.95
+     * @return Frame time at that percentile in seconds
+     */
+    double getFrameTimePercentile(double percentile) const;
+
+    /**
+     * Get a percentile of the work time (frame time before the frame-limit
+     * sleep) over the last 60 frames. Unlike frame time this shows how much
+     * headroom is left inside the frame budget.
+     * 
+     * @param percentile Fraction in [0, 1], e.g. 0.95
+     * @return Work time at that percentile in seconds
+     */
+    double getWorkTimePercentile(double percentile) const;
+
+    /**
+     * Get the target time per frame.
+     * 
+     * @return Target frame time in seconds
+     */
+    double getTargetFrameTime() const { return targetFrameTime; }
+
     /**
      * Set the target frame rate.
      * 
@@ -80,6 +115,26 @@ public:
      */
     double getClock() const;
 
+    /**
+     * Advance the game clock by simulated time.
+     *
+     * The first call switches getClock() from wall time to the sum of all
+     * advanced time, so cooldowns and spawn intervals follow the simulation
+     * when it is paused, slowed down or fast-forwarded (and stay
+     * deterministic in headless runs).
+     *
+     * @param seconds Simulated time of the step just taken
+     */
+    void advanceClock(double seconds);
+
+    /**
+     * Set the simulated clock, e.g. when a replay keyframe is restored.
+     * Switches getClock() to simulated time like advanceClock().
+     *
+     * @param seconds New value of getClock()
+     */
+    void setClock(double seconds);
+
 private:
     static constexpr int MAX_FRAME_HISTORY = 60;  // Keep last 60 frames for smoothing
     static constexpr double FPS_UPDATE_INTERVAL = 1.0;  // Update FPS every second
@@ -92,9 +147,13 @@ private:
     Uint32 lastFpsUpdate;         // Last time FPS was updated
     double sleepError;            // Track sleep inaccuracy
     double lastFrameTime;         // Actual elapsed time of the last frame
+    Uint64 frameStartNs;          // Frame start time in nanoseconds (work time)
+    double simulatedClock;        // Time advanced through advanceClock()
+    bool clockAdvanced;           // getClock() returns simulatedClock
 
     // Circular buffer for frame times
     std::array<double, MAX_FRAME_HISTORY> frameTimes;
+    std::array<double, MAX_FRAME_HISTORY> workTimes;   // Parallel to frameTimes
     int frameTimeIndex;           // Current position in circular buffer
     int frameTimeCount;           // Number of valid entries in buffer
 }; 
\ No newline at end of file
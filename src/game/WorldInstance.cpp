@@ -0,0 +1,81 @@
+#include "WorldInstance.hpp"
+
+namespace game {
+
+WorldInstance::Scope::Scope(WorldInstance &world) : previous_(current()) {
+  bind(&world);
+}
+
+WorldInstance::Scope::~Scope() { bind(previous_); }
+
+WorldInstance::WorldInstance()
+    : eventManager_(ecs::WorldLocal<events::EventManager>::create()),
+      componentManager_(ecs::WorldLocal<ecs::ComponentManager>::create()),
+      systemManager_(ecs::WorldLocal<ecs::SystemManager>::create()),
+      randomService_(ecs::WorldLocal<ecs::RandomService>::create()),
+      spatialQuery_(ecs::WorldLocal<ecs::SpatialQuery>::create()),
+      tweener_(ecs::WorldLocal<ecs::Tweener>::create()),
+      simulationLod_(ecs::WorldLocal<ecs::SimulationLod>::create()),
+      journal_(ecs::WorldLocal<diagnostics::GameplayJournal>::create()) {
+  // GameWorld grabs its managers on construction, so make it in scope
+  Scope scope(*this);
+  gameWorld_ = ecs::WorldLocal<GameWorld>::create();
+  ecs::WorldLocal<GameWorld>::set(gameWorld_.get());
+}
+
+WorldInstance::~WorldInstance() {
+  // Systems unsubscribe and release components as they go, so tear down in
+  // scope and before the managers they use
+  Scope scope(*this);
+  gameWorld_.reset();
+  systemManager_.reset();
+  gameState_.instance.reset();
+  tweener_.reset();
+  simulationLod_.reset();
+  journal_.reset();
+  spatialQuery_.reset();
+  randomService_.reset();
+  componentManager_.reset();
+  eventManager_.reset();
+}
+
+bool WorldInstance::initialize(const std::string &assetsDir) {
+  Scope scope(*this);
+  gameWorld_->setAssetsDirectory(assetsDir);
+  // Many worlds share one working directory
+  gameWorld_->setHighScoreFile("");
+  return gameWorld_->initialize();
+}
+
+void WorldInstance::update(float deltaTime) {
+  Scope scope(*this);
+  gameWorld_->update(deltaTime, false);
+}
+
+WorldInstance *WorldInstance::current() {
+  return ecs::WorldLocal<WorldInstance>::get();
+}
+
+void WorldInstance::bind(WorldInstance *world) {
+  ecs::WorldLocal<WorldInstance>::set(world);
+  ecs::WorldLocal<events::EventManager>::set(
+      world ? world->eventManager_.get() : nullptr);
+  ecs::WorldLocal<ecs::ComponentManager>::set(
+      world ? world->componentManager_.get() : nullptr);
+  ecs::WorldLocal<ecs::SystemManager>::set(
+      world ? world->systemManager_.get() : nullptr);
+  ecs::WorldLocal<ecs::RandomService>::set(
+      world ? world->randomService_.get() : nullptr);
+  ecs::WorldLocal<ecs::SpatialQuery>::set(
+      world ? world->spatialQuery_.get() : nullptr);
+  ecs::WorldLocal<ecs::Tweener>::set(world ? world->tweener_.get() : nullptr);
+  ecs::WorldLocal<ecs::SimulationLod>::set(
+      world ? world->simulationLod_.get() : nullptr);
+  ecs::WorldLocal<diagnostics::GameplayJournal>::set(
+      world ? world->journal_.get() : nullptr);
+  ecs::WorldLocal<ecs::components::ShootingGalleryState::Holder>::set(
+      world ? &world->gameState_ : nullptr);
+  ecs::WorldLocal<GameWorld>::set(world ? world->gameWorld_.get() : nullptr);
+}
+
+} // namespace game
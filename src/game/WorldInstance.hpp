@@ -0,0 +1,90 @@
+#pragma once
+
+#include "GameWorld.hpp"
+#include "diagnostics/GameplayJournal.hpp"
+#include "ecs/ComponentManager.hpp"
+#include "ecs/Random.hpp"
+#include "ecs/SimulationLod.hpp"
+#include "ecs/SpatialQuery.hpp"
+#include "ecs/SystemManager.hpp"
+#include "ecs/Tweener.hpp"
+#include "ecs/components/ShootingGalleryState.hpp"
+#include "events/EventManager.hpp"
+#include <memory>
+
+namespace game {
+
+/**
+ * WorldInstance - a complete, independent game world.
+ *
+ * Owns its own GameWorld and every world service it reaches through
+ * getInstance(): ComponentManager, SystemManager, EventManager,
+ * ShootingGalleryState, RandomService, SpatialQuery, Tweener, SimulationLod
+ * and GameplayJournal (closed unless opened). While a Scope is alive on a
+ * thread, getInstance() on that thread returns this world's services, so
+ * unmodified systems run against it. Worlds bound on different threads can
+ * tick at the same time.
+ *
+ * AudioMixer and ResourceManager stay process-wide. Instances do not
+ * persist a high score.
+ */
+class WorldInstance {
+public:
+  /**
+   * Bind a world to the calling thread until the scope ends; restores the
+   * previous binding, so scopes nest.
+   */
+  class Scope {
+  public:
+    explicit Scope(WorldInstance &world);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    WorldInstance *previous_;
+  };
+
+  WorldInstance();
+  ~WorldInstance();
+
+  WorldInstance(const WorldInstance &) = delete;
+  WorldInstance &operator=(const WorldInstance &) = delete;
+
+  /**
+   * Load the world from assetsDir/GameData.json.
+   * @return false if GameWorld failed to initialize
+   */
+  bool initialize(const std::string &assetsDir);
+
+  /**
+   * Advance the world by one step without drawing (binds it for the call).
+   */
+  void update(float deltaTime);
+
+  GameWorld &getGameWorld() { return *gameWorld_; }
+
+  /**
+   * @return World bound to the calling thread, or null if the process-wide
+   *         services are in use
+   */
+  static WorldInstance *current();
+
+private:
+  // Point every WorldLocal at this world's services (or clear them)
+  static void bind(WorldInstance *world);
+
+  std::unique_ptr<events::EventManager> eventManager_;
+  std::unique_ptr<ecs::ComponentManager> componentManager_;
+  std::unique_ptr<ecs::SystemManager> systemManager_;
+  std::unique_ptr<ecs::RandomService> randomService_;
+  std::unique_ptr<ecs::SpatialQuery> spatialQuery_;
+  std::unique_ptr<ecs::Tweener> tweener_;
+  std::unique_ptr<ecs::SimulationLod> simulationLod_;
+  std::unique_ptr<diagnostics::GameplayJournal> journal_;
+  ecs::components::ShootingGalleryState::Holder gameState_;
+  std::unique_ptr<GameWorld> gameWorld_;
+};
+
+} // namespace game
@@ -0,0 +1,151 @@
+#include "WorldStreamer.hpp"
+#include "ecs/ComponentManager.hpp"
+#include "ecs/SystemManager.hpp"
+#include "ecs/components/Images.hpp"
+#include "ecs/components/Sprite.hpp"
+#include "ecs/components/Transform.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+
+namespace game {
+
+bool WorldStreamer::open(const std::string &path) {
+  close();
+  return scene.open(path);
+}
+
+void WorldStreamer::close() {
+  for (auto &[index, entities] : loadedCells) {
+    unloadCell(entities);
+  }
+  loadedCells.clear();
+  streamedEntities = 0;
+  scene.close();
+}
+
+WorldStreamer::CellRange WorldStreamer::cellRange(float viewX, float viewY,
+                                                  float viewWidth,
+                                                  float viewHeight,
+                                                  int radius) const {
+  const auto &header = scene.getHeader();
+  CellRange range;
+  range.minX = static_cast<int>(std::floor(viewX / header.cellSize)) - radius;
+  range.minY = static_cast<int>(std::floor(viewY / header.cellSize)) - radius;
+  range.maxX = static_cast<int>(
+                   std::floor((viewX + viewWidth) / header.cellSize)) +
+               radius;
+  range.maxY = static_cast<int>(
+                   std::floor((viewY + viewHeight) / header.cellSize)) +
+               radius;
+  range.minX = std::max(range.minX, 0);
+  range.minY = std::max(range.minY, 0);
+  range.maxX = std::min(range.maxX, static_cast<int>(header.cellsX) - 1);
+  range.maxY = std::min(range.maxY, static_cast<int>(header.cellsY) - 1);
+  return range;
+}
+
+void WorldStreamer::update(float viewX, float viewY, float viewWidth,
+                           float viewHeight) {
+  if (!scene.isOpen()) {
+    return;
+  }
+  const auto &header = scene.getHeader();
+
+  // 1. Unload cells that drifted out of the outer radius (a few per update;
+  // the rest go on the following updates)
+  CellRange keep =
+      cellRange(viewX, viewY, viewWidth, viewHeight, UNLOAD_RADIUS);
+  int unloads = 0;
+  for (auto it = loadedCells.begin();
+       it != loadedCells.end() && unloads < MAX_UNLOADS_PER_UPDATE;) {
+    int cellX = static_cast<int>(it->first % header.cellsX);
+    int cellY = static_cast<int>(it->first / header.cellsX);
+    if (keep.contains(cellX, cellY)) {
+      ++it;
+      continue;
+    }
+    unloadCell(it->second);
+    it = loadedCells.erase(it);
+    unloads++;
+  }
+
+  // 2. Load the nearest missing cells inside the inner radius
+  CellRange wanted =
+      cellRange(viewX, viewY, viewWidth, viewHeight, LOAD_RADIUS);
+  float centerX = viewX + viewWidth * 0.5f;
+  float centerY = viewY + viewHeight * 0.5f;
+  candidates.clear();
+  for (int y = wanted.minY; y <= wanted.maxY; ++y) {
+    for (int x = wanted.minX; x <= wanted.maxX; ++x) {
+      uint32_t index = static_cast<uint32_t>(y) * header.cellsX + x;
+      if (loadedCells.count(index) == 0) {
+        float dx = (x + 0.5f) * header.cellSize - centerX;
+        float dy = (y + 0.5f) * header.cellSize - centerY;
+        candidates.emplace_back(dx * dx + dy * dy, index);
+      }
+    }
+  }
+  size_t loads =
+      std::min(candidates.size(), static_cast<size_t>(MAX_LOADS_PER_UPDATE));
+  std::partial_sort(candidates.begin(), candidates.begin() + loads,
+                    candidates.end());
+  for (size_t i = 0; i < loads; ++i) {
+    uint32_t index = candidates[i].second;
+    loadCell(index % header.cellsX, index / header.cellsX);
+  }
+}
+
+void WorldStreamer::loadCell(uint32_t cellX, uint32_t cellY) {
+  auto &cm = ecs::ComponentManager::getInstance();
+  auto &sm = ecs::SystemManager::getInstance();
+  uint32_t index = cellY * scene.getHeader().cellsX + cellX;
+
+  // An unreadable cell is still marked loaded so it is not retried each frame
+  std::vector<ecs::Entity> &entities = loadedCells[index];
+  if (!scene.readCell(cellX, cellY, records)) {
+    return;
+  }
+
+  entities.reserve(records.size());
+  // Systems pick up the whole cell in one pass once it is built
+  ecs::ComponentManager::Batch batch(cm);
+  for (const auto &record : records) {
+    ecs::Entity entity = ecs::Entity::create("scenery");
+    sm.onEntityCreated(entity);
+
+    cm.addComponent<ecs::components::Transform>(
+        entity, ecs::Vector2(record.x, record.y), record.rotation);
+    cm.addComponent<ecs::components::Sprite>(
+        entity, record.width, record.height,
+        SDL_Color{record.r, record.g, record.b, record.a});
+
+    const std::string &imageName = scene.getImageName(record.imageIndex);
+    if (!imageName.empty()) {
+      cm.addComponent<ecs::components::Images>(
+          entity, std::vector<std::string>{imageName});
+    }
+    entities.push_back(entity);
+  }
+  streamedEntities += entities.size();
+  cellLoads++;
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[WorldStreamer] Loaded cell (%u, %u): %zu entities, %zu "
+              "resident",
+              cellX, cellY, entities.size(), streamedEntities);
+}
+
+void WorldStreamer::unloadCell(std::vector<ecs::Entity> &entities) {
+  auto &cm = ecs::ComponentManager::getInstance();
+  auto &sm = ecs::SystemManager::getInstance();
+  for (const ecs::Entity &entity : entities) {
+    sm.onEntityDestroyed(entity);
+    cm.removeAllComponents(entity);
+  }
+  streamedEntities -= entities.size();
+  entities.clear();
+  cellUnloads++;
+}
+
+} // namespace game
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "ecs/Entity.hpp"
+#include "resources/SceneFile.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace game {
+
+/**
+ * Streams scene entities in and out by cell around the camera.
+ *
+ * The world is partitioned into the square cells of a binary scene file
+ * (see resources::SceneFile). Cells within LOAD_RADIUS cells of the view are
+ * instantiated as entities (Transform, Sprite and Images when the record has
+ * an image). Cells farther than UNLOAD_RADIUS are destroyed again, so the
+ * number of resident scene entities depends on the view size and not on the
+ * size of the world. The gap between the two radii keeps a camera sitting on
+ * a cell border from loading and unloading the same cells every frame.
+ *
+ * Work is spread out: at most MAX_LOADS_PER_UPDATE cells are read per
+ * update, nearest to the view first, and at most MAX_UNLOADS_PER_UPDATE
+ * cells are destroyed.
+ *
+ * Streamed entities are static scenery; their state is not written back.
+ * Destroying the streamer does not touch the ECS (it may outlive the
+ * managers at shutdown); call close() to remove streamed entities.
+ */
+class WorldStreamer {
+public:
+    static constexpr int LOAD_RADIUS = 1;           // Cells beyond the view kept loaded
+    static constexpr int UNLOAD_RADIUS = 2;         // Cells beyond the view before unloading
+    static constexpr int MAX_LOADS_PER_UPDATE = 2;
+    static constexpr int MAX_UNLOADS_PER_UPDATE = 2;
+
+    WorldStreamer() = default;
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    /**
+     * Open a scene file. Nothing is loaded until the first update().
+     * @param path Binary scene file
+     * @return true on success
+     */
+    bool open(const std::string& path);
+
+    /**
+     * Destroy all streamed entities and close the scene.
+     */
+    void close();
+
+    bool isOpen() const { return scene.isOpen(); }
+
+    /**
+     * Load and unload cells around the view rectangle.
+     * @param viewX Left edge of the view in world coordinates
+     * @param viewY Top edge of the view in world coordinates
+     * @param viewWidth View width
+     * @param viewHeight View height
+     */
+    void update(float viewX, float viewY, float viewWidth, float viewHeight);
+
+    size_t getLoadedCellCount() const { return loadedCells.size(); }
+    size_t getStreamedEntityCount() const { return streamedEntities; }
+    uint64_t getCellLoadCount() const { return cellLoads; }
+    uint64_t getCellUnloadCount() const { return cellUnloads; }
+    const resources::SceneFile& getScene() const { return scene; }
+
+private:
+    struct CellRange {
+        int minX, minY, maxX, maxY;
+        bool contains(int x, int y) const { return x >= minX && x <= maxX && y >= minY && y <= maxY; }
+    };
+
+    CellRange cellRange(float viewX, float viewY, float viewWidth, float viewHeight, int radius) const;
+    void loadCell(uint32_t cellX, uint32_t cellY);
+    void unloadCell(std::vector<ecs::Entity>& entities);
+
+    resources::SceneFile scene;
+    std::unordered_map<uint32_t, std::vector<ecs::Entity>> loadedCells;  // Cell index -> entities
+    std::vector<resources::SceneEntityRecord> records;                    // Scratch buffer for reads
+    std::vector<std::pair<float, uint32_t>> candidates;                   // Scratch: (distance, cell index)
+    size_t streamedEntities = 0;
+    uint64_t cellLoads = 0;
+    uint64_t cellUnloads = 0;
+};
+
+} // namespace game
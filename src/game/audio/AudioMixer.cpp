@@ -0,0 +1,233 @@
+#include "AudioMixer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace game {
+namespace audio {
+
+AudioMixer::AudioMixer(int maxVoices)
+    : stream_(nullptr)
+    , commands_(COMMAND_QUEUE_SIZE)
+    , head_(0)
+    , tail_(0)
+    , voices_(std::max(1, maxVoices))
+    , buffer_(static_cast<size_t>(MIX_CHUNK_FRAMES) * SoundBank::CHANNELS)
+    , masterVolume_(1.0f)
+    , nextSerial_(0)
+    , activeVoices_(0)
+    , stolenVoices_(0)
+    , rejectedSounds_(0)
+    , droppedCommands_(0)
+    , lastMixNs_(0)
+    , lastMixVoices_(0)
+{
+}
+
+AudioMixer::~AudioMixer() {
+    close();
+}
+
+bool AudioMixer::setMaxVoices(int maxVoices) {
+    if (isOpen()) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO, "[AudioMixer] Cannot change the voice cap while open");
+        return false;
+    }
+    voices_.assign(std::max(1, maxVoices), Voice());
+    activeVoices_.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+bool AudioMixer::open(bool start) {
+    if (isOpen()) {
+        return true;
+    }
+
+    SDL_AudioSpec spec;
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = SoundBank::CHANNELS;
+    spec.freq = SoundBank::SAMPLE_RATE;
+    stream_ = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec,
+                                        &AudioMixer::streamCallback, this);
+    if (!stream_) {
+        SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "[AudioMixer] Cannot open audio device: %s",
+                     SDL_GetError());
+        return false;
+    }
+    if (start && !SDL_ResumeAudioStreamDevice(stream_)) {
+        SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "[AudioMixer] Cannot start audio device: %s",
+                     SDL_GetError());
+        close();
+        return false;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+                "[AudioMixer] Opened %s driver: %d Hz stereo, %d voices, %zu sounds (%zu bytes)%s",
+                SDL_GetCurrentAudioDriver(), SoundBank::SAMPLE_RATE, getMaxVoices(),
+                bank_.getSoundCount(), bank_.getPoolBytes(), start ? "" : ", paused");
+    return true;
+}
+
+void AudioMixer::close() {
+    if (!stream_) {
+        return;
+    }
+    // Destroying the stream waits for a running callback to finish
+    SDL_DestroyAudioStream(stream_);
+    stream_ = nullptr;
+    for (Voice& voice : voices_) {
+        voice = Voice();
+    }
+    head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+    activeVoices_.store(0, std::memory_order_relaxed);
+}
+
+bool AudioMixer::push(const Command& command) {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) >= COMMAND_QUEUE_SIZE) {
+        droppedCommands_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    commands_[tail & (COMMAND_QUEUE_SIZE - 1)] = command;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool AudioMixer::play(SoundId sound, float volume, float pan, int priority) {
+    if (!bank_.isValid(sound)) {
+        return false;
+    }
+    Command command;
+    command.type = Command::Play;
+    command.sound = sound;
+    command.volume = volume;
+    command.pan = std::max(-1.0f, std::min(1.0f, pan));
+    command.priority = static_cast<uint8_t>(
+        priority < 0 ? bank_.get(sound).priority : std::min(priority, 255));
+    return push(command);
+}
+
+bool AudioMixer::stopAll() {
+    Command command;
+    command.type = Command::StopAll;
+    return push(command);
+}
+
+bool AudioMixer::setMasterVolume(float volume) {
+    Command command;
+    command.type = Command::SetMasterVolume;
+    command.volume = std::max(0.0f, std::min(1.0f, volume));
+    return push(command);
+}
+
+void AudioMixer::applyCommands() {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    uint32_t tail = tail_.load(std::memory_order_acquire);
+    for (; head != tail; ++head) {
+        const Command& command = commands_[head & (COMMAND_QUEUE_SIZE - 1)];
+        switch (command.type) {
+            case Command::Play:
+                startVoice(command);
+                break;
+            case Command::StopAll:
+                for (Voice& voice : voices_) {
+                    voice.samples = nullptr;
+                }
+                break;
+            case Command::SetMasterVolume:
+                masterVolume_ = command.volume;
+                break;
+        }
+    }
+    head_.store(head, std::memory_order_release);
+}
+
+void AudioMixer::startVoice(const Command& command) {
+    // Free voice first, otherwise the lowest priority (oldest among equals)
+    Voice* target = nullptr;
+    for (Voice& voice : voices_) {
+        if (!voice.samples) {
+            target = &voice;
+            break;
+        }
+        if (!target || voice.priority < target->priority ||
+            (voice.priority == target->priority && voice.serial < target->serial)) {
+            target = &voice;
+        }
+    }
+    if (target->samples) {
+        if (target->priority > command.priority) {
+            rejectedSounds_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        stolenVoices_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Equal-power pan
+    const Sound& sound = bank_.get(command.sound);
+    float gain = sound.volume * command.volume;
+    float angle = (command.pan + 1.0f) * 0.25f * 3.14159265f;
+    target->samples = bank_.getSamples(command.sound);
+    target->frames = sound.frames;
+    target->position = 0;
+    target->gainLeft = gain * std::cos(angle);
+    target->gainRight = gain * std::sin(angle);
+    target->priority = command.priority;
+    target->serial = nextSerial_++;
+}
+
+void AudioMixer::mix(float* out, int frames) {
+    Uint64 start = SDL_GetTicksNS();
+    frames = std::min(frames, MIX_CHUNK_FRAMES);
+    applyCommands();
+    std::memset(out, 0, static_cast<size_t>(frames) * SoundBank::CHANNELS * sizeof(float));
+
+    int mixed = 0;
+    int active = 0;
+    for (Voice& voice : voices_) {
+        if (!voice.samples) {
+            continue;
+        }
+        uint32_t count = std::min(static_cast<uint32_t>(frames), voice.frames - voice.position);
+        const float* source = voice.samples + static_cast<size_t>(voice.position) * SoundBank::CHANNELS;
+        const float left = voice.gainLeft;
+        const float right = voice.gainRight;
+        for (uint32_t i = 0; i < count; ++i) {
+            out[2 * i] += source[2 * i] * left;
+            out[2 * i + 1] += source[2 * i + 1] * right;
+        }
+        mixed++;
+        voice.position += count;
+        if (voice.position >= voice.frames) {
+            voice.samples = nullptr;
+        } else {
+            active++;
+        }
+    }
+
+    const int samples = frames * SoundBank::CHANNELS;
+    const float master = masterVolume_;
+    for (int i = 0; i < samples; ++i) {
+        out[i] = std::max(-1.0f, std::min(1.0f, out[i] * master));
+    }
+
+    activeVoices_.store(active, std::memory_order_relaxed);
+    lastMixVoices_.store(mixed, std::memory_order_relaxed);
+    lastMixNs_.store(SDL_GetTicksNS() - start, std::memory_order_relaxed);
+}
+
+void AudioMixer::streamCallback(void* userdata, SDL_AudioStream* stream, int additionalAmount,
+                                int) {
+    auto* mixer = static_cast<AudioMixer*>(userdata);
+    const int frameBytes = static_cast<int>(sizeof(float)) * SoundBank::CHANNELS;
+    int frames = additionalAmount / frameBytes;
+    while (frames > 0) {
+        int chunk = std::min(frames, MIX_CHUNK_FRAMES);
+        mixer->mix(mixer->buffer_.data(), chunk);
+        SDL_PutAudioStreamData(stream, mixer->buffer_.data(), chunk * frameBytes);
+        frames -= chunk;
+    }
+}
+
+} // namespace audio
+} // namespace game
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "SoundBank.hpp"
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace audio {
+
+/**
+ * AudioMixer - software mixer on an SDL audio stream with a fixed voice cap.
+ *
+ * Game code triggers sounds with play(); the request goes into a lock-free
+ * single-producer/single-consumer ring and is picked up by the audio
+ * callback, which is the only code touching the voices. No locks are taken
+ * and nothing is allocated on either side after open().
+ *
+ * At most getMaxVoices() sounds play at once. When all voices are busy a new
+ * sound takes over the voice with the lowest priority (the oldest one among
+ * equals), unless every playing voice outranks it, in which case the new
+ * sound is dropped. Bursts of hundreds of triggers therefore cost a bounded
+ * amount of mixing.
+ *
+ * Threading: play(), stopAll() and setMasterVolume() must be called from one
+ * thread (the game thread). mix() runs on SDL's audio thread once the device
+ * is started; when the mixer is not started it can be called directly to
+ * render offline (benchmarks, tests). Fill the sound bank before open().
+ *
+ * The game uses getInstance(); other instances can be created for tests.
+ */
+class AudioMixer {
+public:
+    static constexpr int DEFAULT_MAX_VOICES = 32;
+    static constexpr uint32_t COMMAND_QUEUE_SIZE = 256;  // Power of two
+    static constexpr int MIX_CHUNK_FRAMES = 1024;        // Frames mixed per pass
+
+    static AudioMixer& getInstance() {
+        static AudioMixer instance;
+        return instance;
+    }
+
+    /**
+     * @param maxVoices Number of sounds that can play at once
+     */
+    explicit AudioMixer(int maxVoices = DEFAULT_MAX_VOICES);
+    ~AudioMixer();
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    SoundBank& getSoundBank() { return bank_; }
+    const SoundBank& getSoundBank() const { return bank_; }
+
+    /**
+     * Change the voice cap. Only allowed while the mixer is closed.
+     * @return false if the mixer is open
+     */
+    bool setMaxVoices(int maxVoices);
+    int getMaxVoices() const { return static_cast<int>(voices_.size()); }
+
+    /**
+     * Open the default playback device as an audio stream in the bank's format.
+     * Requires SDL's audio subsystem (SDL_INIT_AUDIO); set the SDL_AUDIO_DRIVER
+     * hint or environment variable to "dummy" to run without sound hardware.
+     * @param start Start pulling audio right away; pass false to keep the
+     *              device paused and render with mix() instead
+     * @return true on success
+     */
+    bool open(bool start = true);
+
+    /**
+     * Stop the device and release the stream. Playing voices are dropped.
+     */
+    void close();
+
+    bool isOpen() const { return stream_ != nullptr; }
+
+    /**
+     * Queue a sound to start on the next mix.
+     * @param sound Sound from the bank
+     * @param volume Gain on top of the sound's default volume
+     * @param pan -1 (left) to 1 (right)
+     * @param priority Voice-stealing priority; -1 uses the sound's default
+     * @return false if the sound is unknown or the command queue is full
+     */
+    bool play(SoundId sound, float volume = 1.0f, float pan = 0.0f, int priority = -1);
+
+    /**
+     * Queue stopping every playing voice.
+     */
+    bool stopAll();
+
+    /**
+     * Queue a new master volume (0-1).
+     */
+    bool setMasterVolume(float volume);
+
+    /**
+     * Apply queued commands and mix all playing voices.
+     * @param out Receives frames * 2 interleaved floats (overwritten)
+     * @param frames Number of stereo frames, at most MIX_CHUNK_FRAMES
+     */
+    void mix(float* out, int frames);
+
+    // Statistics; safe to read from any thread
+    int getActiveVoices() const { return activeVoices_.load(std::memory_order_relaxed); }
+    uint64_t getStolenVoices() const { return stolenVoices_.load(std::memory_order_relaxed); }
+    uint64_t getRejectedSounds() const { return rejectedSounds_.load(std::memory_order_relaxed); }
+    uint64_t getDroppedCommands() const { return droppedCommands_.load(std::memory_order_relaxed); }
+    // Duration of the last mix() and the voices it mixed
+    uint64_t getLastMixNs() const { return lastMixNs_.load(std::memory_order_relaxed); }
+    int getLastMixVoices() const { return lastMixVoices_.load(std::memory_order_relaxed); }
+
+private:
+    struct Command {
+        enum Type : uint8_t { Play, StopAll, SetMasterVolume };
+        Type type = Play;
+        uint8_t priority = 0;
+        SoundId sound = INVALID_SOUND;
+        float volume = 1.0f;
+        float pan = 0.0f;
+    };
+
+    struct Voice {
+        const float* samples = nullptr;  // nullptr = free
+        uint32_t frames = 0;
+        uint32_t position = 0;
+        float gainLeft = 0.0f;
+        float gainRight = 0.0f;
+        uint8_t priority = 0;
+        uint64_t serial = 0;             // Start order, for stealing the oldest
+    };
+
+    bool push(const Command& command);
+    void applyCommands();
+    void startVoice(const Command& command);
+
+    static void streamCallback(void* userdata, SDL_AudioStream* stream, int additionalAmount,
+                               int totalAmount);
+
+    SoundBank bank_;
+    SDL_AudioStream* stream_;
+
+    // Command ring: the game thread writes tail_, the audio thread head_
+    std::vector<Command> commands_;
+    std::atomic<uint32_t> head_;
+    std::atomic<uint32_t> tail_;
+
+    // Audio thread state
+    std::vector<Voice> voices_;
+    std::vector<float> buffer_;  // MIX_CHUNK_FRAMES stereo frames for the callback
+    float masterVolume_;
+    uint64_t nextSerial_;
+
+    std::atomic<int> activeVoices_;
+    std::atomic<uint64_t> stolenVoices_;
+    std::atomic<uint64_t> rejectedSounds_;
+    std::atomic<uint64_t> droppedCommands_;
+    std::atomic<uint64_t> lastMixNs_;
+    std::atomic<int> lastMixVoices_;
+};
+
+} // namespace audio
+} // namespace game
@@ -0,0 +1,91 @@
+#include "SoundBank.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+
+namespace game {
+namespace audio {
+
+SoundId SoundBank::add(const std::string& name, const float* samples, uint32_t frames,
+                       float volume, uint8_t priority) {
+    if (names_.count(name) != 0) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO, "[SoundBank] Sound %s already loaded", name.c_str());
+        return INVALID_SOUND;
+    }
+
+    Sound sound;
+    sound.name = name;
+    sound.offset = samples_.size();
+    sound.frames = frames;
+    sound.volume = volume;
+    sound.priority = priority;
+    samples_.insert(samples_.end(), samples, samples + static_cast<size_t>(frames) * CHANNELS);
+
+    SoundId id = static_cast<SoundId>(sounds_.size());
+    sounds_.push_back(sound);
+    names_.emplace(name, id);
+    SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO, "[SoundBank] Added %s: %u frames (%.2fs), pool %zu bytes",
+                name.c_str(), frames, static_cast<float>(frames) / SAMPLE_RATE, getPoolBytes());
+    return id;
+}
+
+SoundId SoundBank::loadWav(const std::string& name, const std::string& path, float volume,
+                           uint8_t priority) {
+    SDL_AudioSpec sourceSpec;
+    Uint8* source = nullptr;
+    Uint32 sourceBytes = 0;
+    if (!SDL_LoadWAV(path.c_str(), &sourceSpec, &source, &sourceBytes)) {
+        SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "[SoundBank] Cannot load %s: %s", path.c_str(),
+                     SDL_GetError());
+        return INVALID_SOUND;
+    }
+
+    SDL_AudioSpec targetSpec;
+    targetSpec.format = SDL_AUDIO_F32;
+    targetSpec.channels = CHANNELS;
+    targetSpec.freq = SAMPLE_RATE;
+    Uint8* converted = nullptr;
+    int convertedBytes = 0;
+    bool ok = SDL_ConvertAudioSamples(&sourceSpec, source, static_cast<int>(sourceBytes),
+                                      &targetSpec, &converted, &convertedBytes);
+    SDL_free(source);
+    if (!ok) {
+        SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "[SoundBank] Cannot convert %s: %s", path.c_str(),
+                     SDL_GetError());
+        return INVALID_SOUND;
+    }
+
+    uint32_t frames = static_cast<uint32_t>(convertedBytes / (sizeof(float) * CHANNELS));
+    SoundId id = add(name, reinterpret_cast<const float*>(converted), frames, volume, priority);
+    SDL_free(converted);
+    return id;
+}
+
+SoundId SoundBank::addTone(const std::string& name, float frequency, float seconds, float volume,
+                           uint8_t priority) {
+    uint32_t frames = static_cast<uint32_t>(seconds * SAMPLE_RATE);
+    std::vector<float> samples(static_cast<size_t>(frames) * CHANNELS);
+    const float step = 2.0f * 3.14159265f * frequency / SAMPLE_RATE;
+    const float decay = 5.0f / std::max(seconds, 0.001f);  // ~-43 dB at the end
+    for (uint32_t i = 0; i < frames; ++i) {
+        float t = static_cast<float>(i) / SAMPLE_RATE;
+        float value = std::sin(step * i) * std::exp(-decay * t);
+        samples[2 * i] = value;
+        samples[2 * i + 1] = value;
+    }
+    return add(name, samples.data(), frames, volume, priority);
+}
+
+SoundId SoundBank::find(const std::string& name) const {
+    auto it = names_.find(name);
+    return it != names_.end() ? it->second : INVALID_SOUND;
+}
+
+void SoundBank::clear() {
+    samples_.clear();
+    sounds_.clear();
+    names_.clear();
+}
+
+} // namespace audio
+} // namespace game
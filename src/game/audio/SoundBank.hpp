@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace game {
+namespace audio {
+
+using SoundId = uint32_t;
+constexpr SoundId INVALID_SOUND = 0xFFFFFFFFu;
+
+/**
+ * A decoded sound inside the bank's sample pool.
+ */
+struct Sound {
+    std::string name;
+    size_t offset = 0;      // First sample in the pool
+    uint32_t frames = 0;    // Stereo frames
+    float volume = 1.0f;    // Default gain
+    uint8_t priority = 0;   // Higher survives voice stealing longer
+};
+
+/**
+ * Preloaded sounds, decoded once into the mixer's format.
+ *
+ * Every sound is converted to interleaved 32-bit float stereo at
+ * SAMPLE_RATE and appended to one contiguous sample pool, so the mixer reads
+ * plain float arrays and never decodes, converts or allocates while playing.
+ *
+ * The bank is not synchronized: fill it before the mixer starts (see
+ * AudioMixer::open()) and leave it unchanged while audio is running.
+ */
+class SoundBank {
+public:
+    static constexpr int SAMPLE_RATE = 48000;
+    static constexpr int CHANNELS = 2;
+
+    SoundBank() = default;
+
+    /**
+     * Add already decoded samples.
+     * @param name Lookup name
+     * @param samples Interleaved stereo floats at SAMPLE_RATE
+     * @param frames Number of stereo frames
+     * @param volume Default gain
+     * @param priority Voice-stealing priority
+     * @return Sound id, or INVALID_SOUND if the name is taken
+     */
+    SoundId add(const std::string& name, const float* samples, uint32_t frames,
+                float volume = 1.0f, uint8_t priority = 0);
+
+    /**
+     * Decode a WAV file and convert it to the mixer format.
+     * @return Sound id, or INVALID_SOUND on failure
+     */
+    SoundId loadWav(const std::string& name, const std::string& path,
+                    float volume = 1.0f, uint8_t priority = 0);
+
+    /**
+     * Synthesize an exponentially decaying sine blip (placeholder effects
+     * and benchmarks that should not depend on asset files).
+     * @param frequency Pitch in Hz
+     * @param seconds Length
+     * @return Sound id, or INVALID_SOUND if the name is taken
+     */
+    SoundId addTone(const std::string& name, float frequency, float seconds,
+                    float volume = 1.0f, uint8_t priority = 0);
+
+    SoundId find(const std::string& name) const;
+    const Sound& get(SoundId id) const { return sounds_[id]; }
+    bool isValid(SoundId id) const { return id < sounds_.size(); }
+    const float* getSamples(SoundId id) const { return samples_.data() + sounds_[id].offset; }
+
+    size_t getSoundCount() const { return sounds_.size(); }
+    size_t getPoolBytes() const { return samples_.size() * sizeof(float); }
+    void clear();
+
+private:
+    std::vector<float> samples_;  // Pool shared by all sounds
+    std::vector<Sound> sounds_;
+    std::unordered_map<std::string, SoundId> names_;
+};
+
+} // namespace audio
+} // namespace game
@@ -0,0 +1,76 @@
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> allocationCount{0};
+std::atomic<uint64_t> freeCount{0};
+std::atomic<uint64_t> allocatedBytes{0};
+
+void *countedAlloc(std::size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void countedFree(void *ptr) noexcept {
+  if (ptr) {
+    freeCount.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+  }
+}
+
+} // namespace
+
+namespace game {
+namespace diagnostics {
+
+AllocationCounter::Snapshot AllocationCounter::snapshot() {
+  Snapshot s;
+  s.allocations = allocationCount.load(std::memory_order_relaxed);
+  s.frees = freeCount.load(std::memory_order_relaxed);
+  s.bytes = allocatedBytes.load(std::memory_order_relaxed);
+  return s;
+}
+
+uint64_t AllocationCounter::getAllocationCount() {
+  return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace diagnostics
+} // namespace game
+
+// Global replacements. Over-aligned new/delete are left to the runtime since
+// nothing in the engine requests extended alignment.
+void *operator new(std::size_t size) { return countedAlloc(size); }
+void *operator new[](std::size_t size) { return countedAlloc(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return countedAlloc(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return countedAlloc(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void operator delete(void *ptr) noexcept { countedFree(ptr); }
+void operator delete[](void *ptr) noexcept { countedFree(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  countedFree(ptr);
+}
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  countedFree(ptr);
+}
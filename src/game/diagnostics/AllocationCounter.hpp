@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+namespace game {
+namespace diagnostics {
+
+/**
+ * Process-wide heap allocation counters.
+ *
+ * Linking this translation unit replaces the global operator new/delete with
+ * thin wrappers that bump relaxed atomic counters before forwarding to
+ * malloc/free. game_ecs is a static library, and every target that links it
+ * needs operator new, so the linker resolves it from this object and all of
+ * them (game, server, tools, PerfGate) get the counting allocator. The cost is
+ * two relaxed atomic adds per allocation.
+ *
+ * Counters are monotonic: take a snapshot before and after the region you
+ * care about and subtract.
+ */
+class AllocationCounter {
+public:
+    struct Snapshot {
+        uint64_t allocations = 0; // Number of operator new calls
+        uint64_t frees = 0;       // Number of operator delete calls (non-null)
+        uint64_t bytes = 0;       // Total bytes requested from operator new
+    };
+
+    /**
+     * Read the current counter values.
+     * @return Snapshot of the process-wide counters
+     */
+    static Snapshot snapshot();
+
+    /**
+     * Total number of allocations since process start.
+     * @return Allocation count
+     */
+    static uint64_t getAllocationCount();
+};
+
+} // namespace diagnostics
+} // namespace game
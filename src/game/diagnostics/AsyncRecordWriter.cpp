@@ -0,0 +1,116 @@
+#include "AsyncRecordWriter.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace game {
+namespace diagnostics {
+
+namespace {
+// How long the writer sleeps when the ring is empty
+constexpr auto IDLE_SLEEP = std::chrono::milliseconds(4);
+} // namespace
+
+AsyncRecordWriter::AsyncRecordWriter(size_t recordSize, size_t capacity)
+    : recordSize_(recordSize), capacity_(capacity > 0 ? capacity : 1),
+      slots_(recordSize_ * capacity_) {}
+
+AsyncRecordWriter::~AsyncRecordWriter() { close(); }
+
+bool AsyncRecordWriter::open(const std::string &path, const void *header,
+                             size_t headerSize) {
+  close();
+
+  file_ = std::fopen(path.c_str(), "wb");
+  if (!file_) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[AsyncRecordWriter] Failed to open %s", path.c_str());
+    return false;
+  }
+  if (header && headerSize > 0) {
+    std::fwrite(header, 1, headerSize, file_);
+  }
+
+  head_.store(0, std::memory_order_relaxed);
+  tail_.store(0, std::memory_order_relaxed);
+  written_.store(0, std::memory_order_relaxed);
+  dropped_.store(0, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  thread_ = std::thread(&AsyncRecordWriter::run, this);
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[AsyncRecordWriter] Writing %zu-byte records to %s",
+              recordSize_, path.c_str());
+  return true;
+}
+
+bool AsyncRecordWriter::push(const void *record) {
+  if (!file_) {
+    return false;
+  }
+  uint64_t head = head_.load(std::memory_order_relaxed);
+  uint64_t tail = tail_.load(std::memory_order_acquire);
+  if (head - tail >= capacity_) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  std::memcpy(&slots_[(head % capacity_) * recordSize_], record, recordSize_);
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+size_t AsyncRecordWriter::drain() {
+  uint64_t tail = tail_.load(std::memory_order_relaxed);
+  uint64_t head = head_.load(std::memory_order_acquire);
+  size_t total = 0;
+
+  while (tail < head) {
+    // Write the contiguous run up to the end of the ring in one call
+    size_t start = static_cast<size_t>(tail % capacity_);
+    size_t count = static_cast<size_t>(
+        std::min<uint64_t>(head - tail, capacity_ - start));
+    std::fwrite(&slots_[start * recordSize_], recordSize_, count, file_);
+    tail += count;
+    total += count;
+    tail_.store(tail, std::memory_order_release);
+  }
+
+  if (total > 0) {
+    written_.fetch_add(total, std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void AsyncRecordWriter::run() {
+  while (running_.load(std::memory_order_acquire)) {
+    if (drain() == 0) {
+      std::this_thread::sleep_for(IDLE_SLEEP);
+    }
+  }
+  // Pick up anything pushed before close() flipped the flag
+  drain();
+  std::fflush(file_);
+}
+
+void AsyncRecordWriter::close() {
+  if (!file_) {
+    return;
+  }
+  running_.store(false, std::memory_order_release);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  std::fclose(file_);
+  file_ = nullptr;
+
+  if (dropped_.load(std::memory_order_relaxed) > 0) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[AsyncRecordWriter] Dropped %llu records (writer fell behind)",
+                static_cast<unsigned long long>(
+                    dropped_.load(std::memory_order_relaxed)));
+  }
+}
+
+} // namespace diagnostics
+} // namespace game
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace game {
+namespace diagnostics {
+
+/**
+ * Streams fixed-size binary records to a file from a background thread.
+ *
+ * The game thread hands records over through a single-producer /
+ * single-consumer ring of pre-allocated slots, so push() never blocks, locks
+ * or allocates. If the writer falls behind and the ring is full, the record
+ * is dropped and counted rather than stalling the frame.
+ *
+ * Only one thread may call push(); open() and close() must not race with it.
+ */
+class AsyncRecordWriter {
+public:
+    /**
+     * @param recordSize Size of every record in bytes
+     * @param capacity Number of records the ring can hold before dropping
+     */
+    AsyncRecordWriter(size_t recordSize, size_t capacity);
+
+    /**
+     * Flushes pending records and stops the writer thread.
+     */
+    ~AsyncRecordWriter();
+
+    AsyncRecordWriter(const AsyncRecordWriter&) = delete;
+    AsyncRecordWriter& operator=(const AsyncRecordWriter&) = delete;
+
+    /**
+     * Create the output file, write an optional header and start the
+     * background writer.
+     * @param path Output file path (truncated if it exists)
+     * @param header Bytes written once at the start of the file (may be null)
+     * @param headerSize Size of the header in bytes
+     * @return true if the file was opened
+     */
+    bool open(const std::string& path, const void* header, size_t headerSize);
+
+    /**
+     * Queue one record (recordSize bytes) for writing.
+     * @param record Pointer to the record bytes
+     * @return false if the ring was full and the record was dropped
+     */
+    bool push(const void* record);
+
+    /**
+     * Drain everything queued so far, then stop the thread and close the file.
+     */
+    void close();
+
+    bool isOpen() const { return file_ != nullptr; }
+    uint64_t getWrittenCount() const { return written_.load(std::memory_order_relaxed); }
+    uint64_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    size_t drain();
+
+    const size_t recordSize_;
+    const size_t capacity_;
+    std::vector<uint8_t> slots_;
+
+    // head_ is only written by the producer, tail_ only by the writer thread.
+    // Both count records monotonically; slot index = count % capacity_.
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::FILE* file_ = nullptr;
+    std::thread thread_;
+};
+
+} // namespace diagnostics
+} // namespace game
@@ -0,0 +1,250 @@
+#include "GameplayJournal.hpp"
+#include "../GameWorld.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace game {
+namespace diagnostics {
+
+namespace {
+// Records read per chunk by analyze()
+constexpr size_t READ_CHUNK = 16384;
+
+void setError(std::string *error, const std::string &message) {
+  if (error) {
+    *error = message;
+  }
+}
+
+size_t cellIndex(float position, float size, size_t cells) {
+  if (!(size > 0.0f) || !(position > 0.0f)) {
+    return 0;
+  }
+  return std::min(cells - 1, static_cast<size_t>(position / size * cells));
+}
+} // namespace
+
+float JournalReport::timeToKillPercentile(double fraction) const {
+  const double wanted = fraction * timeToKillCount;
+  uint64_t seen = 0;
+  for (size_t i = 0; i < timeToKill.size(); ++i) {
+    seen += timeToKill[i];
+    if (seen > 0 && seen >= wanted) {
+      return (i + 1) * TTK_BIN_SECONDS;
+    }
+  }
+  return timeToKill.size() * TTK_BIN_SECONDS;
+}
+
+GameplayJournal::GameplayJournal()
+    : writer_(sizeof(JournalRecord), RING_CAPACITY) {}
+
+GameplayJournal::~GameplayJournal() { close(); }
+
+bool GameplayJournal::open(const std::string &path, float worldWidth,
+                           float worldHeight) {
+  close();
+  JournalFileHeader header;
+  header.recordSize = sizeof(JournalRecord);
+  header.worldWidth = worldWidth;
+  header.worldHeight = worldHeight;
+  wave_ = 0;
+  recorded_ = 0;
+  return writer_.open(path, &header, sizeof(header));
+}
+
+void GameplayJournal::close() {
+  if (!writer_.isOpen()) {
+    return;
+  }
+  writer_.close();
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[GameplayJournal] Journaled %llu events (%llu dropped)",
+              static_cast<unsigned long long>(writer_.getWrittenCount()),
+              static_cast<unsigned long long>(writer_.getDroppedCount()));
+}
+
+void GameplayJournal::record(JournalEvent event, uint64_t entity, float x,
+                             float y, float value, uint8_t detail) {
+  if (!writer_.isOpen()) {
+    return;
+  }
+  JournalRecord record;
+  record.time = GameWorld::getInstance().getGameTimer().getClock();
+  record.entity = entity;
+  record.x = x;
+  record.y = y;
+  record.value = value;
+  record.wave = wave_;
+  record.event = static_cast<uint8_t>(event);
+  record.detail = detail;
+  writer_.push(&record);
+  ++recorded_;
+}
+
+void GameplayJournal::recordState(ecs::components::GameState state,
+                                  int score) {
+  if (!writer_.isOpen()) {
+    return;
+  }
+  if (state == ecs::components::GameState::PLAYING) {
+    ++wave_;
+  }
+  record(JournalEvent::STATE, 0, 0.0f, 0.0f, static_cast<float>(score),
+         static_cast<uint8_t>(state));
+}
+
+uint8_t GameplayJournal::targetKind(const std::string &targetType) {
+  return static_cast<uint8_t>(targetType == "boss" ? JournalTarget::BOSS
+                                                   : JournalTarget::REGULAR);
+}
+
+bool GameplayJournal::analyze(const std::string &path, size_t columns,
+                              size_t rows, JournalReport &report,
+                              std::string *error) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) {
+    setError(error, "Cannot open " + path);
+    return false;
+  }
+  JournalFileHeader header;
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      header.magic != JournalFileHeader::MAGIC) {
+    setError(error, path + " is not a gameplay journal");
+    return false;
+  }
+  if (header.version != JournalFileHeader::VERSION ||
+      header.recordSize != sizeof(JournalRecord)) {
+    setError(error, path + " was written by an incompatible version");
+    return false;
+  }
+
+  report = JournalReport();
+  report.worldWidth = header.worldWidth;
+  report.worldHeight = header.worldHeight;
+  report.gridColumns = std::max<size_t>(1, columns);
+  report.gridRows = std::max<size_t>(1, rows);
+  report.cellHits.assign(report.gridColumns * report.gridRows, 0);
+  report.cellMisses.assign(report.cellHits.size(), 0);
+  report.timeToKill.assign(JournalReport::TTK_BINS, 0);
+
+  // Every duck still alive at this point of the journal. Only a few dozen
+  // are alive at once, so a flat list beats a hash map and does not
+  // allocate per spawn
+  struct Spawn {
+    uint64_t entity;
+    double time;
+    size_t wave; // Index in report.waves
+  };
+  std::vector<Spawn> spawns;
+  spawns.reserve(256);
+  auto findSpawn = [&spawns](uint64_t entity) {
+    return std::find_if(
+        spawns.begin(), spawns.end(),
+        [entity](const Spawn &spawn) { return spawn.entity == entity; });
+  };
+  auto eraseSpawn = [&spawns](std::vector<Spawn>::iterator spawn) {
+    *spawn = spawns.back();
+    spawns.pop_back();
+  };
+  std::unordered_map<uint16_t, size_t> waveIndex;
+  JournalReport::Wave *wave = nullptr;
+  size_t waveSlot = 0;
+
+  std::vector<JournalRecord> chunk(READ_CHUNK);
+  while (in) {
+    in.read(reinterpret_cast<char *>(chunk.data()),
+            chunk.size() * sizeof(JournalRecord));
+    const size_t count =
+        static_cast<size_t>(in.gcount()) / sizeof(JournalRecord);
+    for (size_t i = 0; i < count; ++i) {
+      const JournalRecord &record = chunk[i];
+      if (!wave || wave->wave != record.wave) {
+        auto found = waveIndex.find(record.wave);
+        if (found == waveIndex.end()) {
+          found = waveIndex.emplace(record.wave, report.waves.size()).first;
+          report.waves.emplace_back();
+          report.waves.back().wave = record.wave;
+          report.waves.back().startTime = record.time;
+        }
+        waveSlot = found->second;
+        wave = &report.waves[waveSlot];
+      }
+      wave->endTime = record.time;
+      if (record.event < std::size(report.counts)) {
+        ++report.counts[record.event];
+      }
+
+      const size_t cell =
+          cellIndex(record.y, report.worldHeight, report.gridRows) *
+              report.gridColumns +
+          cellIndex(record.x, report.worldWidth, report.gridColumns);
+      switch (static_cast<JournalEvent>(record.event)) {
+      case JournalEvent::SPAWN: {
+        ++wave->spawns;
+        auto spawned = findSpawn(record.entity);
+        if (spawned != spawns.end()) {
+          *spawned = {record.entity, record.time, waveSlot};
+        } else {
+          spawns.push_back({record.entity, record.time, waveSlot});
+        }
+        break;
+      }
+      case JournalEvent::SHOT:
+        ++wave->shots;
+        break;
+      case JournalEvent::HIT: {
+        ++wave->hits;
+        ++report.cellHits[cell];
+        auto spawned = findSpawn(record.entity);
+        if (spawned != spawns.end()) {
+          const float seconds =
+              static_cast<float>(record.time - spawned->time);
+          const size_t bin = std::min(
+              JournalReport::TTK_BINS - 1,
+              static_cast<size_t>(std::max(0.0f, seconds) /
+                                  JournalReport::TTK_BIN_SECONDS));
+          ++report.timeToKill[bin];
+          ++report.timeToKillCount;
+          report.timeToKillSum += seconds;
+          report.timeToKillMax = std::max(report.timeToKillMax, seconds);
+          wave->timeToKillSum += seconds;
+          ++wave->timeToKillCount;
+          eraseSpawn(spawned);
+        }
+        break;
+      }
+      case JournalEvent::MISS:
+        ++wave->misses;
+        ++report.cellMisses[cell];
+        break;
+      case JournalEvent::EXPIRE: {
+        // Ducks left over when a round ends are cleared as the next one
+        // starts; count them against the round they flew in
+        auto spawned = findSpawn(record.entity);
+        if (spawned != spawns.end()) {
+          ++report.waves[spawned->wave].expiries;
+          eraseSpawn(spawned);
+        } else {
+          ++wave->expiries;
+        }
+        break;
+      }
+      case JournalEvent::STATE:
+        if (record.detail ==
+            static_cast<uint8_t>(ecs::components::GameState::GAME_OVER)) {
+          wave->score = static_cast<int64_t>(record.value);
+        }
+        break;
+      }
+    }
+    report.records += count;
+  }
+  return true;
+}
+
+} // namespace diagnostics
+} // namespace game
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "AsyncRecordWriter.hpp"
+#include "../ecs/WorldLocal.hpp"
+#include "../ecs/components/ShootingGalleryState.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace game {
+namespace diagnostics {
+
+/**
+ * Binary layout of a gameplay journal:
+ *   JournalFileHeader, then one JournalRecord per event until EOF.
+ * Both structs are written as-is, so files are only portable between
+ * machines with the same endianness (the analyzer checks the magic).
+ */
+struct JournalFileHeader {
+    static constexpr uint32_t MAGIC = 0x4E524A47; // "GJRN" little-endian
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t recordSize = 0;
+    uint32_t reserved = 0;
+    float worldWidth = 0.0f;  // Bounds of the positions in the records
+    float worldHeight = 0.0f;
+};
+
+enum class JournalEvent : uint8_t {
+    SPAWN = 1,  // TargetSpawnSystem created a duck
+    SHOT,       // ProjectileSystem fired a projectile
+    HIT,        // A projectile hit a duck
+    MISS,       // A projectile ran out of range without hitting
+    EXPIRE,     // A duck was removed without being hit (flew off, round cleared)
+    STATE       // The round changed state
+};
+
+// Kind of duck in the detail byte of SPAWN, HIT and EXPIRE records
+enum class JournalTarget : uint8_t {
+    REGULAR = 0,
+    BOSS = 1
+};
+
+struct JournalRecord {
+    double time = 0.0;     // Game clock in seconds
+    uint64_t entity = 0;   // Duck (SPAWN, HIT, EXPIRE) or projectile (SHOT, MISS)
+    float x = 0.0f;        // World position of the event
+    float y = 0.0f;
+    float value = 0.0f;    // SPAWN, HIT: points; STATE: score
+    uint16_t wave = 0;     // Round the event belongs to; 0 = before the first
+    uint8_t event = 0;     // JournalEvent
+    uint8_t detail = 0;    // JournalTarget, or the new GameState for STATE
+};
+static_assert(sizeof(JournalRecord) == 32, "JournalRecord must stay 32 bytes");
+
+/**
+ * Summary of a journal computed by GameplayJournal::analyze().
+ */
+struct JournalReport {
+    static constexpr float TTK_BIN_SECONDS = 0.1f;
+    static constexpr size_t TTK_BINS = 300; // The last bin collects the rest
+
+    struct Wave {
+        uint32_t wave = 0;
+        double startTime = 0.0;
+        double endTime = 0.0;  // Time of its last event
+        uint64_t spawns = 0;
+        uint64_t shots = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t expiries = 0;
+        int64_t score = 0;     // From the STATE record that ended it
+        double timeToKillSum = 0.0;
+        uint64_t timeToKillCount = 0;
+    };
+
+    uint64_t records = 0;
+    uint64_t counts[8] = {}; // Indexed by JournalEvent
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+
+    // Hits and misses by where they happened, row by row from the top left
+    size_t gridColumns = 0;
+    size_t gridRows = 0;
+    std::vector<uint64_t> cellHits;
+    std::vector<uint64_t> cellMisses;
+
+    // Seconds from a duck's spawn to its hit (ducks spawned in the journal)
+    std::vector<uint64_t> timeToKill; // TTK_BINS bins of TTK_BIN_SECONDS
+    uint64_t timeToKillCount = 0;
+    double timeToKillSum = 0.0;
+    float timeToKillMax = 0.0f;
+
+    std::vector<Wave> waves; // In the order they started
+
+    /**
+     * @return Seconds below which the given fraction of kills fall
+     *         (resolution TTK_BIN_SECONDS)
+     */
+    float timeToKillPercentile(double fraction) const;
+};
+
+/**
+ * GameplayJournal - append-only binary log of what happens in a match.
+ *
+ * Systems report spawns, shots, hits, misses, expiries and round changes
+ * through record(); each becomes one fixed-size JournalRecord stamped with
+ * the game clock and round number and handed to an AsyncRecordWriter, so
+ * the game thread only fills a struct and copies it into a ring slot. While
+ * no journal is open record() returns at once.
+ *
+ * Each WorldInstance has its own journal (closed unless opened), so worlds
+ * ticking on other threads never push into the process-wide one. Only the
+ * thread updating the world may call record().
+ *
+ * analyze() (or the JournalAnalyzer tool) reads a journal back.
+ */
+class GameplayJournal {
+public:
+    static constexpr size_t RING_CAPACITY = 4096; // Bursts when a round is cleared
+
+    static GameplayJournal& getInstance() {
+        if (GameplayJournal* local = ecs::WorldLocal<GameplayJournal>::get()) {
+            return *local;
+        }
+        static GameplayJournal instance;
+        return instance;
+    }
+
+    ~GameplayJournal();
+
+    GameplayJournal(const GameplayJournal&) = delete;
+    GameplayJournal& operator=(const GameplayJournal&) = delete;
+
+    /**
+     * Start a new journal (truncating the file).
+     * @param worldWidth World size the positions refer to
+     * @param worldHeight
+     * @return false if the file could not be opened
+     */
+    bool open(const std::string& path, float worldWidth, float worldHeight);
+
+    /**
+     * Write everything queued and close the file.
+     */
+    void close();
+
+    bool isOpen() const { return writer_.isOpen(); }
+
+    /**
+     * Journal one event at the current game clock.
+     */
+    void record(JournalEvent event, uint64_t entity, float x, float y,
+                float value = 0.0f, uint8_t detail = 0);
+
+    /**
+     * Journal a round change; entering PLAYING starts the next wave.
+     * @param score Score at the change
+     */
+    void recordState(ecs::components::GameState state, int score);
+
+    /**
+     * @return JournalTarget of a Target's type, as a detail byte
+     */
+    static uint8_t targetKind(const std::string& targetType);
+
+    uint64_t getRecordedCount() const { return recorded_; }
+    uint64_t getWrittenCount() const { return writer_.getWrittenCount(); }
+    uint64_t getDroppedCount() const { return writer_.getDroppedCount(); }
+
+    /**
+     * Read a journal and compute accuracy by cell, time-to-kill and
+     * per-wave statistics in one pass.
+     * @param columns Heatmap cells across the world
+     * @param rows Heatmap cells down the world
+     * @param error Receives a description of the failure (may be null)
+     * @return true on success
+     */
+    static bool analyze(const std::string& path, size_t columns, size_t rows,
+                        JournalReport& report, std::string* error = nullptr);
+
+private:
+    GameplayJournal();
+    friend class ecs::WorldLocal<GameplayJournal>;
+
+    AsyncRecordWriter writer_;
+    uint16_t wave_ = 0;
+    uint64_t recorded_ = 0;
+};
+
+} // namespace diagnostics
+} // namespace game
@@ -0,0 +1,154 @@
+#include "MetricsRecorder.hpp"
+#include "AllocationCounter.hpp"
+#include "../Timer.hpp"
+#include "../ecs/SystemManager.hpp"
+#include "../ecs/systems/CollisionSystem.hpp"
+#include "../ecs/systems/RenderSystem.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace game {
+namespace diagnostics {
+
+namespace {
+// About four seconds of frames at 60 FPS; the writer drains every few ms
+constexpr size_t RING_CAPACITY = 256;
+
+void setError(std::string *error, const std::string &message) {
+  if (error) {
+    *error = message;
+  }
+}
+} // namespace
+
+MetricsRecorder::MetricsRecorder(const std::string &outputPath)
+    : writer_(sizeof(FrameMetricsRecord), RING_CAPACITY) {
+  auto &systemManager = ecs::SystemManager::getInstance();
+  collisionSystem_ = systemManager.getSystem<ecs::systems::CollisionSystem>();
+  renderSystem_ = systemManager.getSystem<ecs::systems::RenderSystem>();
+
+  const auto &names = systemManager.getSystemNames();
+  systemCount_ = static_cast<uint32_t>(std::min<size_t>(
+      names.size(), MetricsFileHeader::MAX_SYSTEMS));
+  if (names.size() > MetricsFileHeader::MAX_SYSTEMS) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[MetricsRecorder] %zu systems registered, only the first %d "
+                "are recorded",
+                names.size(), MetricsFileHeader::MAX_SYSTEMS);
+  }
+
+  MetricsFileHeader header;
+  header.recordSize = sizeof(FrameMetricsRecord);
+  header.systemCount = systemCount_;
+  for (uint32_t i = 0; i < systemCount_; ++i) {
+    std::strncpy(header.systemNames[i], names[i].c_str(),
+                 MetricsFileHeader::NAME_LENGTH - 1);
+  }
+
+  writer_.open(outputPath, &header, sizeof(header));
+  lastAllocationCount_ = AllocationCounter::getAllocationCount();
+}
+
+MetricsRecorder::~MetricsRecorder() {
+  writer_.close();
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[MetricsRecorder] Recorded %llu frames",
+              static_cast<unsigned long long>(writer_.getWrittenCount()));
+}
+
+bool MetricsRecorder::isRecording() const { return writer_.isOpen(); }
+
+void MetricsRecorder::recordFrame(const Timer &timer) {
+  if (!writer_.isOpen()) {
+    return;
+  }
+
+  const auto &systemManager = ecs::SystemManager::getInstance();
+  const auto &systems = systemManager.getSystems();
+  const auto &times = systemManager.getLastUpdateTimes();
+
+  FrameMetricsRecord record;
+  record.frameIndex = frameIndex_++;
+  record.frameTimeMs = static_cast<float>(timer.getElapsedTime() * 1000.0);
+  record.systemCount = systemCount_;
+
+  Uint64 updateNs = 0;
+  for (uint32_t i = 0; i < systemCount_; ++i) {
+    updateNs += times[i];
+    record.systemTimeUs[i] = static_cast<float>(times[i] / 1000.0);
+    record.systemEntities[i] =
+        static_cast<uint32_t>(systems[i]->getEntities().size());
+  }
+  record.updateTimeMs = static_cast<float>(updateNs / 1.0e6);
+
+  if (collisionSystem_) {
+    record.contacts = static_cast<uint32_t>(collisionSystem_->getContactCount());
+  }
+  if (renderSystem_) {
+    record.drawCalls = static_cast<uint32_t>(renderSystem_->getDrawCallCount());
+  }
+
+  uint64_t allocations = AllocationCounter::getAllocationCount();
+  record.allocations = static_cast<uint32_t>(allocations - lastAllocationCount_);
+  lastAllocationCount_ = allocations;
+  record.eventQueueDepth = static_cast<uint32_t>(eventQueueDepth_);
+
+  writer_.push(&record);
+}
+
+bool MetricsRecorder::convertToCsv(const std::string &binaryPath,
+                                   const std::string &csvPath,
+                                   std::string *error) {
+  std::ifstream in(binaryPath, std::ios::binary);
+  if (!in.is_open()) {
+    setError(error, "Cannot open " + binaryPath);
+    return false;
+  }
+
+  MetricsFileHeader header;
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      header.magic != MetricsFileHeader::MAGIC) {
+    setError(error, binaryPath + " is not a metrics capture");
+    return false;
+  }
+  if (header.version != MetricsFileHeader::VERSION ||
+      header.recordSize != sizeof(FrameMetricsRecord) ||
+      header.systemCount > MetricsFileHeader::MAX_SYSTEMS) {
+    setError(error, binaryPath + " was written by an incompatible version");
+    return false;
+  }
+
+  std::ofstream out(csvPath);
+  if (!out.is_open()) {
+    setError(error, "Cannot write " + csvPath);
+    return false;
+  }
+
+  out << "frame,frame_ms,update_ms,contacts,draw_calls,allocations,"
+         "event_queue_depth";
+  for (uint32_t i = 0; i < header.systemCount; ++i) {
+    const char *raw = header.systemNames[i];
+    std::string name(raw, std::find(raw, raw + MetricsFileHeader::NAME_LENGTH,
+                                     '\0'));
+    out << ',' << name << "_us," << name << "_entities";
+  }
+  out << '\n';
+
+  FrameMetricsRecord record;
+  while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+    out << record.frameIndex << ',' << record.frameTimeMs << ','
+        << record.updateTimeMs << ',' << record.contacts << ','
+        << record.drawCalls << ',' << record.allocations << ','
+        << record.eventQueueDepth;
+    for (uint32_t i = 0; i < header.systemCount; ++i) {
+      out << ',' << record.systemTimeUs[i] << ',' << record.systemEntities[i];
+    }
+    out << '\n';
+  }
+  return true;
+}
+
+} // namespace diagnostics
+} // namespace game
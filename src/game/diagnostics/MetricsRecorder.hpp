@@ -0,0 +1,116 @@
+#pragma once
+
+#include "AsyncRecordWriter.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class Timer;
+
+namespace game {
+namespace ecs {
+namespace systems {
+class CollisionSystem;
+class RenderSystem;
+} // namespace systems
+} // namespace ecs
+
+namespace diagnostics {
+
+/**
+ * Binary layout of a metrics file:
+ *   MetricsFileHeader, then one FrameMetricsRecord per frame until EOF.
+ * Both structs are written as-is, so files are only portable between
+ * machines with the same endianness (the converter checks the magic).
+ */
+struct MetricsFileHeader {
+    static constexpr uint32_t MAGIC = 0x54454D46; // "FMET" little-endian
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int MAX_SYSTEMS = 24;
+    static constexpr int NAME_LENGTH = 32;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t recordSize = 0;
+    uint32_t systemCount = 0;
+    char systemNames[MAX_SYSTEMS][NAME_LENGTH] = {};
+};
+
+struct FrameMetricsRecord {
+    uint64_t frameIndex = 0;
+    float frameTimeMs = 0.0f;      // Wall time of the whole frame (Timer)
+    float updateTimeMs = 0.0f;     // Sum of all system update times
+    uint32_t contacts = 0;         // Colliding pairs found by CollisionSystem
+    uint32_t drawCalls = 0;        // Draws issued by RenderSystem
+    uint32_t allocations = 0;      // Heap allocations during the frame
+    uint32_t eventQueueDepth = 0;  // Events queued before dispatch
+    uint32_t systemCount = 0;
+    uint32_t reserved = 0;
+    float systemTimeUs[MetricsFileHeader::MAX_SYSTEMS] = {};
+    uint32_t systemEntities[MetricsFileHeader::MAX_SYSTEMS] = {};
+};
+
+/**
+ * Per-frame metrics stream.
+ *
+ * Each frame the game loop calls recordFrame(), which samples the Timer, the
+ * per-system timings kept by SystemManager, the collision/render counters and
+ * the allocation counter into one fixed-size record and hands it to an
+ * AsyncRecordWriter. The game thread only fills a struct and copies it into a
+ * ring slot; all file I/O happens on the writer thread.
+ *
+ * Use convertToCsv() (or the MetricsToCsv tool) to turn a capture into a CSV
+ * with one row per frame.
+ */
+class MetricsRecorder {
+public:
+    /**
+     * Create a recorder for the systems currently registered with
+     * SystemManager. Call after GameWorld::initialize().
+     * @param outputPath Binary file to write
+     */
+    explicit MetricsRecorder(const std::string& outputPath);
+    ~MetricsRecorder();
+
+    /**
+     * @return true if the output file is open and records are being written
+     */
+    bool isRecording() const;
+
+    /**
+     * Remember how many events were queued this frame. Call before
+     * EventManager::update() drains the queue.
+     * @param depth Current EventManager queue size
+     */
+    void setEventQueueDepth(size_t depth) { eventQueueDepth_ = depth; }
+
+    /**
+     * Sample this frame's metrics and queue them for writing.
+     * Call once per frame after Timer::waitForFrameEnd().
+     * @param timer The engine's frame timer
+     */
+    void recordFrame(const Timer& timer);
+
+    /**
+     * Convert a binary metrics capture to CSV.
+     * @param binaryPath Capture written by MetricsRecorder
+     * @param csvPath CSV file to create
+     * @param error Receives a description of the failure (may be null)
+     * @return true on success
+     */
+    static bool convertToCsv(const std::string& binaryPath,
+                             const std::string& csvPath,
+                             std::string* error = nullptr);
+
+private:
+    AsyncRecordWriter writer_;
+    ecs::systems::CollisionSystem* collisionSystem_ = nullptr;
+    ecs::systems::RenderSystem* renderSystem_ = nullptr;
+    uint32_t systemCount_ = 0;
+    uint64_t frameIndex_ = 0;
+    uint64_t lastAllocationCount_ = 0;
+    size_t eventQueueDepth_ = 0;
+};
+
+} // namespace diagnostics
+} // namespace game
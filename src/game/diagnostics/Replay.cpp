@@ -0,0 +1,1071 @@
+#include "Replay.hpp"
+#include "../GameWorld.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/Random.hpp"
+#include "../ecs/SimulationLod.hpp"
+#include "../ecs/SystemManager.hpp"
+#include "../ecs/components/Bot.hpp"
+#include "../ecs/components/CollisionResult.hpp"
+#include "../ecs/components/Expirable.hpp"
+#include "../ecs/components/KeyboardInput.hpp"
+#include "../ecs/components/Projectile.hpp"
+#include "../ecs/components/Tags.hpp"
+#include "../ecs/components/Target.hpp"
+#include "../net/PlayerInput.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+namespace game {
+namespace diagnostics {
+
+namespace {
+
+using ecs::ComponentManager;
+using ecs::Entity;
+using ecs::SystemManager;
+using ecs::Vector2;
+namespace components = ecs::components;
+
+constexpr int INPUT_BITS = 5; // Width of net::PlayerInput
+
+// Components stored for an entity, in the order they are restored
+enum ComponentBit : uint32_t {
+  TRANSFORM = 1 << 0,
+  SPRITE = 1 << 1,
+  IMAGES = 1 << 2,
+  MOVEMENT = 1 << 3,
+  TARGET = 1 << 4,
+  PROJECTILE = 1 << 5,
+  COLLISION = 1 << 6,
+  COLLISION_RESULT = 1 << 7,
+  EXPIRABLE = 1 << 8,
+  PLAYER = 1 << 9,
+  KEYBOARD = 1 << 10,
+  BOT = 1 << 11
+};
+
+// Mask bit for a component the entity may lack
+uint32_t bitIf(const void *component, ComponentBit bit) {
+  return component ? static_cast<uint32_t>(bit) : 0u;
+}
+
+// Entities in a keyframe are named by their distance below
+// Entity::peekNextId(); 0 is the player
+constexpr uint64_t PLAYER_REF = 0;
+
+void putU8(std::vector<uint8_t> &out, uint8_t value) { out.push_back(value); }
+
+void putVarint(std::vector<uint8_t> &out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+void putSigned(std::vector<uint8_t> &out, int64_t value) {
+  putVarint(out, (static_cast<uint64_t>(value) << 1) ^
+                     static_cast<uint64_t>(value >> 63));
+}
+
+void putU64(std::vector<uint8_t> &out, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+// Floats are stored bit for bit; anything less would break determinism
+void putF32(std::vector<uint8_t> &out, float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+  }
+}
+
+void putF64(std::vector<uint8_t> &out, double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  putU64(out, bits);
+}
+
+void putBytes(std::vector<uint8_t> &out, const uint8_t *data, size_t size) {
+  putVarint(out, size);
+  out.insert(out.end(), data, data + size);
+}
+
+void putString(std::vector<uint8_t> &out, const std::string &value) {
+  putBytes(out, reinterpret_cast<const uint8_t *>(value.data()),
+           value.size());
+}
+
+// Bounds-checked reads; ok turns false at the first bad read
+struct Reader {
+  const uint8_t *data;
+  const uint8_t *end;
+  bool ok = true;
+
+  bool has(uint64_t count) {
+    ok = ok && static_cast<uint64_t>(end - data) >= count;
+    return ok;
+  }
+
+  uint8_t u8() { return has(1) ? *data++ : 0; }
+
+  uint64_t varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (!has(1)) {
+        return 0;
+      }
+      const uint8_t byte = *data++;
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+    ok = false;
+    return 0;
+  }
+
+  int64_t signedVarint() {
+    const uint64_t value = varint();
+    return static_cast<int64_t>((value >> 1) ^ (0 - (value & 1)));
+  }
+
+  uint64_t u64() {
+    if (!has(8)) {
+      return 0;
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+      value |= static_cast<uint64_t>(*data++) << (8 * i);
+    }
+    return value;
+  }
+
+  float f32() {
+    if (!has(4)) {
+      return 0.0f;
+    }
+    uint32_t bits = 0;
+    for (int i = 0; i < 4; ++i) {
+      bits |= static_cast<uint32_t>(*data++) << (8 * i);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  double f64() {
+    const uint64_t bits = u64();
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // Length-prefixed bytes; returns the start and advances past them
+  const uint8_t *bytes(size_t &size) {
+    const uint64_t length = varint();
+    if (!has(length)) {
+      size = 0;
+      return nullptr;
+    }
+    const uint8_t *start = data;
+    data += length;
+    size = static_cast<size_t>(length);
+    return start;
+  }
+
+  std::string string() {
+    size_t size = 0;
+    const uint8_t *start = bytes(size);
+    return start ? std::string(reinterpret_cast<const char *>(start), size)
+                 : std::string();
+  }
+};
+
+struct SavedCollision {
+  uint64_t a = 0, b = 0; // Entity refs
+  Vector2 point, normal;
+};
+
+// Everything stored for one entity; which parts are valid is in mask
+struct SavedEntity {
+  uint64_t ref = PLAYER_REF;
+  uint32_t mask = 0;
+  Vector2 position, scale;
+  float rotation = 0.0f;
+  float width = 0.0f, height = 0.0f;
+  SDL_Color color = {255, 255, 255, 255};
+  bool visible = true;
+  std::vector<std::string> images;
+  uint64_t imageIndex = 0;
+  Vector2 velocity, acceleration;
+  float maxSpeed = 0.0f;
+  bool movementEnabled = true;
+  int64_t pointValue = 0;
+  std::string targetType;
+  bool hit = false;
+  float speed = 0.0f, maxRange = 0.0f, traveledDistance = 0.0f;
+  std::string collisionType;
+  std::vector<SavedCollision> collisions;
+  bool expired = false;
+  double lastFired = 0.0;
+  uint8_t keys = 0;
+  float shotsPerSecond = 0.0f, aimTolerance = 0.0f, dangerRadius = 0.0f;
+  float wanderInterval = 0.0f;
+  bool restartRounds = true;
+  uint8_t botKeys = 0;
+  float fireCooldown = 0.0f, wanderTimer = 0.0f;
+  Vector2 wanderDirection;
+  std::vector<std::pair<uint64_t, float>> lodPending; // System index, time
+};
+
+struct SavedWorld {
+  double clock = 0.0;
+  uint64_t lodPhase = 0; // LOD frame + next entity ID
+  nlohmann::json random;
+  uint8_t roundState = 0;
+  int64_t score = 0, targetsHit = 0, shotsFired = 0, highScore = 0;
+  float timeRemaining = 0.0f;
+  double gameStartTime = 0.0, lastTargetSpawn = 0.0;
+  bool hasPlayer = false;
+  SavedEntity player;
+  uint64_t idSpan = 0; // Largest ref, so the IDs to reserve
+  std::vector<SavedEntity> entities;
+};
+
+bool isDynamic(ComponentManager &cm, Entity::ID id) {
+  return cm.getComponent<components::Target>(id) ||
+         cm.getComponent<components::Projectile>(id);
+}
+
+Entity findPlayer(ComponentManager &cm) {
+  Entity player;
+  bool found = false;
+  cm.forEachComponent<components::Player>(
+      [&](Entity::ID, components::Player &component) {
+        if (!found) {
+          player = component.getEntity();
+          found = true;
+        }
+      });
+  return player;
+}
+
+uint8_t readInput(ComponentManager &cm, const Entity &player) {
+  auto *keyboard = cm.getComponent<components::KeyboardInput>(player);
+  return keyboard ? net::readPlayerInput(*keyboard) : 0;
+}
+
+void writeEntity(std::vector<uint8_t> &out, const Entity &entity, uint64_t ref,
+                 Entity::ID nextId, Entity::ID playerId) {
+  auto &cm = ComponentManager::getInstance();
+  const Entity::ID id = entity.getId();
+  auto *transform = cm.getComponent<components::Transform>(id);
+  auto *sprite = cm.getComponent<components::Sprite>(id);
+  auto *images = cm.getComponent<components::Images>(id);
+  auto *movement = cm.getComponent<components::Movement>(id);
+  auto *target = cm.getComponent<components::Target>(id);
+  auto *projectile = cm.getComponent<components::Projectile>(id);
+  auto *collision = cm.getComponent<components::Collision>(id);
+  auto *collisionResult = cm.getComponent<components::CollisionResult>(id);
+  auto *expirable = cm.getComponent<components::Expirable>(id);
+  auto *player = cm.getComponent<components::Player>(id);
+  auto *keyboard = cm.getComponent<components::KeyboardInput>(id);
+  auto *bot = cm.getComponent<components::Bot>(id);
+
+  uint32_t mask = 0;
+  mask |= bitIf(transform, TRANSFORM);
+  mask |= bitIf(sprite, SPRITE);
+  mask |= bitIf(images, IMAGES);
+  mask |= bitIf(movement, MOVEMENT);
+  mask |= bitIf(target, TARGET);
+  mask |= bitIf(projectile, PROJECTILE);
+  mask |= bitIf(collision, COLLISION);
+  mask |= bitIf(collisionResult, COLLISION_RESULT);
+  mask |= bitIf(expirable, EXPIRABLE);
+  mask |= bitIf(player, PLAYER);
+  mask |= bitIf(keyboard, KEYBOARD);
+  mask |= bitIf(bot, BOT);
+
+  // Names are left out: duck names carry the wall clock
+  putVarint(out, ref);
+  putVarint(out, mask);
+  if (transform) {
+    putF32(out, transform->getPosition().x);
+    putF32(out, transform->getPosition().y);
+    putF32(out, transform->getRotation());
+    putF32(out, transform->getScale().x);
+    putF32(out, transform->getScale().y);
+  }
+  if (sprite) {
+    putF32(out, sprite->getWidth());
+    putF32(out, sprite->getHeight());
+    const SDL_Color &color = sprite->getColor();
+    for (uint8_t channel : {color.r, color.g, color.b, color.a}) {
+      putU8(out, channel);
+    }
+    putU8(out, sprite->isVisible() ? 1 : 0);
+  }
+  if (images) {
+    putVarint(out, images->getImageNames().size());
+    for (const std::string &name : images->getImageNames()) {
+      putString(out, name);
+    }
+    putVarint(out, images->getCurrentIndex());
+  }
+  if (movement) {
+    putF32(out, movement->getVelocity().x);
+    putF32(out, movement->getVelocity().y);
+    putF32(out, movement->getAcceleration().x);
+    putF32(out, movement->getAcceleration().y);
+    putF32(out, movement->getMaxSpeed());
+    putU8(out, movement->isEnabled() ? 1 : 0);
+  }
+  if (target) {
+    putSigned(out, target->getPointValue());
+    putString(out, target->getTargetType());
+    putU8(out, target->isHitTarget() ? 1 : 0);
+  }
+  if (projectile) {
+    putF32(out, projectile->getSpeed());
+    putF32(out, projectile->getMaxRange());
+    putF32(out, projectile->getTraveledDistance());
+  }
+  if (collision) {
+    putString(out, collision->getType());
+  }
+  if (collisionResult) {
+    // Collisions with entities that are neither stored nor the player
+    // cannot be restored and are left out
+    auto refOf = [&](const Entity &other, uint64_t &otherRef) {
+      if (other.getId() == playerId) {
+        otherRef = PLAYER_REF;
+        return true;
+      }
+      otherRef = nextId - other.getId();
+      return other.getId() < nextId && isDynamic(cm, other.getId());
+    };
+    std::vector<SavedCollision> kept;
+    for (const auto &data : collisionResult->getCollisions()) {
+      SavedCollision saved;
+      if (refOf(data.entityA, saved.a) && refOf(data.entityB, saved.b)) {
+        saved.point = data.collisionPoint;
+        saved.normal = data.collisionNormal;
+        kept.push_back(saved);
+      }
+    }
+    putVarint(out, kept.size());
+    for (const SavedCollision &saved : kept) {
+      putVarint(out, saved.a);
+      putVarint(out, saved.b);
+      putF32(out, saved.point.x);
+      putF32(out, saved.point.y);
+      putF32(out, saved.normal.x);
+      putF32(out, saved.normal.y);
+    }
+  }
+  if (expirable) {
+    putU8(out, expirable->isExpired() ? 1 : 0);
+  }
+  if (player) {
+    putF64(out, player->getLastFired());
+  }
+  if (keyboard) {
+    putU8(out, net::readPlayerInput(*keyboard));
+  }
+  if (bot) {
+    putF32(out, bot->getShotsPerSecond());
+    putF32(out, bot->getAimTolerance());
+    putF32(out, bot->getDangerRadius());
+    putF32(out, bot->getWanderInterval());
+    putU8(out, bot->getRestartRounds() ? 1 : 0);
+    putU8(out, bot->getHeldKeys());
+    putF32(out, bot->getFireCooldown());
+    putF32(out, bot->getWanderTimer());
+    putF32(out, bot->getWanderDirection().x);
+    putF32(out, bot->getWanderDirection().y);
+  }
+
+  // Time skipped while far from the view, per system (by index)
+  const auto &systems = SystemManager::getInstance().getSystems();
+  size_t pendingCount = 0;
+  for (const auto &system : systems) {
+    pendingCount += system->getLodPendingTime(id) != 0.0f ? 1 : 0;
+  }
+  putVarint(out, pendingCount);
+  for (size_t i = 0; i < systems.size(); ++i) {
+    const float pending = systems[i]->getLodPendingTime(id);
+    if (pending != 0.0f) {
+      putVarint(out, i);
+      putF32(out, pending);
+    }
+  }
+}
+
+bool readEntity(Reader &in, SavedEntity &entity) {
+  entity.ref = in.varint();
+  entity.mask = static_cast<uint32_t>(in.varint());
+  if (entity.mask & TRANSFORM) {
+    entity.position.x = in.f32();
+    entity.position.y = in.f32();
+    entity.rotation = in.f32();
+    entity.scale.x = in.f32();
+    entity.scale.y = in.f32();
+  }
+  if (entity.mask & SPRITE) {
+    entity.width = in.f32();
+    entity.height = in.f32();
+    entity.color.r = in.u8();
+    entity.color.g = in.u8();
+    entity.color.b = in.u8();
+    entity.color.a = in.u8();
+    entity.visible = in.u8() != 0;
+  }
+  if (entity.mask & IMAGES) {
+    const uint64_t count = in.varint();
+    for (uint64_t i = 0; i < count && in.ok; ++i) {
+      entity.images.push_back(in.string());
+    }
+    entity.imageIndex = in.varint();
+  }
+  if (entity.mask & MOVEMENT) {
+    entity.velocity.x = in.f32();
+    entity.velocity.y = in.f32();
+    entity.acceleration.x = in.f32();
+    entity.acceleration.y = in.f32();
+    entity.maxSpeed = in.f32();
+    entity.movementEnabled = in.u8() != 0;
+  }
+  if (entity.mask & TARGET) {
+    entity.pointValue = in.signedVarint();
+    entity.targetType = in.string();
+    entity.hit = in.u8() != 0;
+  }
+  if (entity.mask & PROJECTILE) {
+    entity.speed = in.f32();
+    entity.maxRange = in.f32();
+    entity.traveledDistance = in.f32();
+  }
+  if (entity.mask & COLLISION) {
+    entity.collisionType = in.string();
+  }
+  if (entity.mask & COLLISION_RESULT) {
+    const uint64_t count = in.varint();
+    for (uint64_t i = 0; i < count && in.ok; ++i) {
+      SavedCollision saved;
+      saved.a = in.varint();
+      saved.b = in.varint();
+      saved.point.x = in.f32();
+      saved.point.y = in.f32();
+      saved.normal.x = in.f32();
+      saved.normal.y = in.f32();
+      entity.collisions.push_back(saved);
+    }
+  }
+  if (entity.mask & EXPIRABLE) {
+    entity.expired = in.u8() != 0;
+  }
+  if (entity.mask & PLAYER) {
+    entity.lastFired = in.f64();
+  }
+  if (entity.mask & KEYBOARD) {
+    entity.keys = in.u8();
+  }
+  if (entity.mask & BOT) {
+    entity.shotsPerSecond = in.f32();
+    entity.aimTolerance = in.f32();
+    entity.dangerRadius = in.f32();
+    entity.wanderInterval = in.f32();
+    entity.restartRounds = in.u8() != 0;
+    entity.botKeys = in.u8();
+    entity.fireCooldown = in.f32();
+    entity.wanderTimer = in.f32();
+    entity.wanderDirection.x = in.f32();
+    entity.wanderDirection.y = in.f32();
+  }
+  const uint64_t pendingCount = in.varint();
+  for (uint64_t i = 0; i < pendingCount && in.ok; ++i) {
+    const uint64_t system = in.varint();
+    entity.lodPending.emplace_back(system, in.f32());
+  }
+  return in.ok;
+}
+
+bool readWorld(const uint8_t *data, size_t size, SavedWorld &world) {
+  Reader in{data, data + size};
+  world.clock = in.f64();
+  world.lodPhase = in.u64();
+  size_t randomSize = 0;
+  const uint8_t *random = in.bytes(randomSize);
+  if (!random) {
+    return false;
+  }
+  world.random = nlohmann::json::from_cbor(random, random + randomSize,
+                                           true, false);
+  if (world.random.is_discarded()) {
+    return false;
+  }
+  world.roundState = in.u8();
+  world.score = in.signedVarint();
+  world.targetsHit = in.signedVarint();
+  world.shotsFired = in.signedVarint();
+  world.highScore = in.signedVarint();
+  world.timeRemaining = in.f32();
+  world.gameStartTime = in.f64();
+  world.lastTargetSpawn = in.f64();
+  world.hasPlayer = in.u8() != 0;
+  if (world.hasPlayer && !readEntity(in, world.player)) {
+    return false;
+  }
+  const uint64_t count = in.varint();
+  for (uint64_t i = 0; i < count && in.ok; ++i) {
+    world.entities.emplace_back();
+    SavedEntity &entity = world.entities.back();
+    if (!readEntity(in, entity) || entity.ref == PLAYER_REF) {
+      return false;
+    }
+    world.idSpan = std::max(world.idSpan, entity.ref);
+  }
+  return in.ok && in.data == in.end;
+}
+
+template <typename T, typename... Args>
+T &addComponent(const Entity &entity, Args &&...args) {
+  auto &cm = ComponentManager::getInstance();
+  cm.addComponent<T>(entity, std::forward<Args>(args)...);
+  return *cm.getComponent<T>(entity);
+}
+
+void setTransform(components::Transform &transform,
+                  const SavedEntity &saved) {
+  transform.setPosition(saved.position);
+  transform.setRotation(saved.rotation);
+  transform.setScale(saved.scale);
+}
+
+void setMovement(components::Movement &movement, const SavedEntity &saved) {
+  movement.setEnabled(saved.movementEnabled);
+  movement.setAcceleration(saved.acceleration);
+  movement.setMaxSpeed(saved.maxSpeed);
+  movement.setVelocity(saved.velocity);
+}
+
+// A duck or projectile, created the way TargetSpawnSystem and
+// ProjectileSystem build them
+void createEntity(const Entity &entity, const SavedEntity &saved) {
+  SystemManager::getInstance().onEntityCreated(entity);
+  ComponentManager::Batch batch(ComponentManager::getInstance());
+  if (saved.mask & TRANSFORM) {
+    setTransform(addComponent<components::Transform>(entity), saved);
+  }
+  if (saved.mask & SPRITE) {
+    auto &sprite = addComponent<components::Sprite>(entity, saved.width,
+                                                    saved.height, saved.color);
+    sprite.setVisible(saved.visible);
+  }
+  if (saved.mask & IMAGES) {
+    addComponent<components::Images>(entity, saved.images)
+        .setCurrentImage(saved.imageIndex);
+  }
+  if (saved.mask & MOVEMENT) {
+    setMovement(addComponent<components::Movement>(entity), saved);
+  }
+  if (saved.mask & TARGET) {
+    addComponent<components::Target>(entity,
+                                     static_cast<int>(saved.pointValue),
+                                     saved.targetType, saved.hit);
+    if (saved.targetType == "boss") {
+      ComponentManager::getInstance().addTag<components::BossTarget>(entity);
+    }
+  }
+  if (saved.mask & PROJECTILE) {
+    addComponent<components::Projectile>(entity, saved.speed, saved.maxRange,
+                                         saved.traveledDistance);
+  }
+  if (saved.mask & COLLISION) {
+    addComponent<components::Collision>(entity).setType(saved.collisionType);
+  }
+  if (saved.mask & COLLISION_RESULT) {
+    addComponent<components::CollisionResult>(entity);
+  }
+  if (saved.mask & EXPIRABLE) {
+    addComponent<components::Expirable>(entity).isExpiredFlag = saved.expired;
+  }
+}
+
+void restorePlayer(GameWorld &world, const Entity &entity,
+                   const SavedEntity &saved) {
+  auto &cm = ComponentManager::getInstance();
+  if (auto *transform = cm.getComponent<components::Transform>(entity)) {
+    if (saved.mask & TRANSFORM) {
+      setTransform(*transform, saved);
+    }
+  }
+  if (auto *movement = cm.getComponent<components::Movement>(entity)) {
+    if (saved.mask & MOVEMENT) {
+      setMovement(*movement, saved);
+    }
+  }
+  if (auto *player = cm.getComponent<components::Player>(entity)) {
+    player->lastFired = saved.lastFired;
+  }
+
+  // Bot first: detaching one releases its keys
+  auto *bot = cm.getComponent<components::Bot>(entity);
+  if ((saved.mask & BOT) && !bot) {
+    world.enableBot();
+    bot = cm.getComponent<components::Bot>(entity);
+  } else if (!(saved.mask & BOT) && bot) {
+    world.disableBot();
+    bot = nullptr;
+  }
+  if (bot) {
+    bot->setShotsPerSecond(saved.shotsPerSecond);
+    bot->setAimTolerance(saved.aimTolerance);
+    bot->setDangerRadius(saved.dangerRadius);
+    bot->setWanderInterval(saved.wanderInterval);
+    bot->setRestartRounds(saved.restartRounds);
+    bot->setHeldKeys(saved.botKeys);
+    bot->setFireCooldown(saved.fireCooldown);
+    bot->setWanderTimer(saved.wanderTimer);
+    bot->setWanderDirection(saved.wanderDirection);
+  }
+  if (saved.mask & KEYBOARD) {
+    auto &keyboard = net::ensureKeyboardInput(entity);
+    net::applyPlayerInput(net::readPlayerInput(keyboard), saved.keys,
+                          keyboard);
+  }
+  // CollisionSystem adds this on the first hit, so match the capture
+  const bool hasResult =
+      cm.getComponent<components::CollisionResult>(entity) != nullptr;
+  if ((saved.mask & COLLISION_RESULT) && !hasResult) {
+    addComponent<components::CollisionResult>(entity);
+  } else if (!(saved.mask & COLLISION_RESULT) && hasResult) {
+    cm.removeComponent<components::CollisionResult>(entity);
+  }
+}
+
+} // namespace
+
+void captureKeyframe(std::vector<uint8_t> &out) {
+  auto &cm = ComponentManager::getInstance();
+  GameWorld &world = GameWorld::getInstance();
+  const Entity::ID nextId = Entity::peekNextId();
+
+  putF64(out, world.getGameTimer().getClock());
+  putU64(out, ecs::SimulationLod::getInstance().getFrame() + nextId);
+  const std::vector<uint8_t> random =
+      nlohmann::json::to_cbor(ecs::RandomService::getInstance().saveState());
+  putBytes(out, random.data(), random.size());
+
+  if (components::ShootingGalleryState::hasInstance()) {
+    const auto &round = components::ShootingGalleryState::getInstance();
+    putU8(out, static_cast<uint8_t>(round.state));
+    putSigned(out, round.score);
+    putSigned(out, round.targetsHit);
+    putSigned(out, round.shotsFired);
+    putSigned(out, round.highScore);
+    putF32(out, round.timeRemaining);
+    putF64(out, round.gameStartTime);
+    putF64(out, round.lastTargetSpawn);
+  } else {
+    putU8(out, static_cast<uint8_t>(components::GameState::MENU));
+    for (int i = 0; i < 4; ++i) {
+      putSigned(out, 0);
+    }
+    putF32(out, 0.0f);
+    putF64(out, 0.0);
+    putF64(out, 0.0);
+  }
+
+  const Entity player = findPlayer(cm);
+  const bool hasPlayer = cm.getComponent<components::Player>(player);
+  putU8(out, hasPlayer ? 1 : 0);
+  if (hasPlayer) {
+    writeEntity(out, player, PLAYER_REF, nextId, player.getId());
+  }
+
+  // Ducks and projectiles oldest first, the order systems saw them created
+  std::vector<Entity> dynamic;
+  auto collect = [&](Entity::ID id, const ecs::Component &component) {
+    if (id < nextId && (dynamic.empty() || dynamic.back().getId() != id)) {
+      dynamic.push_back(component.getEntity());
+    }
+  };
+  cm.forEachComponent<components::Target>(collect);
+  cm.forEachComponent<components::Projectile>(collect);
+  std::sort(dynamic.begin(), dynamic.end());
+  dynamic.erase(std::unique(dynamic.begin(), dynamic.end()), dynamic.end());
+  putVarint(out, dynamic.size());
+  for (const Entity &entity : dynamic) {
+    writeEntity(out, entity, nextId - entity.getId(), nextId,
+                hasPlayer ? player.getId() : nextId);
+  }
+}
+
+bool restoreKeyframe(const uint8_t *data, size_t size) {
+  SavedWorld saved;
+  if (!readWorld(data, size, saved) || !saved.hasPlayer ||
+      !ecs::RandomService::isValidState(saved.random)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[Replay] Malformed keyframe (%zu bytes)", size);
+    return false;
+  }
+  auto &cm = ComponentManager::getInstance();
+  auto &sm = SystemManager::getInstance();
+  GameWorld &world = GameWorld::getInstance();
+  const Entity player = findPlayer(cm);
+  if (!cm.getComponent<components::Player>(player)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[Replay] World has no player to restore");
+    return false;
+  }
+
+  std::vector<Entity> dynamic;
+  auto collect = [&](Entity::ID, const ecs::Component &component) {
+    dynamic.push_back(component.getEntity());
+  };
+  cm.forEachComponent<components::Target>(collect);
+  cm.forEachComponent<components::Projectile>(collect);
+  std::sort(dynamic.begin(), dynamic.end());
+  dynamic.erase(std::unique(dynamic.begin(), dynamic.end()), dynamic.end());
+  for (const Entity &entity : dynamic) {
+    sm.onEntityDestroyed(entity);
+    cm.removeAllComponents(entity);
+  }
+
+  // Fresh IDs at the same distances below the next ID as in the capture
+  const Entity::ID first = Entity::reserveIds(saved.idSpan);
+  const Entity::ID nextId = first + saved.idSpan;
+  auto entityOf = [&](uint64_t ref) {
+    return ref == PLAYER_REF ? player : Entity::withId(nextId - ref);
+  };
+  for (const SavedEntity &entity : saved.entities) {
+    const char *name = (entity.mask & PROJECTILE) ? "projectile" : "pawn";
+    createEntity(Entity::withId(nextId - entity.ref, name), entity);
+  }
+  restorePlayer(world, player, saved.player);
+
+  // Collisions and skipped time once every entity exists again
+  const auto &systems = sm.getSystems();
+  auto restoreLinks = [&](const Entity &entity, const SavedEntity &from) {
+    if (auto *result = cm.getComponent<components::CollisionResult>(entity)) {
+      result->clearCollisions();
+      for (const SavedCollision &collision : from.collisions) {
+        result->addCollision(entityOf(collision.a), entityOf(collision.b),
+                             collision.point, collision.normal);
+      }
+    }
+    for (const auto &[system, time] : from.lodPending) {
+      if (system < systems.size()) {
+        systems[system]->setLodPendingTime(entity.getId(), time);
+      }
+    }
+  };
+  restoreLinks(player, saved.player);
+  for (const SavedEntity &entity : saved.entities) {
+    restoreLinks(entityOf(entity.ref), entity);
+  }
+
+  world.getGameTimer().setClock(saved.clock);
+  if (!ecs::RandomService::getInstance().loadState(saved.random)) {
+    return false; // Not reached: isValidState() passed above
+  }
+  ecs::SimulationLod::getInstance().setFrame(saved.lodPhase - nextId);
+  if (components::ShootingGalleryState::hasInstance()) {
+    auto &round = components::ShootingGalleryState::getInstance();
+    round.state = static_cast<components::GameState>(saved.roundState);
+    round.score = static_cast<int>(saved.score);
+    round.targetsHit = static_cast<int>(saved.targetsHit);
+    round.shotsFired = static_cast<int>(saved.shotsFired);
+    round.highScore = static_cast<int>(saved.highScore);
+    round.timeRemaining = saved.timeRemaining;
+    round.gameStartTime = saved.gameStartTime;
+    round.lastTargetSpawn = saved.lastTargetSpawn;
+  }
+  // GameStateSystem follows the round again on its next update
+  if (auto *gameState = sm.getSystem<ecs::systems::GameStateSystem>()) {
+    gameState->reset();
+  }
+  // Publish the restored view to the LOD before the next update reads it
+  if (auto *camera = sm.getSystem<ecs::systems::CameraSystem>()) {
+    camera->publishViewport();
+  }
+  return true;
+}
+
+ReplayRecorder::ReplayRecorder(const std::string &path, float tickSeconds,
+                               const Config &config)
+    : config_(config) {
+  config_.keyframeInterval = std::max<uint32_t>(1, config_.keyframeInterval);
+  file_ = std::fopen(path.c_str(), "wb");
+  if (!file_) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[ReplayRecorder] Could not open %s", path.c_str());
+    return;
+  }
+  ReplayFileHeader header;
+  header.tickSeconds = tickSeconds;
+  header.keyframeInterval = config_.keyframeInterval;
+  if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[ReplayRecorder] Could not write %s", path.c_str());
+    std::fclose(file_);
+    file_ = nullptr;
+    return;
+  }
+  bytesWritten_ = sizeof(header);
+  beginSegment();
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[ReplayRecorder] Recording to %s (keyframe every %u ticks)",
+              path.c_str(), config_.keyframeInterval);
+}
+
+ReplayRecorder::~ReplayRecorder() { close(); }
+
+void ReplayRecorder::beginSegment() {
+  segmentStart_ = tick_;
+  lastChange_ = tick_;
+  auto &cm = ComponentManager::getInstance();
+  input_ = readInput(cm, findPlayer(cm));
+  startInput_ = input_;
+  keyframe_.clear();
+  changes_.clear();
+  captureKeyframe(keyframe_);
+  ++keyframeCount_;
+}
+
+void ReplayRecorder::recordTick() {
+  if (!file_) {
+    return;
+  }
+  ++tick_;
+  auto &cm = ComponentManager::getInstance();
+  const uint8_t input = readInput(cm, findPlayer(cm));
+  if (input != input_) {
+    const uint64_t run = tick_ - lastChange_ - 1;
+    putVarint(changes_, (run << INPUT_BITS) | (input ^ input_));
+    input_ = input;
+    lastChange_ = tick_;
+  }
+  if (tick_ - segmentStart_ >= config_.keyframeInterval) {
+    writeSegment();
+    beginSegment();
+  }
+}
+
+void ReplayRecorder::writeSegment() {
+  std::vector<uint8_t> &body = segment_;
+  body.clear();
+  putVarint(body, segmentStart_);
+  putVarint(body, tick_ - segmentStart_);
+  putU8(body, startInput_);
+  putBytes(body, keyframe_.data(), keyframe_.size());
+  body.insert(body.end(), changes_.begin(), changes_.end());
+
+  std::vector<uint8_t> size;
+  putVarint(size, body.size());
+  if (std::fwrite(size.data(), 1, size.size(), file_) != size.size() ||
+      std::fwrite(body.data(), 1, body.size(), file_) != body.size()) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[ReplayRecorder] Write failed at tick %u; recording stopped",
+                 tick_);
+    std::fclose(file_);
+    file_ = nullptr;
+    return;
+  }
+  bytesWritten_ += size.size() + body.size();
+}
+
+void ReplayRecorder::close() {
+  if (!file_) {
+    return;
+  }
+  writeSegment();
+  if (file_) {
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[ReplayRecorder] Recorded %u ticks, %zu keyframes, %llu bytes",
+              tick_, keyframeCount_,
+              static_cast<unsigned long long>(bytesWritten_));
+}
+
+bool ReplayPlayer::open(const std::string &path) {
+  data_.clear();
+  segments_.clear();
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[ReplayPlayer] Could not open %s", path.c_str());
+    return false;
+  }
+  data_.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+  if (data_.size() < sizeof(header_)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[ReplayPlayer] %s is too short", path.c_str());
+    return false;
+  }
+  std::memcpy(&header_, data_.data(), sizeof(header_));
+  if (header_.magic != ReplayFileHeader::MAGIC ||
+      header_.version != ReplayFileHeader::VERSION ||
+      !(header_.tickSeconds > 0.0f)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                 "[ReplayPlayer] %s is not a version %u replay", path.c_str(),
+                 ReplayFileHeader::VERSION);
+    return false;
+  }
+  if (!parseSegments() || !enterSegment(0, true)) {
+    segments_.clear();
+    return false;
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[ReplayPlayer] %s: %u ticks, %zu keyframes, %.1f KB per minute",
+              path.c_str(), getTickCount(), segments_.size(),
+              getBytesPerMinute() / 1024.0);
+  return true;
+}
+
+bool ReplayPlayer::parseSegments() {
+  Reader in{data_.data() + sizeof(header_), data_.data() + data_.size()};
+  uint32_t expectedTick = 0;
+  while (in.ok && in.data < in.end) {
+    size_t size = 0;
+    const uint8_t *body = in.bytes(size);
+    if (!body) {
+      break; // Cut short, e.g. by a crash while recording
+    }
+    Reader segmentIn{body, body + size};
+    Segment segment;
+    segment.firstTick = static_cast<uint32_t>(segmentIn.varint());
+    segment.tickCount = static_cast<uint32_t>(segmentIn.varint());
+    segment.startInput = segmentIn.u8();
+    size_t keyframeSize = 0;
+    const uint8_t *keyframe = segmentIn.bytes(keyframeSize);
+    if (!segmentIn.ok || !keyframe || segment.firstTick != expectedTick) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                   "[ReplayPlayer] Bad segment at tick %u", expectedTick);
+      return false;
+    }
+    segment.keyframeOffset = keyframe - data_.data();
+    segment.keyframeSize = keyframeSize;
+    segment.inputOffset = segmentIn.data - data_.data();
+    segment.inputSize = segmentIn.end - segmentIn.data;
+    segments_.push_back(segment);
+    expectedTick = segment.firstTick + segment.tickCount;
+  }
+  return !segments_.empty();
+}
+
+bool ReplayPlayer::enterSegment(size_t index, bool restore) {
+  const Segment &segment = segments_[index];
+  if (restore) {
+    if (!restoreKeyframe(data_.data() + segment.keyframeOffset,
+                         segment.keyframeSize)) {
+      return false;
+    }
+    tick_ = segment.firstTick;
+  }
+  segment_ = index;
+  input_ = segment.startInput;
+
+  // Expand the input changes to one byte per tick
+  inputs_.assign(segment.tickCount, segment.startInput);
+  Reader in{data_.data() + segment.inputOffset,
+            data_.data() + segment.inputOffset + segment.inputSize};
+  uint8_t input = segment.startInput;
+  uint64_t at = 0;
+  while (in.ok && in.data < in.end) {
+    const uint64_t change = in.varint();
+    at += change >> INPUT_BITS;
+    if (at >= inputs_.size()) {
+      break;
+    }
+    input ^= static_cast<uint8_t>(change & net::INPUT_ALL);
+    std::fill(inputs_.begin() + at, inputs_.end(), input);
+    ++at;
+  }
+  return true;
+}
+
+bool ReplayPlayer::seek(uint32_t tick) {
+  if (segments_.empty()) {
+    return false;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  tick = std::min(tick, getTickCount());
+
+  // Last segment starting at or before the tick
+  size_t index = segments_.size() - 1;
+  while (index > 0 && segments_[index].firstTick > tick) {
+    --index;
+  }
+  // Restore unless the world is already in that segment, before the tick
+  const bool simulateOn = index == segment_ && tick_ <= tick &&
+                          tick_ >= segments_[index].firstTick;
+  if (!simulateOn && !enterSegment(index, true)) {
+    return false;
+  }
+
+  const uint32_t from = tick_;
+  while (tick_ < tick && step(false)) {
+  }
+
+  const double elapsedMs = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+  ++stats_.seeks;
+  stats_.lastSeekMs = elapsedMs;
+  stats_.worstSeekMs = std::max(stats_.worstSeekMs, elapsedMs);
+  stats_.lastSeekTicks = tick_ - from;
+  stats_.worstSeekTicks = std::max(stats_.worstSeekTicks, tick_ - from);
+  return true;
+}
+
+bool ReplayPlayer::step(bool draw) {
+  if (segments_.empty() || tick_ >= getTickCount()) {
+    return false;
+  }
+  const Segment *segment = &segments_[segment_];
+  if (tick_ >= segment->firstTick + segment->tickCount) {
+    enterSegment(segment_ + 1, false);
+    segment = &segments_[segment_];
+  }
+
+  auto &cm = ComponentManager::getInstance();
+  const Entity player = findPlayer(cm);
+  const uint8_t input = inputs_[tick_ - segment->firstTick];
+  if (cm.getComponent<components::Player>(player)) {
+    auto &keyboard = net::ensureKeyboardInput(player);
+    net::applyPlayerInput(net::readPlayerInput(keyboard), input, keyboard);
+  }
+  input_ = input;
+  GameWorld::getInstance().update(header_.tickSeconds, draw);
+  ++tick_;
+  return true;
+}
+
+uint32_t ReplayPlayer::getTickCount() const {
+  if (segments_.empty()) {
+    return 0;
+  }
+  return segments_.back().firstTick + segments_.back().tickCount;
+}
+
+double ReplayPlayer::getBytesPerMinute() const {
+  const double minutes = getTickCount() * header_.tickSeconds / 60.0;
+  return minutes > 0.0 ? data_.size() / minutes : 0.0;
+}
+
+} // namespace diagnostics
+} // namespace game
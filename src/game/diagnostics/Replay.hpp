@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace game {
+namespace diagnostics {
+
+/**
+ * Binary layout of a replay file (varints are LEB128):
+ *   ReplayFileHeader, then one segment per keyframe interval:
+ *     varint size of the rest of the segment
+ *     varint first tick, varint tick count, u8 input held at the first tick
+ *     varint keyframe size, keyframe (see captureKeyframe())
+ *     one varint per input change in the segment:
+ *       (ticks since the previous change << 5) | (input bits that flipped)
+ *
+ * Tick n is the state after n world updates, so a segment's keyframe is the
+ * world at its first tick and its input covers the ticks that follow.
+ * Held keys and idle stretches cost nothing; a minute of play is dominated
+ * by its keyframes. Segments are self-delimiting, so a file cut short by a
+ * crash still plays up to its last complete segment.
+ *
+ * The header is written as-is, so files are only portable between machines
+ * with the same endianness (the player checks the magic).
+ */
+struct ReplayFileHeader {
+    static constexpr uint32_t MAGIC = 0x4C505244; // "DRPL" little-endian
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    float tickSeconds = 0.0f;      // Length of every recorded world update
+    uint32_t keyframeInterval = 0; // Ticks between keyframes
+};
+
+/**
+ * Append the simulation state of the bound world to out: every duck and
+ * projectile with all of its components, the player (position, fire
+ * cooldown, held keys, bot), collisions not yet handled, the round, the game
+ * clock, the random streams and the simulation LOD phase.
+ *
+ * Entity IDs are stored relative to Entity::peekNextId(), so a keyframe can
+ * be restored in another process and entities spawned after it line up with
+ * the recording (the LOD stagger depends on IDs). That holds while the world
+ * is the only one creating entities. Scenery, tweens and audio are not
+ * stored. Tweens could move a collision box or turn the player, so
+ * GameWorld only lets GameData tween the alpha of entities that collide,
+ * move or are steered; the rest does not feed back into the simulation.
+ */
+void captureKeyframe(std::vector<uint8_t>& out);
+
+/**
+ * Replace the bound world's simulation state with a captured one. Ducks and
+ * projectiles are destroyed and recreated; everything else is written over.
+ * The world must have been loaded from the same GameData as the capture.
+ * @return false if the data is malformed or the world has no player;
+ *         nothing is changed then
+ */
+bool restoreKeyframe(const uint8_t* data, size_t size);
+
+/**
+ * ReplayRecorder - writes the bound world's session to a replay file.
+ *
+ * Create it once the world is initialized, before the first update to
+ * record (that state is the first keyframe), and call recordTick() after
+ * every world update. Every keyframeInterval ticks the finished segment is
+ * written out and a new keyframe taken; a keyframe costs one pass over the
+ * ducks and projectiles, input costs a few bits per tick.
+ */
+class ReplayRecorder {
+public:
+    struct Config {
+        uint32_t keyframeInterval = 600; // 10 s at 60 Hz
+    };
+
+    /**
+     * @param path Output file (truncated if it exists)
+     * @param tickSeconds Length of every world update that will be recorded
+     */
+    ReplayRecorder(const std::string& path, float tickSeconds, const Config& config);
+    ReplayRecorder(const std::string& path, float tickSeconds)
+        : ReplayRecorder(path, tickSeconds, Config()) {}
+
+    /**
+     * Writes the open segment (see close()).
+     */
+    ~ReplayRecorder();
+
+    ReplayRecorder(const ReplayRecorder&) = delete;
+    ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+    bool isRecording() const { return file_ != nullptr; }
+
+    /**
+     * Record the input of the update just taken.
+     */
+    void recordTick();
+
+    /**
+     * Write the open segment and close the file.
+     */
+    void close();
+
+    uint32_t getTickCount() const { return tick_; }
+    size_t getKeyframeCount() const { return keyframeCount_; }
+    uint64_t getBytesWritten() const { return bytesWritten_; }
+
+private:
+    void beginSegment();
+    void writeSegment();
+
+    std::FILE* file_ = nullptr;
+    Config config_;
+    uint32_t tick_ = 0;
+    uint32_t segmentStart_ = 0;
+    uint32_t lastChange_ = 0; // Tick of the last input change in the segment
+    uint8_t startInput_ = 0;  // Held at segmentStart_
+    uint8_t input_ = 0;       // Held at tick_
+    std::vector<uint8_t> keyframe_;
+    std::vector<uint8_t> changes_;
+    std::vector<uint8_t> segment_; // Reused by writeSegment()
+    size_t keyframeCount_ = 0;
+    uint64_t bytesWritten_ = 0;
+};
+
+/**
+ * ReplayPlayer - plays a replay file back into the bound world.
+ *
+ * open() reads the whole file and indexes its segments. seek() restores the
+ * last keyframe at or before the tick and fast-simulates the remaining
+ * ticks without drawing (a short seek forward within the current segment
+ * just simulates on). step() applies the next tick's recorded input and
+ * updates the world.
+ *
+ * A recorded bot is restored with its keyframe and plays again, which
+ * replays the rounds it restarted; its key presses match the recorded input.
+ */
+class ReplayPlayer {
+public:
+    struct Stats {
+        uint64_t seeks = 0;
+        double lastSeekMs = 0.0;
+        double worstSeekMs = 0.0;
+        uint32_t lastSeekTicks = 0; // Ticks simulated by the last seek
+        uint32_t worstSeekTicks = 0;
+    };
+
+    /**
+     * Load a replay and restore its first keyframe into the bound world.
+     * @return false if the file is missing, not a replay or holds no
+     *         complete segment
+     */
+    bool open(const std::string& path);
+
+    bool isOpen() const { return !segments_.empty(); }
+
+    /**
+     * Bring the world to the state after the given tick (clamped to the
+     * recording).
+     * @return false if a keyframe could not be restored
+     */
+    bool seek(uint32_t tick);
+
+    /**
+     * Apply the next tick's input and update the world.
+     * @param draw Let RenderSystem draw this update
+     * @return false at the end of the recording
+     */
+    bool step(bool draw = false);
+
+    uint32_t getTick() const { return tick_; }
+    uint32_t getTickCount() const;
+    float getTickSeconds() const { return header_.tickSeconds; }
+    size_t getKeyframeCount() const { return segments_.size(); }
+    uint64_t getFileSize() const { return data_.size(); }
+
+    /**
+     * @return File size per minute of recorded play
+     */
+    double getBytesPerMinute() const;
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    struct Segment {
+        uint32_t firstTick = 0;
+        uint32_t tickCount = 0;
+        uint8_t startInput = 0;
+        size_t keyframeOffset = 0;
+        size_t keyframeSize = 0;
+        size_t inputOffset = 0;
+        size_t inputSize = 0;
+    };
+
+    bool parseSegments();
+    bool enterSegment(size_t index, bool restore);
+
+    std::vector<uint8_t> data_;
+    ReplayFileHeader header_;
+    std::vector<Segment> segments_;
+    size_t segment_ = 0;
+    std::vector<uint8_t> inputs_; // Input of each tick of the current segment
+    uint32_t tick_ = 0;
+    uint8_t input_ = 0; // Applied last
+    Stats stats_;
+};
+
+} // namespace diagnostics
+} // namespace game
@@ -0,0 +1,120 @@
+#include "StartupProfiler.hpp"
+#include <SDL3/SDL.h>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+namespace game {
+namespace diagnostics {
+
+StartupProfiler::Scope::Scope(const char *name)
+    : name_(name), startNs_(0) {
+  if (StartupProfiler::getInstance().isRecording()) {
+    startNs_ = SDL_GetTicksNS();
+  }
+}
+
+StartupProfiler::Scope::~Scope() {
+  if (startNs_ != 0) {
+    StartupProfiler::getInstance().record(name_, startNs_, SDL_GetTicksNS());
+  }
+}
+
+StartupProfiler &StartupProfiler::getInstance() {
+  static StartupProfiler instance;
+  return instance;
+}
+
+void StartupProfiler::start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  phases_.clear();
+  threads_.assign(1, std::this_thread::get_id());
+  firstFrameNs_ = 0;
+  originNs_ = SDL_GetTicksNS();
+  recording_ = true;
+}
+
+void StartupProfiler::finishFirstFrame() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!recording_) {
+    return;
+  }
+  firstFrameNs_ = SDL_GetTicksNS() - originNs_;
+  recording_ = false;
+}
+
+void StartupProfiler::record(const char *name, uint64_t startNs,
+                             uint64_t endNs) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // A phase still running when recording stopped is dropped
+  if (!recording_ || startNs < originNs_) {
+    return;
+  }
+  Phase phase;
+  phase.name = name;
+  phase.startNs = startNs - originNs_;
+  phase.endNs = endNs - originNs_;
+  phase.thread = threadIndex(std::this_thread::get_id());
+  phases_.push_back(std::move(phase));
+}
+
+uint32_t StartupProfiler::threadIndex(std::thread::id id) {
+  for (size_t i = 0; i < threads_.size(); ++i) {
+    if (threads_[i] == id) {
+      return static_cast<uint32_t>(i);
+    }
+  }
+  threads_.push_back(id);
+  return static_cast<uint32_t>(threads_.size() - 1);
+}
+
+std::vector<StartupProfiler::Phase> StartupProfiler::getPhases() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return phases_;
+}
+
+void StartupProfiler::report() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Phase &phase : phases_) {
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[Startup] %-28s thread %u  %8.2f - %8.2f ms (%.2f ms)",
+                phase.name.c_str(), phase.thread, phase.startNs / 1e6,
+                phase.endNs / 1e6, (phase.endNs - phase.startNs) / 1e6);
+  }
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[Startup] First frame presented after %.2f ms (%zu phases on "
+              "%zu threads)",
+              firstFrameNs_ / 1e6, phases_.size(), threads_.size());
+}
+
+bool StartupProfiler::writeTrace(const std::string &path) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  nlohmann::json events = nlohmann::json::array();
+  for (const Phase &phase : phases_) {
+    events.push_back({{"name", phase.name},
+                      {"ph", "X"},
+                      {"pid", 1},
+                      {"tid", phase.thread},
+                      {"ts", phase.startNs / 1000.0},
+                      {"dur", (phase.endNs - phase.startNs) / 1000.0}});
+  }
+  if (firstFrameNs_ != 0) {
+    events.push_back({{"name", "first frame"},
+                      {"ph", "i"},
+                      {"s", "g"},
+                      {"pid", 1},
+                      {"tid", 0},
+                      {"ts", firstFrameNs_ / 1000.0}});
+  }
+
+  std::ofstream file(path);
+  if (!file) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[Startup] Cannot write startup trace %s", path.c_str());
+    return false;
+  }
+  file << nlohmann::json{{"traceEvents", events}}.dump(1) << '\n';
+  return static_cast<bool>(file);
+}
+
+} // namespace diagnostics
+} // namespace game
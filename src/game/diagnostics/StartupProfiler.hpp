@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace game {
+namespace diagnostics {
+
+/**
+ * Startup timeline: when each initialization phase began and ended, and on
+ * which thread, from GameEngine::init() until the first frame is presented.
+ *
+ * Phases are recorded with a Scope and may run on worker threads. Recording
+ * is off until start() and stops again at finishFirstFrame(), so code that
+ * also runs later (GameWorld::initialize in server rooms) costs one flag
+ * check outside startup.
+ */
+class StartupProfiler {
+public:
+    struct Phase {
+        std::string name;
+        uint64_t startNs = 0;  // Relative to start()
+        uint64_t endNs = 0;
+        uint32_t thread = 0;   // 0 = the thread that called start()
+    };
+
+    /**
+     * Time one phase until the end of the enclosing block.
+     */
+    class Scope {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* name_;
+        uint64_t startNs_;
+    };
+
+    static StartupProfiler& getInstance();
+
+    /**
+     * Clear the timeline and start recording; phase times count from here.
+     */
+    void start();
+
+    /**
+     * Stop recording and note the time to the first presented frame.
+     */
+    void finishFirstFrame();
+
+    bool isRecording() const { return recording_; }
+
+    /**
+     * @return Nanoseconds from start() to finishFirstFrame() (0 before then)
+     */
+    uint64_t getTimeToFirstFrameNs() const { return firstFrameNs_; }
+
+    /**
+     * @return Recorded phases in the order they ended
+     */
+    std::vector<Phase> getPhases() const;
+
+    /**
+     * Log every phase and the time to first frame.
+     */
+    void report() const;
+
+    /**
+     * Write the timeline as Chrome trace events (chrome://tracing, Perfetto).
+     * @param path Output file
+     * @return false if the file could not be written
+     */
+    bool writeTrace(const std::string& path) const;
+
+private:
+    StartupProfiler() = default;
+
+    void record(const char* name, uint64_t startNs, uint64_t endNs);
+    uint32_t threadIndex(std::thread::id id);
+
+    mutable std::mutex mutex_;
+    std::atomic<bool> recording_{false};
+    uint64_t originNs_ = 0;
+    uint64_t firstFrameNs_ = 0;
+    std::vector<Phase> phases_;
+    std::vector<std::thread::id> threads_; // Index = Phase::thread
+};
+
+} // namespace diagnostics
+} // namespace game
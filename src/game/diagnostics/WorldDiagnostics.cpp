@@ -0,0 +1,172 @@
+#include "WorldDiagnostics.hpp"
+#include "../ecs/SystemManager.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <unordered_set>
+
+namespace game {
+namespace diagnostics {
+
+namespace {
+
+bool satisfies(const ecs::Signature &signature,
+               const ecs::Signature &required) {
+  return (signature & required) == required;
+}
+
+std::string describeSignature(const ecs::Signature &signature,
+                              const std::vector<std::string> &typeNames) {
+  std::string text;
+  for (size_t bit = 0; bit < typeNames.size() && bit < signature.size();
+       ++bit) {
+    if (signature.test(bit)) {
+      if (!text.empty()) {
+        text += '+';
+      }
+      text += typeNames[bit];
+    }
+  }
+  return text;
+}
+
+void addMismatch(WorldReport &report, const std::string &system,
+                 ecs::Entity::ID entity, bool stale) {
+  report.mismatchCount++;
+  if (report.mismatches.size() < WorldDiagnostics::MAX_LISTED_MISMATCHES) {
+    report.mismatches.push_back({system, entity, stale});
+  }
+}
+
+} // namespace
+
+WorldReport WorldDiagnostics::buildReport() {
+  Uint64 start = SDL_GetTicksNS();
+  auto &componentManager = ecs::ComponentManager::getInstance();
+  auto &systemManager = ecs::SystemManager::getInstance();
+  const auto &systems = systemManager.getSystems();
+  const auto &systemNames = systemManager.getSystemNames();
+  const auto &archetypeCounts = componentManager.getArchetypeCounts();
+  const auto &typeNames = componentManager.getComponentTypeNames();
+
+  WorldReport report;
+  report.componentTypeCount = typeNames.size();
+
+  // 1. Archetype histogram and orphans. Systems without requirements accept
+  // every entity, so they do not count as "processing" an archetype.
+  report.archetypes.reserve(archetypeCounts.size());
+  for (const auto &[signature, count] : archetypeCounts) {
+    ArchetypeInfo info;
+    info.signature = signature;
+    info.components = describeSignature(signature, typeNames);
+    info.entityCount = count;
+    info.orphaned = true;
+    for (const auto &system : systems) {
+      const auto &required = system->getRequiredSignature();
+      if (required.any() && satisfies(signature, required)) {
+        info.orphaned = false;
+        break;
+      }
+    }
+    report.entityCount += count;
+    if (info.orphaned) {
+      report.orphanedEntities += count;
+    }
+    report.archetypes.push_back(std::move(info));
+  }
+  std::sort(report.archetypes.begin(), report.archetypes.end(),
+            [](const ArchetypeInfo &a, const ArchetypeInfo &b) {
+              return a.entityCount > b.entityCount;
+            });
+
+  // 2. System membership. Members are checked against their signature;
+  // missing members are only searched for when the histogram says some exist.
+  for (size_t i = 0; i < systems.size(); ++i) {
+    const auto &system = systems[i];
+    const auto &required = system->getRequiredSignature();
+
+    size_t expected = 0;
+    for (const auto &[signature, count] : archetypeCounts) {
+      if (satisfies(signature, required)) {
+        expected += count;
+      }
+    }
+
+    size_t validMembers = 0;
+    for (const ecs::Entity &member : system->getEntities()) {
+      ecs::Signature signature = componentManager.getSignature(member);
+      if (!satisfies(signature, required)) {
+        addMismatch(report, systemNames[i], member.getId(), true);
+      } else if (signature.any()) {
+        validMembers++;
+      }
+    }
+
+    if (validMembers < expected) {
+      std::unordered_set<ecs::Entity::ID> members;
+      members.reserve(system->getEntities().size());
+      for (const ecs::Entity &member : system->getEntities()) {
+        members.insert(member.getId());
+      }
+      for (ecs::Entity::ID id : componentManager.getLiveEntities()) {
+        if (satisfies(componentManager.getSignature(id), required) &&
+            members.count(id) == 0) {
+          addMismatch(report, systemNames[i], id, false);
+        }
+      }
+    }
+  }
+
+  report.buildTimeMs = (SDL_GetTicksNS() - start) / 1.0e6;
+  return report;
+}
+
+void WorldDiagnostics::logReport(const WorldReport &report) {
+  SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+              "[WorldDiagnostics] === WORLD REPORT (built in %.3f ms) ===",
+              report.buildTimeMs);
+  SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+              "[WorldDiagnostics] %zu entities, %zu archetypes, %zu component "
+              "types",
+              report.entityCount, report.archetypes.size(),
+              report.componentTypeCount);
+
+  for (const auto &archetype : report.archetypes) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[WorldDiagnostics]   %6zu x %s%s", archetype.entityCount,
+                archetype.components.c_str(),
+                archetype.orphaned ? "  (ORPHANED: no system processes it)"
+                                   : "");
+  }
+
+  if (report.orphanedEntities > 0) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[WorldDiagnostics] %zu entities hold components no system "
+                "uses",
+                report.orphanedEntities);
+  }
+
+  if (report.mismatchCount == 0) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[WorldDiagnostics] System membership consistent");
+  } else {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[WorldDiagnostics] %zu system membership mismatches%s",
+                report.mismatchCount,
+                report.mismatchCount > report.mismatches.size()
+                    ? " (first ones listed)"
+                    : "");
+    for (const auto &mismatch : report.mismatches) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                  "[WorldDiagnostics]   entity %llu %s %s",
+                  static_cast<unsigned long long>(mismatch.entity),
+                  mismatch.staleMember ? "is in but lacks components for"
+                                       : "qualifies for but is missing from",
+                  mismatch.system.c_str());
+    }
+  }
+  SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+              "[WorldDiagnostics] === END REPORT ===");
+}
+
+} // namespace diagnostics
+} // namespace game
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/Entity.hpp"
+#include <string>
+#include <vector>
+
+namespace game {
+namespace diagnostics {
+
+/**
+ * One archetype (distinct set of component types) and how many live
+ * entities currently have exactly that set.
+ */
+struct ArchetypeInfo {
+    ecs::Signature signature;
+    std::string components;   // e.g. "Transform+Sprite+Collision"
+    size_t entityCount = 0;
+    bool orphaned = false;    // No system with requirements would process it
+};
+
+/**
+ * An entity whose system membership disagrees with its components.
+ */
+struct MembershipMismatch {
+    std::string system;
+    ecs::Entity::ID entity = 0;
+    bool staleMember = false; // true: in the system but missing a required
+                              // component; false: qualifies but not a member
+};
+
+/**
+ * Snapshot of world consistency produced by WorldDiagnostics::buildReport().
+ */
+struct WorldReport {
+    size_t entityCount = 0;         // Entities that own at least one component
+    size_t componentTypeCount = 0;
+    size_t orphanedEntities = 0;    // Sum over orphaned archetypes
+    size_t mismatchCount = 0;       // Total mismatches (list may be truncated)
+    std::vector<ArchetypeInfo> archetypes;          // Largest first
+    std::vector<MembershipMismatch> mismatches;
+    double buildTimeMs = 0.0;
+};
+
+/**
+ * On-demand world diagnostics.
+ *
+ * Reports are built from bookkeeping the ECS already maintains: the archetype
+ * histogram ComponentManager updates on every add/remove, each entity's
+ * signature and each system's member list. Orphans are found per archetype
+ * (not per entity), and only systems whose member count disagrees with the
+ * archetype histogram are searched for missing members, so a healthy world
+ * costs roughly O(archetypes x systems + system members).
+ *
+ * Nothing here runs per frame; request a report with F5 in game
+ * (GameWorld::requestDiagnosticsReport) or call buildReport() directly.
+ */
+class WorldDiagnostics {
+public:
+    // Upper bound on mismatches listed individually in a report
+    static constexpr size_t MAX_LISTED_MISMATCHES = 32;
+
+    /**
+     * Build a report from the current ComponentManager / SystemManager state.
+     * @return The report
+     */
+    static WorldReport buildReport();
+
+    /**
+     * Write a report to the log. Uses WARN priority so it is visible at the
+     * game's default log level.
+     * @param report Report to log
+     */
+    static void logReport(const WorldReport& report);
+};
+
+} // namespace diagnostics
+} // namespace game
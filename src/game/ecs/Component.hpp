@@ -3,6 +3,7 @@
 #include "Entity.hpp"
 #include <typeindex>
 #include <memory>
+#include <string>
 
 namespace game {
 namespace ecs {
@@ -20,6 +21,9 @@ public:
     // Get the entity this component belongs to
     const Entity& getEntity() const { return entity_; }
 
+    // Human-readable summary of the component's state, shown by debug tools
+    virtual std::string toString() const { return std::string(); }
+
 protected:
     // Protected constructor to ensure components are created through derived classes
     Component(const Entity& entity) : entity_(entity) {}
@@ -2,35 +2,178 @@
 
 #include "Component.hpp"
 #include "Entity.hpp"
+#include "TypeName.hpp"
+#include "WorldLocal.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <bitset>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <typeindex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace game {
 namespace ecs {
 
+// Upper bound on distinct component types; each type owns one signature bit
+constexpr size_t MAX_COMPONENT_TYPES = 64;
+
+// Set of component types an entity currently has (bit = type index)
+using Signature = std::bitset<MAX_COMPONENT_TYPES>;
+
+// Tags are empty structs (e.g. components::BossTarget) added with addTag():
+// they own a signature bit like any component but have no storage, so
+// has<Tag>() is a bit test and a System can require them like components.
+
+// Receives signature changes for the component types it registered for with
+// ComponentManager::addObserver(). before/after are the entity's signatures
+// around the change; inside a Batch they span the whole batch.
+class ComponentObserver {
+public:
+  virtual ~ComponentObserver() = default;
+  virtual void onSignatureChanged(const Entity &entity,
+                                  const Signature &before,
+                                  const Signature &after) = 0;
+};
+
 class ComponentManager {
 public:
   // Get the singleton instance
   static ComponentManager &getInstance() {
+    if (ComponentManager *local = WorldLocal<ComponentManager>::get()) {
+      return *local;
+    }
     static ComponentManager instance;
     return instance;
   }
 
-  // Add a component to an entity
+  // Add a component to an entity; observers of T (e.g. SystemManager) are
+  // notified, so callers no longer announce the add themselves
   template <typename T, typename... Args>
   void addComponent(const Entity &entity, Args &&...args) {
     auto component = std::make_unique<T>(entity, std::forward<Args>(args)...);
     components_[Component::getTypeId<T>()][entity.getId()] =
         std::move(component);
+    setSignatureBit(entity, getTypeIndex<T>(), true);
   }
 
   // Remove a component from an entity
   template <typename T> void removeComponent(const Entity &entity) {
     auto typeId = Component::getTypeId<T>();
     auto &componentMap = components_[typeId];
-    componentMap.erase(entity.getId());
+    if (componentMap.erase(entity.getId()) > 0) {
+      setSignatureBit(entity, getTypeIndex<T>(), false);
+    }
+  }
+
+  // Mark an entity with a tag (an empty struct); sets only its signature bit
+  template <typename Tag> void addTag(const Entity &entity) {
+    static_assert(std::is_empty<Tag>::value,
+                  "Tags are empty structs; use addComponent for data");
+    setSignatureBit(entity, getTypeIndex<Tag>(), true);
+  }
+
+  template <typename Tag> void removeTag(const Entity &entity) {
+    static_assert(std::is_empty<Tag>::value,
+                  "Tags are empty structs; use removeComponent for data");
+    setSignatureBit(entity, getTypeIndex<Tag>(), false);
+  }
+
+  // Register an observer for changes to one signature bit (see
+  // getTypeIndex()). The observer must outlive its registration.
+  void addObserver(size_t typeIndex, ComponentObserver *observer) {
+    if (typeIndex >= observers_.size()) {
+      observers_.resize(typeIndex + 1);
+    }
+    auto &list = observers_[typeIndex];
+    if (std::find(list.begin(), list.end(), observer) == list.end()) {
+      list.push_back(observer);
+    }
+  }
+
+  // Unregister an observer from every type it was registered for
+  void removeObserver(ComponentObserver *observer) {
+    for (auto &list : observers_) {
+      list.erase(std::remove(list.begin(), list.end(), observer), list.end());
+    }
+  }
+
+  // Defer observer notifications until the outermost endBatch(); then each
+  // entity touched in between is reported once, with its signature from
+  // before the batch and its current one. Use Batch to scope it.
+  void beginBatch() { ++batchDepth_; }
+  void endBatch() {
+    if (batchDepth_ == 0 || --batchDepth_ > 0) {
+      return;
+    }
+    // Observers may add components while we notify; those go out directly
+    std::vector<PendingChange> pending;
+    pending.swap(pending_);
+    for (const PendingChange &change : pending) {
+      auto it = records_.find(change.entity.getId());
+      if (it != records_.end()) {
+        it->second.pending = NOT_PENDING;
+      }
+    }
+    droppedPending_.clear();
+    for (const PendingChange &change : pending) {
+      notifyObservers(change.entity, change.before,
+                      getSignature(change.entity.getId()));
+    }
+    pending.clear();
+    if (pending_.empty()) {
+      pending_.swap(pending); // Keep the capacity for the next batch
+    }
+  }
+
+  // Scoped beginBatch()/endBatch(), e.g. around building an entity from
+  // several components
+  class Batch {
+  public:
+    explicit Batch(ComponentManager &manager) : manager_(manager) {
+      manager_.beginBatch();
+    }
+    ~Batch() { manager_.endBatch(); }
+    Batch(const Batch &) = delete;
+    Batch &operator=(const Batch &) = delete;
+
+  private:
+    ComponentManager &manager_;
+  };
+
+  // Whether an entity has a tag or component of type T: one record lookup
+  // and a bit test, without touching component storage
+  template <typename T> bool has(const Entity &entity) {
+    return has<T>(entity.getId());
+  }
+  template <typename T> bool has(Entity::ID id) {
+    const size_t index = getTypeIndex<T>();
+    auto it = records_.find(id);
+    return it != records_.end() && it->second.signature.test(index);
+  }
+
+  // Signature with the bits of every listed tag or component type, for
+  // filtering with forEachEntityWith() or testing getSignature() results
+  template <typename... Ts> Signature makeSignature() {
+    Signature signature;
+    (signature.set(getTypeIndex<Ts>()), ...);
+    return signature;
+  }
+
+  // Call fn(entityId) for every entity whose signature contains all bits of
+  // required; order is unspecified
+  template <typename Fn>
+  void forEachEntityWith(const Signature &required, Fn &&fn) const {
+    for (const auto &[id, record] : records_) {
+      if ((record.signature & required) == required) {
+        fn(id);
+      }
+    }
   }
 
   // Get a component from an entity
@@ -63,6 +206,32 @@ public:
     return entities;
   }
 
+  // Call fn(entityId, component) for every component of type T, without
+  // building an entity list
+  template <typename T, typename Fn> void forEachComponent(Fn &&fn) {
+    auto it = components_.find(Component::getTypeId<T>());
+    if (it == components_.end()) {
+      return;
+    }
+    for (auto &[entityId, component] : it->second) {
+      if (component) {
+        fn(entityId, static_cast<T &>(*component));
+      }
+    }
+  }
+
+  // Get a component by entity ID
+  template <typename T> T *getComponent(Entity::ID id) {
+    auto it = components_.find(Component::getTypeId<T>());
+    if (it == components_.end()) {
+      return nullptr;
+    }
+    auto componentIt = it->second.find(id);
+    return componentIt != it->second.end()
+               ? static_cast<T *>(componentIt->second.get())
+               : nullptr;
+  }
+
   // Check if an entity has a component
   bool hasComponent(const Entity &entity, const std::type_index &typeId) const {
     auto it = components_.find(typeId);
@@ -73,24 +242,289 @@ public:
     return false;
   }
 
-  // Remove all components for an entity
+  // Remove all components for an entity. Observers are not told: destroying
+  // an entity goes through SystemManager::onEntityDestroyed() instead.
   void removeAllComponents(const Entity &entity) {
     for (auto &[typeId, componentMap] : components_) {
       componentMap.erase(entity.getId());
     }
+    auto it = records_.find(entity.getId());
+    if (it != records_.end()) {
+      releaseArchetype(it->second.signature);
+      removeLiveEntity(it);
+    }
   }
 
   // Reset the component manager (clear all components)
-  void reset() { components_.clear(); }
+  void reset() {
+    components_.clear();
+    records_.clear();
+    liveEntities_.clear();
+    archetypeCounts_.clear();
+    pending_.clear();
+    droppedPending_.clear();
+  }
+
+  // Signature bit of a tag or component type, cached per type so repeat
+  // calls are a vector lookup
+  template <typename T> size_t getTypeIndex() {
+    const size_t key = getTypeKey<T>();
+    if (key >= typeIndexCache_.size()) {
+      typeIndexCache_.resize(key + 1, NO_TYPE_INDEX);
+    }
+    if (typeIndexCache_[key] == NO_TYPE_INDEX) {
+      typeIndexCache_[key] = getComponentTypeIndex(typeid(T));
+    }
+    return typeIndexCache_[key];
+  }
+
+  // Dense index of a component type, assigned on first use. Indices are
+  // stable for the lifetime of this manager (reset() keeps them); each
+  // WorldInstance's manager assigns its own, so never cache a bit across
+  // worlds. Throws
+  // std::runtime_error past MAX_COMPONENT_TYPES types rather than letting
+  // two types share a signature bit.
+  size_t getComponentTypeIndex(const std::type_index &typeId) {
+    auto it = typeIndices_.find(typeId);
+    if (it != typeIndices_.end()) {
+      return it->second;
+    }
+    const size_t index = typeNames_.size();
+    if (index >= MAX_COMPONENT_TYPES) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                   "[ComponentManager] More than %zu component types; no "
+                   "signature bit left for %s",
+                   MAX_COMPONENT_TYPES, typeId.name());
+      throw std::runtime_error("Too many component types: " +
+                               makeTypeName(typeId.name()));
+    }
+    typeIndices_.emplace(typeId, index);
+    typeNames_.push_back(makeTypeName(typeId.name()));
+    typeIds_.push_back(typeId);
+    return index;
+  }
+
+  // Readable component type names, indexed by getComponentTypeIndex()
+  const std::vector<std::string> &getComponentTypeNames() const {
+    return typeNames_;
+  }
+
+  // Component types the entity currently has (empty if it has none)
+  Signature getSignature(const Entity &entity) const {
+    return getSignature(entity.getId());
+  }
+  Signature getSignature(Entity::ID id) const {
+    auto it = records_.find(id);
+    return it != records_.end() ? it->second.signature : Signature();
+  }
+
+  // IDs of every entity that owns at least one component, densely packed
+  // (order is unspecified and changes as entities are removed)
+  const std::vector<Entity::ID> &getLiveEntities() const {
+    return liveEntities_;
+  }
+
+  // Untyped access to one of an entity's components by signature bit (null
+  // for tags, which have no storage)
+  Component *getComponent(Entity::ID id, size_t typeIndex) const {
+    if (typeIndex >= typeIds_.size()) {
+      return nullptr;
+    }
+    auto it = components_.find(typeIds_[typeIndex]);
+    if (it == components_.end()) {
+      return nullptr;
+    }
+    auto componentIt = it->second.find(id);
+    return componentIt != it->second.end() ? componentIt->second.get()
+                                           : nullptr;
+  }
+
+  // Recover the Entity (with its name) for a live ID from any of its
+  // components; returns a default Entity if the ID owns no components
+  Entity findEntity(Entity::ID id) const {
+    Signature signature = getSignature(id);
+    for (size_t bit = 0; bit < typeIds_.size(); ++bit) {
+      if (signature.test(bit)) {
+        if (Component *component = getComponent(id, bit)) {
+          return component->getEntity();
+        }
+      }
+    }
+    return Entity();
+  }
+
+  // Number of live entities per archetype (distinct signature). Maintained
+  // incrementally as components are added and removed.
+  const std::unordered_map<Signature, size_t> &getArchetypeCounts() const {
+    return archetypeCounts_;
+  }
 
 private:
   // Private constructor for singleton
   ComponentManager() = default;
+  friend class WorldLocal<ComponentManager>;
+
+  static constexpr size_t NO_TYPE_INDEX = static_cast<size_t>(-1);
+
+  // Process-wide dense key per type, used to index typeIndexCache_ (bit
+  // indices themselves are assigned per manager)
+  static size_t nextTypeKey() {
+    static std::atomic<size_t> next{0};
+    return next++;
+  }
+  template <typename T> static size_t getTypeKey() {
+    static const size_t key = nextTypeKey();
+    return key;
+  }
+
+  static constexpr size_t NOT_PENDING = static_cast<size_t>(-1);
+
+  struct EntityRecord {
+    Signature signature;
+    size_t slot = 0;              // Position in liveEntities_
+    size_t pending = NOT_PENDING; // Entry in pending_ while batching
+  };
+
+  struct PendingChange {
+    Entity entity;
+    Signature before;
+  };
+
+  // Flip one signature bit, move the entity between archetype counts and
+  // tell the bit's observers (or queue the entity while batching)
+  void setSignatureBit(const Entity &entity, size_t index, bool value) {
+    const Entity::ID id = entity.getId();
+    auto it = records_.find(id);
+    if (it == records_.end()) {
+      if (!value) {
+        return;
+      }
+      it = records_.emplace(id, EntityRecord{Signature(), liveEntities_.size()})
+               .first;
+      liveEntities_.push_back(id);
+    } else {
+      if (it->second.signature.test(index) == value) {
+        return;
+      }
+      releaseArchetype(it->second.signature);
+    }
+
+    const Signature before = it->second.signature;
+    it->second.signature.set(index, value);
+    const Signature after = it->second.signature;
+    if (batchDepth_ > 0) {
+      queueChange(entity, it->second, before);
+    }
+    if (after.none()) {
+      removeLiveEntity(it);
+    } else {
+      ++archetypeCounts_[after];
+    }
+
+    if (batchDepth_ == 0 && index < observers_.size()) {
+      for (ComponentObserver *observer : observers_[index]) {
+        observer->onSignatureChanged(entity, before, after);
+      }
+    }
+  }
+
+  // Remember an entity's pre-batch signature when it starts changing; later
+  // changes to it, even after other entities changed, merge into that entry
+  void queueChange(const Entity &entity, EntityRecord &record,
+                   const Signature &before) {
+    if (record.pending != NOT_PENDING) {
+      return;
+    }
+    // An entity that lost every component earlier in the batch has a fresh
+    // record but keeps its first entry
+    for (auto dropped = droppedPending_.begin();
+         dropped != droppedPending_.end(); ++dropped) {
+      if (dropped->first == entity.getId()) {
+        record.pending = dropped->second;
+        droppedPending_.erase(dropped);
+        return;
+      }
+    }
+    record.pending = pending_.size();
+    pending_.push_back(PendingChange{entity, before});
+  }
+
+  // Tell every observer of a changed bit once about a batched change
+  void notifyObservers(const Entity &entity, const Signature &before,
+                       const Signature &after) {
+    const Signature changed = before ^ after;
+    if (changed.none()) {
+      return;
+    }
+    notified_.clear();
+    for (size_t bit = 0; bit < observers_.size(); ++bit) {
+      if (!changed.test(bit)) {
+        continue;
+      }
+      for (ComponentObserver *observer : observers_[bit]) {
+        if (std::find(notified_.begin(), notified_.end(), observer) ==
+            notified_.end()) {
+          notified_.push_back(observer);
+        }
+      }
+    }
+    // Copy: an observer may start a nested change that reuses notified_
+    std::vector<ComponentObserver *> targets;
+    targets.swap(notified_);
+    for (ComponentObserver *observer : targets) {
+      observer->onSignatureChanged(entity, before, after);
+    }
+    targets.clear();
+    notified_.swap(targets);
+  }
+
+  // Swap-remove an entity from the dense live list and drop its record
+  void removeLiveEntity(
+      std::unordered_map<Entity::ID, EntityRecord>::iterator it) {
+    if (it->second.pending != NOT_PENDING) {
+      droppedPending_.emplace_back(it->first, it->second.pending);
+    }
+    size_t slot = it->second.slot;
+    Entity::ID moved = liveEntities_.back();
+    liveEntities_[slot] = moved;
+    liveEntities_.pop_back();
+    if (moved != it->first) {
+      records_[moved].slot = slot;
+    }
+    records_.erase(it);
+  }
+
+  void releaseArchetype(const Signature &signature) {
+    auto it = archetypeCounts_.find(signature);
+    if (it != archetypeCounts_.end() && --it->second == 0) {
+      archetypeCounts_.erase(it);
+    }
+  }
 
   // Map of component type to map of entity ID to component
   std::unordered_map<std::type_index,
                      std::unordered_map<Entity::ID, std::unique_ptr<Component>>>
       components_;
+
+  // Per-entity component signatures, the dense list of live IDs and the
+  // archetype histogram they feed
+  std::unordered_map<Entity::ID, EntityRecord> records_;
+  std::vector<Entity::ID> liveEntities_;
+  std::unordered_map<Signature, size_t> archetypeCounts_;
+
+  // Component type -> signature bit, plus type and readable name per bit
+  std::unordered_map<std::type_index, size_t> typeIndices_;
+  std::vector<std::type_index> typeIds_;
+  std::vector<std::string> typeNames_;
+  std::vector<size_t> typeIndexCache_; // By getTypeKey<T>()
+
+  // Observers per signature bit, and entities changed in the open batch
+  std::vector<std::vector<ComponentObserver *>> observers_;
+  size_t batchDepth_ = 0;
+  std::vector<PendingChange> pending_;
+  // Pending entries of entities whose record was dropped mid-batch
+  std::vector<std::pair<Entity::ID, size_t>> droppedPending_;
+  std::vector<ComponentObserver *> notified_;
 };
 
 } // namespace ecs
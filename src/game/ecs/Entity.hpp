@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -14,12 +15,25 @@ public:
     // Default constructor needed for unordered_map
     Entity() : id_(0), name_("") {}
 
-    // Create a new entity with a unique ID
+    // Create a new entity with a unique ID (unique across every world, so
+    // worlds ticking on different threads may create entities at once)
     static Entity create(const std::string& name = "") {
-        static ID nextId = 0;
-        return Entity(nextId++, name);
+        return Entity(nextId().fetch_add(1, std::memory_order_relaxed), name);
     }
 
+    // ID the next create() will return (replay keyframes store IDs relative
+    // to it, so they can be restored into any process)
+    static ID peekNextId() { return nextId().load(std::memory_order_relaxed); }
+
+    // Reserve count consecutive IDs that create() will never return, and
+    // return the first; withId() turns them into entities
+    static ID reserveIds(ID count) {
+        return nextId().fetch_add(count, std::memory_order_relaxed);
+    }
+
+    // Entity with an ID obtained from reserveIds()
+    static Entity withId(ID id, const std::string& name = "") { return Entity(id, name); }
+
     // Get the entity's ID
     ID getId() const { return id_; }
 
@@ -38,6 +52,11 @@ private:
     // Private constructor to ensure entities are created through create()
     Entity(ID id, const std::string& name) : id_(id), name_(name) {}
 
+    static std::atomic<ID>& nextId() {
+        static std::atomic<ID> next{0};
+        return next;
+    }
+
     ID id_;
     std::string name_;
 };
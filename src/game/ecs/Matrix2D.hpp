@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Vector2.hpp"
+#include <cmath>
+
+namespace game {
+namespace ecs {
+
+/**
+ * 2D affine transform stored as the top two rows of a 3x3 matrix:
+ *
+ *   | a  c  tx |
+ *   | b  d  ty |
+ *   | 0  0  1  |
+ *
+ * Rotations are in degrees to match Transform.
+ */
+struct Matrix2D {
+    float a, b, c, d, tx, ty;
+
+    Matrix2D() : a(1.0f), b(0.0f), c(0.0f), d(1.0f), tx(0.0f), ty(0.0f) {}
+    Matrix2D(float a, float b, float c, float d, float tx, float ty)
+        : a(a), b(b), c(c), d(d), tx(tx), ty(ty) {}
+
+    /**
+     * Compose translate * rotate * scale.
+     * @param position Translation
+     * @param rotation Rotation in degrees
+     * @param scale Scale along the local axes
+     */
+    static Matrix2D compose(const Vector2& position, float rotation, const Vector2& scale) {
+        float radians = rotation * 3.14159265358979f / 180.0f;
+        float cosR = std::cos(radians);
+        float sinR = std::sin(radians);
+        return Matrix2D(cosR * scale.x, sinR * scale.x, -sinR * scale.y, cosR * scale.y,
+                        position.x, position.y);
+    }
+
+    // this * other: applies other first, then this
+    Matrix2D operator*(const Matrix2D& other) const {
+        return Matrix2D(a * other.a + c * other.b,
+                        b * other.a + d * other.b,
+                        a * other.c + c * other.d,
+                        b * other.c + d * other.d,
+                        a * other.tx + c * other.ty + tx,
+                        b * other.tx + d * other.ty + ty);
+    }
+
+    Vector2 transformPoint(const Vector2& point) const {
+        return Vector2(a * point.x + c * point.y + tx, b * point.x + d * point.y + ty);
+    }
+
+    // Decomposition back into Transform fields. Exact unless a non-uniform
+    // scale was composed with a rotation further up (shear is dropped).
+    Vector2 getTranslation() const { return Vector2(tx, ty); }
+
+    float getRotation() const {
+        return std::atan2(b, a) * 180.0f / 3.14159265358979f;
+    }
+
+    Vector2 getScale() const {
+        float determinant = a * d - b * c;
+        float scaleX = std::sqrt(a * a + b * b);
+        float scaleY = scaleX != 0.0f ? determinant / scaleX : std::sqrt(c * c + d * d);
+        return Vector2(scaleX, scaleY);
+    }
+};
+
+} // namespace ecs
+} // namespace game
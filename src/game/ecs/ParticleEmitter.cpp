@@ -0,0 +1,90 @@
+#include "ParticleEmitter.hpp"
+#include "components/Camera.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace game {
+namespace ecs {
+
+ParticleEmitter::ParticleEmitter()
+    : x_(CAPACITY)
+    , y_(CAPACITY)
+    , vx_(CAPACITY)
+    , vy_(CAPACITY)
+    , age_(CAPACITY)
+    , color_(CAPACITY)
+    , live_(0)
+    , maxParticles_(CAPACITY)
+    , dropped_(0)
+    , random_(0x5041525449434C45ULL) // "PARTICLE"
+{
+}
+
+size_t ParticleEmitter::emit(const Vector2& position, size_t count, const SDL_Color& color) {
+    const size_t room = maxParticles_ > live_ ? maxParticles_ - live_ : 0;
+    const size_t spawned = std::min(count, room);
+    dropped_ += count - spawned;
+
+    for (size_t i = 0; i < spawned; ++i) {
+        const size_t slot = live_++;
+        const float angle = random_.range(0.0f, 6.2831853f);
+        const float speed = random_.range(0.3f, 1.0f) * SPEED;
+        x_[slot] = position.x;
+        y_[slot] = position.y;
+        vx_[slot] = std::cos(angle) * speed;
+        vy_[slot] = std::sin(angle) * speed;
+        age_[slot] = random_.range(0.0f, 0.2f) * LIFETIME;
+        color_[slot] = color;
+    }
+    return spawned;
+}
+
+void ParticleEmitter::update(float deltaTime) {
+    size_t i = 0;
+    while (i < live_) {
+        age_[i] += deltaTime;
+        if (age_[i] >= LIFETIME) {
+            // Keep the pool packed: move the last live particle here
+            --live_;
+            x_[i] = x_[live_];
+            y_[i] = y_[live_];
+            vx_[i] = vx_[live_];
+            vy_[i] = vy_[live_];
+            age_[i] = age_[live_];
+            color_[i] = color_[live_];
+            continue;
+        }
+        vy_[i] += GRAVITY * deltaTime;
+        x_[i] += vx_[i] * deltaTime;
+        y_[i] += vy_[i] * deltaTime;
+        ++i;
+    }
+}
+
+void ParticleEmitter::draw(SDL_Renderer* renderer, const components::Camera* camera,
+                           const Vector2& origin) const {
+    if (!renderer) {
+        return;
+    }
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    for (size_t i = 0; i < live_; ++i) {
+        if (camera && !camera->isVisible(x_[i], y_[i], SIZE, SIZE)) {
+            continue;
+        }
+        const Vector2 position = Vector2(x_[i], y_[i]) - origin;
+        const SDL_Color& color = color_[i];
+        const float fade = 1.0f - age_[i] / LIFETIME;
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b,
+                               static_cast<Uint8>(color.a * fade));
+        const SDL_FRect rect = {position.x, position.y, SIZE, SIZE};
+        SDL_RenderFillRect(renderer, &rect);
+    }
+}
+
+void ParticleEmitter::setMaxParticles(size_t maxParticles) {
+    maxParticles_ = std::min(maxParticles, CAPACITY);
+    live_ = std::min(live_, maxParticles_);
+}
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Random.hpp"
+#include "Vector2.hpp"
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace ecs {
+namespace components {
+class Camera;
+}
+
+/**
+ * ParticleEmitter - short-lived visual sparks (duck hits).
+ *
+ * Particles live in a fixed pool of CAPACITY slots, allocated once, and are
+ * kept packed: a dead particle is replaced by the last live one. The live
+ * count never exceeds getMaxParticles(); emit() drops what does not fit and
+ * counts it, so a burst of hits costs a bounded amount of work. The
+ * QualityGovernor lowers the limit on slow machines (0 turns sparks off).
+ *
+ * Particles are cosmetic: they use their own random stream and never touch
+ * components, so they do not affect the simulation or replays.
+ */
+class ParticleEmitter {
+public:
+    static constexpr size_t CAPACITY = 1024;     // Hard limit on live particles
+    static constexpr float LIFETIME = 0.45f;     // Seconds
+    static constexpr float SPEED = 180.0f;       // Pixels per second, at most
+    static constexpr float GRAVITY = 400.0f;     // Pixels per second squared
+    static constexpr float SIZE = 3.0f;          // Pixels
+
+    ParticleEmitter();
+
+    /**
+     * Spawn a burst of particles flying out from a point.
+     * @param position World position of the burst
+     * @param count Particles wanted
+     * @param color Particle color (faded out over the lifetime)
+     * @return Particles actually spawned (the rest hit the limit)
+     */
+    size_t emit(const Vector2& position, size_t count, const SDL_Color& color);
+
+    /**
+     * Move the particles and retire those that ran out of time.
+     * @param deltaTime Step length in seconds
+     */
+    void update(float deltaTime);
+
+    /**
+     * Draw every live particle.
+     * @param renderer Target renderer
+     * @param camera Culls particles outside its view (null = draw all)
+     * @param origin World position drawn at the top-left corner (the
+     *        camera's position as RenderSystem draws it)
+     */
+    void draw(SDL_Renderer* renderer, const components::Camera* camera,
+              const Vector2& origin) const;
+
+    /**
+     * Limit the live particles (clamped to CAPACITY). Particles above a
+     * lowered limit are retired at once.
+     * @param maxParticles New limit, 0 = no particles
+     */
+    void setMaxParticles(size_t maxParticles);
+    size_t getMaxParticles() const { return maxParticles_; }
+
+    size_t getLiveCount() const { return live_; }
+
+    /**
+     * @return Particles emit() could not spawn because of the limit
+     */
+    uint64_t getDroppedCount() const { return dropped_; }
+
+    void clear() { live_ = 0; }
+
+private:
+    // Structure of arrays, CAPACITY entries each; [0, live_) are alive
+    std::vector<float> x_, y_, vx_, vy_, age_;
+    std::vector<SDL_Color> color_;
+    size_t live_;
+    size_t maxParticles_;
+    uint64_t dropped_;
+    RandomStream random_;
+};
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,183 @@
+#include "Random.hpp"
+#include <SDL3/SDL.h>
+#include <random>
+
+namespace game {
+namespace ecs {
+
+namespace {
+
+uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// FNV-1a; stable across platforms, unlike std::hash
+uint64_t hashName(const std::string& name) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (unsigned char c : name) {
+        hash ^= c;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// Read saveState() output without throwing; false (and logged) if it is
+// malformed, e.g. a word that is not a 32-bit number or an all-zero stream,
+// which xoshiro128 would never leave
+bool parseState(const nlohmann::json& data, uint64_t& seed,
+                std::unordered_map<std::string, RandomStream::State>& states) {
+    if (!data.is_object() || !data.contains("seed") || !data["seed"].is_number_unsigned()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[RandomService] Invalid state: missing seed");
+        return false;
+    }
+    if (data.contains("streams")) {
+        const auto& streams = data["streams"];
+        if (!streams.is_object()) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[RandomService] Invalid state: streams");
+            return false;
+        }
+        for (auto it = streams.begin(); it != streams.end(); ++it) {
+            const auto& words = it.value();
+            bool valid = words.is_array() && words.size() == 4;
+            RandomStream::State state{};
+            uint32_t any = 0;
+            for (size_t i = 0; valid && i < 4; ++i) {
+                valid = words[i].is_number_unsigned() &&
+                        words[i].get<uint64_t>() <= UINT32_MAX;
+                if (valid) {
+                    state.s[i] = static_cast<uint32_t>(words[i].get<uint64_t>());
+                    any |= state.s[i];
+                }
+            }
+            if (!valid || any == 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                             "[RandomService] Invalid state for stream %s", it.key().c_str());
+                return false;
+            }
+            states[it.key()] = state;
+        }
+    }
+    seed = data["seed"].get<uint64_t>();
+    return true;
+}
+
+} // namespace
+
+void RandomStream::reseed(uint64_t seed) {
+    uint64_t a = splitmix64(seed);
+    uint64_t b = splitmix64(seed);
+    state_.s[0] = static_cast<uint32_t>(a);
+    state_.s[1] = static_cast<uint32_t>(a >> 32);
+    state_.s[2] = static_cast<uint32_t>(b);
+    state_.s[3] = static_cast<uint32_t>(b >> 32);
+    if ((state_.s[0] | state_.s[1] | state_.s[2] | state_.s[3]) == 0) {
+        state_.s[0] = 1;  // The all-zero state only ever produces zeros
+    }
+}
+
+void RandomStream::fill(float* out, size_t count, float min, float max) {
+    uint32_t s0 = state_.s[0], s1 = state_.s[1], s2 = state_.s[2], s3 = state_.s[3];
+    const float scale = (max - min) * (1.0f / 16777216.0f);
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t result = rotl(s1 * 5, 7) * 9;
+        const uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl(s3, 11);
+        out[i] = min + static_cast<float>(result >> 8) * scale;
+    }
+    state_.s[0] = s0;
+    state_.s[1] = s1;
+    state_.s[2] = s2;
+    state_.s[3] = s3;
+}
+
+void RandomStream::fill(uint32_t* out, size_t count) {
+    uint32_t s0 = state_.s[0], s1 = state_.s[1], s2 = state_.s[2], s3 = state_.s[3];
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = rotl(s1 * 5, 7) * 9;
+        const uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl(s3, 11);
+    }
+    state_.s[0] = s0;
+    state_.s[1] = s1;
+    state_.s[2] = s2;
+    state_.s[3] = s3;
+}
+
+RandomService::RandomService() {
+    std::random_device device;
+    seed_ = (static_cast<uint64_t>(device()) << 32) | device();
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RandomService] World seed %llu",
+                static_cast<unsigned long long>(seed_));
+}
+
+void RandomService::setSeed(uint64_t seed) {
+    seed_ = seed;
+    for (auto& [name, stream] : streams_) {
+        stream->reseed(streamSeed(name));
+    }
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RandomService] World seed set to %llu (%zu streams)",
+                static_cast<unsigned long long>(seed_), streams_.size());
+}
+
+RandomStream& RandomService::stream(const std::string& name) {
+    auto it = streams_.find(name);
+    if (it == streams_.end()) {
+        it = streams_.emplace(name, std::make_unique<RandomStream>(streamSeed(name))).first;
+    }
+    return *it->second;
+}
+
+uint64_t RandomService::streamSeed(const std::string& name) const {
+    return seed_ ^ hashName(name);
+}
+
+nlohmann::json RandomService::saveState() const {
+    nlohmann::json data;
+    data["seed"] = seed_;
+    nlohmann::json streams = nlohmann::json::object();
+    for (const auto& [name, stream] : streams_) {
+        const RandomStream::State& state = stream->getState();
+        streams[name] = {state.s[0], state.s[1], state.s[2], state.s[3]};
+    }
+    data["streams"] = streams;
+    return data;
+}
+
+bool RandomService::isValidState(const nlohmann::json& data) {
+    uint64_t seed = 0;
+    std::unordered_map<std::string, RandomStream::State> states;
+    return parseState(data, seed, states);
+}
+
+bool RandomService::loadState(const nlohmann::json& data) {
+    uint64_t seed = 0;
+    std::unordered_map<std::string, RandomStream::State> states;
+    if (!parseState(data, seed, states)) {
+        return false;
+    }
+
+    seed_ = seed;
+    for (auto& [name, stream] : streams_) {
+        stream->reseed(streamSeed(name));
+    }
+    for (const auto& [name, state] : states) {
+        stream(name).setState(state);
+    }
+    return true;
+}
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "WorldLocal.hpp"
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace game {
+namespace ecs {
+
+/**
+ * RandomStream - one xoshiro128** generator.
+ *
+ * Much cheaper than std::mt19937 plus a distribution (16 bytes of state, a
+ * few shifts and rotates per number) and, unlike the standard distributions,
+ * produces the same sequence on every compiler and platform, so a seed fully
+ * determines the game's random choices.
+ *
+ * Streams are owned by the RandomService; systems keep a reference.
+ */
+class RandomStream {
+public:
+    struct State {
+        uint32_t s[4];
+    };
+
+    /**
+     * @param seed Any value; expanded to the full state with splitmix64
+     */
+    explicit RandomStream(uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(uint64_t seed);
+
+    uint32_t nextU32() {
+        const uint32_t result = rotl(state_.s[1] * 5, 7) * 9;
+        const uint32_t t = state_.s[1] << 9;
+        state_.s[2] ^= state_.s[0];
+        state_.s[3] ^= state_.s[1];
+        state_.s[1] ^= state_.s[2];
+        state_.s[0] ^= state_.s[3];
+        state_.s[2] ^= t;
+        state_.s[3] = rotl(state_.s[3], 11);
+        return result;
+    }
+
+    /**
+     * @return Uniform float in [0, 1)
+     */
+    float nextFloat() { return toUnitFloat(nextU32()); }
+
+    /**
+     * @return Uniform float in [min, max)
+     */
+    float range(float min, float max) { return min + (max - min) * nextFloat(); }
+
+    /**
+     * @return Uniform integer in [0, bound); 0 if bound is 0
+     */
+    uint32_t nextBelow(uint32_t bound) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(nextU32()) * bound) >> 32);
+    }
+
+    /**
+     * @return true with the given probability
+     */
+    bool chance(float probability) { return nextFloat() < probability; }
+
+    /**
+     * Fill an array with uniform floats in [min, max). The generator state is
+     * kept in registers for the whole loop, which makes this several times
+     * faster than calling range() per element.
+     */
+    void fill(float* out, size_t count, float min = 0.0f, float max = 1.0f);
+
+    /**
+     * Fill an array with raw 32-bit values.
+     */
+    void fill(uint32_t* out, size_t count);
+
+    const State& getState() const { return state_; }
+    void setState(const State& state) { state_ = state; }
+
+private:
+    static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    // Top 24 bits scaled by 2^-24: exactly representable, never reaches 1
+    static float toUnitFloat(uint32_t x) { return static_cast<float>(x >> 8) * (1.0f / 16777216.0f); }
+
+    State state_;
+};
+
+/**
+ * RandomService - the world's source of randomness.
+ *
+ * Every system draws from its own named stream. Each stream is seeded from
+ * the world seed and a hash of its name, so streams are independent: adding
+ * random calls to one system does not shift the numbers another one sees.
+ *
+ * The world seed comes from GameData.json ("world.seed") or --seed; without
+ * one a random seed is picked at startup and logged so the run can be
+ * reproduced. saveState()/loadState() capture every stream for save games
+ * and replays.
+ */
+class RandomService {
+public:
+    static RandomService& getInstance() {
+        if (RandomService* local = WorldLocal<RandomService>::get()) {
+            return *local;
+        }
+        static RandomService instance;
+        return instance;
+    }
+
+    RandomService(const RandomService&) = delete;
+    RandomService& operator=(const RandomService&) = delete;
+
+    /**
+     * Set the world seed and reseed all existing streams from it.
+     */
+    void setSeed(uint64_t seed);
+    uint64_t getSeed() const { return seed_; }
+
+    /**
+     * Get the stream with this name, creating it on first use. The
+     * reference stays valid for the lifetime of the service.
+     */
+    RandomStream& stream(const std::string& name);
+
+    /**
+     * @return The world seed and the state of every stream
+     */
+    nlohmann::json saveState() const;
+
+    /**
+     * Restore state written by saveState(). Streams missing from the data
+     * are reseeded from the restored world seed.
+     * @return false if the data is malformed; nothing is changed then
+     */
+    bool loadState(const nlohmann::json& data);
+
+    /**
+     * @return Whether loadState() would accept the data; changes nothing
+     */
+    static bool isValidState(const nlohmann::json& data);
+
+private:
+    RandomService();
+    friend class WorldLocal<RandomService>;
+
+    uint64_t streamSeed(const std::string& name) const;
+
+    uint64_t seed_;
+    std::unordered_map<std::string, std::unique_ptr<RandomStream>> streams_;
+};
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,39 @@
+#include "RollbackBuffer.hpp"
+#include <algorithm>
+
+namespace game {
+namespace ecs {
+
+RollbackBuffer::RollbackBuffer(size_t capacity)
+    : capacity_(std::max<size_t>(1, capacity)), ticks_(capacity_, 0) {}
+
+void RollbackBuffer::save(uint32_t tick) {
+    const size_t slot = tick % capacity_;
+    lastSaveSize_ = 0;
+    for (const auto& store : stores_) {
+        lastSaveSize_ += store->save(slot);
+    }
+    ticks_[slot] = tick;
+}
+
+bool RollbackBuffer::restore(uint32_t tick) {
+    if (!contains(tick)) {
+        return false;
+    }
+    const size_t slot = tick % capacity_;
+    for (const auto& store : stores_) {
+        store->restore(slot);
+    }
+    return true;
+}
+
+bool RollbackBuffer::contains(uint32_t tick) const {
+    return tick != 0 && ticks_[tick % capacity_] == tick;
+}
+
+void RollbackBuffer::clear() {
+    std::fill(ticks_.begin(), ticks_.end(), 0);
+}
+
+} // namespace ecs
+} // namespace game
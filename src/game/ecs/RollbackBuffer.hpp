@@ -0,0 +1,125 @@
+#pragma once
+
+#include "ComponentManager.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace game {
+namespace ecs {
+
+/**
+ * RollbackBuffer - per-tick copies of selected component types.
+ *
+ * save(tick) copies every component of each registered type into a ring slot;
+ * restore(tick) writes those values back, so the world can be rewound a few
+ * ticks and simulated forward again. Copies are made into storage reused
+ * from earlier saves, so a steady-state save does not allocate.
+ *
+ * Only component values are rewound: an entity created after the saved tick
+ * keeps its current state, and one destroyed since is not brought back.
+ * Spawning and despawning stay authoritative (from the server or the live
+ * simulation).
+ */
+class RollbackBuffer {
+public:
+    /**
+     * @param capacity Number of ticks kept (older ticks are overwritten)
+     */
+    explicit RollbackBuffer(size_t capacity = 64);
+
+    /**
+     * Save and restore components of type T. T must be copy-constructible
+     * and copy-assignable.
+     * @param restore Writes a saved value back into the live component;
+     *        plain assignment if empty (pass one that goes through setters
+     *        when the component tracks its own changes)
+     */
+    template <typename T>
+    void registerComponent(std::function<void(T&, const T&)> restore = {}) {
+        stores_.push_back(std::make_unique<Store<T>>(capacity_, std::move(restore)));
+    }
+
+    /**
+     * Copy the current value of every registered component as tick.
+     */
+    void save(uint32_t tick);
+
+    /**
+     * Write the values saved for tick back into the live components.
+     * @return false if tick is not (or no longer) in the buffer
+     */
+    bool restore(uint32_t tick);
+
+    bool contains(uint32_t tick) const;
+
+    /**
+     * Forget every saved tick.
+     */
+    void clear();
+
+    size_t getCapacity() const { return capacity_; }
+
+    /**
+     * @return Components copied by the last save()
+     */
+    size_t getLastSaveSize() const { return lastSaveSize_; }
+
+private:
+    struct StoreBase {
+        virtual ~StoreBase() = default;
+        virtual size_t save(size_t slot) = 0;
+        virtual void restore(size_t slot) = 0;
+    };
+
+    template <typename T>
+    struct Store : StoreBase {
+        Store(size_t capacity, std::function<void(T&, const T&)> restoreFn)
+            : slots(capacity), restoreFn(std::move(restoreFn)) {}
+
+        size_t save(size_t slot) override {
+            auto& saved = slots[slot];
+            size_t count = 0;
+            ComponentManager::getInstance().forEachComponent<T>(
+                [&](Entity::ID id, const T& component) {
+                    // Assign over earlier copies so their storage is reused
+                    if (count < saved.size()) {
+                        saved[count].first = id;
+                        saved[count].second = component;
+                    } else {
+                        saved.emplace_back(id, component);
+                    }
+                    ++count;
+                });
+            saved.erase(saved.begin() + count, saved.end());
+            return count;
+        }
+
+        void restore(size_t slot) override {
+            ComponentManager& cm = ComponentManager::getInstance();
+            for (const auto& [id, value] : slots[slot]) {
+                if (T* live = cm.getComponent<T>(id)) {
+                    if (restoreFn) {
+                        restoreFn(*live, value);
+                    } else {
+                        *live = value;
+                    }
+                }
+            }
+        }
+
+        std::vector<std::vector<std::pair<Entity::ID, T>>> slots;
+        std::function<void(T&, const T&)> restoreFn;
+    };
+
+    size_t capacity_;
+    std::vector<uint32_t> ticks_; // Tick held by each slot (0 = empty)
+    std::vector<std::unique_ptr<StoreBase>> stores_;
+    size_t lastSaveSize_ = 0;
+};
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,59 @@
+#include "SimulationLod.hpp"
+#include <algorithm>
+
+namespace game {
+namespace ecs {
+
+SimulationLod::SimulationLod()
+    : viewLeft_(0.0f)
+    , viewTop_(0.0f)
+    , viewRight_(800.0f)
+    , viewBottom_(600.0f)
+    , margin_(DEFAULT_MARGIN)
+    , focusRadius_(DEFAULT_FOCUS_RADIUS)
+    , offscreenInterval_(DEFAULT_OFFSCREEN_INTERVAL)
+    , frame_(0)
+{
+}
+
+void SimulationLod::beginFrame() {
+    frame_++;
+    focusPoints_.clear();
+}
+
+void SimulationLod::setViewport(float x, float y, float width, float height) {
+    viewLeft_ = x;
+    viewTop_ = y;
+    viewRight_ = x + width;
+    viewBottom_ = y + height;
+}
+
+void SimulationLod::addFocusPoint(const Vector2& position) {
+    focusPoints_.push_back(position);
+}
+
+void SimulationLod::setOffscreenInterval(int frames) {
+    offscreenInterval_ = std::max(1, frames);
+}
+
+bool SimulationLod::isFullRate(const Vector2& position) const {
+    if (offscreenInterval_ <= 1) {
+        return true;
+    }
+    if (position.x >= viewLeft_ - margin_ && position.x <= viewRight_ + margin_ &&
+        position.y >= viewTop_ - margin_ && position.y <= viewBottom_ + margin_) {
+        return true;
+    }
+    float radiusSquared = focusRadius_ * focusRadius_;
+    for (const Vector2& focus : focusPoints_) {
+        float dx = position.x - focus.x;
+        float dy = position.y - focus.y;
+        if (dx * dx + dy * dy <= radiusSquared) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Vector2.hpp"
+#include "WorldLocal.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace ecs {
+
+/**
+ * SimulationLod - shared level-of-detail state for simulation systems.
+ *
+ * Entities inside the viewport (grown by a margin) or near a focus point
+ * (the player) are simulated every frame. Everything else is "far" and is
+ * only simulated every getOffscreenInterval() frames. Far entities are
+ * staggered by ID so that they do not all update on the same frame.
+ *
+ * Systems opt in per component type with System::registerLodComponent<T>()
+ * and ask System::shouldSimulate() for each entity. It accumulates skipped
+ * time, so a far entity's step covers all frames it sat out.
+ *
+ * GameWorld sets the viewport and focus points and calls beginFrame() once
+ * per update. The QualityGovernor sets the off-screen interval.
+ */
+class SimulationLod {
+public:
+    static constexpr float DEFAULT_MARGIN = 32.0f;        // Pixels around the viewport
+    static constexpr float DEFAULT_FOCUS_RADIUS = 200.0f;  // Full-rate radius around focus points
+    static constexpr int DEFAULT_OFFSCREEN_INTERVAL = 2;   // Frames per far update
+
+    static SimulationLod& getInstance() {
+        if (SimulationLod* local = WorldLocal<SimulationLod>::get()) {
+            return *local;
+        }
+        static SimulationLod instance;
+        return instance;
+    }
+
+    SimulationLod(const SimulationLod&) = delete;
+    SimulationLod& operator=(const SimulationLod&) = delete;
+
+    /**
+     * Advance the frame counter used for staggering and clear the focus
+     * points. Call once per world update, before the systems run.
+     */
+    void beginFrame();
+
+    /**
+     * Set the visible area in world coordinates.
+     * @param x Left edge
+     * @param y Top edge
+     * @param width Viewport width
+     * @param height Viewport height
+     */
+    void setViewport(float x, float y, float width, float height);
+
+    /**
+     * @param margin Extra distance around the viewport that still counts as visible
+     */
+    void setMargin(float margin) { margin_ = margin; }
+
+    /**
+     * Keep entities within the focus radius of this point at full rate.
+     * Focus points are cleared by beginFrame().
+     * @param position Focus point in world coordinates (e.g. the player)
+     */
+    void addFocusPoint(const Vector2& position);
+
+    void setFocusRadius(float radius) { focusRadius_ = radius; }
+
+    /**
+     * @param frames Simulate far entities every this many frames (1 = full rate)
+     */
+    void setOffscreenInterval(int frames);
+    int getOffscreenInterval() const { return offscreenInterval_; }
+
+    /**
+     * @return true if an entity at this position must be simulated every frame
+     */
+    bool isFullRate(const Vector2& position) const;
+
+    /**
+     * @return true if a far entity with this ID is due for an update this frame
+     */
+    bool isScheduled(uint64_t entityId) const {
+        return (frame_ + entityId) % static_cast<uint64_t>(offscreenInterval_) == 0;
+    }
+
+    uint64_t getFrame() const { return frame_; }
+
+    // Restore the frame counter (replay keyframes), which staggers far updates
+    void setFrame(uint64_t frame) { frame_ = frame; }
+
+private:
+    SimulationLod();
+    friend class WorldLocal<SimulationLod>;
+
+    float viewLeft_;
+    float viewTop_;
+    float viewRight_;
+    float viewBottom_;
+    float margin_;
+    float focusRadius_;
+    int offscreenInterval_;
+    uint64_t frame_;
+    std::vector<Vector2> focusPoints_;
+};
+
+} // namespace ecs
+} // namespace game
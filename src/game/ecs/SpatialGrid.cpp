@@ -0,0 +1,135 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace game {
+namespace ecs {
+
+namespace {
+
+// Cells per item before the cells are made larger
+constexpr size_t CELLS_PER_ITEM = 4;
+constexpr size_t MIN_CELLS = 64;
+
+} // namespace
+
+SpatialGrid::SpatialGrid(float cellSize) : cellSize_(cellSize) {}
+
+int SpatialGrid::cellX(float x) const {
+    const float cell = (x - originX_) * inverseCell_;
+    if (!(cell > 0.0f)) {
+        return 0;
+    }
+    return cell >= static_cast<float>(columns_) ? columns_ - 1 : static_cast<int>(cell);
+}
+
+int SpatialGrid::cellY(float y) const {
+    const float cell = (y - originY_) * inverseCell_;
+    if (!(cell > 0.0f)) {
+        return 0;
+    }
+    return cell >= static_cast<float>(rows_) ? rows_ - 1 : static_cast<int>(cell);
+}
+
+void SpatialGrid::build(const float* left, const float* top, const float* right,
+                        const float* bottom, size_t count) {
+    minX_.resize(count);
+    minY_.resize(count);
+    maxX_.resize(count);
+    maxY_.resize(count);
+    if (marks_.size() < count) {
+        marks_.assign(count, 0);
+        stamp_ = 0;
+    }
+
+    float boundsLeft = 0.0f, boundsTop = 0.0f, boundsRight = 0.0f, boundsBottom = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        minX_[i] = std::min(left[i], right[i]);
+        maxX_[i] = std::max(left[i], right[i]);
+        minY_[i] = std::min(top[i], bottom[i]);
+        maxY_[i] = std::max(top[i], bottom[i]);
+        if (i == 0) {
+            boundsLeft = minX_[i];
+            boundsTop = minY_[i];
+            boundsRight = maxX_[i];
+            boundsBottom = maxY_[i];
+        } else {
+            boundsLeft = std::min(boundsLeft, minX_[i]);
+            boundsTop = std::min(boundsTop, minY_[i]);
+            boundsRight = std::max(boundsRight, maxX_[i]);
+            boundsBottom = std::max(boundsBottom, maxY_[i]);
+        }
+    }
+
+    // Grow the cells if the preferred size would need too many of them
+    const float width = boundsRight - boundsLeft;
+    const float height = boundsBottom - boundsTop;
+    const size_t maxCells = std::max(MIN_CELLS, count * CELLS_PER_ITEM);
+    cell_ = cellSize_ > 0.0f ? cellSize_ : 64.0f;
+    const float area = width * height;
+    if (std::isfinite(area) && area / (cell_ * cell_) > static_cast<float>(maxCells)) {
+        cell_ = std::sqrt(area / static_cast<float>(maxCells));
+    }
+    // A flat spread (items along one line) has almost no area but may still
+    // be too long for maxCells cells on one axis; grow the cells to fit it
+    // rather than cut the grid short of the items
+    const float span = std::max(width, height);
+    if (std::isfinite(span) && span / cell_ > static_cast<float>(maxCells)) {
+        cell_ = span / static_cast<float>(maxCells);
+    }
+    if (!std::isfinite(cell_) || cell_ <= 0.0f) {
+        cell_ = 64.0f;
+    }
+    inverseCell_ = 1.0f / cell_;
+    originX_ = boundsLeft;
+    originY_ = boundsTop;
+    // The limit only bites for non-finite bounds; finite ones fit by now
+    columns_ = count == 0 ? 0 : static_cast<int>(std::min<float>(width * inverseCell_, maxCells)) + 1;
+    rows_ = count == 0 ? 0 : static_cast<int>(std::min<float>(height * inverseCell_, maxCells)) + 1;
+
+    // Counting sort of items into cells: count, prefix sum, fill
+    const size_t cells = static_cast<size_t>(columns_) * rows_;
+    cellStart_.assign(cells + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
+        const int x0 = cellX(minX_[i]), x1 = cellX(maxX_[i]);
+        const int y0 = cellY(minY_[i]), y1 = cellY(maxY_[i]);
+        for (int row = y0; row <= y1; ++row) {
+            for (int column = x0; column <= x1; ++column) {
+                ++cellStart_[static_cast<size_t>(row) * columns_ + column + 1];
+            }
+        }
+    }
+    for (size_t cell = 0; cell < cells; ++cell) {
+        cellStart_[cell + 1] += cellStart_[cell];
+    }
+    cellItems_.resize(cellStart_[cells]);
+    for (size_t i = 0; i < count; ++i) {
+        const int x0 = cellX(minX_[i]), x1 = cellX(maxX_[i]);
+        const int y0 = cellY(minY_[i]), y1 = cellY(maxY_[i]);
+        for (int row = y0; row <= y1; ++row) {
+            for (int column = x0; column <= x1; ++column) {
+                // cellStart_ is used as the fill cursor and shifted back below
+                cellItems_[cellStart_[static_cast<size_t>(row) * columns_ + column]++] =
+                    static_cast<uint32_t>(i);
+            }
+        }
+    }
+    for (size_t cell = cells; cell > 0; --cell) {
+        cellStart_[cell] = cellStart_[cell - 1];
+    }
+    if (!cellStart_.empty()) {
+        cellStart_[0] = 0;
+    }
+}
+
+uint32_t SpatialGrid::nextStamp() const {
+    if (++stamp_ == 0) {
+        // Wrapped: forget every old mark
+        std::fill(marks_.begin(), marks_.end(), 0);
+        stamp_ = 1;
+    }
+    return stamp_;
+}
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace ecs {
+
+/**
+ * SpatialGrid - uniform grid broadphase over axis-aligned boxes.
+ *
+ * build() bins every box into the cells it overlaps with a counting sort, so
+ * the grid is two flat arrays (cell offsets and item indices) that are reused
+ * from frame to frame. Items are identified by their index in the arrays
+ * passed to build(); boxes with right < left (or bottom < top) are treated as
+ * their flipped box.
+ *
+ * The grid covers the bounding box of all items. When items are spread far
+ * apart (or along a long line) the cells grow so the cell count stays
+ * proportional to the item count and no axis needs more than that many.
+ *
+ * CollisionSystem builds the grid each frame and SpatialQuery answers
+ * gameplay queries from the same grid.
+ */
+class SpatialGrid {
+public:
+    /**
+     * @param cellSize Preferred cell edge length in world units
+     */
+    explicit SpatialGrid(float cellSize = 64.0f);
+
+    void setCellSize(float cellSize) { cellSize_ = cellSize; }
+    float getCellSize() const { return cellSize_; }
+
+    /**
+     * Rebuild from count boxes given as separate edge arrays.
+     */
+    void build(const float* left, const float* top, const float* right, const float* bottom,
+               size_t count);
+
+    size_t size() const { return minX_.size(); }
+
+    // Normalized bounds of item i (min <= max)
+    float getMinX(uint32_t i) const { return minX_[i]; }
+    float getMinY(uint32_t i) const { return minY_[i]; }
+    float getMaxX(uint32_t i) const { return maxX_[i]; }
+    float getMaxY(uint32_t i) const { return maxY_[i]; }
+
+    // Grid layout of the last build (cells actually used, after growing)
+    int getColumns() const { return columns_; }
+    int getRows() const { return rows_; }
+    float getOriginX() const { return originX_; }
+    float getOriginY() const { return originY_; }
+    float getEffectiveCellSize() const { return cell_; }
+
+    /**
+     * Cell containing a point, clamped to the grid.
+     */
+    int cellX(float x) const;
+    int cellY(float y) const;
+
+    /**
+     * Items registered in one cell, in ascending index order.
+     * @return Number of items; *items points at the first
+     */
+    size_t getCellItems(int column, int row, const uint32_t** items) const {
+        const size_t cell = static_cast<size_t>(row) * columns_ + column;
+        *items = cellItems_.data() + cellStart_[cell];
+        return cellStart_[cell + 1] - cellStart_[cell];
+    }
+
+    /**
+     * Call fn(a, b) once for every pair a < b whose normalized boxes touch
+     * (closed intervals). Pairs come out grouped by cell, not sorted.
+     */
+    template <typename Fn>
+    void forEachPair(Fn&& fn) const {
+        for (int row = 0; row < rows_; ++row) {
+            for (int column = 0; column < columns_; ++column) {
+                const uint32_t* items;
+                const size_t count = getCellItems(column, row, &items);
+                for (size_t i = 0; i < count; ++i) {
+                    const uint32_t a = items[i];
+                    for (size_t j = i + 1; j < count; ++j) {
+                        const uint32_t b = items[j];
+                        if (minX_[a] > maxX_[b] || maxX_[a] < minX_[b] ||
+                            minY_[a] > maxY_[b] || maxY_[a] < minY_[b]) {
+                            continue;
+                        }
+                        // Report the pair only in the cell holding the top-left
+                        // corner of the overlap, which both boxes cover
+                        const float refX = minX_[a] > minX_[b] ? minX_[a] : minX_[b];
+                        const float refY = minY_[a] > minY_[b] ? minY_[a] : minY_[b];
+                        if (cellX(refX) == column && cellY(refY) == row) {
+                            fn(a, b);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Call fn(i) once for every item registered in a cell overlapping the
+     * box. Candidates only: the caller does the exact test.
+     */
+    template <typename Fn>
+    void forEachCandidate(float left, float top, float right, float bottom, Fn&& fn) const {
+        if (minX_.empty() || !(left <= right) || !(top <= bottom)) {
+            return;
+        }
+        const uint32_t stamp = nextStamp();
+        const int x0 = cellX(left), x1 = cellX(right);
+        const int y0 = cellY(top), y1 = cellY(bottom);
+        for (int row = y0; row <= y1; ++row) {
+            for (int column = x0; column <= x1; ++column) {
+                const uint32_t* items;
+                const size_t count = getCellItems(column, row, &items);
+                for (size_t i = 0; i < count; ++i) {
+                    if (marks_[items[i]] != stamp) {
+                        marks_[items[i]] = stamp;
+                        fn(items[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Start a new visit: items marked with the returned stamp have been seen.
+     * Used by queries that walk cells themselves.
+     */
+    uint32_t nextStamp() const;
+
+    /**
+     * Mark item i as visited for the current stamp.
+     * @return false if it was already visited
+     */
+    bool visit(uint32_t i, uint32_t stamp) const {
+        if (marks_[i] == stamp) {
+            return false;
+        }
+        marks_[i] = stamp;
+        return true;
+    }
+
+private:
+    float cellSize_;
+
+    // Layout of the last build
+    float originX_ = 0.0f;
+    float originY_ = 0.0f;
+    float cell_ = 64.0f;
+    float inverseCell_ = 1.0f / 64.0f;
+    int columns_ = 0;
+    int rows_ = 0;
+
+    // Normalized item bounds
+    std::vector<float> minX_;
+    std::vector<float> minY_;
+    std::vector<float> maxX_;
+    std::vector<float> maxY_;
+
+    // Counting-sorted cell contents: items of cell c are
+    // cellItems_[cellStart_[c] .. cellStart_[c + 1])
+    std::vector<uint32_t> cellStart_;
+    std::vector<uint32_t> cellItems_;
+
+    // Per-item visit stamps for duplicate-free queries
+    mutable std::vector<uint32_t> marks_;
+    mutable uint32_t stamp_ = 0;
+};
+
+} // namespace ecs
+} // namespace game
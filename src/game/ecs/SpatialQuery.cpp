@@ -0,0 +1,225 @@
+#include "SpatialQuery.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace game {
+namespace ecs {
+
+namespace {
+
+// Entry distance of a ray (unit direction) into a box, or -1 if it misses.
+// A ray starting inside the box enters at 0.
+float rayBoxEntry(float originX, float originY, float dirX, float dirY, float minX, float minY,
+                  float maxX, float maxY) {
+    float tNear = 0.0f;
+    float tFar = std::numeric_limits<float>::infinity();
+    const float origin[2] = {originX, originY};
+    const float dir[2] = {dirX, dirY};
+    const float lo[2] = {minX, minY};
+    const float hi[2] = {maxX, maxY};
+    for (int axis = 0; axis < 2; ++axis) {
+        if (dir[axis] == 0.0f) {
+            if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) {
+                return -1.0f;
+            }
+            continue;
+        }
+        const float inverse = 1.0f / dir[axis];
+        float t0 = (lo[axis] - origin[axis]) * inverse;
+        float t1 = (hi[axis] - origin[axis]) * inverse;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        tNear = std::max(tNear, t0);
+        tFar = std::min(tFar, t1);
+        if (tNear > tFar) {
+            return -1.0f;
+        }
+    }
+    return tNear;
+}
+
+} // namespace
+
+void SpatialQuery::rebuild(const Entity* entities, const float* left, const float* top,
+                           const float* right, const float* bottom, const uint32_t* layers,
+                           size_t count) {
+    entities_.assign(entities, entities + count);
+    layers_.assign(layers, layers + count);
+    grid_.build(left, top, right, bottom, count);
+}
+
+float SpatialQuery::distanceSquared(uint32_t i, float x, float y) const {
+    const float dx = std::max({grid_.getMinX(i) - x, 0.0f, x - grid_.getMaxX(i)});
+    const float dy = std::max({grid_.getMinY(i) - y, 0.0f, y - grid_.getMaxY(i)});
+    return dx * dx + dy * dy;
+}
+
+size_t SpatialQuery::queryRadius(const Vector2& center, float radius, uint32_t layerMask,
+                                 Entity* out, size_t capacity) const {
+    size_t found = 0;
+    const float radiusSquared = radius * radius;
+    grid_.forEachCandidate(center.x - radius, center.y - radius, center.x + radius,
+                           center.y + radius, [&](uint32_t i) {
+                               if (found < capacity && (layers_[i] & layerMask) != 0 &&
+                                   distanceSquared(i, center.x, center.y) <= radiusSquared) {
+                                   out[found++] = entities_[i];
+                               }
+                           });
+    return found;
+}
+
+size_t SpatialQuery::queryAABB(float left, float top, float right, float bottom,
+                               uint32_t layerMask, Entity* out, size_t capacity) const {
+    size_t found = 0;
+    grid_.forEachCandidate(left, top, right, bottom, [&](uint32_t i) {
+        if (found < capacity && (layers_[i] & layerMask) != 0 && grid_.getMinX(i) <= right &&
+            grid_.getMaxX(i) >= left && grid_.getMinY(i) <= bottom && grid_.getMaxY(i) >= top) {
+            out[found++] = entities_[i];
+        }
+    });
+    return found;
+}
+
+size_t SpatialQuery::nearest(const Vector2& point, size_t k, uint32_t layerMask, Hit* out,
+                             float maxDistance) const {
+    if (k == 0 || entities_.empty()) {
+        return 0;
+    }
+    const float maxSquared = maxDistance * maxDistance;
+    const int columns = grid_.getColumns();
+    const int rows = grid_.getRows();
+    const float cell = grid_.getEffectiveCellSize();
+    const int centerX = grid_.cellX(point.x);
+    const int centerY = grid_.cellY(point.y);
+    const int lastRing = std::max({centerX, columns - 1 - centerX, centerY, rows - 1 - centerY});
+    const uint32_t stamp = grid_.nextStamp();
+
+    // out[0..found) stays sorted by squared distance until the end
+    size_t found = 0;
+    auto consider = [&](int column, int row) {
+        const uint32_t* items;
+        const size_t count = grid_.getCellItems(column, row, &items);
+        for (size_t n = 0; n < count; ++n) {
+            const uint32_t i = items[n];
+            if (!grid_.visit(i, stamp) || (layers_[i] & layerMask) == 0) {
+                continue;
+            }
+            const float d2 = distanceSquared(i, point.x, point.y);
+            if (d2 > maxSquared || (found == k && d2 >= out[k - 1].distance)) {
+                continue;
+            }
+            size_t slot = found < k ? found++ : k - 1;
+            while (slot > 0 && out[slot - 1].distance > d2) {
+                out[slot] = out[slot - 1];
+                --slot;
+            }
+            out[slot].entity = entities_[i];
+            out[slot].distance = d2;
+        }
+    };
+
+    // Visit rings of cells around the point's cell; stop once nothing outside
+    // the visited square can beat the k-th hit
+    for (int ring = 0; ring <= lastRing; ++ring) {
+        for (int row = centerY - ring; row <= centerY + ring; ++row) {
+            if (row < 0 || row >= rows) {
+                continue;
+            }
+            const bool edgeRow = row == centerY - ring || row == centerY + ring;
+            const int step = edgeRow ? 1 : std::max(1, 2 * ring);
+            for (int column = centerX - ring; column <= centerX + ring; column += step) {
+                if (column >= 0 && column < columns) {
+                    consider(column, row);
+                }
+            }
+        }
+
+        const float regionLeft = grid_.getOriginX() + (centerX - ring) * cell;
+        const float regionTop = grid_.getOriginY() + (centerY - ring) * cell;
+        const float regionRight = grid_.getOriginX() + (centerX + ring + 1) * cell;
+        const float regionBottom = grid_.getOriginY() + (centerY + ring + 1) * cell;
+        const float bound = std::max(0.0f, std::min({point.x - regionLeft, regionRight - point.x,
+                                                     point.y - regionTop, regionBottom - point.y}));
+        if (bound > maxDistance || (found == k && out[k - 1].distance <= bound * bound)) {
+            break;
+        }
+    }
+
+    for (size_t n = 0; n < found; ++n) {
+        out[n].distance = std::sqrt(out[n].distance);
+    }
+    return found;
+}
+
+bool SpatialQuery::raycast(const Vector2& origin, const Vector2& direction, float maxDistance,
+                           uint32_t layerMask, Hit& hit) const {
+    const float length = direction.length();
+    if (entities_.empty() || length == 0.0f || !(maxDistance >= 0.0f)) {
+        return false;
+    }
+    const float dirX = direction.x / length;
+    const float dirY = direction.y / length;
+
+    // Clip the ray to the grid
+    const float cell = grid_.getEffectiveCellSize();
+    const int columns = grid_.getColumns();
+    const int rows = grid_.getRows();
+    const float gridLeft = grid_.getOriginX();
+    const float gridTop = grid_.getOriginY();
+    const float tStart = rayBoxEntry(origin.x, origin.y, dirX, dirY, gridLeft, gridTop,
+                                     gridLeft + columns * cell, gridTop + rows * cell);
+    if (tStart < 0.0f || tStart > maxDistance) {
+        return false;
+    }
+
+    // Walk the cells along the ray (Amanatides & Woo)
+    int column = grid_.cellX(origin.x + dirX * tStart);
+    int row = grid_.cellY(origin.y + dirY * tStart);
+    const int stepX = dirX > 0.0f ? 1 : (dirX < 0.0f ? -1 : 0);
+    const int stepY = dirY > 0.0f ? 1 : (dirY < 0.0f ? -1 : 0);
+    const float infinity = std::numeric_limits<float>::infinity();
+    float tMaxX = stepX == 0 ? infinity
+                             : (gridLeft + (column + (stepX > 0 ? 1 : 0)) * cell - origin.x) / dirX;
+    float tMaxY = stepY == 0 ? infinity
+                             : (gridTop + (row + (stepY > 0 ? 1 : 0)) * cell - origin.y) / dirY;
+    const float tDeltaX = stepX == 0 ? infinity : cell / std::fabs(dirX);
+    const float tDeltaY = stepY == 0 ? infinity : cell / std::fabs(dirY);
+
+    const uint32_t stamp = grid_.nextStamp();
+    float best = infinity;
+    while (column >= 0 && column < columns && row >= 0 && row < rows) {
+        const uint32_t* items;
+        const size_t count = grid_.getCellItems(column, row, &items);
+        for (size_t n = 0; n < count; ++n) {
+            const uint32_t i = items[n];
+            if (!grid_.visit(i, stamp) || (layers_[i] & layerMask) == 0) {
+                continue;
+            }
+            const float t = rayBoxEntry(origin.x, origin.y, dirX, dirY, grid_.getMinX(i),
+                                        grid_.getMinY(i), grid_.getMaxX(i), grid_.getMaxY(i));
+            if (t >= 0.0f && t <= maxDistance && t < best) {
+                best = t;
+                hit.entity = entities_[i];
+                hit.distance = t;
+            }
+        }
+
+        // A hit before the next cell boundary cannot be beaten further on
+        const float tNext = std::min(tMaxX, tMaxY);
+        if (best <= tNext || tNext > maxDistance) {
+            break;
+        }
+        if (tMaxX < tMaxY) {
+            column += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            row += stepY;
+            tMaxY += tDeltaY;
+        }
+    }
+    return best != infinity;
+}
+
+} // namespace ecs
+} // namespace game
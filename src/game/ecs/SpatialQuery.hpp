@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "SpatialGrid.hpp"
+#include "Vector2.hpp"
+#include "WorldLocal.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace game {
+namespace ecs {
+
+/**
+ * SpatialQuery - "what is near here" for gameplay code.
+ *
+ * Answers radius, box, k-nearest and ray queries over the collision boxes
+ * that CollisionSystem computed in its last update, using the same
+ * SpatialGrid it uses as its broadphase, so no query scans every entity.
+ * Results are a snapshot of that update: an entity destroyed since then may
+ * still be returned, so look its components up before using them.
+ *
+ * Every query takes a layer mask (Layer bits) and writes into a buffer the
+ * caller owns; nothing is allocated per query. Not thread-safe.
+ */
+class SpatialQuery {
+public:
+    // What a collision box belongs to, as filter bits
+    enum Layer : uint32_t {
+        LAYER_PLAYER = 1u << 0,
+        LAYER_TARGET = 1u << 1,
+        LAYER_PROJECTILE = 1u << 2,
+        LAYER_OTHER = 1u << 3,
+        LAYER_ALL = 0xFFFFFFFFu
+    };
+
+    struct Hit {
+        Entity entity;
+        float distance = 0.0f; // From the query point or ray origin
+    };
+
+    static SpatialQuery& getInstance() {
+        if (SpatialQuery* local = WorldLocal<SpatialQuery>::get()) {
+            return *local;
+        }
+        static SpatialQuery instance;
+        return instance;
+    }
+
+    /**
+     * Replace the indexed boxes (CollisionSystem calls this every update).
+     * @param entities Owner of each box
+     * @param layers Layer bit of each box
+     */
+    void rebuild(const Entity* entities, const float* left, const float* top, const float* right,
+                 const float* bottom, const uint32_t* layers, size_t count);
+
+    /**
+     * @return Broadphase grid of the indexed boxes (item i is entity i)
+     */
+    const SpatialGrid& getGrid() const { return grid_; }
+
+    size_t size() const { return entities_.size(); }
+
+    /**
+     * Entities whose box overlaps the circle.
+     * @return Number of entities written to out (at most capacity)
+     */
+    size_t queryRadius(const Vector2& center, float radius, uint32_t layerMask, Entity* out,
+                       size_t capacity) const;
+
+    /**
+     * Entities whose box overlaps [left, right] x [top, bottom].
+     * @return Number of entities written to out (at most capacity)
+     */
+    size_t queryAABB(float left, float top, float right, float bottom, uint32_t layerMask,
+                     Entity* out, size_t capacity) const;
+
+    /**
+     * Up to k entities closest to a point (distance to the box, 0 inside),
+     * nearest first.
+     * @param maxDistance Ignore entities further away than this
+     * @return Number of hits written to out
+     */
+    size_t nearest(const Vector2& point, size_t k, uint32_t layerMask, Hit* out,
+                   float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+    /**
+     * First box hit by a ray. A ray starting inside a box hits it at 0.
+     * @param direction Ray direction; need not be normalized
+     * @param hit Receives the entity and the distance along the ray
+     * @return true if something within maxDistance was hit
+     */
+    bool raycast(const Vector2& origin, const Vector2& direction, float maxDistance,
+                 uint32_t layerMask, Hit& hit) const;
+
+private:
+    SpatialQuery() = default;
+    friend class WorldLocal<SpatialQuery>;
+    SpatialQuery(const SpatialQuery&) = delete;
+    SpatialQuery& operator=(const SpatialQuery&) = delete;
+
+    // Squared distance from a point to box i (0 inside)
+    float distanceSquared(uint32_t i, float x, float y) const;
+
+    SpatialGrid grid_;
+    std::vector<Entity> entities_;
+    std::vector<uint32_t> layers_;
+};
+
+} // namespace ecs
+} // namespace game
@@ -14,13 +14,12 @@ bool System::hasRequiredComponents(const Entity& entity) const {
         return false;
     }
 
-    // Check required components
-    for (const auto& componentType : requiredComponents_) {
-        if (!componentManager_->hasComponent(entity, componentType)) {
-            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Entity %llu missing required component %s for system %s", 
-                entity.getId(), componentType.name(), typeid(*this).name());
-            return false;
-        }
+    // Check required components against the entity's signature
+    const Signature signature = componentManager_->getSignature(entity);
+    if ((signature & requiredSignature_) != requiredSignature_) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Entity %llu missing required components for system %s", 
+            entity.getId(), typeid(*this).name());
+        return false;
     }
 
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Entity %llu has all required components for system %s", 
@@ -28,6 +27,43 @@ bool System::hasRequiredComponents(const Entity& entity) const {
     return true;
 }
 
+bool System::shouldSimulate(const Entity& entity, const Vector2& position, float deltaTime, float& stepTime) {
+    stepTime = deltaTime;
+    if (lodSignature_.none()) {
+        return true;
+    }
+
+    const SimulationLod& lod = SimulationLod::getInstance();
+    bool eligible = (componentManager_->getSignature(entity) & lodSignature_).any();
+    if (eligible && !lod.isFullRate(position) && !lod.isScheduled(entity.getId())) {
+        lodPendingTime_[entity.getId()] += deltaTime;
+        return false;
+    }
+
+    // Catch up on any time skipped while the entity was far away. Entries
+    // are reset rather than erased so far entities do not reallocate them
+    // every cycle; removeEntity() drops them.
+    if (!lodPendingTime_.empty()) {
+        auto it = lodPendingTime_.find(entity.getId());
+        if (it != lodPendingTime_.end()) {
+            stepTime += it->second;
+            it->second = 0.0f;
+        }
+    }
+    return true;
+}
+
+float System::getLodPendingTime(Entity::ID id) const {
+    auto it = lodPendingTime_.find(id);
+    return it != lodPendingTime_.end() ? it->second : 0.0f;
+}
+
+void System::setLodPendingTime(Entity::ID id, float time) {
+    if (time != 0.0f || lodPendingTime_.count(id) != 0) {
+        lodPendingTime_[id] = time;
+    }
+}
+
 void System::addEntity(const Entity& entity) {
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Adding entity %llu to system %s", 
         entity.getId(), typeid(*this).name());
@@ -44,7 +80,10 @@ void System::addEntity(const Entity& entity) {
     entities_.push_back(entity);
     onEntityAdded(entity);
     
-    // Log all entities in the system
+    // Listing the entities allocates; skip it unless the line would be logged
+    if (SDL_GetLogPriority(SDL_LOG_CATEGORY_APPLICATION) > SDL_LOG_PRIORITY_INFO) {
+        return;
+    }
     std::string entityIds;
     for (const auto& e : entities_) {
         entityIds += std::to_string(e.getId()) + ", ";
@@ -62,9 +101,12 @@ void System::removeEntity(const Entity& entity) {
     
     if (it != entities_.end()) {
         entities_.erase(it);
+        lodPendingTime_.erase(entity.getId());
         onEntityRemoved(entity);
         
-        // Log all entities in the system
+        if (SDL_GetLogPriority(SDL_LOG_CATEGORY_APPLICATION) > SDL_LOG_PRIORITY_INFO) {
+            return;
+        }
         std::string entityIds;
         for (const auto& e : entities_) {
             entityIds += std::to_string(e.getId()) + ", ";
@@ -3,9 +3,12 @@
 #include "ComponentManager.hpp"
 #include "Entity.hpp"
 #include "Component.hpp"
+#include "SimulationLod.hpp"
+#include "Vector2.hpp"
 #include <vector>
 #include <typeindex>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <SDL3/SDL.h>
 
@@ -21,6 +24,7 @@ public:
     template<typename T>
     void registerRequiredComponent() {
         requiredComponents_.insert(std::type_index(typeid(T)));
+        requiredSignature_.set(componentManager_->getComponentTypeIndex(typeid(T)));
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Registered required component: %s", typeid(T).name());
     }
 
@@ -31,9 +35,35 @@ public:
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Registered optional component: %s", typeid(T).name());
     }
 
+    // Simulation LOD opt-in: entities with any registered LOD component are
+    // simulated at a reduced, staggered rate while far from the viewport
+    template<typename T>
+    void registerLodComponent() {
+        lodSignature_.set(componentManager_->getComponentTypeIndex(typeid(T)));
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[System] Registered LOD component: %s", typeid(T).name());
+    }
+
+    /**
+     * Decide whether to simulate an entity this frame (see SimulationLod).
+     * Skipped frames are accumulated and added to the next step.
+     * @param entity Entity being processed
+     * @param position Entity's current world position
+     * @param deltaTime Time elapsed since last frame
+     * @param stepTime Receives the time to simulate when returning true
+     * @return false if the entity should be skipped this frame
+     */
+    bool shouldSimulate(const Entity& entity, const Vector2& position, float deltaTime, float& stepTime);
+
+    // Time a far entity has skipped and will catch up on (replay keyframes)
+    float getLodPendingTime(Entity::ID id) const;
+    void setLodPendingTime(Entity::ID id, float time);
+
     // Check if entity has all required components
     bool hasRequiredComponents(const Entity& entity) const;
 
+    // Signature bits of the required components (empty = accepts every entity)
+    const Signature& getRequiredSignature() const { return requiredSignature_; }
+
     // Entity management
     void addEntity(const Entity& entity);
     void removeEntity(const Entity& entity);
@@ -62,6 +92,9 @@ private:
     std::vector<Entity> entities_;  // Maintains insertion order
     std::unordered_set<std::type_index> requiredComponents_;
     std::unordered_set<std::type_index> optionalComponents_;
+    Signature requiredSignature_;
+    Signature lodSignature_;
+    std::unordered_map<Entity::ID, float> lodPendingTime_;  // Time skipped by far entities
     ComponentManager* componentManager_;
 };
 
@@ -1,23 +1,43 @@
 #pragma once
 
 #include "System.hpp"
+#include "ComponentManager.hpp"
 #include "Entity.hpp"
+#include "TypeName.hpp"
+#include "WorldLocal.hpp"
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <string>
 #include <SDL3/SDL.h>
 
 namespace game {
 namespace ecs {
 
-class SystemManager {
+// Systems learn about component adds and removals through ComponentManager
+// observers: a change reaches only the systems whose required signature
+// contains the changed type.
+class SystemManager : public ComponentObserver {
 public:
     // Get the singleton instance
     static SystemManager& getInstance() {
+        if (SystemManager* local = WorldLocal<SystemManager>::get()) {
+            return *local;
+        }
+        // Construct the ComponentManager first so it outlives us: the
+        // destructor unregisters from it
+        ComponentManager::getInstance();
         static SystemManager instance;
         return instance;
     }
 
+    ~SystemManager() override {
+        // Systems may still remove components while they are destroyed
+        if (componentManager_) {
+            componentManager_->removeObserver(this);
+        }
+    }
+
     // Add a system
     template<typename T, typename... Args>
     T* addSystem(Args&&... args) {
@@ -34,6 +54,9 @@ public:
         T* systemPtr = system.get();
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SystemManager] Adding system: %s", typeid(T).name());
         systems_.push_back(std::move(system));
+        systemNames_.push_back(makeTypeName(typeid(T).name()));
+        updateTimesNs_.push_back(0);
+        observeRequiredComponents(*systemPtr);
 
         // Note: We don't need to register with existing entities here
         // because entities will be added to systems when they are created
@@ -56,13 +79,23 @@ public:
     // Expose systems for inspection
     const std::vector<std::unique_ptr<System>>& getSystems() const { return systems_; }
 
-    // Update all systems
+    // Readable system names (e.g. "CollisionSystem"), parallel to getSystems()
+    const std::vector<std::string>& getSystemNames() const { return systemNames_; }
+
+    // Duration of each system's most recent update() in nanoseconds,
+    // parallel to getSystems()
+    const std::vector<Uint64>& getLastUpdateTimes() const { return updateTimesNs_; }
+
+    // Update all systems, recording how long each one took
     void update(float deltaTime) {
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SystemManager] update all systems, count=%zu, deltaTime=%.4f", systems_.size(), deltaTime);
-        for (auto& system : systems_) {
+        for (size_t i = 0; i < systems_.size(); ++i) {
+            auto& system = systems_[i];
             size_t entityCount = system->getEntities().size();
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SystemManager] System %s has %zu entities", getSystemName(system.get()), entityCount);
+            Uint64 start = SDL_GetTicksNS();
             system->update(deltaTime);
+            updateTimesNs_[i] = SDL_GetTicksNS() - start;
         }
     }
 
@@ -89,22 +122,56 @@ public:
         }
     }
 
-    // Handle component addition
-    void onComponentAdded(const Entity& entity, const std::type_index& componentType) {
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SystemManager] onComponentAdded for entity %llu, component: %s", 
-                entity.getId(), componentType.name());
-        for (auto& system : systems_) {
-            if (system->hasRequiredComponents(entity)) {
-                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SystemManager] Entity %llu now has required components for system %s", 
-                    entity.getId(), getSystemName(system.get()));
-                system->addEntity(entity);
+    // Handle a component add or remove (called by ComponentManager): only
+    // systems whose requirements the change completes or breaks are touched
+    void onSignatureChanged(const Entity& entity, const Signature& before, const Signature& after) override {
+        const Signature changed = before ^ after;
+        Signature visited; // Changed bits whose systems were already handled
+        for (size_t bit = 0; bit < systemsByBit_.size(); ++bit) {
+            if (!changed.test(bit)) {
+                continue;
+            }
+            for (System* system : systemsByBit_[bit]) {
+                const Signature& required = system->getRequiredSignature();
+                if ((required & visited).any()) {
+                    continue; // Seen under an earlier changed bit
+                }
+                const bool matched = (before & required) == required;
+                const bool matches = (after & required) == required;
+                if (matches && !matched) {
+                    system->addEntity(entity);
+                } else if (matched && !matches) {
+                    system->removeEntity(entity);
+                }
             }
+            visited.set(bit);
         }
     }
 
 private:
     // Private constructor for singleton
     SystemManager() = default;
+    friend class WorldLocal<SystemManager>;
+
+    // Listen for every component type the system requires and list the
+    // system under each of those bits. Systems with no requirements take
+    // every entity in onEntityCreated() instead.
+    void observeRequiredComponents(System& system) {
+        const Signature& required = system.getRequiredSignature();
+        if (required.none()) {
+            return;
+        }
+        componentManager_ = &ComponentManager::getInstance();
+        for (size_t bit = 0; bit < required.size(); ++bit) {
+            if (required.test(bit)) {
+                componentManager_->addObserver(bit, this);
+                if (bit >= systemsByBit_.size()) {
+                    systemsByBit_.resize(bit + 1);
+                }
+                systemsByBit_[bit].push_back(&system);
+            }
+        }
+    }
 
     // Helper method to get system name
     const char* getSystemName(const System* system) const {
@@ -113,6 +180,11 @@ private:
 
     // Vector of systems
     std::vector<std::unique_ptr<System>> systems_;
+    std::vector<std::string> systemNames_;
+    std::vector<Uint64> updateTimesNs_;
+    // Systems requiring each signature bit, in registration order
+    std::vector<std::vector<System*>> systemsByBit_;
+    ComponentManager* componentManager_ = nullptr;
 };
 
 } // namespace ecs
@@ -0,0 +1,372 @@
+#include "Tweener.hpp"
+#include "ComponentManager.hpp"
+#include "components/Sprite.hpp"
+#include "components/Transform.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace game {
+namespace ecs {
+
+namespace {
+
+const char* const EASING_NAMES[] = {"linear", "inQuad", "outQuad", "inOutQuad",
+                                    "outCubic", "outBack", "outBounce"};
+const char* const PROPERTY_NAMES[] = {"value", "positionX", "positionY", "rotation", "scaleX",
+                                      "scaleY", "width", "height", "alpha"};
+const char* const REPEAT_NAMES[] = {"once", "loop", "pingPong"};
+
+template <typename Enum, size_t N>
+bool parseName(const char* const (&names)[N], const std::string& name, Enum& value) {
+    for (size_t i = 0; i < N; ++i) {
+        if (name == names[i]) {
+            value = static_cast<Enum>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+float outBounce(float t) {
+    const float n = 7.5625f;
+    const float d = 2.75f;
+    if (t < 1.0f / d) {
+        return n * t * t;
+    }
+    if (t < 2.0f / d) {
+        t -= 1.5f / d;
+        return n * t * t + 0.75f;
+    }
+    if (t < 2.5f / d) {
+        t -= 2.25f / d;
+        return n * t * t + 0.9375f;
+    }
+    t -= 2.625f / d;
+    return n * t * t + 0.984375f;
+}
+
+} // namespace
+
+float Tweener::ease(Easing easing, float t) {
+    switch (easing) {
+        case Easing::InQuad:
+            return t * t;
+        case Easing::OutQuad:
+            return t * (2.0f - t);
+        case Easing::InOutQuad:
+            return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+        case Easing::OutCubic: {
+            float u = t - 1.0f;
+            return u * u * u + 1.0f;
+        }
+        case Easing::OutBack: {
+            const float c1 = 1.70158f;
+            const float c3 = c1 + 1.0f;
+            float u = t - 1.0f;
+            return 1.0f + c3 * u * u * u + c1 * u * u;
+        }
+        case Easing::OutBounce:
+            return outBounce(t);
+        case Easing::Linear:
+        default:
+            return t;
+    }
+}
+
+bool Tweener::parseEasing(const std::string& name, Easing& easing) {
+    return parseName(EASING_NAMES, name, easing);
+}
+
+bool Tweener::parseProperty(const std::string& name, TweenProperty& property) {
+    return parseName(PROPERTY_NAMES, name, property);
+}
+
+bool Tweener::parseRepeat(const std::string& name, TweenRepeat& repeat) {
+    return parseName(REPEAT_NAMES, name, repeat);
+}
+
+Tweener::TweenId Tweener::tween(float* target, float from, float to, float duration,
+                                Easing easing, TweenRepeat repeat, float delay) {
+    if (!target) {
+        return INVALID_TWEEN;
+    }
+    return add(target, 0, TweenProperty::Value, from, to, duration, easing, repeat, delay);
+}
+
+Tweener::TweenId Tweener::tween(const Entity& entity, TweenProperty property, float from,
+                                float to, float duration, Easing easing, TweenRepeat repeat,
+                                float delay) {
+    float current;
+    if (property == TweenProperty::Value || !readProperty(entity.getId(), property, current)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Tweener] Entity %llu has no component for %s",
+                    entity.getId(), PROPERTY_NAMES[static_cast<size_t>(property)]);
+        return INVALID_TWEEN;
+    }
+    return add(nullptr, entity.getId(), property, from, to, duration, easing, repeat, delay);
+}
+
+Tweener::TweenId Tweener::tweenTo(const Entity& entity, TweenProperty property, float to,
+                                  float duration, Easing easing, TweenRepeat repeat,
+                                  float delay) {
+    float current;
+    if (property == TweenProperty::Value || !readProperty(entity.getId(), property, current)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Tweener] Entity %llu has no component for %s",
+                    entity.getId(), PROPERTY_NAMES[static_cast<size_t>(property)]);
+        return INVALID_TWEEN;
+    }
+    return add(nullptr, entity.getId(), property, current, to, duration, easing, repeat, delay);
+}
+
+Tweener::TweenId Tweener::add(float* target, Entity::ID entity, TweenProperty property,
+                              float from, float to, float duration, Easing easing,
+                              TweenRepeat repeat, float delay) {
+    TweenId id = nextId_++;
+    if (nextId_ == INVALID_TWEEN) {
+        nextId_ = 1;
+    }
+    ids_.push_back(id);
+    targets_.push_back(target);
+    entities_.push_back(entity);
+    properties_.push_back(property);
+    from_.push_back(from);
+    to_.push_back(to);
+    duration_.push_back(std::max(0.0f, duration));
+    elapsed_.push_back(-std::max(0.0f, delay));
+    easing_.push_back(easing);
+    repeat_.push_back(repeat);
+    callbacks_.emplace_back();
+    return id;
+}
+
+bool Tweener::onComplete(TweenId id, Callback callback) {
+    size_t index = indexOf(id);
+    if (index == NOT_FOUND) {
+        return false;
+    }
+    callbacks_[index] = std::move(callback);
+    return true;
+}
+
+bool Tweener::cancel(TweenId id) {
+    size_t index = indexOf(id);
+    if (index == NOT_FOUND) {
+        return false;
+    }
+    removeAt(index);
+    return true;
+}
+
+void Tweener::cancelTarget(const float* target) {
+    for (size_t i = ids_.size(); i-- > 0;) {
+        if (targets_[i] == target) {
+            removeAt(i);
+        }
+    }
+}
+
+void Tweener::cancelEntity(const Entity& entity) {
+    for (size_t i = ids_.size(); i-- > 0;) {
+        if (!targets_[i] && entities_[i] == entity.getId()) {
+            removeAt(i);
+        }
+    }
+}
+
+void Tweener::clear() {
+    for (size_t i = ids_.size(); i-- > 0;) {
+        removeAt(i);
+    }
+}
+
+void Tweener::update(float deltaTime) {
+    const size_t count = ids_.size();
+    if (count == 0) {
+        return;
+    }
+    progress_.resize(count);
+    values_.resize(count);
+    finished_.assign(count, 0);
+
+    // 1. Advance time and normalize it (branch-free, vectorizable)
+    float* elapsed = elapsed_.data();
+    const float* duration = duration_.data();
+    float* progress = progress_.data();
+    for (size_t i = 0; i < count; ++i) {
+        elapsed[i] += deltaTime;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        progress[i] = std::min(1.0f, std::max(0.0f, elapsed[i] / std::max(duration[i], 1e-6f)));
+    }
+
+    // 2. Easing curves
+    const Easing* easing = easing_.data();
+    for (size_t i = 0; i < count; ++i) {
+        progress[i] = ease(easing[i], progress[i]);
+    }
+
+    // 3. Interpolate (vectorizable)
+    const float* from = from_.data();
+    const float* to = to_.data();
+    float* values = values_.data();
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = from[i] + (to[i] - from[i]) * progress[i];
+    }
+
+    // 4. Write back and handle cycle ends
+    for (size_t i = 0; i < count; ++i) {
+        if (elapsed[i] < 0.0f) {
+            continue;  // Still delayed
+        }
+        bool cycleDone = elapsed[i] >= duration[i];
+        float value = cycleDone ? to[i] : values[i];
+        if (targets_[i]) {
+            *targets_[i] = value;
+        } else if (!writeProperty(entities_[i], properties_[i], value)) {
+            finished_[i] = 2;
+            continue;
+        }
+        if (!cycleDone) {
+            continue;
+        }
+
+        if (repeat_[i] == TweenRepeat::Once || duration[i] <= 0.0f) {
+            finished_[i] = 1;
+            if (callbacks_[i]) {
+                completed_.emplace_back(ids_[i], std::move(callbacks_[i]));
+            }
+            continue;
+        }
+        elapsed[i] = std::fmod(elapsed[i], duration[i]);
+        if (repeat_[i] == TweenRepeat::PingPong) {
+            std::swap(from_[i], to_[i]);
+        }
+    }
+
+    // 5. Compact finished tweens (backwards, so swapped-in elements are done)
+    for (size_t i = count; i-- > 0;) {
+        if (finished_[i]) {
+            removeAt(i);
+        }
+    }
+
+    // 6. Batched completion callbacks; they may add or cancel tweens
+    if (!completed_.empty()) {
+        std::vector<std::pair<TweenId, Callback>> callbacks;
+        callbacks.swap(completed_);
+        for (auto& [id, callback] : callbacks) {
+            callback(id);
+        }
+        callbacks.clear();
+        if (completed_.empty()) {
+            completed_.swap(callbacks);  // Keep the capacity
+        }
+    }
+}
+
+bool Tweener::readProperty(Entity::ID entity, TweenProperty property, float& value) const {
+    // Type indices are looked up per call (a cached vector read): a room's
+    // tweener is created before its ComponentManager numbers these types
+    ComponentManager& cm = ComponentManager::getInstance();
+    if (property >= TweenProperty::Width) {
+        auto* sprite = static_cast<components::Sprite*>(
+            cm.getComponent(entity, cm.getTypeIndex<components::Sprite>()));
+        if (!sprite) {
+            return false;
+        }
+        value = property == TweenProperty::Width    ? sprite->getWidth()
+                : property == TweenProperty::Height ? sprite->getHeight()
+                                                    : static_cast<float>(sprite->getColor().a);
+        return true;
+    }
+
+    auto* transform = static_cast<components::Transform*>(
+        cm.getComponent(entity, cm.getTypeIndex<components::Transform>()));
+    if (!transform) {
+        return false;
+    }
+    switch (property) {
+        case TweenProperty::PositionX: value = transform->getPosition().x; break;
+        case TweenProperty::PositionY: value = transform->getPosition().y; break;
+        case TweenProperty::Rotation: value = transform->getRotation(); break;
+        case TweenProperty::ScaleX: value = transform->getScale().x; break;
+        case TweenProperty::ScaleY: value = transform->getScale().y; break;
+        default: return false;
+    }
+    return true;
+}
+
+bool Tweener::writeProperty(Entity::ID entity, TweenProperty property, float value) const {
+    ComponentManager& cm = ComponentManager::getInstance();
+    if (property >= TweenProperty::Width) {
+        auto* sprite = static_cast<components::Sprite*>(
+            cm.getComponent(entity, cm.getTypeIndex<components::Sprite>()));
+        if (!sprite) {
+            return false;
+        }
+        if (property == TweenProperty::Width) {
+            sprite->setWidth(value);
+        } else if (property == TweenProperty::Height) {
+            sprite->setHeight(value);
+        } else {
+            SDL_Color color = sprite->getColor();
+            color.a = static_cast<Uint8>(std::min(255.0f, std::max(0.0f, value)));
+            sprite->setColor(color);
+        }
+        return true;
+    }
+
+    auto* transform = static_cast<components::Transform*>(
+        cm.getComponent(entity, cm.getTypeIndex<components::Transform>()));
+    if (!transform) {
+        return false;
+    }
+    const Vector2& position = transform->getPosition();
+    const Vector2& scale = transform->getScale();
+    switch (property) {
+        case TweenProperty::PositionX: transform->setPosition(value, position.y); break;
+        case TweenProperty::PositionY: transform->setPosition(position.x, value); break;
+        case TweenProperty::Rotation: transform->setRotation(value); break;
+        case TweenProperty::ScaleX: transform->setScale(value, scale.y); break;
+        case TweenProperty::ScaleY: transform->setScale(scale.x, value); break;
+        default: return false;
+    }
+    return true;
+}
+
+size_t Tweener::indexOf(TweenId id) const {
+    auto it = std::find(ids_.begin(), ids_.end(), id);
+    return it == ids_.end() ? NOT_FOUND : static_cast<size_t>(it - ids_.begin());
+}
+
+void Tweener::removeAt(size_t index) {
+    size_t last = ids_.size() - 1;
+    if (index != last) {
+        ids_[index] = ids_[last];
+        targets_[index] = targets_[last];
+        entities_[index] = entities_[last];
+        properties_[index] = properties_[last];
+        from_[index] = from_[last];
+        to_[index] = to_[last];
+        duration_[index] = duration_[last];
+        elapsed_[index] = elapsed_[last];
+        easing_[index] = easing_[last];
+        repeat_[index] = repeat_[last];
+        callbacks_[index] = std::move(callbacks_[last]);
+    }
+    ids_.pop_back();
+    targets_.pop_back();
+    entities_.pop_back();
+    properties_.pop_back();
+    from_.pop_back();
+    to_.pop_back();
+    duration_.pop_back();
+    elapsed_.pop_back();
+    easing_.pop_back();
+    repeat_.pop_back();
+    callbacks_.pop_back();
+}
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "WorldLocal.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace game {
+namespace ecs {
+
+enum class Easing : uint8_t {
+    Linear,
+    InQuad,
+    OutQuad,
+    InOutQuad,
+    OutCubic,
+    OutBack,
+    OutBounce,
+};
+
+// What a tween writes to. Value writes through a raw float pointer; the
+// other properties write a component of the tween's entity.
+enum class TweenProperty : uint8_t {
+    Value,
+    PositionX,
+    PositionY,
+    Rotation,
+    ScaleX,
+    ScaleY,
+    Width,
+    Height,
+    Alpha,  // Sprite color alpha, 0-255
+};
+
+enum class TweenRepeat : uint8_t {
+    Once,
+    Loop,      // Restart from the start value
+    PingPong,  // Swap start and end each cycle
+};
+
+/**
+ * Tweener - batched interpolation of floats and entity properties.
+ *
+ * Active tweens are stored as parallel arrays (structure of arrays), so one
+ * update advances every tween with a few tight loops: time and progress,
+ * easing, interpolation, then a write-back pass that scatters the values to
+ * their targets. Finished tweens are compacted out by swapping with the
+ * last element.
+ *
+ * Completion callbacks are collected during the update and run together
+ * after the arrays are compacted, so a callback may start or cancel tweens.
+ * Looping tweens never complete.
+ *
+ * Entity tweens look their component up on each write and end silently once
+ * the entity (or the component) is gone. Raw float targets must outlive the
+ * tween; cancel them with cancelTarget() before the owner is destroyed.
+ *
+ * GameWorld updates the tweener once per frame before the systems run.
+ * GameData entities can declare tweens; the HUD pops the score with one.
+ */
+class Tweener {
+public:
+    using TweenId = uint32_t;
+    using Callback = std::function<void(TweenId)>;
+
+    static constexpr TweenId INVALID_TWEEN = 0;
+
+    static Tweener& getInstance() {
+        if (Tweener* local = WorldLocal<Tweener>::get()) {
+            return *local;
+        }
+        static Tweener instance;
+        return instance;
+    }
+
+    Tweener(const Tweener&) = delete;
+    Tweener& operator=(const Tweener&) = delete;
+
+    /**
+     * Tween a float the caller owns.
+     * @param target Value to write each update
+     * @param from Start value
+     * @param to End value
+     * @param duration Seconds per cycle (<= 0 jumps to the end value)
+     * @param easing Easing curve
+     * @param repeat Whether the tween restarts after a cycle
+     * @param delay Seconds to wait before the tween starts moving
+     * @return Tween handle
+     */
+    TweenId tween(float* target, float from, float to, float duration,
+                  Easing easing = Easing::Linear, TweenRepeat repeat = TweenRepeat::Once,
+                  float delay = 0.0f);
+
+    /**
+     * Tween a property of an entity's Transform or Sprite.
+     * @param entity Entity to animate
+     * @param property Property to write (not TweenProperty::Value)
+     * @param from Start value
+     * @param to End value
+     * @param duration Seconds per cycle (<= 0 jumps to the end value)
+     * @param easing Easing curve
+     * @param repeat Whether the tween restarts after a cycle
+     * @param delay Seconds to wait before the tween starts moving
+     * @return Tween handle, or INVALID_TWEEN if the entity lacks the component
+     */
+    TweenId tween(const Entity& entity, TweenProperty property, float from, float to,
+                  float duration, Easing easing = Easing::Linear,
+                  TweenRepeat repeat = TweenRepeat::Once, float delay = 0.0f);
+
+    /**
+     * Tween an entity property from its current value.
+     * @return Tween handle, or INVALID_TWEEN if the entity lacks the component
+     */
+    TweenId tweenTo(const Entity& entity, TweenProperty property, float to, float duration,
+                    Easing easing = Easing::Linear, TweenRepeat repeat = TweenRepeat::Once,
+                    float delay = 0.0f);
+
+    /**
+     * Run a callback when a tween completes (not when it is cancelled).
+     * @return false if the tween is not active
+     */
+    bool onComplete(TweenId id, Callback callback);
+
+    bool cancel(TweenId id);
+    void cancelTarget(const float* target);
+    void cancelEntity(const Entity& entity);
+    void clear();
+
+    /**
+     * Advance all tweens, write their values and run completion callbacks.
+     * @param deltaTime Time elapsed since last update
+     */
+    void update(float deltaTime);
+
+    size_t getActiveCount() const { return ids_.size(); }
+    bool isActive(TweenId id) const { return indexOf(id) != NOT_FOUND; }
+
+    /**
+     * Parse names used in JSON ("outQuad", "positionX", "pingPong", ...).
+     * @return false for unknown names (the output is left unchanged)
+     */
+    static bool parseEasing(const std::string& name, Easing& easing);
+    static bool parseProperty(const std::string& name, TweenProperty& property);
+    static bool parseRepeat(const std::string& name, TweenRepeat& repeat);
+
+    static float ease(Easing easing, float t);
+
+private:
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    Tweener() = default;
+    friend class WorldLocal<Tweener>;
+
+    TweenId add(float* target, Entity::ID entity, TweenProperty property, float from, float to,
+                float duration, Easing easing, TweenRepeat repeat, float delay);
+    bool readProperty(Entity::ID entity, TweenProperty property, float& value) const;
+    bool writeProperty(Entity::ID entity, TweenProperty property, float value) const;
+    size_t indexOf(TweenId id) const;
+    void removeAt(size_t index);
+
+    // Active tweens, one element per tween in every array
+    std::vector<TweenId> ids_;
+    std::vector<float*> targets_;           // Raw target, nullptr for entity tweens
+    std::vector<Entity::ID> entities_;
+    std::vector<TweenProperty> properties_;
+    std::vector<float> from_;
+    std::vector<float> to_;
+    std::vector<float> duration_;
+    std::vector<float> elapsed_;            // Negative while delayed
+    std::vector<Easing> easing_;
+    std::vector<TweenRepeat> repeat_;
+    std::vector<Callback> callbacks_;
+
+    // Per-update scratch
+    std::vector<float> progress_;
+    std::vector<float> values_;
+    std::vector<uint8_t> finished_;        // 1 = completed, 2 = target gone
+    std::vector<std::pair<TweenId, Callback>> completed_;
+
+    TweenId nextId_ = 1;
+};
+
+} // namespace ecs
+} // namespace game
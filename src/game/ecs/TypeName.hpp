@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace game {
+namespace ecs {
+
+/**
+ * Readable name of a type for logs and debug views, e.g. "CollisionSystem".
+ * Demangles on GCC/Clang and strips namespaces.
+ * @param rawName Name from typeid(T).name()
+ */
+inline std::string makeTypeName(const char* rawName) {
+    std::string name = rawName;
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(rawName, nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    size_t pos = name.rfind("::");
+    return pos == std::string::npos ? name : name.substr(pos + 2);
+}
+
+} // namespace ecs
+} // namespace game
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cmath>
+
 namespace game {
 namespace ecs {
 
@@ -60,6 +62,46 @@ struct Vector2 {
     bool operator!=(const Vector2& other) const {
         return !(*this == other);
     }
+
+    // Geometry helpers. Batch versions over arrays live in VectorMath.hpp.
+    float dot(const Vector2& other) const {
+        return x * other.x + y * other.y;
+    }
+
+    // Z component of the 3D cross product; > 0 if other is counter-clockwise
+    float cross(const Vector2& other) const {
+        return x * other.y - y * other.x;
+    }
+
+    float lengthSquared() const {
+        return x * x + y * y;
+    }
+
+    float length() const {
+        return std::sqrt(x * x + y * y);
+    }
+
+    float distance(const Vector2& other) const {
+        return (other - *this).length();
+    }
+
+    /**
+     * @return Unit vector in the same direction, or (0, 0) for a zero vector
+     */
+    Vector2 normalized() const {
+        float len = length();
+        return len > 0.0f ? Vector2(x / len, y / len) : Vector2();
+    }
+
+    /**
+     * @param degrees Rotation in degrees, same convention as Transform
+     */
+    Vector2 rotated(float degrees) const {
+        float radians = degrees * 3.14159265358979f / 180.0f;
+        float cosR = std::cos(radians);
+        float sinR = std::sin(radians);
+        return Vector2(x * cosR - y * sinR, x * sinR + y * cosR);
+    }
 };
 
 } // namespace ecs
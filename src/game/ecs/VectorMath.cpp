@@ -0,0 +1,294 @@
+#include "VectorMath.hpp"
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define VECTORMATH_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VECTORMATH_SSE 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VECTORMATH_NEON 1
+#endif
+
+#if defined(VECTORMATH_AVX) || defined(VECTORMATH_SSE) || defined(VECTORMATH_NEON)
+#define VECTORMATH_SIMD 1
+#endif
+
+namespace game {
+namespace ecs {
+namespace vectormath {
+
+namespace {
+
+// Thin wrappers so each kernel is written once for all instruction sets
+#if defined(VECTORMATH_AVX)
+constexpr size_t LANES = 8;
+using Batch = __m256;
+inline Batch load(const float* p) { return _mm256_loadu_ps(p); }
+inline void store(float* p, Batch v) { _mm256_storeu_ps(p, v); }
+inline Batch splat(float v) { return _mm256_set1_ps(v); }
+inline Batch add(Batch a, Batch b) { return _mm256_add_ps(a, b); }
+inline Batch sub(Batch a, Batch b) { return _mm256_sub_ps(a, b); }
+inline Batch mul(Batch a, Batch b) { return _mm256_mul_ps(a, b); }
+inline Batch div(Batch a, Batch b) { return _mm256_div_ps(a, b); }
+inline Batch sqrt(Batch a) { return _mm256_sqrt_ps(a); }
+inline Batch greater(Batch a, Batch b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+inline Batch select(Batch mask, Batch a, Batch b) { return _mm256_blendv_ps(b, a, mask); }
+#elif defined(VECTORMATH_SSE)
+constexpr size_t LANES = 4;
+using Batch = __m128;
+inline Batch load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, Batch v) { _mm_storeu_ps(p, v); }
+inline Batch splat(float v) { return _mm_set1_ps(v); }
+inline Batch add(Batch a, Batch b) { return _mm_add_ps(a, b); }
+inline Batch sub(Batch a, Batch b) { return _mm_sub_ps(a, b); }
+inline Batch mul(Batch a, Batch b) { return _mm_mul_ps(a, b); }
+inline Batch div(Batch a, Batch b) { return _mm_div_ps(a, b); }
+inline Batch sqrt(Batch a) { return _mm_sqrt_ps(a); }
+inline Batch greater(Batch a, Batch b) { return _mm_cmpgt_ps(a, b); }
+inline Batch select(Batch mask, Batch a, Batch b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+#elif defined(VECTORMATH_NEON)
+constexpr size_t LANES = 4;
+using Batch = float32x4_t;
+inline Batch load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, Batch v) { vst1q_f32(p, v); }
+inline Batch splat(float v) { return vdupq_n_f32(v); }
+inline Batch add(Batch a, Batch b) { return vaddq_f32(a, b); }
+inline Batch sub(Batch a, Batch b) { return vsubq_f32(a, b); }
+inline Batch mul(Batch a, Batch b) { return vmulq_f32(a, b); }
+inline Batch div(Batch a, Batch b) { return vdivq_f32(a, b); }
+inline Batch sqrt(Batch a) { return vsqrtq_f32(a); }
+inline Batch greater(Batch a, Batch b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+inline Batch select(Batch mask, Batch a, Batch b) {
+    return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+#endif
+
+#if defined(VECTORMATH_SIMD)
+// Index where the scalar remainder starts
+inline size_t vectorEnd(size_t count) {
+    return count - count % LANES;
+}
+#endif
+
+} // namespace
+
+const char* getInstructionSet() {
+#if defined(VECTORMATH_AVX)
+    return "AVX";
+#elif defined(VECTORMATH_SSE)
+    return "SSE2";
+#elif defined(VECTORMATH_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+void addScaled(float* x, float* y, const float* dx, const float* dy, const float* scale,
+               size_t count) {
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch s = load(scale + i);
+        store(x + i, add(load(x + i), mul(load(dx + i), s)));
+        store(y + i, add(load(y + i), mul(load(dy + i), s)));
+    }
+#endif
+    for (; i < count; ++i) {
+        x[i] += dx[i] * scale[i];
+        y[i] += dy[i] * scale[i];
+    }
+}
+
+void lengths(const float* x, const float* y, float* out, size_t count) {
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch vx = load(x + i);
+        Batch vy = load(y + i);
+        store(out + i, sqrt(add(mul(vx, vx), mul(vy, vy))));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+    }
+}
+
+void normalize(float* x, float* y, float* lengthsOut, size_t count) {
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    const Batch zero = splat(0.0f);
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch vx = load(x + i);
+        Batch vy = load(y + i);
+        Batch len = sqrt(add(mul(vx, vx), mul(vy, vy)));
+        Batch nonZero = greater(len, zero);
+        // Zero lanes divide to NaN and are replaced by 0
+        store(x + i, select(nonZero, div(vx, len), zero));
+        store(y + i, select(nonZero, div(vy, len), zero));
+        if (lengthsOut) {
+            store(lengthsOut + i, len);
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        float len = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+        if (len > 0.0f) {
+            x[i] = x[i] / len;
+            y[i] = y[i] / len;
+        } else {
+            x[i] = 0.0f;
+            y[i] = 0.0f;
+        }
+        if (lengthsOut) {
+            lengthsOut[i] = len;
+        }
+    }
+}
+
+void clampLength(float* x, float* y, const float* maxLength, size_t count) {
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    const Batch one = splat(1.0f);
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch vx = load(x + i);
+        Batch vy = load(y + i);
+        Batch limit = load(maxLength + i);
+        Batch len = sqrt(add(mul(vx, vx), mul(vy, vy)));
+        Batch scale = select(greater(len, limit), div(limit, len), one);
+        store(x + i, mul(vx, scale));
+        store(y + i, mul(vy, scale));
+    }
+#endif
+    for (; i < count; ++i) {
+        float len = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+        float scale = len > maxLength[i] ? maxLength[i] / len : 1.0f;
+        x[i] = x[i] * scale;
+        y[i] = y[i] * scale;
+    }
+}
+
+void rotate(float* x, float* y, float degrees, size_t count) {
+    const float radians = degrees * 3.14159265358979f / 180.0f;
+    const float cosR = std::cos(radians);
+    const float sinR = std::sin(radians);
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    const Batch c = splat(cosR);
+    const Batch s = splat(sinR);
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch vx = load(x + i);
+        Batch vy = load(y + i);
+        store(x + i, sub(mul(vx, c), mul(vy, s)));
+        store(y + i, add(mul(vx, s), mul(vy, c)));
+    }
+#endif
+    for (; i < count; ++i) {
+        float vx = x[i];
+        float vy = y[i];
+        x[i] = vx * cosR - vy * sinR;
+        y[i] = vx * sinR + vy * cosR;
+    }
+}
+
+void rotate(float* x, float* y, const float* cosines, const float* sines, size_t count) {
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch vx = load(x + i);
+        Batch vy = load(y + i);
+        Batch c = load(cosines + i);
+        Batch s = load(sines + i);
+        store(x + i, sub(mul(vx, c), mul(vy, s)));
+        store(y + i, add(mul(vx, s), mul(vy, c)));
+    }
+#endif
+    for (; i < count; ++i) {
+        float vx = x[i];
+        float vy = y[i];
+        x[i] = vx * cosines[i] - vy * sines[i];
+        y[i] = vx * sines[i] + vy * cosines[i];
+    }
+}
+
+void rectBounds(const float* x, const float* y, const float* width, const float* height,
+                const float* inset, float* left, float* top, float* right, float* bottom,
+                size_t count) {
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch vx = load(x + i);
+        Batch vy = load(y + i);
+        Batch pad = load(inset + i);
+        store(left + i, add(vx, pad));
+        store(top + i, add(vy, pad));
+        store(right + i, sub(add(vx, load(width + i)), pad));
+        store(bottom + i, sub(add(vy, load(height + i)), pad));
+    }
+#endif
+    for (; i < count; ++i) {
+        const float vx = x[i];
+        const float vy = y[i];
+        const float pad = inset[i];
+        left[i] = vx + pad;
+        top[i] = vy + pad;
+        right[i] = vx + width[i] - pad;
+        bottom[i] = vy + height[i] - pad;
+    }
+}
+
+void transformBounds(const Matrix2D& matrix, float* left, float* top, float* right,
+                     float* bottom, size_t count) {
+    // Transform the center; the half extents grow by the absolute matrix
+    const float absA = std::fabs(matrix.a);
+    const float absB = std::fabs(matrix.b);
+    const float absC = std::fabs(matrix.c);
+    const float absD = std::fabs(matrix.d);
+    size_t i = 0;
+#if defined(VECTORMATH_SIMD)
+    const Batch half = splat(0.5f);
+    const Batch a = splat(matrix.a), b = splat(matrix.b);
+    const Batch c = splat(matrix.c), d = splat(matrix.d);
+    const Batch tx = splat(matrix.tx), ty = splat(matrix.ty);
+    const Batch aa = splat(absA), ab = splat(absB), ac = splat(absC), ad = splat(absD);
+    for (const size_t end = vectorEnd(count); i < end; i += LANES) {
+        Batch l = load(left + i), t = load(top + i);
+        Batch r = load(right + i), bt = load(bottom + i);
+        Batch cx = mul(add(l, r), half);
+        Batch cy = mul(add(t, bt), half);
+        Batch ex = mul(sub(r, l), half);
+        Batch ey = mul(sub(bt, t), half);
+        Batch ncx = add(add(mul(a, cx), mul(c, cy)), tx);
+        Batch ncy = add(add(mul(b, cx), mul(d, cy)), ty);
+        Batch nex = add(mul(aa, ex), mul(ac, ey));
+        Batch ney = add(mul(ab, ex), mul(ad, ey));
+        store(left + i, sub(ncx, nex));
+        store(right + i, add(ncx, nex));
+        store(top + i, sub(ncy, ney));
+        store(bottom + i, add(ncy, ney));
+    }
+#endif
+    for (; i < count; ++i) {
+        float cx = (left[i] + right[i]) * 0.5f;
+        float cy = (top[i] + bottom[i]) * 0.5f;
+        float ex = (right[i] - left[i]) * 0.5f;
+        float ey = (bottom[i] - top[i]) * 0.5f;
+        float ncx = matrix.a * cx + matrix.c * cy + matrix.tx;
+        float ncy = matrix.b * cx + matrix.d * cy + matrix.ty;
+        float nex = absA * ex + absC * ey;
+        float ney = absB * ex + absD * ey;
+        left[i] = ncx - nex;
+        right[i] = ncx + nex;
+        top[i] = ncy - ney;
+        bottom[i] = ncy + ney;
+    }
+}
+
+} // namespace vectormath
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Matrix2D.hpp"
+#include <cstddef>
+
+namespace game {
+namespace ecs {
+namespace vectormath {
+
+/**
+ * Batch vector kernels over structure-of-arrays data.
+ *
+ * Each kernel takes separate x and y arrays (and per-element parameters) of
+ * the same length and processes them with the widest instruction set the
+ * build targets: AVX (8 lanes, build with -DENABLE_AVX=ON), SSE2 (4 lanes,
+ * every x86-64 build) or NEON (4 lanes, AArch64). Other targets and the
+ * remainder of each array use the scalar code. Only exact operations
+ * (add, multiply, divide, sqrt) are used, so every path returns bit-identical
+ * results. That holds because VectorMath.cpp is built with
+ * -ffp-contract=off: a compiler allowed to fuse a*b+c into one FMA (GCC
+ * does by default on AArch64) would round the scalar code differently.
+ *
+ * Systems gather component data into scratch arrays, run the kernels and
+ * write the results back; see MovementSystem and DuckMovementSystem.
+ * Input and output arrays may be the same but must not otherwise overlap.
+ */
+
+/**
+ * @return Name of the instruction set the kernels were compiled for
+ */
+const char* getInstructionSet();
+
+/**
+ * x[i] += dx[i] * scale[i], same for y (e.g. position += velocity * dt).
+ */
+void addScaled(float* x, float* y, const float* dx, const float* dy, const float* scale,
+               size_t count);
+
+/**
+ * out[i] = length of (x[i], y[i]).
+ */
+void lengths(const float* x, const float* y, float* out, size_t count);
+
+/**
+ * Scale each vector to unit length. Zero vectors stay zero.
+ * @param lengthsOut Receives the original lengths; may be nullptr
+ */
+void normalize(float* x, float* y, float* lengthsOut, size_t count);
+
+/**
+ * Shorten vectors longer than maxLength[i] to that length. Pass infinity for
+ * elements without a limit.
+ */
+void clampLength(float* x, float* y, const float* maxLength, size_t count);
+
+/**
+ * Rotate every vector by the same angle.
+ * @param degrees Rotation in degrees, same convention as Transform
+ */
+void rotate(float* x, float* y, float degrees, size_t count);
+
+/**
+ * Rotate each vector by its own angle, given as precomputed cosine and sine.
+ */
+void rotate(float* x, float* y, const float* cosines, const float* sines, size_t count);
+
+/**
+ * Axis-aligned boxes of sprites at (x, y) with the given size, shrunk by
+ * inset[i] on every side (collision padding).
+ */
+void rectBounds(const float* x, const float* y, const float* width, const float* height,
+                const float* inset, float* left, float* top, float* right, float* bottom,
+                size_t count);
+
+/**
+ * Replace each box by the axis-aligned bounds of the box transformed by the
+ * matrix (e.g. local sprite bounds to world space).
+ */
+void transformBounds(const Matrix2D& matrix, float* left, float* top, float* right,
+                     float* bottom, size_t count);
+
+} // namespace vectormath
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+
+namespace game {
+namespace ecs {
+
+/**
+ * WorldLocal - the calling thread's instance of a world service.
+ *
+ * World services (ComponentManager, SystemManager, EventManager, ...) are
+ * reached through getInstance(), which returns WorldLocal<T>::get() when a
+ * WorldInstance is bound to the thread and the process-wide instance
+ * otherwise. That lets several independent worlds live in one process and
+ * tick on different threads without changing the code that uses them.
+ *
+ * Services befriend WorldLocal<T> so create() can reach their private
+ * constructors.
+ */
+template <typename T>
+class WorldLocal {
+public:
+    /**
+     * @return Instance bound to the calling thread, or null
+     */
+    static T* get() { return current_; }
+
+    static void set(T* instance) { current_ = instance; }
+
+    /**
+     * Make a new instance for a WorldInstance to own.
+     */
+    static std::unique_ptr<T> create() { return std::unique_ptr<T>(new T()); }
+
+private:
+    static inline thread_local T* current_ = nullptr;
+};
+
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "../Component.hpp"
+#include "../Vector2.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace game {
+namespace ecs {
+namespace components {
+
+/**
+ * Bot - lets BotControlSystem play for this entity.
+ *
+ * The bot drives the entity's KeyboardInput exactly like a human would:
+ * it presses movement keys to turn towards the nearest duck, fires once
+ * the player faces it, steps away from ducks that come too close and
+ * wanders around when there is nothing to shoot. PlayerControlSystem then
+ * handles the keys as usual, so the whole input path is exercised.
+ *
+ * With restartRounds set, finished rounds are restarted automatically so a
+ * bot can play for hours (soak tests).
+ */
+class Bot : public Component {
+public:
+    // Keys the bot holds, as bits of getHeldKeys()
+    enum Key : uint8_t {
+        KEY_LEFT = 1 << 0,
+        KEY_RIGHT = 1 << 1,
+        KEY_UP = 1 << 2,
+        KEY_DOWN = 1 << 3,
+        KEY_FIRE = 1 << 4
+    };
+
+    explicit Bot(const Entity& entity)
+        : Component(entity)
+        , shotsPerSecond_(2.0f)
+        , aimTolerance_(25.0f)
+        , dangerRadius_(120.0f)
+        , wanderInterval_(1.5f)
+        , restartRounds_(true)
+        , heldKeys_(0)
+        , fireCooldown_(0.0f)
+        , wanderTimer_(0.0f)
+        , wanderDirection_(1.0f, 0.0f)
+        , shotsFired_(0)
+        , roundsStarted_(0) {}
+
+    // Configuration
+    float getShotsPerSecond() const { return shotsPerSecond_; }
+    float getAimTolerance() const { return aimTolerance_; }
+    float getDangerRadius() const { return dangerRadius_; }
+    float getWanderInterval() const { return wanderInterval_; }
+    bool getRestartRounds() const { return restartRounds_; }
+
+    /**
+     * @param shotsPerSecond Upper bound on fire key presses (the Player's
+     *                       own fire rate still applies)
+     */
+    void setShotsPerSecond(float shotsPerSecond) { shotsPerSecond_ = shotsPerSecond; }
+
+    /**
+     * @param degrees Fire when the player faces the target within this angle
+     */
+    void setAimTolerance(float degrees) { aimTolerance_ = degrees; }
+
+    /**
+     * @param radius Move away from ducks closer than this (pixels)
+     */
+    void setDangerRadius(float radius) { dangerRadius_ = radius; }
+
+    /**
+     * @param seconds Time between new random directions while idle
+     */
+    void setWanderInterval(float seconds) { wanderInterval_ = seconds; }
+
+    void setRestartRounds(bool restart) { restartRounds_ = restart; }
+
+    // State owned by BotControlSystem
+    uint8_t getHeldKeys() const { return heldKeys_; }
+    void setHeldKeys(uint8_t keys) { heldKeys_ = keys; }
+    float getFireCooldown() const { return fireCooldown_; }
+    void setFireCooldown(float seconds) { fireCooldown_ = seconds; }
+    float getWanderTimer() const { return wanderTimer_; }
+    void setWanderTimer(float seconds) { wanderTimer_ = seconds; }
+    const Vector2& getWanderDirection() const { return wanderDirection_; }
+    void setWanderDirection(const Vector2& direction) { wanderDirection_ = direction; }
+
+    // Statistics
+    uint64_t getShotsFired() const { return shotsFired_; }
+    void recordShot() { ++shotsFired_; }
+    uint64_t getRoundsStarted() const { return roundsStarted_; }
+    void recordRoundStarted() { ++roundsStarted_; }
+
+    std::string toString() const override {
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), "shots=%llu rounds=%llu rate=%.1f/s",
+                      static_cast<unsigned long long>(shotsFired_),
+                      static_cast<unsigned long long>(roundsStarted_), shotsPerSecond_);
+        return buffer;
+    }
+
+private:
+    float shotsPerSecond_;
+    float aimTolerance_;
+    float dangerRadius_;
+    float wanderInterval_;
+    bool restartRounds_;
+
+    uint8_t heldKeys_;
+    float fireCooldown_;
+    float wanderTimer_;
+    Vector2 wanderDirection_;
+
+    uint64_t shotsFired_;
+    uint64_t roundsStarted_;
+};
+
+} // namespace components
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../Component.hpp"
+#include "../Entity.hpp"
+#include "../Vector2.hpp"
+#include <cstdio>
+#include <string>
+
+namespace game {
+namespace ecs {
+namespace components {
+
+/**
+ * Camera - the window's view onto the world.
+ *
+ * The position is the world coordinate of the view's top-left corner, so
+ * view space is world space minus the position. CameraSystem moves the
+ * camera to follow its target and keeps it inside the world bounds.
+ */
+class Camera : public Component {
+public:
+    Camera(const Entity& entity, float viewWidth, float viewHeight)
+        : Component(entity)
+        , position_()
+        , viewWidth_(viewWidth)
+        , viewHeight_(viewHeight)
+        , followTarget_()
+        , following_(false) {}
+
+    // Getters
+    const Vector2& getPosition() const { return position_; }
+    float getViewWidth() const { return viewWidth_; }
+    float getViewHeight() const { return viewHeight_; }
+    bool isFollowing() const { return following_; }
+    const Entity& getFollowTarget() const { return followTarget_; }
+
+    // Setters
+    void setPosition(const Vector2& position) { position_ = position; }
+    void setViewSize(float width, float height) {
+        viewWidth_ = width;
+        viewHeight_ = height;
+    }
+    void follow(const Entity& target) {
+        followTarget_ = target;
+        following_ = true;
+    }
+    void stopFollowing() { following_ = false; }
+
+    // Coordinate transforms
+    Vector2 worldToView(const Vector2& world) const { return world - position_; }
+    Vector2 viewToWorld(const Vector2& view) const { return view + position_; }
+
+    /**
+     * @return true if the world-space rectangle overlaps the view
+     */
+    bool isVisible(float x, float y, float width, float height) const {
+        return x + width >= position_.x && x <= position_.x + viewWidth_ &&
+               y + height >= position_.y && y <= position_.y + viewHeight_;
+    }
+
+    std::string toString() const override {
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), "pos=(%.1f, %.1f) view=%.0fx%.0f%s",
+                      position_.x, position_.y, viewWidth_, viewHeight_,
+                      following_ ? " following" : "");
+        return buffer;
+    }
+
+private:
+    Vector2 position_;
+    float viewWidth_;
+    float viewHeight_;
+    Entity followTarget_;
+    bool following_;
+};
+
+} // namespace components
+} // namespace ecs
+} // namespace game
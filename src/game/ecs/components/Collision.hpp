@@ -14,6 +14,8 @@ public:
     const std::string& getType() const { return type_; }
     void setType(const std::string& type) { type_ = type; }
 
+    std::string toString() const override { return type_; }
+
 private:
     std::string type_;  // Currently only supporting "AABB"
 };
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../Component.hpp"
+#include "../Entity.hpp"
+#include "../Matrix2D.hpp"
+#include "../Vector2.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace game {
+namespace ecs {
+namespace components {
+
+/**
+ * Hierarchy - attaches an entity to a parent entity.
+ *
+ * The local pose is relative to the parent's Transform (position, rotation
+ * in degrees, scale); the parent's position is the pivot. TransformHierarchySystem
+ * composes it with the parent's world matrix and writes the result into
+ * this entity's Transform, so move attached entities through the local
+ * setters - writes to a child's Transform are overwritten the next time its
+ * parent moves.
+ *
+ * The parent only needs a Transform; it may itself have a Hierarchy. Changes
+ * are tracked with two global generations so the system can skip whole
+ * frames in which no local pose and no parent link changed.
+ */
+class Hierarchy : public Component {
+public:
+    Hierarchy(const Entity& entity,
+              const Entity& parent,
+              const Vector2& localPosition = Vector2(),
+              float localRotation = 0.0f,
+              const Vector2& localScale = Vector2(1.0f, 1.0f))
+        : Component(entity)
+        , parent_(parent)
+        , localPosition_(localPosition)
+        , localRotation_(localRotation)
+        , localScale_(localScale)
+        , worldMatrix_()
+        , localDirty_(true) {
+        linkGeneration_.fetch_add(1, std::memory_order_relaxed);
+        changeGeneration_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Getters
+    const Entity& getParent() const { return parent_; }
+    const Vector2& getLocalPosition() const { return localPosition_; }
+    float getLocalRotation() const { return localRotation_; }
+    const Vector2& getLocalScale() const { return localScale_; }
+    const Matrix2D& getWorldMatrix() const { return worldMatrix_; }
+    bool isLocalDirty() const { return localDirty_; }
+
+    Matrix2D getLocalMatrix() const {
+        return Matrix2D::compose(localPosition_, localRotation_, localScale_);
+    }
+
+    // Setters
+    void setParent(const Entity& parent) {
+        parent_ = parent;
+        linkGeneration_.fetch_add(1, std::memory_order_relaxed);
+        markDirty();
+    }
+    void setLocalPosition(const Vector2& position) { localPosition_ = position; markDirty(); }
+    void setLocalRotation(float rotation) { localRotation_ = rotation; markDirty(); }
+    void setLocalScale(const Vector2& scale) { localScale_ = scale; markDirty(); }
+
+    // Called by TransformHierarchySystem after propagation
+    void setWorldMatrix(const Matrix2D& world) {
+        worldMatrix_ = world;
+        localDirty_ = false;
+    }
+
+    // Bumped whenever a parent link is created or changed
+    static uint64_t getLinkGeneration() {
+        return linkGeneration_.load(std::memory_order_relaxed);
+    }
+    // Bumped whenever any local pose or parent link changes
+    static uint64_t getChangeGeneration() {
+        return changeGeneration_.load(std::memory_order_relaxed);
+    }
+
+    std::string toString() const override {
+        char buffer[128];
+        std::snprintf(buffer, sizeof(buffer), "parent=%llu local=(%.1f, %.1f) rot=%.1f scale=(%.2f, %.2f)",
+                      static_cast<unsigned long long>(parent_.getId()), localPosition_.x, localPosition_.y,
+                      localRotation_, localScale_.x, localScale_.y);
+        return buffer;
+    }
+
+private:
+    void markDirty() {
+        localDirty_ = true;
+        changeGeneration_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Entity parent_;
+    Vector2 localPosition_;
+    float localRotation_;
+    Vector2 localScale_;
+    Matrix2D worldMatrix_;
+    bool localDirty_;
+
+    // Shared by every world (atomic, as worlds may tick on several threads);
+    // a change elsewhere only costs TransformHierarchySystem a spare check
+    static inline std::atomic<uint64_t> linkGeneration_{0};
+    static inline std::atomic<uint64_t> changeGeneration_{0};
+};
+
+} // namespace components
+} // namespace ecs
+} // namespace game
@@ -20,6 +20,9 @@ public:
         imageNames_.push_back(imageName);
     }
 
+    // Get the index of the current image
+    size_t getCurrentIndex() const { return currentIndex_; }
+
     // Get the current image name
     const std::string& getCurrentImageName() const {
         if (imageNames_.empty()) {
@@ -3,7 +3,9 @@
 #include "../Component.hpp"
 #include "../Vector2.hpp"
 #include <cmath>
+#include <cstdio>
 #include <limits>
+#include <string>
 
 namespace game {
 namespace ecs {
@@ -58,6 +60,14 @@ public:
         clampVelocity();
     }
 
+    std::string toString() const override {
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), "vel=(%.1f, %.1f) acc=(%.1f, %.1f)%s",
+                      velocity_.x, velocity_.y, acceleration_.x, acceleration_.y,
+                      enabled_ ? "" : " disabled");
+        return buffer;
+    }
+
 private:
     void clampVelocity() {
         if (maxSpeed_ == std::numeric_limits<float>::infinity()) {
@@ -1,5 +1,6 @@
 #include "ShootingGalleryState.hpp"
 #include "../../Timer.hpp"
+#include "../WorldLocal.hpp"
 #include <sstream>
 #include <iomanip>
 #include <fstream>
@@ -11,12 +12,11 @@
 
 namespace game::ecs::components {
     
-    // Static member definition
-    ShootingGalleryState* ShootingGalleryState::instance_ = nullptr;
-    
-    ShootingGalleryState::ShootingGalleryState(const game::ecs::Entity& entity, const Timer* timer)
+    ShootingGalleryState::ShootingGalleryState(const game::ecs::Entity& entity, const Timer* timer,
+                                               const std::string& highScoreFile)
         : game::ecs::Component(entity)
         , timer_(timer)
+        , highScoreFile_(highScoreFile)
     {
         if (timer_ == nullptr) {
             throw std::invalid_argument("ShootingGalleryState requires a Timer instance for hardware-independent timing");
@@ -24,32 +24,36 @@ namespace game::ecs::components {
         loadHighScore();
     }
     
+    ShootingGalleryState::Holder& ShootingGalleryState::holder() {
+        if (Holder* local = WorldLocal<Holder>::get()) {
+            return *local;
+        }
+        static Holder global;
+        return global;
+    }
+    
     ShootingGalleryState& ShootingGalleryState::getInstance() {
-        if (!instance_) {
+        Holder& current = holder();
+        if (!current.instance) {
             throw std::runtime_error("ShootingGalleryState instance not created. Call createInstance() first.");
         }
-        return *instance_;
+        return *current.instance;
     }
     
-    void ShootingGalleryState::createInstance(const game::ecs::Entity& entity, const Timer* timer) {
+    void ShootingGalleryState::createInstance(const game::ecs::Entity& entity, const Timer* timer,
+                                              const std::string& highScoreFile) {
         if (timer == nullptr) {
             throw std::invalid_argument("Timer instance required to create ShootingGalleryState singleton");
         }
-        if (instance_) {
-            delete instance_;
-        }
-        instance_ = new ShootingGalleryState(entity, timer);
+        holder().instance.reset(new ShootingGalleryState(entity, timer, highScoreFile));
     }
     
     bool ShootingGalleryState::hasInstance() {
-        return instance_ != nullptr;
+        return holder().instance != nullptr;
     }
     
     void ShootingGalleryState::destroyInstance() {
-        if (instance_) {
-            delete instance_;
-            instance_ = nullptr;
-        }
+        holder().instance.reset();
     }
     
     void ShootingGalleryState::addScore(int points) {
@@ -193,6 +197,10 @@ namespace game::ecs::components {
     void ShootingGalleryState::loadHighScore() {
         try {
             const std::string filePath = getHighScoreFilePath();
+            if (filePath.empty()) {
+                highScore = 0;
+                return;
+            }
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[ShootingGalleryState] Attempting to load high score from: %s", filePath.c_str());
             
             if (!std::filesystem::exists(filePath)) {
@@ -227,6 +235,9 @@ namespace game::ecs::components {
     void ShootingGalleryState::saveHighScore() {
         try {
             const std::string filePath = getHighScoreFilePath();
+            if (filePath.empty()) {
+                return;
+            }
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[ShootingGalleryState] Saving high score to: %s", filePath.c_str());
             
             nlohmann::json jsonData;
@@ -249,8 +260,8 @@ namespace game::ecs::components {
     }
     
     std::string ShootingGalleryState::getHighScoreFilePath() const {
-        // Simple current directory approach to match Java and Python implementations
-        return "high_score.json";
+        // Current directory by default, to match Java and Python implementations
+        return highScoreFile_;
     }
     
     // Utility functions
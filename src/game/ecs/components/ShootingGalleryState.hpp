@@ -2,6 +2,7 @@
 
 #include "../Component.hpp"
 #include "../Entity.hpp"
+#include <memory>
 #include <string>
 
 // Forward declaration
@@ -41,10 +42,17 @@ namespace game::ecs::components {
      * - Auto-start functionality for seamless gameplay
      */
     class ShootingGalleryState : public game::ecs::Component {
-    private:
-        static ShootingGalleryState* instance_;
-        
     public:
+        /**
+         * Owns the singleton instance; each WorldInstance has its own.
+         */
+        struct Holder {
+            std::unique_ptr<ShootingGalleryState> instance;
+        };
+
+        /// High score file used unless GameWorld is told otherwise
+        static constexpr const char* DEFAULT_HIGH_SCORE_FILE = "high_score.json";
+
         /**
          * Get the singleton instance of the game state
          * 
@@ -57,9 +65,12 @@ namespace game::ecs::components {
          * Create the singleton instance with an entity and Timer dependency.
          * @param entity The entity this component belongs to
          * @param timer Timer instance for hardware-independent timing (required)
+         * @param highScoreFile Where the high score is kept; empty keeps it in
+         *        memory only
          * @throws std::invalid_argument if timer is null
          */
-        static void createInstance(const game::ecs::Entity& entity, const Timer* timer);
+        static void createInstance(const game::ecs::Entity& entity, const Timer* timer,
+                                   const std::string& highScoreFile = DEFAULT_HIGH_SCORE_FILE);
         
         /**
          * Check if the singleton instance exists
@@ -211,10 +222,18 @@ namespace game::ecs::components {
          * Private constructor for singleton pattern with Timer dependency.
          * @param entity The entity this component belongs to
          * @param timer Timer instance for hardware-independent timing (required)
+         * @param highScoreFile High score file (empty = not persisted)
+         */
+        ShootingGalleryState(const game::ecs::Entity& entity, const Timer* timer,
+                             const std::string& highScoreFile);
+
+        /**
+         * The calling thread's holder (the bound WorldInstance's, if any)
          */
-        explicit ShootingGalleryState(const game::ecs::Entity& entity, const Timer* timer);
+        static Holder& holder();
         
         const Timer* timer_;  ///< Timer reference for hardware-independent timing
+        std::string highScoreFile_;  ///< Empty when the high score is not persisted
         
         /**
          * Load high score from persistent storage
@@ -229,7 +248,7 @@ namespace game::ecs::components {
         /**
          * Get the high score file path
          * 
-         * @return Path to high score storage file
+         * @return Path to high score storage file (empty if not persisted)
          */
         std::string getHighScoreFilePath() const;
     };
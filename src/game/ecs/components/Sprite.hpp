@@ -2,6 +2,8 @@
 
 #include "../Component.hpp"
 #include <SDL3/SDL.h>
+#include <cstdio>
+#include <string>
 
 namespace game {
 namespace ecs {
@@ -34,6 +36,14 @@ public:
     }
     void setVisible(bool visible) { visible_ = visible; }
 
+    std::string toString() const override {
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), "%.0fx%.0f rgba(%d,%d,%d,%d)%s",
+                      width_, height_, color_.r, color_.g, color_.b, color_.a,
+                      visible_ ? "" : " hidden");
+        return buffer;
+    }
+
 private:
     float width_;
     float height_;
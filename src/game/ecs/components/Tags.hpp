@@ -0,0 +1,20 @@
+#pragma once
+
+namespace game {
+namespace ecs {
+namespace components {
+
+/**
+ * Tag components: empty markers that exist only as a bit in the entity
+ * signature (ComponentManager::addTag / has). Add one next to the data it
+ * summarizes; systems requiring it are notified like for any component:
+ *
+ *   cm.addTag<components::BossTarget>(entity);
+ */
+
+// Target whose type is "boss" (faster, worth more)
+struct BossTarget {};
+
+} // namespace components
+} // namespace ecs
+} // namespace game
@@ -2,6 +2,9 @@
 
 #include "../Component.hpp"
 #include "../Vector2.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string>
 
 namespace game {
 namespace ecs {
@@ -16,24 +19,37 @@ public:
         : Component(entity)
         , position_(position)
         , rotation_(rotation)
-        , scale_(scale) {}
+        , scale_(scale)
+        , version_(0) {}
 
     // Getters
     const Vector2& getPosition() const { return position_; }
     float getRotation() const { return rotation_; }
     const Vector2& getScale() const { return scale_; }
 
+    // Incremented by every setter; lets TransformHierarchySystem detect moved
+    // parents without comparing poses
+    uint32_t getVersion() const { return version_; }
+
     // Setters
-    void setPosition(const Vector2& position) { position_ = position; }
-    void setPosition(float x, float y) { position_ = Vector2(x, y); }
-    void setRotation(float rotation) { rotation_ = rotation; }
-    void setScale(const Vector2& scale) { scale_ = scale; }
-    void setScale(float x, float y) { scale_ = Vector2(x, y); }
+    void setPosition(const Vector2& position) { position_ = position; ++version_; }
+    void setPosition(float x, float y) { position_ = Vector2(x, y); ++version_; }
+    void setRotation(float rotation) { rotation_ = rotation; ++version_; }
+    void setScale(const Vector2& scale) { scale_ = scale; ++version_; }
+    void setScale(float x, float y) { scale_ = Vector2(x, y); ++version_; }
+
+    std::string toString() const override {
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), "pos=(%.1f, %.1f) rot=%.1f scale=(%.2f, %.2f)",
+                      position_.x, position_.y, rotation_, scale_.x, scale_.y);
+        return buffer;
+    }
 
 private:
     Vector2 position_;
     float rotation_;
     Vector2 scale_;
+    uint32_t version_;
 };
 
 } // namespace components
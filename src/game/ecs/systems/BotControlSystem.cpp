@@ -0,0 +1,209 @@
+#include "BotControlSystem.hpp"
+#include "../ComponentManager.hpp"
+#include "../Random.hpp"
+#include "../SystemManager.hpp"
+#include "../components/Expirable.hpp"
+#include "../components/Player.hpp"
+#include "../components/ShootingGalleryState.hpp"
+#include "../components/Sprite.hpp"
+#include "../components/Target.hpp"
+#include "GameStateSystem.hpp"
+#include <cmath>
+#include <limits>
+
+namespace game {
+namespace ecs {
+namespace systems {
+
+namespace {
+
+// Key names PlayerControlSystem always accepts, in Bot::Key bit order
+const char *const KEY_NAMES[] = {"arrowleft", "arrowright", "arrowup",
+                                 "arrowdown", "space"};
+
+// Center of an entity's sprite (its position if it has no sprite)
+Vector2 centerOf(ComponentManager &cm, const Entity &entity,
+                 const components::Transform &transform) {
+  Vector2 center = transform.getPosition();
+  if (auto *sprite = cm.getComponent<components::Sprite>(entity)) {
+    center += Vector2(sprite->getWidth() * 0.5f, sprite->getHeight() * 0.5f);
+  }
+  return center;
+}
+
+} // namespace
+
+BotControlSystem::BotControlSystem()
+    : System(),
+      random_(RandomService::getInstance().stream("BotControlSystem")) {
+  registerRequiredComponent<components::Bot>();
+  registerRequiredComponent<components::Transform>();
+  registerRequiredComponent<components::KeyboardInput>();
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[BotControlSystem] Initialized");
+}
+
+void BotControlSystem::update(float deltaTime) {
+  if (getEntities().empty() ||
+      !components::ShootingGalleryState::hasInstance()) {
+    return;
+  }
+  auto &gameState = components::ShootingGalleryState::getInstance();
+  ComponentManager &cm = ComponentManager::getInstance();
+
+  for (const Entity &entity : getEntities()) {
+    auto *bot = cm.getComponent<components::Bot>(entity);
+    auto *transform = cm.getComponent<components::Transform>(entity);
+    auto *keyboard = cm.getComponent<components::KeyboardInput>(entity);
+    if (!bot || !transform || !keyboard || !keyboard->isEnabled()) {
+      continue;
+    }
+
+    if (gameState.isGameOver() && bot->getRestartRounds()) {
+      restartRound(*bot);
+    }
+    if (!gameState.isPlaying()) {
+      applyKeys(*bot, *keyboard, 0);
+      continue;
+    }
+
+    applyKeys(*bot, *keyboard,
+              chooseKeys(entity, *bot, *transform, deltaTime));
+  }
+}
+
+uint8_t BotControlSystem::chooseKeys(const Entity &entity,
+                                     components::Bot &bot,
+                                     const components::Transform &transform,
+                                     float deltaTime) {
+  ComponentManager &cm = ComponentManager::getInstance();
+  const Vector2 center = centerOf(cm, entity, transform);
+  bot.setFireCooldown(bot.getFireCooldown() - deltaTime);
+
+  // Nearest live duck
+  Vector2 toNearest;
+  float nearestSquared = std::numeric_limits<float>::infinity();
+  for (const Entity &target : cm.getEntitiesWithComponent<components::Target>()) {
+    auto *targetTransform = cm.getComponent<components::Transform>(target);
+    auto *expirable = cm.getComponent<components::Expirable>(target);
+    if (!targetTransform || (expirable && expirable->isExpired())) {
+      continue;
+    }
+    Vector2 offset = centerOf(cm, target, *targetTransform) - center;
+    float distanceSquared = offset.lengthSquared();
+    if (distanceSquared < nearestSquared) {
+      nearestSquared = distanceSquared;
+      toNearest = offset;
+    }
+  }
+
+  if (nearestSquared == std::numeric_limits<float>::infinity()) {
+    // Nothing to shoot: wander
+    bot.setWanderTimer(bot.getWanderTimer() - deltaTime);
+    if (bot.getWanderTimer() <= 0.0f) {
+      float angle = random_.range(0.0f, 360.0f);
+      bot.setWanderDirection(Vector2(1.0f, 0.0f).rotated(angle));
+      bot.setWanderTimer(bot.getWanderInterval());
+    }
+    return directionKeys(bot.getWanderDirection());
+  }
+
+  const float dangerRadius = bot.getDangerRadius();
+  if (nearestSquared < dangerRadius * dangerRadius) {
+    // Too close: back off
+    return directionKeys(toNearest * -1.0f);
+  }
+
+  // Turn towards the duck; the player only turns while it moves
+  float aim = std::atan2(toNearest.y, toNearest.x) * 180.0f / 3.14159265f;
+  float diff = std::fmod(aim - transform.getRotation(), 360.0f);
+  if (diff > 180.0f) {
+    diff -= 360.0f;
+  } else if (diff < -180.0f) {
+    diff += 360.0f;
+  }
+  if (std::fabs(diff) > bot.getAimTolerance()) {
+    return directionKeys(toNearest);
+  }
+
+  // Facing it: stand still and fire. A press the Player's own fire rate
+  // would swallow is held back, so every recorded shot is a real one.
+  auto *player = cm.getComponent<components::Player>(entity);
+  if (bot.getFireCooldown() <= 0.0f && bot.getShotsPerSecond() > 0.0f &&
+      (!player || player->canFire())) {
+    bot.setFireCooldown(1.0f / bot.getShotsPerSecond());
+    bot.recordShot();
+    return components::Bot::KEY_FIRE;
+  }
+  return 0;
+}
+
+uint8_t BotControlSystem::directionKeys(const Vector2 &direction) {
+  using components::Bot;
+  // Octants clockwise from +x (y points down), as PlayerControlSystem faces
+  static const uint8_t OCTANT_KEYS[8] = {
+      Bot::KEY_RIGHT,
+      Bot::KEY_RIGHT | Bot::KEY_DOWN,
+      Bot::KEY_DOWN,
+      Bot::KEY_DOWN | Bot::KEY_LEFT,
+      Bot::KEY_LEFT,
+      Bot::KEY_LEFT | Bot::KEY_UP,
+      Bot::KEY_UP,
+      Bot::KEY_UP | Bot::KEY_RIGHT};
+  if (direction.lengthSquared() == 0.0f) {
+    return 0;
+  }
+  float angle = std::atan2(direction.y, direction.x) * 180.0f / 3.14159265f;
+  long octant = std::lround(angle / 45.0f);
+  return OCTANT_KEYS[((octant % 8) + 8) % 8];
+}
+
+void BotControlSystem::applyKeys(components::Bot &bot,
+                                 components::KeyboardInput &keyboard,
+                                 uint8_t keys) {
+  uint8_t held = bot.getHeldKeys();
+  uint8_t changed = held ^ keys;
+  for (int bit = 0; changed != 0; ++bit, changed >>= 1) {
+    if ((changed & 1) == 0) {
+      continue;
+    }
+    if (keys & (1 << bit)) {
+      keyboard.pressKey(KEY_NAMES[bit]);
+    } else {
+      keyboard.releaseKey(KEY_NAMES[bit]);
+    }
+  }
+  bot.setHeldKeys(keys);
+}
+
+void BotControlSystem::restartRound(components::Bot &bot) {
+  auto &gameState = components::ShootingGalleryState::getInstance();
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[BotControlSystem] Round over (score %d, %d shots); starting "
+              "round %llu",
+              gameState.score, gameState.shotsFired,
+              static_cast<unsigned long long>(bot.getRoundsStarted() + 1));
+  // Clear the field, or the duck that ended the round ends the next one too
+  ComponentManager &cm = ComponentManager::getInstance();
+  for (const Entity &target :
+       cm.getEntitiesWithComponent<components::Target>()) {
+    if (auto *expirable = cm.getComponent<components::Expirable>(target)) {
+      expirable->markExpired();
+    }
+  }
+  gameState.startGame();
+  if (auto *gameStateSystem =
+          SystemManager::getInstance().getSystem<GameStateSystem>()) {
+    gameStateSystem->reset();
+  }
+  bot.recordRoundStarted();
+}
+
+std::string BotControlSystem::toString() const {
+  return "BotControlSystem(entities=" + std::to_string(getEntities().size()) +
+         ")";
+}
+
+} // namespace systems
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../System.hpp"
+#include "../Vector2.hpp"
+#include "../components/Bot.hpp"
+#include "../components/KeyboardInput.hpp"
+#include "../components/Transform.hpp"
+#include <SDL3/SDL.h>
+#include <string>
+
+namespace game {
+namespace ecs {
+class RandomStream;
+namespace systems {
+
+/**
+ * System that plays the game for entities with a Bot component.
+ *
+ * Each frame the bot picks a direction and writes key presses into the
+ * entity's KeyboardInput, which PlayerControlSystem reads like human input:
+ * - a duck inside the danger radius: move directly away from it
+ * - otherwise the nearest duck: turn towards it (the player only turns
+ *   while moving, in 45 degree steps), then stand still and fire at most
+ *   Bot::getShotsPerSecond() times per second
+ * - no ducks: wander in a random direction that changes every
+ *   Bot::getWanderInterval() seconds
+ *
+ * Random choices come from the "BotControlSystem" stream of the world RNG,
+ * so a seeded run replays the same bot session. Runs before
+ * PlayerControlSystem.
+ *
+ * Requires entities to have Bot, Transform and KeyboardInput components.
+ */
+class BotControlSystem : public System {
+public:
+  BotControlSystem();
+
+  virtual ~BotControlSystem() = default;
+
+  /**
+   * Decide and apply the bot's key presses.
+   * @param deltaTime Time elapsed since last update
+   */
+  void update(float deltaTime) override;
+
+  /**
+   * String representation for debugging
+   * @return String describing the bot system
+   */
+  std::string toString() const;
+
+private:
+  /**
+   * Choose the keys to hold this frame.
+   * @return Bitmask of components::Bot::Key
+   */
+  uint8_t chooseKeys(const Entity &entity, components::Bot &bot,
+                     const components::Transform &transform, float deltaTime);
+
+  /**
+   * Movement keys that make the player move (and face) along a direction.
+   * @return Bitmask of components::Bot::Key
+   */
+  static uint8_t directionKeys(const Vector2 &direction);
+
+  /**
+   * Press and release keys so that exactly the given bot keys are held.
+   */
+  static void applyKeys(components::Bot &bot,
+                        components::KeyboardInput &keyboard, uint8_t keys);
+
+  /**
+   * Start a new round after game over (Bot::getRestartRounds()), expiring
+   * the ducks left over from the last one.
+   */
+  void restartRound(components::Bot &bot);
+
+  RandomStream &random_;
+};
+
+} // namespace systems
+} // namespace ecs
+} // namespace game
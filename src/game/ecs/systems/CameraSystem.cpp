@@ -0,0 +1,92 @@
+#include "CameraSystem.hpp"
+#include "../ComponentManager.hpp"
+#include "../SimulationLod.hpp"
+#include "../components/Camera.hpp"
+#include "../components/Sprite.hpp"
+#include "../components/Transform.hpp"
+#include <algorithm>
+
+namespace game {
+namespace ecs {
+namespace systems {
+
+CameraSystem::CameraSystem(float worldWidth, float worldHeight)
+    : System(), worldWidth_(worldWidth), worldHeight_(worldHeight) {
+
+  // Register required components
+  registerRequiredComponent<components::Camera>();
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[CameraSystem] Initialized with world %fx%f", worldWidth_,
+              worldHeight_);
+}
+
+void CameraSystem::setWorldBounds(float worldWidth, float worldHeight) {
+  worldWidth_ = worldWidth;
+  worldHeight_ = worldHeight;
+}
+
+void CameraSystem::update(float) { track(); }
+
+void CameraSystem::publishViewport() {
+  if (const components::Camera *camera = track()) {
+    const Vector2 &position = camera->getPosition();
+    SimulationLod::getInstance().setViewport(position.x, position.y,
+                                             camera->getViewWidth(),
+                                             camera->getViewHeight());
+  }
+}
+
+components::Camera *CameraSystem::track() {
+  if (getEntities().empty()) {
+    return nullptr;
+  }
+
+  ComponentManager &cm = ComponentManager::getInstance();
+  auto *camera = cm.getComponent<components::Camera>(getEntities().front());
+  if (!camera) {
+    return nullptr;
+  }
+
+  Vector2 position = camera->getPosition();
+  if (camera->isFollowing()) {
+    const Entity &target = camera->getFollowTarget();
+    auto *transform = cm.getComponent<components::Transform>(target);
+    if (transform) {
+      // Center on the middle of the target's sprite when it has one
+      Vector2 center = transform->getPosition();
+      auto *sprite = cm.getComponent<components::Sprite>(target);
+      if (sprite) {
+        center.x += sprite->getWidth() * 0.5f;
+        center.y += sprite->getHeight() * 0.5f;
+      }
+      position.x = center.x - camera->getViewWidth() * 0.5f;
+      position.y = center.y - camera->getViewHeight() * 0.5f;
+    }
+  }
+
+  // Keep the view inside the world (pinned to the origin if the world is
+  // smaller than the view)
+  position.x = std::max(
+      0.0f, std::min(position.x, worldWidth_ - camera->getViewWidth()));
+  position.y = std::max(
+      0.0f, std::min(position.y, worldHeight_ - camera->getViewHeight()));
+  camera->setPosition(position);
+  return camera;
+}
+
+const components::Camera *CameraSystem::getActiveCamera() const {
+  if (getEntities().empty()) {
+    return nullptr;
+  }
+  return ComponentManager::getInstance().getComponent<components::Camera>(
+      getEntities().front());
+}
+
+std::string CameraSystem::toString() const {
+  return "CameraSystem(cameras=" + std::to_string(getEntities().size()) + ")";
+}
+
+} // namespace systems
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../System.hpp"
+#include "../Entity.hpp"
+#include <SDL3/SDL.h>
+#include <string>
+
+namespace game {
+namespace ecs {
+namespace components {
+class Camera;
+}
+namespace systems {
+
+/**
+ * System that moves cameras and publishes the active view.
+ *
+ * The first Camera entity is the active camera. Each update it is centered
+ * on its follow target (when it has one) and clamped to the world bounds,
+ * and RenderSystem uses it to transform world coordinates into view space.
+ * GameWorld calls publishViewport() before the other systems run, so
+ * SimulationLod culls against this step's view rather than the last one.
+ *
+ * Requires entities to have a Camera component.
+ */
+class CameraSystem : public System {
+public:
+    /**
+     * Creates a new CameraSystem.
+     * @param worldWidth Width of the game world
+     * @param worldHeight Height of the game world
+     */
+    CameraSystem(float worldWidth, float worldHeight);
+
+    virtual ~CameraSystem() = default;
+
+    /**
+     * Follow targets and clamp the active camera to the world.
+     * @param deltaTime Time elapsed since last update
+     */
+    void update(float deltaTime) override;
+
+    /**
+     * Move the active camera to its target's current position and hand the
+     * view rectangle to SimulationLod. Call before the systems that ask
+     * SimulationLod which entities are on screen.
+     */
+    void publishViewport();
+
+    /**
+     * @param worldWidth Width of the game world
+     * @param worldHeight Height of the game world
+     */
+    void setWorldBounds(float worldWidth, float worldHeight);
+
+    /**
+     * @return The active camera, or nullptr if there is none
+     */
+    const components::Camera* getActiveCamera() const;
+
+    /**
+     * String representation for debugging
+     * @return String describing the camera system
+     */
+    std::string toString() const;
+
+private:
+    /**
+     * Center the active camera on its follow target and clamp it to the
+     * world.
+     * @return The active camera, or nullptr if there is none
+     */
+    components::Camera* track();
+
+    float worldWidth_;
+    float worldHeight_;
+};
+
+} // namespace systems
+} // namespace ecs
+} // namespace game
@@ -1,7 +1,9 @@
 #include "CollisionSystem.hpp"
 #include "../ComponentManager.hpp"
 #include "../Entity.hpp"
+#include "../SpatialQuery.hpp"
 #include "../SystemManager.hpp"
+#include "../VectorMath.hpp"
 #include "../components/Collision.hpp"
 #include "../components/CollisionResult.hpp"
 #include "../components/Player.hpp"
@@ -9,6 +11,7 @@
 #include "../components/Sprite.hpp"
 #include "../components/Target.hpp"
 #include "../components/Transform.hpp"
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -17,8 +20,7 @@ namespace ecs {
 namespace systems {
 
 CollisionSystem::CollisionSystem()
-    : System(), componentManager_(ComponentManager::getInstance()),
-      systemManager_(SystemManager::getInstance()) {
+    : System(), componentManager_(ComponentManager::getInstance()) {
 
   // Register required components
   registerRequiredComponent<components::Transform>();
@@ -31,29 +33,93 @@ CollisionSystem::CollisionSystem()
 }
 
 void CollisionSystem::update(float deltaTime) {
-  const auto &entitySet = getEntities();
-  std::vector<Entity> entities(entitySet.begin(), entitySet.end());
-
   // Clear all previous collision results for fresh detection cycle
   clearCollisionResults();
+  contactCount_ = 0;
+
+  computeBounds();
+
+  // Broadphase: the grid shared with SpatialQuery yields nearby pairs only.
+  // Sorting them keeps the order of the former all-pairs loop.
+  SpatialQuery &spatialQuery = SpatialQuery::getInstance();
+  spatialQuery.rebuild(entities_.data(), left_.data(), top_.data(),
+                       right_.data(), bottom_.data(), layers_.data(),
+                       entities_.size());
+  pairs_.clear();
+  spatialQuery.getGrid().forEachPair(
+      [this](uint32_t a, uint32_t b) { pairs_.emplace_back(a, b); });
+  std::sort(pairs_.begin(), pairs_.end());
+
+  for (const auto &[i, j] : pairs_) {
+    // AABB collision check with padded bounds
+    if (left_[i] < right_[j] && right_[i] > left_[j] && top_[i] < bottom_[j] &&
+        bottom_[i] > top_[j]) {
+      const Entity &entityA = entities_[i];
+      const Entity &entityB = entities_[j];
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                  "[CollisionSystem] Collision detected between entity %llu "
+                  "and entity %llu",
+                  entityA.getId(), entityB.getId());
+
+      // Store collision results in CollisionResult components (pure ECS)
+      storeCollisionResult(entityA, entityB);
+      contactCount_++;
+    }
+  }
+}
 
-  // Check each pair of entities for collision
-  for (size_t i = 0; i < entities.size(); i++) {
-    for (size_t j = i + 1; j < entities.size(); j++) {
-      const Entity &entityA = entities[i];
-      const Entity &entityB = entities[j];
-
-      if (checkCollision(entityA, entityB)) {
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-                    "[CollisionSystem] Collision detected between entity %llu "
-                    "and entity %llu",
-                    entityA.getId(), entityB.getId());
-
-        // Store collision results in CollisionResult components (pure ECS)
-        storeCollisionResult(entityA, entityB);
-      }
+void CollisionSystem::computeBounds() {
+  const size_t playerBit = componentManager_.getTypeIndex<components::Player>();
+  const size_t targetBit = componentManager_.getTypeIndex<components::Target>();
+  const size_t projectileBit =
+      componentManager_.getTypeIndex<components::Projectile>();
+
+  entities_.clear();
+  positionX_.clear();
+  positionY_.clear();
+  widths_.clear();
+  heights_.clear();
+  padding_.clear();
+  layers_.clear();
+
+  for (const Entity &entity : getEntities()) {
+    auto *transform = componentManager_.getComponent<components::Transform>(entity);
+    auto *sprite = componentManager_.getComponent<components::Sprite>(entity);
+    if (!transform || !sprite) {
+      continue;
     }
+
+    // Padding makes collision boxes smaller than the sprite; the player's
+    // box is 20 pixels smaller on each side, everything else 10
+    const Signature signature = componentManager_.getSignature(entity);
+    bool isPlayer = signature.test(playerBit);
+
+    entities_.push_back(entity);
+    positionX_.push_back(transform->getPosition().x);
+    positionY_.push_back(transform->getPosition().y);
+    widths_.push_back(sprite->getWidth());
+    heights_.push_back(sprite->getHeight());
+    padding_.push_back(isPlayer ? 20.0f : 10.0f);
+
+    uint32_t layer = SpatialQuery::LAYER_OTHER;
+    if (isPlayer) {
+      layer = SpatialQuery::LAYER_PLAYER;
+    } else if (signature.test(targetBit)) {
+      layer = SpatialQuery::LAYER_TARGET;
+    } else if (signature.test(projectileBit)) {
+      layer = SpatialQuery::LAYER_PROJECTILE;
+    }
+    layers_.push_back(layer);
   }
+
+  const size_t count = entities_.size();
+  left_.resize(count);
+  top_.resize(count);
+  right_.resize(count);
+  bottom_.resize(count);
+  vectormath::rectBounds(positionX_.data(), positionY_.data(), widths_.data(),
+                         heights_.data(), padding_.data(), left_.data(),
+                         top_.data(), right_.data(), bottom_.data(), count);
 }
 
 void CollisionSystem::clearCollisionResults() {
@@ -78,15 +144,11 @@ void CollisionSystem::clearCollisionResults() {
 
 void CollisionSystem::storeCollisionResult(const Entity &entityA,
                                            const Entity &entityB) {
-  // Enhanced debug logging
-  bool aIsPlayer =
-      componentManager_.getComponent<components::Player>(entityA) != nullptr;
-  bool aIsTarget =
-      componentManager_.getComponent<components::Target>(entityA) != nullptr;
-  bool bIsPlayer =
-      componentManager_.getComponent<components::Player>(entityB) != nullptr;
-  bool bIsTarget =
-      componentManager_.getComponent<components::Target>(entityB) != nullptr;
+  // Enhanced debug logging (signature bit tests, no component lookups)
+  bool aIsPlayer = componentManager_.has<components::Player>(entityA);
+  bool aIsTarget = componentManager_.has<components::Target>(entityA);
+  bool bIsPlayer = componentManager_.has<components::Player>(entityB);
+  bool bIsTarget = componentManager_.has<components::Target>(entityB);
 
   // Highlight player-target collisions with ERROR level so they stand out
   if ((aIsPlayer && bIsTarget) || (aIsTarget && bIsPlayer)) {
@@ -136,13 +198,9 @@ void CollisionSystem::storeCollisionResult(const Entity &entityA,
 }
 
 void CollisionSystem::ensureCollisionResultComponent(const Entity &entity) {
-  auto *collisionResult =
-      componentManager_.getComponent<components::CollisionResult>(entity);
-  if (collisionResult == nullptr) {
+  if (!componentManager_.has<components::CollisionResult>(entity)) {
     // Create and add CollisionResult component
     componentManager_.addComponent<components::CollisionResult>(entity);
-    systemManager_.onComponentAdded(
-        entity, std::type_index(typeid(components::CollisionResult)));
     SDL_LogDebug(
         SDL_LOG_CATEGORY_APPLICATION,
         "[CollisionSystem] Created CollisionResult component for entity %llu",
@@ -150,54 +208,6 @@ void CollisionSystem::ensureCollisionResultComponent(const Entity &entity) {
   }
 }
 
-bool CollisionSystem::checkCollision(const Entity &entityA,
-                                     const Entity &entityB) {
-  auto *transformA =
-      componentManager_.getComponent<components::Transform>(entityA);
-  auto *spriteA = componentManager_.getComponent<components::Sprite>(entityA);
-  auto *transformB =
-      componentManager_.getComponent<components::Transform>(entityB);
-  auto *spriteB = componentManager_.getComponent<components::Sprite>(entityB);
-
-  if (!transformA || !spriteA || !transformB || !spriteB) {
-    return false;
-  }
-
-  // Add padding to make collision boxes smaller
-  // Adjust these values to make collision boxes smaller or larger
-  float paddingA = 10.0f; // Pixels to shrink entityA's collision box
-  float paddingB = 10.0f; // Pixels to shrink entityB's collision box
-
-  // Special padding for player (make player collision box even smaller)
-  bool aIsPlayer =
-      componentManager_.getComponent<components::Player>(entityA) != nullptr;
-  bool bIsPlayer =
-      componentManager_.getComponent<components::Player>(entityB) != nullptr;
-
-  if (aIsPlayer) {
-    paddingA =
-        20.0f; // Make player collision box 20 pixels smaller on each side
-  }
-  if (bIsPlayer) {
-    paddingB =
-        20.0f; // Make player collision box 20 pixels smaller on each side
-  }
-
-  // Calculate collision bounds with padding
-  float leftA = transformA->getPosition().x + paddingA;
-  float rightA = transformA->getPosition().x + spriteA->getWidth() - paddingA;
-  float topA = transformA->getPosition().y + paddingA;
-  float bottomA = transformA->getPosition().y + spriteA->getHeight() - paddingA;
-
-  float leftB = transformB->getPosition().x + paddingB;
-  float rightB = transformB->getPosition().x + spriteB->getWidth() - paddingB;
-  float topB = transformB->getPosition().y + paddingB;
-  float bottomB = transformB->getPosition().y + spriteB->getHeight() - paddingB;
-
-  // AABB collision check with padded bounds
-  return (leftA < rightB && rightA > leftB && topA < bottomB && bottomA > topB);
-}
-
 CollisionSystem::CollisionInfo
 CollisionSystem::calculateCollisionInfo(const Entity &entityA,
                                         const Entity &entityB) {
@@ -219,16 +229,10 @@ CollisionSystem::calculateCollisionInfo(const Entity &entityA,
                          (centerA.y + centerB.y) / 2.0f);
 
   // Calculate collision normal (normalized vector from centerA to centerB)
-  float dx = centerB.x - centerA.x;
-  float dy = centerB.y - centerA.y;
-  float length = std::sqrt(dx * dx + dy * dy);
-
-  Vector2 collisionNormal;
-  if (length == 0.0f) {
+  Vector2 collisionNormal = (centerB - centerA).normalized();
+  if (collisionNormal.lengthSquared() == 0.0f) {
     // If centers are at same point, use default normal
     collisionNormal = Vector2(1.0f, 0.0f);
-  } else {
-    collisionNormal = Vector2(dx / length, dy / length);
   }
 
   return CollisionInfo(collisionPoint, collisionNormal);
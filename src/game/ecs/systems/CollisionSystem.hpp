@@ -5,7 +5,10 @@
 #include "../ComponentManager.hpp"
 #include "../SystemManager.hpp"
 #include <SDL3/SDL.h>
+#include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace game {
 namespace ecs {
@@ -24,7 +27,9 @@ namespace systems {
  * 2. No event dependencies - component-based collision handling only
  * 3. Uses AABB collision detection algorithm
  * 
- * Uses AABB (Axis-Aligned Bounding Box) collision detection.
+ * Uses AABB (Axis-Aligned Bounding Box) collision detection. Candidate pairs
+ * come from a SpatialGrid broadphase, which is published through
+ * SpatialQuery for gameplay queries.
  * Requires entities to have Transform, Sprite, and Collision components.
  */
 class CollisionSystem : public System {
@@ -47,6 +52,12 @@ public:
      */
     void update(float deltaTime) override;
 
+    /**
+     * Number of colliding pairs found by the most recent update.
+     * @return Contact count for the last frame
+     */
+    size_t getContactCount() const { return contactCount_; }
+
     /**
      * String representation for debugging
      * @return String describing the collision system
@@ -66,12 +77,11 @@ private:
     };
 
     /**
-     * Check if two entities are colliding using AABB collision detection.
-     * @param entityA First entity to check
-     * @param entityB Second entity to check
-     * @return true if the entities are colliding, false otherwise
+     * Gather the system's entities and compute their padded collision boxes
+     * into left_/top_/right_/bottom_ with one batch kernel call, plus their
+     * SpatialQuery layers.
      */
-    bool checkCollision(const Entity& entityA, const Entity& entityB);
+    void computeBounds();
 
     /**
      * Calculate the collision point and normal between two entities.
@@ -104,7 +114,25 @@ private:
 
     // Manager references
     ComponentManager& componentManager_;
-    SystemManager& systemManager_;
+
+    // Colliding pairs found in the last update
+    size_t contactCount_ = 0;
+
+    // Per-frame collision boxes, parallel to entities_; reused every frame
+    std::vector<Entity> entities_;
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> widths_;
+    std::vector<float> heights_;
+    std::vector<float> padding_;
+    std::vector<float> left_;
+    std::vector<float> top_;
+    std::vector<float> right_;
+    std::vector<float> bottom_;
+    std::vector<uint32_t> layers_;
+
+    // Broadphase candidate pairs (indices into entities_)
+    std::vector<std::pair<uint32_t, uint32_t>> pairs_;
 };
 
 } // namespace systems
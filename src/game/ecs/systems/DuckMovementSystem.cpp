@@ -1,9 +1,11 @@
 #include "DuckMovementSystem.hpp"
 #include "../ComponentManager.hpp"
+#include "../VectorMath.hpp"
 #include "../components/Expirable.hpp"
 #include "../components/Images.hpp"
 #include "../components/Movement.hpp"
 #include "../components/Player.hpp"
+#include "../components/Tags.hpp"
 #include "../components/Target.hpp"
 #include "../components/Transform.hpp"
 #include <cmath>
@@ -25,6 +27,9 @@ DuckMovementSystem::DuckMovementSystem(float worldWidth, float worldHeight)
   // Register optional component for sprite direction
   registerOptionalComponent<components::Images>();
 
+  // Ducks far from the viewport steer and move at a reduced rate
+  registerLodComponent<components::Target>();
+
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "[DuckMovementSystem] Initialized with world %fx%f", worldWidth_,
               worldHeight_);
@@ -51,7 +56,17 @@ void DuckMovementSystem::update(float deltaTime) {
     return;
   }
 
-  // Now process the ducks in this system
+  // Collect the ducks due for a step this frame
+  const Vector2 playerPosition = playerTransform->getPosition();
+  transforms_.clear();
+  movements_.clear();
+  expirables_.clear();
+  speeds_.clear();
+  directionX_.clear();
+  directionY_.clear();
+  positionX_.clear();
+  positionY_.clear();
+  stepTimes_.clear();
   for (const Entity &entity : getEntities()) {
     auto *transform = cm.getComponent<components::Transform>(entity);
     auto *movement = cm.getComponent<components::Movement>(entity);
@@ -71,43 +86,68 @@ void DuckMovementSystem::update(float deltaTime) {
       continue;
     }
 
-    // Calculate direction to player
-    Vector2 toPlayer =
-        playerTransform->getPosition() - transform->getPosition();
-    float distance =
-        std::sqrt(toPlayer.x * toPlayer.x + toPlayer.y * toPlayer.y);
+    float stepTime;
+    if (!shouldSimulate(entity, transform->getPosition(), deltaTime,
+                        stepTime)) {
+      continue;
+    }
+
+    // Flight speed by target type: bosses are faster
+    const float speed = cm.has<components::BossTarget>(entity) ? 50.0f : 30.0f;
+
+    transforms_.push_back(transform);
+    movements_.push_back(movement);
+    expirables_.push_back(expirable);
+    speeds_.push_back(speed);
+    directionX_.push_back(playerPosition.x - transform->getPosition().x);
+    directionY_.push_back(playerPosition.y - transform->getPosition().y);
+    positionX_.push_back(transform->getPosition().x);
+    positionY_.push_back(transform->getPosition().y);
+    stepTimes_.push_back(stepTime);
+  }
 
-    if (distance > 0.0f) {
-      // Normalize direction
-      toPlayer.x /= distance;
-      toPlayer.y /= distance;
+  // Calculate direction to player
+  const size_t count = transforms_.size();
+  distances_.resize(count);
+  vectormath::normalize(directionX_.data(), directionY_.data(),
+                        distances_.data(), count);
 
-      // Set velocity towards player
-      float speed = 30.0f; // Default speed
-      if (target->getTargetType() == "regular") {
-        speed = 30.0f;
-      } else if (target->getTargetType() == "boss") {
-        speed = 50.0f;
-      }
+  // Steer towards the player
+  velocityX_.resize(count);
+  velocityY_.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    auto *transform = transforms_[i];
+    auto *movement = movements_[i];
 
-      movement->setVelocity(Vector2(toPlayer.x * speed, toPlayer.y * speed));
+    if (distances_[i] > 0.0f) {
+      const float speed = speeds_[i];
+      movement->setVelocity(
+          Vector2(directionX_[i] * speed, directionY_[i] * speed));
 
       // Calculate rotation angle
-      float angle = std::atan2(toPlayer.y, toPlayer.x) * 180.0f / M_PI;
+      float angle =
+          std::atan2(directionY_[i], directionX_[i]) * 180.0f / M_PI;
       transform->setRotation(angle);
     }
 
-    // Update position based on velocity
-    float newX =
-        transform->getPosition().x + movement->getVelocity().x * deltaTime;
-    float newY =
-        transform->getPosition().y + movement->getVelocity().y * deltaTime;
-    transform->setPosition(Vector2(newX, newY));
+    velocityX_[i] = movement->getVelocity().x;
+    velocityY_[i] = movement->getVelocity().y;
+  }
+
+  // Update position based on velocity
+  vectormath::addScaled(positionX_.data(), positionY_.data(),
+                        velocityX_.data(), velocityY_.data(),
+                        stepTimes_.data(), count);
+
+  for (size_t i = 0; i < count; ++i) {
+    float newX = positionX_[i];
+    float newY = positionY_[i];
+    transforms_[i]->setPosition(Vector2(newX, newY));
 
     // Check if pawn has gone off screen
     if (newX < -50.0f || newX > worldWidth_ + 50.0f || newY < -50.0f ||
         newY > worldHeight_ + 50.0f) {
-      expirable->markExpired();
+      expirables_[i]->markExpired();
     }
   }
 }
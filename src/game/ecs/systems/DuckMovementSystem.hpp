@@ -2,7 +2,11 @@
 
 #include "../System.hpp"
 #include "../Vector2.hpp"
+#include "../components/Expirable.hpp"
+#include "../components/Movement.hpp"
+#include "../components/Transform.hpp"
 #include <SDL3/SDL.h>
+#include <vector>
 
 namespace game {
 namespace ecs {
@@ -56,6 +60,20 @@ private:
     // Duck constants
     static constexpr float DUCK_WIDTH = 40.0f;     // Duck sprite width
     static constexpr float EDGE_MARGIN = 25.0f;    // Margin beyond screen edge
+
+    // Scratch arrays for the batch kernels, reused every frame
+    std::vector<components::Transform*> transforms_;
+    std::vector<components::Movement*> movements_;
+    std::vector<components::Expirable*> expirables_;
+    std::vector<float> speeds_;
+    std::vector<float> directionX_;   // Toward the player, normalized in place
+    std::vector<float> directionY_;
+    std::vector<float> distances_;
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> velocityX_;
+    std::vector<float> velocityY_;
+    std::vector<float> stepTimes_;
 };
 
 } // namespace systems
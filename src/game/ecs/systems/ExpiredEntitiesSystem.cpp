@@ -15,6 +15,9 @@
 #include "../SystemManager.hpp"
 #include "../components/Expirable.hpp"
 #include "../components/DestroyRequest.hpp"
+#include "../components/Target.hpp"
+#include "../components/Transform.hpp"
+#include "../../diagnostics/GameplayJournal.hpp"
 #include <SDL3/SDL.h>
 #include <sstream>
 #include <algorithm>
@@ -195,12 +198,25 @@ void ExpiredEntitiesSystem::cleanupEntities(const std::vector<EntityWithReason>&
      * Remove a list of entities from the game with enhanced debugging.
      */
     ComponentManager& cm = ComponentManager::getInstance();
+    auto& journal = diagnostics::GameplayJournal::getInstance();
     std::unordered_map<std::string, int> destructionSummary;
     
     for (const EntityWithReason& entityWithReason : entitiesToRemove) {
         const Entity& entity = entityWithReason.entity;
         const std::string& reason = entityWithReason.reason;
         
+        // Ducks leaving unhit (hits are journaled by ProjectileSystem)
+        if (journal.isOpen()) {
+            auto* target = cm.getComponent<components::Target>(entity);
+            auto* transform = cm.getComponent<components::Transform>(entity);
+            if (target && transform && !target->isHitTarget()) {
+                journal.record(diagnostics::JournalEvent::EXPIRE, entity.getId(),
+                               transform->getPosition().x, transform->getPosition().y,
+                               static_cast<float>(target->getPointValue()),
+                               diagnostics::GameplayJournal::targetKind(target->getTargetType()));
+            }
+        }
+        
         try {
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                        "[ExpiredEntitiesSystem] Cleaning up entity %llu (reason: %s)",
@@ -5,6 +5,7 @@
 #include "../components/Player.hpp"
 #include "../components/Projectile.hpp"
 #include "../components/Target.hpp"
+#include "../../diagnostics/GameplayJournal.hpp"
 #include <stdexcept>
 #include <unordered_set>
 
@@ -36,6 +37,13 @@ void GameStateSystem::update(float deltaTime) {
 
   // Process collision results for player collision detection
   processCollisionResults();
+
+  // Journal round changes, whoever made them (timer, collision, restart)
+  auto &journal = diagnostics::GameplayJournal::getInstance();
+  if (journal.isOpen() && galleryState.state != journaledState_) {
+    journaledState_ = galleryState.state;
+    journal.recordState(journaledState_, galleryState.score);
+  }
 }
 
 void GameStateSystem::processCollisionResults() {
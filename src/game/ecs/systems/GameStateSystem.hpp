@@ -72,6 +72,8 @@ private:
     void processCollisionResults();
 
     GameState state_;
+    // Round state last written to the GameplayJournal
+    components::GameState journaledState_ = components::GameState::MENU;
 };
 
 } // namespace systems
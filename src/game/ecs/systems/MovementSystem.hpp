@@ -4,16 +4,23 @@
 #include "../ComponentManager.hpp"
 #include "../Entity.hpp"
 #include "../Vector2.hpp"
+#include "../VectorMath.hpp"
 #include "../components/Transform.hpp"
 #include "../components/Movement.hpp"
 #include "../components/Sprite.hpp"
+#include "../components/Target.hpp"
 #include <SDL3/SDL.h>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace game::ecs::systems {
 
 /**
  * System that handles simple entity movement without boundary collision.
+ *
+ * Moving entities are gathered into arrays each frame and integrated with
+ * the vectormath batch kernels, then written back to their components.
  * 
  * Based on: Lesson-40-WorldState/Python/src/game/ecs/systems/movement_system.py
  *           Lesson-40-WorldState/Java/src/game/ecs/systems/MovementSystem.java
@@ -28,6 +35,9 @@ public:
         registerRequiredComponent<components::Transform>();
         registerRequiredComponent<components::Movement>();
         registerRequiredComponent<components::Sprite>();
+
+        // Targets far from the viewport move at a reduced rate
+        registerLodComponent<components::Target>();
         
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
                    "MovementSystem initialized (no boundary collision)");
@@ -49,9 +59,18 @@ public:
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
                    "[MovementSystem] Entities in system at update: [%s]", ids.c_str());
         
-        for (auto& entity : getEntities()) {
-            processEntity(entity, deltaTime);
-        }
+        gatherEntities(deltaTime);
+        const size_t count = transforms_.size();
+
+        // velocity += acceleration * step, clamped to the max speed;
+        // position += velocity * step
+        vectormath::addScaled(velocityX_.data(), velocityY_.data(), accelerationX_.data(),
+                              accelerationY_.data(), stepTimes_.data(), count);
+        vectormath::clampLength(velocityX_.data(), velocityY_.data(), maxSpeeds_.data(), count);
+        vectormath::addScaled(positionX_.data(), positionY_.data(), velocityX_.data(),
+                              velocityY_.data(), stepTimes_.data(), count);
+
+        writeBack();
     }
 
     void onEntityAdded(const Entity& entity) override {
@@ -67,62 +86,90 @@ public:
 
 private:
     /**
-     * Process a single entity's movement
+     * Collect the enabled entities due for a step this frame into the
+     * scratch arrays used by the batch kernels.
      */
-    void processEntity(const Entity& entity, float deltaTime) {
-        auto transform = getComponentManager()->getComponent<components::Transform>(entity);
-        auto movement = getComponentManager()->getComponent<components::Movement>(entity);
+    void gatherEntities(float deltaTime) {
+        transforms_.clear();
+        movements_.clear();
+        positionX_.clear();
+        positionY_.clear();
+        velocityX_.clear();
+        velocityY_.clear();
+        accelerationX_.clear();
+        accelerationY_.clear();
+        maxSpeeds_.clear();
+        stepTimes_.clear();
 
-        if (!movement->isEnabled()) {
-            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                       "Entity %llu movement is disabled", entity.getId());
-            return;
-        }
+        for (const auto& entity : getEntities()) {
+            auto transform = getComponentManager()->getComponent<components::Transform>(entity);
+            auto movement = getComponentManager()->getComponent<components::Movement>(entity);
 
-        // Log initial state
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                   "Entity %llu - Initial Position: (%.2f, %.2f), Velocity: (%.2f, %.2f)",
-                   entity.getId(),
-                   transform->getPosition().x,
-                   transform->getPosition().y,
-                   movement->getVelocity().x,
-                   movement->getVelocity().y);
-
-        // Update velocity based on acceleration
-        movement->applyAcceleration(deltaTime);
-
-        // Apply max speed limit if set
-        if (movement->getMaxSpeed() > 0) {
-            clampVelocity(movement);
-        }
+            if (!movement->isEnabled()) {
+                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
+                           "Entity %llu movement is disabled", entity.getId());
+                continue;
+            }
 
-        // Calculate and apply new position (no boundary checking)
-        float newX = transform->getPosition().x + movement->getVelocity().x * deltaTime;
-        float newY = transform->getPosition().y + movement->getVelocity().y * deltaTime;
-        transform->setPosition(newX, newY);
+            float stepTime;
+            if (!shouldSimulate(entity, transform->getPosition(), deltaTime, stepTime)) {
+                continue;
+            }
 
-        // Log final state
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                   "Entity %llu - Final Position: (%.2f, %.2f), Velocity: (%.2f, %.2f)",
-                   entity.getId(),
-                   transform->getPosition().x,
-                   transform->getPosition().y,
-                   movement->getVelocity().x,
-                   movement->getVelocity().y);
+            // Log initial state
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
+                       "Entity %llu - Initial Position: (%.2f, %.2f), Velocity: (%.2f, %.2f)",
+                       entity.getId(),
+                       transform->getPosition().x,
+                       transform->getPosition().y,
+                       movement->getVelocity().x,
+                       movement->getVelocity().y);
+
+            transforms_.push_back(transform);
+            movements_.push_back(movement);
+            positionX_.push_back(transform->getPosition().x);
+            positionY_.push_back(transform->getPosition().y);
+            velocityX_.push_back(movement->getVelocity().x);
+            velocityY_.push_back(movement->getVelocity().y);
+            accelerationX_.push_back(movement->getAcceleration().x);
+            accelerationY_.push_back(movement->getAcceleration().y);
+            maxSpeeds_.push_back(movement->getMaxSpeed() > 0
+                                     ? movement->getMaxSpeed()
+                                     : std::numeric_limits<float>::infinity());
+            stepTimes_.push_back(stepTime);
+        }
     }
 
     /**
-     * Clamp velocity to max speed if it exceeds the limit
+     * Store the integrated velocities and positions in the components.
      */
-    void clampVelocity(components::Movement* movement) {
-        auto velocity = movement->getVelocity();
-        float speed = sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-        
-        if (speed > movement->getMaxSpeed()) {
-            float scale = movement->getMaxSpeed() / speed;
-            movement->setVelocity(velocity.x * scale, velocity.y * scale);
+    void writeBack() {
+        for (size_t i = 0; i < transforms_.size(); ++i) {
+            movements_[i]->setVelocity(velocityX_[i], velocityY_[i]);
+            transforms_[i]->setPosition(positionX_[i], positionY_[i]);
+
+            // Log final state
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
+                       "Entity %llu - Final Position: (%.2f, %.2f), Velocity: (%.2f, %.2f)",
+                       transforms_[i]->getEntity().getId(),
+                       positionX_[i],
+                       positionY_[i],
+                       velocityX_[i],
+                       velocityY_[i]);
         }
     }
+
+    // Scratch arrays for the batch kernels, reused every frame
+    std::vector<components::Transform*> transforms_;
+    std::vector<components::Movement*> movements_;
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> velocityX_;
+    std::vector<float> velocityY_;
+    std::vector<float> accelerationX_;
+    std::vector<float> accelerationY_;
+    std::vector<float> maxSpeeds_;
+    std::vector<float> stepTimes_;
 };
 
 } // namespace game::ecs::systems 
\ No newline at end of file
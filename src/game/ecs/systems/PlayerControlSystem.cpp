@@ -37,10 +37,8 @@ void PlayerControlSystem::onEvent(const game::events::Event &event) {
     return;
   }
 
-  // Convert key to lowercase string (matches Python/Java)
-  std::string keyString = keyboardEvent->getKeyText();
-  std::transform(keyString.begin(), keyString.end(), keyString.begin(),
-                 ::tolower);
+  // Key names are interned lowercase (matches Python/Java)
+  const std::string &keyString = keyboardEvent->getKeyText();
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "PlayerControlSystem received keyboard event: key=%s, pressed=%s",
@@ -53,6 +51,11 @@ void PlayerControlSystem::onEvent(const game::events::Event &event) {
     pressedKeys_.erase(keyString);
   }
 
+  // Joining the keys allocates; skip it unless the line would be logged
+  if (SDL_GetLogPriority(SDL_LOG_CATEGORY_APPLICATION) >
+      SDL_LOG_PRIORITY_INFO) {
+    return;
+  }
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "PlayerControlSystem pressed_keys after update: {%s}",
               [this]() {
@@ -20,8 +20,11 @@
  */
 
 #include "ProjectileSystem.hpp"
+#include "../../audio/AudioMixer.hpp"
+#include "../../diagnostics/GameplayJournal.hpp"
 #include "../ComponentManager.hpp"
 #include "../Entity.hpp"
+#include "../ParticleEmitter.hpp"
 #include "../SystemManager.hpp"
 #include "../components/Collision.hpp"
 #include "../components/CollisionResult.hpp"
@@ -56,6 +59,7 @@ ProjectileSystem::ProjectileSystem()
 
   // Get system manager reference for proper entity registration
   systemManager_ = &SystemManager::getInstance();
+  resolveSounds();
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "[ProjectileSystem] Initialized with pure component-based "
@@ -122,6 +126,10 @@ void ProjectileSystem::update(float deltaTime) {
    * 3. Update existing projectile behavior (range tracking)
    */
 
+  if (!soundsResolved_) {
+    resolveSounds();
+  }
+
   // Process ShootRequest components first
   processShootRequests();
 
@@ -188,6 +196,10 @@ void ProjectileSystem::processShootRequests() {
       // Mark request as processed
       shootRequest->markProcessed(projectileEntity->getId());
       requestsProcessed_++;
+      playSound(shotSound_);
+      diagnostics::GameplayJournal::getInstance().record(
+          diagnostics::JournalEvent::SHOT, projectileEntity->getId(),
+          shootRequest->getPosition().x, shootRequest->getPosition().y);
       SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                   "[ProjectileSystem] Created projectile %llu from "
                   "ShootRequest at (%.1f, %.1f)",
@@ -224,38 +236,29 @@ Entity *ProjectileSystem::createProjectileFromRequest(
 
     // Notify system manager about new entity
     systemManager_->onEntityCreated(projectileEntity);
+    ComponentManager::Batch batch(cm);
 
     // Add Transform component with position from request
     Vector2 position(shootRequest.getPosition().x,
                      shootRequest.getPosition().y);
     cm.addComponent<components::Transform>(projectileEntity, position);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::Transform));
 
     // Add Movement component with direction from request
     float speed = 800.0f; // Base speed
     Vector2 direction = shootRequest.getDirection();
     Vector2 velocity(direction.x * speed, direction.y * speed);
     cm.addComponent<components::Movement>(projectileEntity, velocity);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::Movement));
 
     // Add Projectile component
     // Add Projectile component with appropriate range
     float maxRange = 800.0f; // Maximum range in any direction
     cm.addComponent<components::Projectile>(projectileEntity, speed, maxRange);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::Projectile));
 
     // Add Collision component
     cm.addComponent<components::Collision>(projectileEntity);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::Collision));
 
     // Add CollisionResult component for collision tracking
     cm.addComponent<components::CollisionResult>(projectileEntity);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::CollisionResult));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                 "[ProjectileSystem] Added CollisionResult component to "
                 "projectile %llu, should register with CollisionSystem",
@@ -265,16 +268,12 @@ Entity *ProjectileSystem::createProjectileFromRequest(
     SDL_Color yellowColor = {255, 255, 0, 255};
     cm.addComponent<components::Sprite>(projectileEntity, 4.0f, 10.0f,
                                         yellowColor);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::Sprite));
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                 "[ProjectileSystem] Added Sprite component to projectile %llu",
                 projectileEntity.getId());
 
     // Add Expirable component
     cm.addComponent<components::Expirable>(projectileEntity);
-    systemManager_->onComponentAdded(projectileEntity,
-                                     typeid(components::Expirable));
     SDL_LogInfo(
         SDL_LOG_CATEGORY_APPLICATION,
         "[ProjectileSystem] Added Expirable component to projectile %llu",
@@ -289,8 +288,9 @@ Entity *ProjectileSystem::createProjectileFromRequest(
         projectileEntity.getId(),
         projectileComp ? projectileComp->getMaxRange() : 0.0f);
 
-    // Store the entity in a static location to return a pointer
-    static Entity lastCreatedProjectile;
+    // Store the entity in a static location to return a pointer (per thread,
+    // as worlds on other threads create projectiles too)
+    static thread_local Entity lastCreatedProjectile;
     lastCreatedProjectile = projectileEntity;
     return &lastCreatedProjectile;
 
@@ -438,6 +438,9 @@ void ProjectileSystem::updateProjectiles(float deltaTime) {
     // Check if projectile has exceeded its range
     if (projectile->shouldExpire()) {
       expirable->markExpired();
+      diagnostics::GameplayJournal::getInstance().record(
+          diagnostics::JournalEvent::MISS, entity.getId(),
+          transform->getPosition().x, transform->getPosition().y);
       SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                   "[ProjectileSystem] Projectile %llu marked as EXPIRED after "
                   "traveling %.1f units",
@@ -497,6 +500,27 @@ void ProjectileSystem::handleProjectileTargetCollision(
   // Record hit in game state
   auto &gameState = components::ShootingGalleryState::getInstance();
   gameState.addScore(target->getPointValue());
+  playSound(hitSound_);
+  auto *transform = cm.getComponent<components::Transform>(targetEntity);
+  if (particles_ && transform) {
+    // Sparks fly from the middle of the duck, in its color
+    Vector2 center = transform->getPosition();
+    SDL_Color color = {255, 255, 255, 255};
+    if (auto *sprite = cm.getComponent<components::Sprite>(targetEntity)) {
+      center += Vector2(sprite->getWidth(), sprite->getHeight()) * 0.5f;
+      color = sprite->getColor();
+    }
+    particles_->emit(center, HIT_PARTICLES, color);
+  }
+  auto &journal = diagnostics::GameplayJournal::getInstance();
+  if (journal.isOpen()) {
+    const Vector2 position = transform ? transform->getPosition() : Vector2();
+    journal.record(diagnostics::JournalEvent::HIT, targetEntity.getId(),
+                   position.x, position.y,
+                   static_cast<float>(target->getPointValue()),
+                   diagnostics::GameplayJournal::targetKind(
+                       target->getTargetType()));
+  }
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "[ProjectileSystem] Recorded %d points in game state",
               target->getPointValue());
@@ -521,6 +545,25 @@ void ProjectileSystem::handleProjectileTargetCollision(
               target->getTargetType().c_str(), target->getPointValue());
 }
 
+void ProjectileSystem::playSound(audio::SoundId sound) const {
+  auto &mixer = audio::AudioMixer::getInstance();
+  if (mixer.isOpen()) {
+    mixer.play(sound);
+  }
+}
+
+void ProjectileSystem::resolveSounds() {
+  // The bank only changes while the mixer is closed (GameWorld::loadAudio)
+  auto &mixer = audio::AudioMixer::getInstance();
+  if (!mixer.isOpen()) {
+    return;
+  }
+  const audio::SoundBank &bank = mixer.getSoundBank();
+  shotSound_ = bank.find("shot");
+  hitSound_ = bank.find("hit");
+  soundsResolved_ = true;
+}
+
 std::string ProjectileSystem::getStatistics() const {
   /**
    * Get system statistics for debugging.
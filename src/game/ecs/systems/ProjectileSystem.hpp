@@ -23,6 +23,7 @@
 
 #include "../System.hpp"
 #include "../Vector2.hpp"
+#include "../../audio/SoundBank.hpp"
 #include <SDL3/SDL.h>
 #include <memory>
 #include <string>
@@ -31,6 +32,7 @@
 namespace game {
 namespace ecs {
     class Entity;
+    class ParticleEmitter;
     class SystemManager;
     namespace components {
         class ShootRequest;
@@ -78,6 +80,15 @@ public:
      */
     std::string toString() const;
 
+    /**
+     * Burst sparks here when a projectile hits a target (optional).
+     * @param particles Particle pool of this world
+     */
+    void setParticleEmitter(ParticleEmitter* particles) { particles_ = particles; }
+
+    // Sparks per hit
+    static constexpr size_t HIT_PARTICLES = 16;
+
 private:
     /**
      * Helper method to find all entities with a specific component type.
@@ -123,8 +134,30 @@ private:
      */
     void handleProjectileTargetCollision(const Entity& projectileEntity, const Entity& targetEntity);
 
+    /**
+     * Trigger a sound effect from GameData.json's audio section, if loaded.
+     * @param sound shotSound_ or hitSound_
+     */
+    void playSound(audio::SoundId sound) const;
+
+    /**
+     * Look the sound effects up in the bank once it is final (the mixer is
+     * open). GameData loads the sounds after the systems are created, so
+     * the constructor usually finds the mixer still closed and update()
+     * retries until it is open.
+     */
+    void resolveSounds();
+
     // System manager reference for entity registration
     SystemManager* systemManager_;
+
+    // Hit sparks (optional)
+    ParticleEmitter* particles_ = nullptr;
+
+    // Sound effects, resolved by resolveSounds()
+    audio::SoundId shotSound_ = audio::INVALID_SOUND;
+    audio::SoundId hitSound_ = audio::INVALID_SOUND;
+    bool soundsResolved_ = false;
     
     // Statistics for request processing
     int requestsProcessed_;
@@ -2,9 +2,13 @@
 #include "../../resources/ResourceManager.hpp"
 #include "../ComponentManager.hpp"
 #include "../Entity.hpp"
+#include "../ParticleEmitter.hpp"
+#include "CameraSystem.hpp"
+#include "../components/Camera.hpp"
 #include "../components/Images.hpp"
 #include "../components/Sprite.hpp"
 #include "../components/Transform.hpp"
+#include <algorithm>
 #include <sstream>
 
 namespace game {
@@ -35,7 +39,54 @@ void RenderSystem::setRenderer(SDL_Renderer *renderer) {
               "[RenderSystem] Renderer set to: %p", renderer);
 }
 
-void RenderSystem::update(float deltaTime) {
+void RenderSystem::update(float) {
+  // What the last step left behind is now the previous step
+  previous_.swap(latest_);
+  previousCamera_ = latestCamera_;
+  if (enabled_) {
+    render();
+  }
+  capturePositions();
+}
+
+void RenderSystem::capturePositions() {
+  latest_.clear();
+  if (!renderer_) {
+    return; // Headless worlds never draw
+  }
+  ComponentManager &cm = ComponentManager::getInstance();
+  for (const Entity &entity : getEntities()) {
+    if (auto *transform = cm.getComponent<components::Transform>(entity)) {
+      latest_.push_back({entity.getId(), transform->getPosition()});
+    }
+  }
+  if (const components::Camera *camera =
+          cameraSystem_ ? cameraSystem_->getActiveCamera() : nullptr) {
+    latestCamera_ = camera->getPosition();
+  }
+}
+
+Vector2 RenderSystem::drawPosition(size_t index, const Entity &entity,
+                                   const Vector2 &current) const {
+  if (!interpolate_ || alpha_ >= 1.0f) {
+    return current;
+  }
+  // Entities keep their order between steps unless one was added or
+  // removed in front of them; then this entity draws un-interpolated once
+  if (index >= previous_.size() || previous_[index].id != entity.getId()) {
+    return current;
+  }
+  const Vector2 &previous = previous_[index].position;
+  const Vector2 delta = current - previous;
+  if (delta.x * delta.x + delta.y * delta.y >
+      MAX_INTERPOLATED_DISTANCE * MAX_INTERPOLATED_DISTANCE) {
+    return current;
+  }
+  return previous + delta * alpha_;
+}
+
+void RenderSystem::render() {
+  drawCallCount_ = 0;
   if (!renderer_) {
     SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
                 "[RenderSystem] No renderer set for rendering");
@@ -53,8 +104,19 @@ void RenderSystem::update(float deltaTime) {
               entities.size());
 
   ComponentManager &cm = ComponentManager::getInstance();
+  const components::Camera *camera =
+      cameraSystem_ ? cameraSystem_->getActiveCamera() : nullptr;
+  Vector2 cameraPosition;
+  if (camera) {
+    cameraPosition = camera->getPosition();
+    if (interpolate_ && alpha_ < 1.0f && !previous_.empty()) {
+      cameraPosition =
+          previousCamera_ + (cameraPosition - previousCamera_) * alpha_;
+    }
+  }
 
-  for (const Entity &entity : entities) {
+  for (size_t index = 0; index < entities.size(); ++index) {
+    const Entity &entity = entities[index];
     auto *transform = cm.getComponent<components::Transform>(entity);
     auto *sprite = cm.getComponent<components::Sprite>(entity);
     auto *images = getOptionalComponent<components::Images>(entity);
@@ -86,11 +148,28 @@ void RenderSystem::update(float deltaTime) {
     }
 
     // Get the position and size
-    float x = transform->getPosition().x;
-    float y = transform->getPosition().y;
+    const Vector2 position =
+        drawPosition(index, entity, transform->getPosition());
+    float x = position.x;
+    float y = position.y;
     float width = sprite->getWidth() * transform->getScale().x;
     float height = sprite->getHeight() * transform->getScale().y;
 
+    // Cull against the camera view (padded for rotation) and move into
+    // view space
+    if (camera) {
+      float pad = transform->getRotation() != 0.0f
+                      ? std::max(width, height) * 0.5f
+                      : 0.0f;
+      if (!camera->isVisible(x - pad, y - pad, width + 2.0f * pad,
+                             height + 2.0f * pad)) {
+        continue;
+      }
+      Vector2 view = position - cameraPosition;
+      x = view.x;
+      y = view.y;
+    }
+
     // Create rectangle for positioning
     SDL_FRect rect = {x, y, width, height};
 
@@ -105,7 +184,9 @@ void RenderSystem::update(float deltaTime) {
       auto image = resourceManager.loadImage(currentImageName, renderer_);
       if (image) {
         // Draw the image centered in the rect
+        image->setScaleMode(scaleMode_);
         image->render(renderer_, x, y, width, height, transform->getRotation());
+        drawCallCount_++;
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
                     "  Rendered image '%s' for entity %llu with rotation %.1f",
                     currentImageName.c_str(), entity.getId(),
@@ -119,6 +200,11 @@ void RenderSystem::update(float deltaTime) {
       drawSprite(sprite, rect, transform->getRotation());
     }
   }
+
+  if (particles_ && particles_->getLiveCount() > 0) {
+    particles_->draw(renderer_, camera, cameraPosition);
+    drawCallCount_++;
+  }
 }
 
 void RenderSystem::drawSprite(const components::Sprite *sprite,
@@ -129,6 +215,7 @@ void RenderSystem::drawSprite(const components::Sprite *sprite,
 
   // Draw the rectangle
   SDL_RenderFillRect(renderer_, &rect);
+  drawCallCount_++;
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "  Drew rectangle at (%.1f, %.1f) with size %.1fx%.1f", rect.x,
@@ -1,22 +1,33 @@
 #pragma once
 
+#include "../Entity.hpp"
 #include "../System.hpp"
 #include "../Vector2.hpp"
 #include <SDL3/SDL.h>
 #include <memory>
+#include <vector>
 
 namespace game {
 namespace ecs {
-class Entity;
+class ParticleEmitter;
 namespace components {
 class Sprite;
 }
 namespace systems {
+class CameraSystem;
 
 /**
  * System that renders entities with sprite components.
  * Can optionally use Images component for image-based rendering.
  *
+ * The world advances in fixed steps, so a frame usually falls between two
+ * of them. With interpolation on, entities and the camera are drawn at
+ * previous + (current - previous) * alpha, where alpha is the part of a step
+ * the engine has accumulated but not simulated yet. Positions are
+ * remembered at the end of every update(); an entity without a previous
+ * position, or one that jumped further than MAX_INTERPOLATED_DISTANCE
+ * (spawned, respawned), is drawn where it is.
+ *
  * Based on: Lesson-40-WorldState/Python/src/game/ecs/systems/render_system.py
  *           Lesson-40-WorldState/Java/src/game/ecs/systems/RenderSystem.java
  */
@@ -48,6 +59,69 @@ public:
    */
   void update(float deltaTime) override;
 
+  /**
+   * Draw through the camera's active view. Entities are transformed into
+   * view space and those outside the view are skipped. Without a camera
+   * system, world coordinates are drawn as-is.
+   * @param cameraSystem Camera system providing the active camera
+   */
+  void setCameraSystem(const CameraSystem *cameraSystem) {
+    cameraSystem_ = cameraSystem;
+  }
+
+  /**
+   * Number of sprite/image draws issued by the most recent update.
+   * @return Draw call count for the last frame
+   */
+  size_t getDrawCallCount() const { return drawCallCount_; }
+
+  /**
+   * Choose smooth (linear) or nearest-neighbour filtering for scaled images.
+   * @param smooth true for linear filtering
+   */
+  void setSmoothScaling(bool smooth) {
+    scaleMode_ = smooth ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST;
+  }
+
+  /**
+   * Turn render interpolation on or off (QualityGovernor). Off draws the
+   * latest simulated positions.
+   * @param enabled true to interpolate between the last two steps
+   */
+  void setInterpolation(bool enabled) { interpolate_ = enabled; }
+
+  /**
+   * Where between the last two simulated steps the next draw falls.
+   * @param alpha 0 = previous step, 1 = latest step (clamped)
+   */
+  void setInterpolationAlpha(float alpha) {
+    alpha_ = alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+  }
+
+  /**
+   * Draw these particles on top of the entities (optional).
+   * @param particles Particle pool of this world
+   */
+  void setParticleEmitter(const ParticleEmitter *particles) {
+    particles_ = particles;
+  }
+
+  // Larger moves within one step are teleports and are not interpolated
+  static constexpr float MAX_INTERPOLATED_DISTANCE = 64.0f;
+
+  /**
+   * Skip drawing in update(), e.g. for the intermediate steps of a
+   * fast-forwarded frame. draw() still renders on demand.
+   * @param enabled false to make update() a no-op
+   */
+  void setEnabled(bool enabled) { enabled_ = enabled; }
+
+  /**
+   * Draw the current state without advancing anything (paused or slowed
+   * down simulation).
+   */
+  void draw() { render(); }
+
   /**
    * String representation for debugging
    * @return String describing the render system
@@ -55,6 +129,24 @@ public:
   std::string toString() const;
 
 private:
+  /**
+   * Clear the screen and draw every visible entity.
+   */
+  void render();
+
+  /**
+   * Remember every entity's position (and the camera's) after this step.
+   */
+  void capturePositions();
+
+  /**
+   * Position to draw an entity at: interpolated between the last two steps
+   * when possible, the current one otherwise.
+   * @param index Index of the entity in getEntities()
+   */
+  Vector2 drawPosition(size_t index, const Entity &entity,
+                       const Vector2 &current) const;
+
   /**
    * Draw a sprite at the specified position and size.
    * @param sprite The sprite component to draw
@@ -68,6 +160,35 @@ private:
 
   // Background color for clearing the screen
   SDL_Color backgroundColor_;
+
+  // Draws issued in the last update
+  size_t drawCallCount_ = 0;
+
+  // Source of the view transform (optional)
+  const CameraSystem *cameraSystem_ = nullptr;
+
+  // Texture filtering applied to images before drawing
+  SDL_ScaleMode scaleMode_ = SDL_SCALEMODE_LINEAR;
+
+  // update() draws (see setEnabled)
+  bool enabled_ = true;
+
+  // Render interpolation (see setInterpolation)
+  struct PreviousPosition {
+    Entity::ID id;
+    Vector2 position;
+  };
+  bool interpolate_ = true;
+  float alpha_ = 1.0f;
+  // Positions after the step before the latest one, in getEntities() order
+  std::vector<PreviousPosition> previous_;
+  // Positions after the latest step; becomes previous_ on the next step
+  std::vector<PreviousPosition> latest_;
+  Vector2 previousCamera_;
+  Vector2 latestCamera_;
+
+  // Drawn after the entities (optional)
+  const ParticleEmitter *particles_ = nullptr;
 };
 
 } // namespace systems
@@ -6,8 +6,10 @@
 #include "../components/Images.hpp"
 #include "../components/Movement.hpp"
 #include "../components/Sprite.hpp"
+#include "../components/Tags.hpp"
 #include "../components/Target.hpp"
 #include "../components/Transform.hpp"
+#include "../../diagnostics/GameplayJournal.hpp"
 #include <sstream>
 
 namespace game {
@@ -18,11 +20,11 @@ TargetSpawnSystem::TargetSpawnSystem(float worldWidth, float worldHeight)
     : System(), worldWidth_(worldWidth), worldHeight_(worldHeight),
       spawnAreaBottom_(worldHeight * 0.6f) // 60% from top
       ,
-      randomEngine_(randomDevice_()), distribution_(0.0f, 1.0f) {
+      random_(RandomService::getInstance().stream("TargetSpawnSystem")) {
 
   // Target type probabilities (should sum to 1.0)
-  targetWeights_["boss"] = 0.1f;   // 10% chance
-  targetWeights_["regular"] = 0.9; // 100% chance
+  targetWeights_.emplace_back("regular", 0.9f); // 90% chance
+  targetWeights_.emplace_back("boss", 0.1f);    // 10% chance
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "[TargetSpawnSystem] Initialized with world %fx%f", worldWidth_,
@@ -101,30 +103,30 @@ void TargetSpawnSystem::spawnTarget() {
   std::string targetType = chooseTargetType();
 
   // Choose which edge to spawn from (0: top, 1: right, 2: bottom, 3: left)
-  int edge = static_cast<int>(distribution_(randomEngine_) * 4);
+  int edge = static_cast<int>(random_.nextBelow(4));
 
   float x, y;
   Vector2 direction;
 
   switch (edge) {
   case 0: // Top edge
-    x = distribution_(randomEngine_) * worldWidth_;
+    x = random_.nextFloat() * worldWidth_;
     y = -25.0f;
     direction = Vector2(0.0f, 1.0f);
     break;
   case 1: // Right edge
     x = worldWidth_ + 25.0f;
-    y = distribution_(randomEngine_) * worldHeight_;
+    y = random_.nextFloat() * worldHeight_;
     direction = Vector2(-1.0f, 0.0f);
     break;
   case 2: // Bottom edge
-    x = distribution_(randomEngine_) * worldWidth_;
+    x = random_.nextFloat() * worldWidth_;
     y = worldHeight_ + 25.0f;
     direction = Vector2(0.0f, -1.0f);
     break;
   case 3: // Left edge
     x = -25.0f;
-    y = distribution_(randomEngine_) * worldHeight_;
+    y = random_.nextFloat() * worldHeight_;
     direction = Vector2(1.0f, 0.0f);
     break;
   }
@@ -139,8 +141,6 @@ void TargetSpawnSystem::spawnTarget() {
 
   // Add Collision component
   getComponentManager()->addComponent<components::Collision>(targetEntity);
-  SystemManager::getInstance().onComponentAdded(
-      targetEntity, std::type_index(typeid(components::Collision)));
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "[TargetSpawnSystem] Added Collision component to target %llu",
               targetEntity.getId());
@@ -159,6 +159,10 @@ void TargetSpawnSystem::spawnTarget() {
   ComponentManager &cm = ComponentManager::getInstance();
   auto *targetComponent = cm.getComponent<components::Target>(targetEntity);
   int pointValue = targetComponent ? targetComponent->getPointValue() : 0;
+  diagnostics::GameplayJournal::getInstance().record(
+      diagnostics::JournalEvent::SPAWN, targetEntity.getId(), x, y,
+      static_cast<float>(pointValue),
+      diagnostics::GameplayJournal::targetKind(targetType));
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
               "[TargetSpawnSystem] Created %s pawn at (%.1f, %.1f) from edge "
@@ -167,7 +171,7 @@ void TargetSpawnSystem::spawnTarget() {
 }
 
 std::string TargetSpawnSystem::chooseTargetType() {
-  float randValue = distribution_(randomEngine_);
+  float randValue = random_.nextFloat();
   float cumulativeWeight = 0.0f;
 
   for (const auto &[targetType, weight] : targetWeights_) {
@@ -252,14 +256,14 @@ void TargetSpawnSystem::createDuckFromTemplate(
 
   const auto &components = template_json["components"];
   ComponentManager &cm = ComponentManager::getInstance();
-  auto &systemManager = SystemManager::getInstance();
+
+  // Systems see the duck once, after the whole template is applied
+  ComponentManager::Batch batch(cm);
 
   // Add Transform component with initial rotation based on direction
   float initialRotation = std::atan2(direction.y, direction.x) * 180.0f / M_PI;
   cm.addComponent<components::Transform>(entity, Vector2(x, y), initialRotation,
                                          Vector2(1.0f, 1.0f));
-  systemManager.onComponentAdded(
-      entity, std::type_index(typeid(components::Transform)));
 
   // Add Sprite component from template
   if (components.contains("sprite")) {
@@ -276,8 +280,6 @@ void TargetSpawnSystem::createDuckFromTemplate(
     cm.addComponent<components::Sprite>(
         entity, spriteData["width"].get<float>(),
         spriteData["height"].get<float>(), color);
-    systemManager.onComponentAdded(entity,
-                                   std::type_index(typeid(components::Sprite)));
   }
 
   // Add Images component from template
@@ -294,16 +296,12 @@ void TargetSpawnSystem::createDuckFromTemplate(
       // Always use the first image since we're rotating the sprite
       images->setCurrentImage(0);
     }
-    systemManager.onComponentAdded(entity,
-                                   std::type_index(typeid(components::Images)));
   }
 
   // Add Movement component with velocity based on direction
   float speed = getSpeedFromTemplate(templateName);
   cm.addComponent<components::Movement>(
       entity, Vector2(direction.x * speed, direction.y * speed));
-  systemManager.onComponentAdded(entity,
-                                 std::type_index(typeid(components::Movement)));
 
   // Add Target component from template
   if (components.contains("target")) {
@@ -315,19 +313,16 @@ void TargetSpawnSystem::createDuckFromTemplate(
                                  ? targetData["targetType"].get<std::string>()
                                  : "regular";
     cm.addComponent<components::Target>(entity, pointValue, targetType);
-    systemManager.onComponentAdded(entity,
-                                   std::type_index(typeid(components::Target)));
+    if (targetType == "boss") {
+      cm.addTag<components::BossTarget>(entity);
+    }
   }
 
   // Add Collision component
   cm.addComponent<components::Collision>(entity);
-  systemManager.onComponentAdded(
-      entity, std::type_index(typeid(components::Collision)));
 
   // Add Expirable component
   cm.addComponent<components::Expirable>(entity);
-  systemManager.onComponentAdded(
-      entity, std::type_index(typeid(components::Expirable)));
 }
 
 std::string TargetSpawnSystem::toString() const {
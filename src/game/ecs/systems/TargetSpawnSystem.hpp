@@ -1,13 +1,15 @@
 #pragma once
 
+#include "../Random.hpp"
 #include "../System.hpp"
 #include "../Vector2.hpp"
 #include "../components/ShootingGalleryState.hpp"
 #include <SDL3/SDL.h>
 #include <nlohmann/json.hpp>
-#include <random>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace game {
 namespace ecs {
@@ -109,12 +111,12 @@ private:
   float spawnAreaBottom_; // Bottom of spawn area (60% from top)
 
   // Random number generation
-  mutable std::random_device randomDevice_;
-  mutable std::mt19937 randomEngine_;
-  mutable std::uniform_real_distribution<float> distribution_;
+  RandomStream &random_; // "TargetSpawnSystem" stream of the world RNG
 
-  // Target type probabilities (should sum to 1.0)
-  std::unordered_map<std::string, float> targetWeights_;
+  // Target type probabilities (should sum to 1.0), in GameData template
+  // order; chooseTargetType() walks them in this order, so a random value
+  // maps to the same type on every standard library
+  std::vector<std::pair<std::string, float>> targetWeights_;
 
   // Template storage - loaded from JSON
   std::unordered_map<std::string, nlohmann::json> templates_;
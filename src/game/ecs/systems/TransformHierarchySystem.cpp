@@ -0,0 +1,167 @@
+#include "TransformHierarchySystem.hpp"
+#include "../ComponentManager.hpp"
+#include "../components/Hierarchy.hpp"
+#include "../components/Transform.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+namespace game {
+namespace ecs {
+namespace systems {
+
+TransformHierarchySystem::TransformHierarchySystem()
+    : System(), rootCount_(0), structureDirty_(true), propagateAll_(false),
+      seenLinkGeneration_(0), seenChangeGeneration_(0), lastUpdated_(0) {
+
+  // Register required components
+  registerRequiredComponent<components::Transform>();
+  registerRequiredComponent<components::Hierarchy>();
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[TransformHierarchySystem] Initialized");
+}
+
+void TransformHierarchySystem::onEntityAdded(const Entity &) {
+  structureDirty_ = true;
+}
+
+void TransformHierarchySystem::onEntityRemoved(const Entity &) {
+  structureDirty_ = true;
+}
+
+void TransformHierarchySystem::rebuild() {
+  ComponentManager &cm = ComponentManager::getInstance();
+  nodes_.clear();
+  scratch_.clear();
+  std::unordered_map<Entity::ID, int32_t> indices;
+
+  // Walk each node's parent chain once to find its depth and root
+  for (const Entity &entity : getEntities()) {
+    auto *link = cm.getComponent<components::Hierarchy>(entity);
+    auto *transform = cm.getComponent<components::Transform>(entity);
+    if (!link || !transform) {
+      continue;
+    }
+
+    Entity root = entity;
+    int depth = 0;
+    for (auto *current = link; current && depth <= MAX_DEPTH;
+         current = cm.getComponent<components::Hierarchy>(root)) {
+      root = current->getParent();
+      depth++;
+    }
+    if (depth > MAX_DEPTH) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                  "[TransformHierarchySystem] Entity %llu: parent chain "
+                  "deeper than %d or cyclic; not attached",
+                  entity.getId(), MAX_DEPTH);
+      continue;
+    }
+    auto *rootTransform = cm.getComponent<components::Transform>(root);
+    if (!rootTransform) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                  "[TransformHierarchySystem] Entity %llu: root %llu has no "
+                  "Transform; not attached",
+                  entity.getId(), root.getId());
+      continue;
+    }
+
+    if (indices.emplace(root.getId(), static_cast<int32_t>(nodes_.size()))
+            .second) {
+      nodes_.push_back(Node{root, -1, 0, rootTransform->getVersion(), true,
+                            nullptr, nullptr, Matrix2D()});
+    }
+    scratch_.push_back(Node{entity, -1, depth, 0, true, transform, link,
+                            Matrix2D()});
+  }
+  rootCount_ = nodes_.size();
+
+  // Parents have smaller depths, so after sorting every parent is placed
+  // before its children. Nodes whose parent was dropped are dropped too.
+  std::stable_sort(
+      scratch_.begin(), scratch_.end(),
+      [](const Node &a, const Node &b) { return a.depth < b.depth; });
+  for (Node &node : scratch_) {
+    auto parent = indices.find(node.link->getParent().getId());
+    if (parent == indices.end()) {
+      continue;
+    }
+    node.parent = parent->second;
+    indices[node.entity.getId()] = static_cast<int32_t>(nodes_.size());
+    nodes_.push_back(node);
+  }
+
+  structureDirty_ = false;
+  propagateAll_ = true;
+  seenLinkGeneration_ = components::Hierarchy::getLinkGeneration();
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+              "[TransformHierarchySystem] Rebuilt: %zu roots, %zu of %zu nodes "
+              "attached",
+              rootCount_, nodes_.size() - rootCount_, getEntities().size());
+}
+
+void TransformHierarchySystem::update(float) {
+  lastUpdated_ = 0;
+  if (structureDirty_ ||
+      seenLinkGeneration_ != components::Hierarchy::getLinkGeneration()) {
+    rebuild();
+  }
+  if (nodes_.size() == rootCount_) {
+    return;
+  }
+
+  // 1. Roots: a new Transform version means the root moved
+  ComponentManager &cm = ComponentManager::getInstance();
+  bool anyDirty = propagateAll_;
+  for (size_t i = 0; i < rootCount_; ++i) {
+    Node &root = nodes_[i];
+    auto *transform = cm.getComponent<components::Transform>(root.entity);
+    if (!transform) {
+      // Root destroyed: its subtree is detached on the next rebuild
+      structureDirty_ = true;
+      return;
+    }
+    root.dirty = propagateAll_ || transform->getVersion() != root.version;
+    if (root.dirty) {
+      root.version = transform->getVersion();
+      root.world = Matrix2D::compose(transform->getPosition(),
+                                     transform->getRotation(),
+                                     transform->getScale());
+      anyDirty = true;
+    }
+  }
+
+  // Nothing moved and no local pose changed: static hierarchies stop here
+  uint64_t changes = components::Hierarchy::getChangeGeneration();
+  if (!anyDirty && changes == seenChangeGeneration_) {
+    return;
+  }
+  seenChangeGeneration_ = changes;
+
+  // 2. Nodes in depth order: parents are final before their children
+  for (size_t i = rootCount_; i < nodes_.size(); ++i) {
+    Node &node = nodes_[i];
+    const Node &parent = nodes_[node.parent];
+    node.dirty = parent.dirty || node.link->isLocalDirty();
+    if (!node.dirty) {
+      continue;
+    }
+    node.world = parent.world * node.link->getLocalMatrix();
+    node.link->setWorldMatrix(node.world);
+    node.transform->setPosition(node.world.getTranslation());
+    node.transform->setRotation(node.world.getRotation());
+    node.transform->setScale(node.world.getScale());
+    lastUpdated_++;
+  }
+  propagateAll_ = false;
+}
+
+std::string TransformHierarchySystem::toString() const {
+  return "TransformHierarchySystem(roots=" + std::to_string(rootCount_) +
+         ", nodes=" + std::to_string(getNodeCount()) + ")";
+}
+
+} // namespace systems
+} // namespace ecs
+} // namespace game
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../System.hpp"
+#include "../Entity.hpp"
+#include "../Matrix2D.hpp"
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace game {
+namespace ecs {
+namespace components {
+class Hierarchy;
+class Transform;
+}
+namespace systems {
+
+/**
+ * System that moves attached entities with their parents.
+ *
+ * Every entity with a Hierarchy component is a node; the entities at the top
+ * of the parent chains (which only need a Transform) are roots. The nodes
+ * are kept in one array sorted by depth with the roots first, so a single
+ * forward pass visits every parent before its children. The array is rebuilt
+ * only when nodes are added or removed or a parent link changes.
+ *
+ * Each update compares the roots' Transform versions with the ones seen last
+ * time. A node is dirty when its parent is dirty or its local pose changed;
+ * clean nodes are skipped, so moving one root updates only its subtree and a
+ * frame without changes costs one version check per root.
+ *
+ * Component pointers of nodes are cached between rebuilds; remove a node's
+ * Transform or Hierarchy by destroying the entity.
+ *
+ * Requires entities to have Transform and Hierarchy components.
+ */
+class TransformHierarchySystem : public System {
+public:
+    static constexpr int MAX_DEPTH = 32;  // Deeper chains are treated as cycles
+
+    TransformHierarchySystem();
+
+    virtual ~TransformHierarchySystem() = default;
+
+    /**
+     * Propagate moved roots and changed local poses down the hierarchy.
+     * @param deltaTime Time elapsed since last update
+     */
+    void update(float deltaTime) override;
+
+    void onEntityAdded(const Entity& entity) override;
+    void onEntityRemoved(const Entity& entity) override;
+
+    size_t getNodeCount() const { return nodes_.size() - rootCount_; }
+    size_t getRootCount() const { return rootCount_; }
+    size_t getLastUpdatedCount() const { return lastUpdated_; }
+
+    /**
+     * String representation for debugging
+     * @return String describing the hierarchy system
+     */
+    std::string toString() const;
+
+private:
+    struct Node {
+        Entity entity;
+        int32_t parent;                    // Index into nodes_, -1 for roots
+        int depth;                         // 0 for roots
+        uint32_t version;                  // Last seen Transform version (roots)
+        bool dirty;
+        components::Transform* transform;  // Cached for nodes, looked up for roots
+        components::Hierarchy* link;       // nullptr for roots
+        Matrix2D world;
+    };
+
+    void rebuild();
+
+    std::vector<Node> nodes_;        // Roots first, then nodes by depth
+    std::vector<Node> scratch_;      // Rebuild buffer for the non-root nodes
+    size_t rootCount_;
+    bool structureDirty_;
+    bool propagateAll_;              // Set by rebuild() to refresh every node once
+    uint64_t seenLinkGeneration_;
+    uint64_t seenChangeGeneration_;
+    size_t lastUpdated_;
+};
+
+} // namespace systems
+} // namespace ecs
+} // namespace game
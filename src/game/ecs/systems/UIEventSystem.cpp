@@ -60,9 +60,8 @@ void UIEventSystem::onEvent(const events::Event& event) {
         return;
     }
     
-    // Convert key to normalized string (lowercase for consistency)
-    std::string key = keyboardEvent->getKeyText();
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    // Key names are interned lowercase
+    const std::string& key = keyboardEvent->getKeyText();
     
     // Log that we received an event
     const char* action = keyboardEvent->isPressed() ? "pressed" : "released";
@@ -5,6 +5,9 @@ namespace game {
 namespace events {
 
 EventManager& EventManager::getInstance() {
+    if (EventManager* local = ecs::WorldLocal<EventManager>::get()) {
+        return *local;
+    }
     static EventManager instance;
     return instance;
 }
@@ -27,50 +30,60 @@ void EventManager::unsubscribe(const std::string& eventType, EventListener* list
 
 void EventManager::publish(std::shared_ptr<Event> event) {
     std::lock_guard<std::mutex> lock(queueMutex_);
-    eventQueue_.push(event);
+    eventQueue_.push_back(std::move(event));
 }
 
 void EventManager::update() {
+    // Take the reusable buffers; a listener calling update() again gets
+    // fresh ones instead of clobbering these
+    std::vector<std::shared_ptr<Event>> batch;
+    std::vector<EventListener*> listeners;
+    batch.swap(dispatchBatch_);
+    listeners.swap(dispatchListeners_);
+
     while (true) {
-        // Get next event from queue (thread-safe)
-        std::shared_ptr<Event> event;
+        // Take everything queued so far (thread-safe); events published
+        // while it is dispatched form the next batch
         {
             std::lock_guard<std::mutex> lock(queueMutex_);
             if (eventQueue_.empty()) {
                 break;
             }
-            event = eventQueue_.front();
-            eventQueue_.pop();
+            batch.swap(eventQueue_);
         }
 
-        // Get listeners for this event type (thread-safe)
-        std::unordered_set<EventListener*> listeners;
-        {
-            std::lock_guard<std::mutex> lock(listenersMutex_);
-            auto it = listeners_.find(event->getType());
-            if (it != listeners_.end()) {
-                listeners = it->second;
+        for (const auto& event : batch) {
+            // Get listeners for this event type (thread-safe)
+            listeners.clear();
+            {
+                std::lock_guard<std::mutex> lock(listenersMutex_);
+                auto it = listeners_.find(event->getType());
+                if (it != listeners_.end()) {
+                    listeners.assign(it->second.begin(), it->second.end());
+                }
             }
-        }
 
-        // Notify all listeners
-        for (auto listener : listeners) {
-            try {
-                listener->onEvent(*event);
-            } catch (const std::exception& e) {
-                std::cerr << "Error processing event: " << e.what() << std::endl;
+            // Notify all listeners
+            for (auto listener : listeners) {
+                try {
+                    listener->onEvent(*event);
+                } catch (const std::exception& e) {
+                    std::cerr << "Error processing event: " << e.what() << std::endl;
+                }
             }
         }
+        batch.clear();
     }
+
+    dispatchBatch_.swap(batch);
+    dispatchListeners_.swap(listeners);
 }
 
 void EventManager::clear() {
     std::lock_guard<std::mutex> lock1(listenersMutex_);
     std::lock_guard<std::mutex> lock2(queueMutex_);
     listeners_.clear();
-    while (!eventQueue_.empty()) {
-        eventQueue_.pop();
-    }
+    eventQueue_.clear();
 }
 
 size_t EventManager::getListenerCount(const std::string& eventType) const {
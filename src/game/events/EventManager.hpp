@@ -2,11 +2,12 @@
 
 #include "Event.hpp"
 #include "EventListener.hpp"
+#include "../ecs/WorldLocal.hpp"
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
-#include <queue>
+#include <vector>
 #include <mutex>
 
 namespace game {
@@ -15,6 +16,10 @@ namespace events {
 /**
  * Manages event subscriptions and publishing.
  * Thread-safe implementation using mutexes and thread-safe collections.
+ *
+ * The queue and the per-event listener list are vectors reused from frame to
+ * frame, so dispatching does not allocate once they have grown. update()
+ * must only be called from one thread at a time.
  */
 class EventManager {
 public:
@@ -73,12 +78,17 @@ public:
 private:
     // Private constructor for singleton pattern
     EventManager() = default;
+    friend class ecs::WorldLocal<EventManager>;
     // Delete copy constructor and assignment operator
     EventManager(const EventManager&) = delete;
     EventManager& operator=(const EventManager&) = delete;
 
     std::unordered_map<std::string, std::unordered_set<EventListener*>> listeners_;
-    std::queue<std::shared_ptr<Event>> eventQueue_;
+    std::vector<std::shared_ptr<Event>> eventQueue_;
+    // Storage kept between update() calls for the batch being dispatched
+    // and the listeners of the current event
+    std::vector<std::shared_ptr<Event>> dispatchBatch_;
+    std::vector<EventListener*> dispatchListeners_;
     mutable std::mutex listenersMutex_;
     mutable std::mutex queueMutex_;
 };
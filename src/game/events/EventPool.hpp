@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace game {
+namespace events {
+
+/**
+ * Free list of fixed-size memory blocks.
+ *
+ * Released blocks are kept (up to MAX_FREE) and handed out again, so an
+ * event type published every frame stops reaching the heap once the pool
+ * has warmed up. Thread-safe: events may be published from any thread.
+ */
+template <size_t BlockSize>
+class BlockPool {
+public:
+    static constexpr size_t MAX_FREE = 1024;
+
+    static BlockPool& getInstance() {
+        // Never destroyed: events still queued at exit are released during
+        // static destruction
+        static BlockPool* instance = new BlockPool();
+        return *instance;
+    }
+
+    void* allocate() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (FreeBlock* block = free_) {
+                free_ = block->next;
+                --freeCount_;
+                return block;
+            }
+        }
+        return ::operator new(SIZE);
+    }
+
+    void deallocate(void* memory) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (freeCount_ < MAX_FREE) {
+                free_ = new (memory) FreeBlock{free_};
+                ++freeCount_;
+                return;
+            }
+        }
+        ::operator delete(memory);
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    static constexpr size_t SIZE =
+        BlockSize > sizeof(FreeBlock) ? BlockSize : sizeof(FreeBlock);
+
+    BlockPool() = default;
+
+    std::mutex mutex_;
+    FreeBlock* free_ = nullptr;
+    size_t freeCount_ = 0;
+};
+
+/**
+ * Allocator drawing single objects from a BlockPool; use it with
+ * std::allocate_shared so the event and its control block come from one
+ * recycled block.
+ */
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "PoolAllocator does not support over-aligned types");
+        if (count != 1) {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T*>(BlockPool<sizeof(T)>::getInstance().allocate());
+    }
+
+    void deallocate(T* memory, size_t count) {
+        if (count != 1) {
+            ::operator delete(memory);
+            return;
+        }
+        BlockPool<sizeof(T)>::getInstance().deallocate(memory);
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>&) const { return false; }
+};
+
+} // namespace events
+} // namespace game
@@ -1,14 +1,68 @@
 #include "KeyboardEvent.hpp"
+#include "EventPool.hpp"
+#include <cctype>
+#include <mutex>
+#include <vector>
 
 namespace game {
 namespace events {
 
+namespace {
+
+// Interned key names; a keyboard has only so many keys, so a linear scan is
+// as fast as hashing and needs no temporary string
+std::mutex symbolsMutex;
+std::vector<std::unique_ptr<std::string>> symbols;
+
+bool matchesLowercase(const std::string& symbol, const char* keyName) {
+    size_t i = 0;
+    for (; i < symbol.size(); ++i) {
+        if (keyName[i] == '\0' ||
+            symbol[i] != std::tolower(static_cast<unsigned char>(keyName[i]))) {
+            return false;
+        }
+    }
+    return keyName[i] == '\0';
+}
+
+} // namespace
+
 KeyboardEvent::KeyboardEvent(const std::string& key, const std::string& keyText, bool isPressed)
     : Event("keyboard")
-    , key_(key)
-    , keyText_(keyText)
+    , key_(&internKey(key.c_str()))
+    , keyText_(&internKey(keyText.c_str()))
     , isPressed_(isPressed) {
 }
 
+KeyboardEvent::KeyboardEvent(Interned, const std::string& key, const std::string& keyText,
+                             bool isPressed)
+    : Event("keyboard")
+    , key_(&key)
+    , keyText_(&keyText)
+    , isPressed_(isPressed) {
+}
+
+std::shared_ptr<KeyboardEvent> KeyboardEvent::create(const char* keyName, bool isPressed) {
+    // One lookup: the key and its text are the same symbol
+    const std::string& key = internKey(keyName);
+    return std::allocate_shared<KeyboardEvent>(PoolAllocator<KeyboardEvent>(), Interned(), key,
+                                               key, isPressed);
+}
+
+const std::string& KeyboardEvent::internKey(const char* keyName) {
+    std::lock_guard<std::mutex> lock(symbolsMutex);
+    for (const auto& symbol : symbols) {
+        if (matchesLowercase(*symbol, keyName)) {
+            return *symbol;
+        }
+    }
+    auto symbol = std::make_unique<std::string>(keyName);
+    for (char& c : *symbol) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    symbols.push_back(std::move(symbol));
+    return *symbols.back();
+}
+
 } // namespace events
-} // namespace game 
\ No newline at end of file
+} // namespace game
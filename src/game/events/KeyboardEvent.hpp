@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Event.hpp"
+#include <memory>
 #include <string>
 
 namespace game {
@@ -9,8 +10,18 @@ namespace events {
 /**
  * Represents a keyboard input event in the game.
  * Extends the base Event class with keyboard-specific data.
+ *
+ * Key names are interned: each event points at a shared lowercase copy of
+ * the name instead of owning strings, and events made with create() come
+ * from a recycling pool, so publishing a key press does not allocate.
  */
 class KeyboardEvent : public Event {
+    // Only KeyboardEvent can make one, so only it can pass pre-interned names
+    class Interned {
+        Interned() {}
+        friend class KeyboardEvent;
+    };
+
 public:
     /**
      * Initialize a new keyboard event.
@@ -20,17 +31,37 @@ public:
      */
     KeyboardEvent(const std::string& key, const std::string& keyText, bool isPressed);
 
+    /**
+     * Initialize from names internKey() already returned (used by create()).
+     */
+    KeyboardEvent(Interned, const std::string& key, const std::string& keyText, bool isPressed);
+
+    /**
+     * Create a pooled event for a key.
+     * @param keyName Key name in any case (e.g. from SDL_GetKeyName)
+     * @param isPressed Whether the key was pressed (true) or released (false)
+     * @return The event, ready to publish
+     */
+    static std::shared_ptr<KeyboardEvent> create(const char* keyName, bool isPressed);
+
+    /**
+     * Get the interned symbol for a key name.
+     * @param keyName Key name in any case
+     * @return Lowercase name, valid for the lifetime of the program
+     */
+    static const std::string& internKey(const char* keyName);
+
     /**
      * Get the key code.
      * @return The key code or SDL key constant
      */
-    const std::string& getKey() const { return key_; }
+    const std::string& getKey() const { return *key_; }
 
     /**
      * Get the text representation of the key.
      * @return The key text
      */
-    const std::string& getKeyText() const { return keyText_; }
+    const std::string& getKeyText() const { return *keyText_; }
 
     /**
      * Check if the key was pressed.
@@ -39,10 +70,10 @@ public:
     bool isPressed() const { return isPressed_; }
 
 private:
-    const std::string key_;
-    const std::string keyText_;
+    const std::string* const key_;
+    const std::string* const keyText_;
     const bool isPressed_;
 };
 
 } // namespace events
-} // namespace game 
\ No newline at end of file
+} // namespace game
@@ -0,0 +1,170 @@
+#include "ClientPrediction.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/components/KeyboardInput.hpp"
+#include "../ecs/components/Transform.hpp"
+#include "PlayerInput.hpp"
+#include "Protocol.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace game {
+namespace net {
+
+using ecs::components::KeyboardInput;
+using ecs::components::Transform;
+
+ClientPrediction::ClientPrediction(const ecs::Entity& player, std::vector<ecs::System*> systems,
+                                   const Config& config)
+    : player_(player)
+    , systems_(std::move(systems))
+    , config_(config)
+    , rollback_(std::max<size_t>(protocol::HISTORY_SIZE, config.maxRollbackTicks + 1))
+    , frames_(rollback_.getCapacity())
+{
+    ensureKeyboardInput(player_);
+
+    // Through the setters, so systems that watch Transform versions notice
+    rollback_.registerComponent<Transform>([](Transform& live, const Transform& saved) {
+        live.setPosition(saved.getPosition());
+        live.setRotation(saved.getRotation());
+        live.setScale(saved.getScale());
+    });
+}
+
+void ClientPrediction::applyInput(uint32_t tick, uint8_t input) {
+    tick_ = tick;
+    Frame& frame = frames_[tick % frames_.size()];
+    frame.tick = tick;
+    frame.input = input;
+    setInput(input);
+}
+
+void ClientPrediction::simulate() {
+    for (ecs::System* system : systems_) {
+        system->update(config_.tickSeconds);
+    }
+}
+
+void ClientPrediction::saveState() {
+    saveFrame(tick_);
+}
+
+void ClientPrediction::saveFrame(uint32_t tick) {
+    Frame& frame = frames_[tick % frames_.size()];
+    if (frame.tick != tick) {
+        return;
+    }
+    frame.predicted.id = player_.getId();
+    if (const auto* transform =
+            ecs::ComponentManager::getInstance().getComponent<Transform>(player_)) {
+        frame.predicted.fields[EntityState::X] =
+            WorldSnapshot::quantizePosition(transform->getPosition().x);
+        frame.predicted.fields[EntityState::Y] =
+            WorldSnapshot::quantizePosition(transform->getPosition().y);
+        frame.predicted.fields[EntityState::ROTATION] =
+            WorldSnapshot::quantizeRotation(transform->getRotation());
+    }
+    rollback_.save(tick);
+}
+
+const EntityState* ClientPrediction::getPredicted(uint32_t tick) const {
+    const Frame& frame = frames_[tick % frames_.size()];
+    return tick != 0 && frame.tick == tick && rollback_.contains(tick) ? &frame.predicted
+                                                                       : nullptr;
+}
+
+bool ClientPrediction::reconcile(uint32_t tick, const EntityState& authoritative) {
+    if (tick == 0 || tick > tick_) {
+        return false;
+    }
+    Frame& frame = frames_[tick % frames_.size()];
+    const bool known = frame.tick == tick && rollback_.contains(tick);
+    if (known && matches(frame.predicted, authoritative)) {
+        return false;
+    }
+    stats_.corrections++;
+
+    // Replay only what fits in the budget at the cost measured so far
+    const uint32_t replayTicks = tick_ - tick;
+    uint32_t allowedTicks = config_.maxRollbackTicks;
+    if (tickCostMs_ > 0.0) {
+        allowedTicks = std::min<uint32_t>(
+            allowedTicks, static_cast<uint32_t>(config_.budgetMs / tickCostMs_));
+    }
+    if (!known || replayTicks > allowedTicks) {
+        setPlayerState(authoritative);
+        stats_.snaps++;
+        // Predictions between tick and now were made from the wrong state
+        rollback_.clear();
+        saveState();
+        return true;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const uint8_t held = heldInput_;
+    rollback_.restore(tick);
+    setPlayerState(authoritative);
+    frame.predicted = authoritative;
+    for (uint32_t replay = tick + 1; replay <= tick_; ++replay) {
+        const Frame& recorded = frames_[replay % frames_.size()];
+        // Shots already happened; replaying FIRE would spawn them again
+        setInput(recorded.input & static_cast<uint8_t>(~INPUT_FIRE));
+        simulate();
+        saveFrame(replay);
+    }
+    setInput(held);
+    const double elapsedMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+
+    if (replayTicks > 0) {
+        const double perTick = elapsedMs / replayTicks;
+        tickCostMs_ = tickCostMs_ > 0.0 ? tickCostMs_ * 0.9 + perTick * 0.1 : perTick;
+    }
+    stats_.resimulatedTicks += replayTicks;
+    stats_.worstResimulatedTicks = std::max(stats_.worstResimulatedTicks, replayTicks);
+    stats_.lastResimulationMs = elapsedMs;
+    stats_.worstResimulationMs = std::max(stats_.worstResimulationMs, elapsedMs);
+    stats_.totalResimulationMs += elapsedMs;
+    return true;
+}
+
+void ClientPrediction::setInput(uint8_t input) {
+    if (input == heldInput_) {
+        return;
+    }
+    if (auto* keyboard =
+            ecs::ComponentManager::getInstance().getComponent<KeyboardInput>(player_)) {
+        applyPlayerInput(heldInput_, input, *keyboard);
+    }
+    heldInput_ = input;
+}
+
+void ClientPrediction::setPlayerState(const EntityState& state) {
+    if (auto* transform = ecs::ComponentManager::getInstance().getComponent<Transform>(player_)) {
+        transform->setPosition(WorldSnapshot::dequantizePosition(state.fields[EntityState::X]),
+                               WorldSnapshot::dequantizePosition(state.fields[EntityState::Y]));
+        transform->setRotation(WorldSnapshot::dequantizeRotation(state.fields[EntityState::ROTATION]));
+    }
+}
+
+bool ClientPrediction::matches(const EntityState& predicted,
+                               const EntityState& authoritative) const {
+    const int32_t dx = predicted.fields[EntityState::X] - authoritative.fields[EntityState::X];
+    const int32_t dy = predicted.fields[EntityState::Y] - authoritative.fields[EntityState::Y];
+    // Rotation wraps at a full turn
+    const int32_t turn = 65536;
+    int32_t dr = (predicted.fields[EntityState::ROTATION] -
+                  authoritative.fields[EntityState::ROTATION]) % turn;
+    if (dr > turn / 2) {
+        dr -= turn;
+    } else if (dr < -turn / 2) {
+        dr += turn;
+    }
+    return std::abs(dx) <= config_.positionTolerance && std::abs(dy) <= config_.positionTolerance &&
+           std::abs(dr) <= config_.rotationTolerance;
+}
+
+} // namespace net
+} // namespace game
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../ecs/Entity.hpp"
+#include "../ecs/RollbackBuffer.hpp"
+#include "../ecs/System.hpp"
+#include "Snapshot.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace net {
+
+/**
+ * ClientPrediction - runs the local player ahead of the server and corrects
+ * it when the server disagrees.
+ *
+ * Each client tick the game calls applyInput(), simulate() and saveState().
+ * When a snapshot arrives, reconcile() compares the server's state of the
+ * player at the newest input it applied with what was predicted for that
+ * tick. On a mismatch the predicted components are rewound to that tick,
+ * the player is set to the server's state and the recorded inputs since
+ * are replayed through the predicted systems. Corrections that would
+ * replay more than maxRollbackTicks, or more than fits in budgetMs at the
+ * measured cost per tick, snap to the server's state instead.
+ *
+ * Only component values registered with the RollbackBuffer are rewound
+ * (Transform by default), and FIRE is not replayed, so a correction never
+ * spawns projectiles twice.
+ */
+class ClientPrediction {
+public:
+    struct Config {
+        float tickSeconds = 1.0f / 60.0f;
+        uint32_t maxRollbackTicks = 16;
+        double budgetMs = 4.0; // Re-simulation time allowed per correction
+        int32_t positionTolerance = 2; // In 1/POSITION_SCALE pixels
+        int32_t rotationTolerance = 182; // In 1/65536 turn (about a degree)
+    };
+
+    struct Stats {
+        uint64_t corrections = 0; // Mispredictions found
+        uint64_t snaps = 0; // Corrections applied without re-simulating
+        uint64_t resimulatedTicks = 0;
+        uint32_t worstResimulatedTicks = 0;
+        double lastResimulationMs = 0.0;
+        double worstResimulationMs = 0.0;
+        double totalResimulationMs = 0.0;
+    };
+
+    /**
+     * @param player Entity driven by the local input (given a KeyboardInput
+     *        if it has none)
+     * @param systems Systems that run the prediction, in update order
+     *        (normally just PlayerControlSystem)
+     */
+    ClientPrediction(const ecs::Entity& player, std::vector<ecs::System*> systems,
+                     const Config& config);
+    ClientPrediction(const ecs::Entity& player, std::vector<ecs::System*> systems)
+        : ClientPrediction(player, std::move(systems), Config()) {}
+
+    /**
+     * Register further component types to rewind (Transform already is).
+     */
+    ecs::RollbackBuffer& getRollbackBuffer() { return rollback_; }
+
+    /**
+     * Hold the keys of input on the player for the given tick.
+     * @param tick Ticks must increase by one per call
+     */
+    void applyInput(uint32_t tick, uint8_t input);
+
+    /**
+     * Run the predicted systems for one tick.
+     */
+    void simulate();
+
+    /**
+     * Remember the predicted state after simulating the current tick.
+     */
+    void saveState();
+
+    /**
+     * Check the server's state of the player after input tick against the
+     * prediction and correct it if they differ.
+     * @return true if a correction was made
+     */
+    bool reconcile(uint32_t tick, const EntityState& authoritative);
+
+    /**
+     * @return Predicted state of the player after tick, or null if it is no
+     *         longer remembered
+     */
+    const EntityState* getPredicted(uint32_t tick) const;
+
+    /**
+     * @return Tick of the last applyInput()
+     */
+    uint32_t getTick() const { return tick_; }
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    struct Frame {
+        uint32_t tick = 0;
+        uint8_t input = 0;
+        EntityState predicted;
+    };
+
+    void saveFrame(uint32_t tick);
+    void setInput(uint8_t input);
+    void setPlayerState(const EntityState& state);
+    bool matches(const EntityState& predicted, const EntityState& authoritative) const;
+
+    ecs::Entity player_;
+    std::vector<ecs::System*> systems_;
+    Config config_;
+    ecs::RollbackBuffer rollback_;
+    std::vector<Frame> frames_; // Ring indexed by tick % capacity
+    uint32_t tick_ = 0;
+    uint8_t heldInput_ = 0;
+    double tickCostMs_ = 0.0; // Smoothed cost of re-simulating one tick
+    Stats stats_;
+};
+
+} // namespace net
+} // namespace game
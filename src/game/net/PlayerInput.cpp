@@ -0,0 +1,51 @@
+#include "PlayerInput.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/components/KeyboardInput.hpp"
+
+namespace game {
+namespace net {
+
+namespace {
+
+// Key names PlayerControlSystem always accepts, in PlayerInput bit order
+const char* const KEY_NAMES[] = {"arrowleft", "arrowright", "arrowup", "arrowdown", "space"};
+const char* const ALTERNATE_KEY_NAMES[] = {"a", "d", "w", "s", " "};
+
+} // namespace
+
+void applyPlayerInput(uint8_t previous, uint8_t input, ecs::components::KeyboardInput& keyboard) {
+    uint8_t changed = (previous ^ input) & INPUT_ALL;
+    for (int bit = 0; changed != 0; ++bit, changed >>= 1) {
+        if ((changed & 1) == 0) {
+            continue;
+        }
+        if (input & (1 << bit)) {
+            keyboard.pressKey(KEY_NAMES[bit]);
+        } else {
+            keyboard.releaseKey(KEY_NAMES[bit]);
+        }
+    }
+}
+
+ecs::components::KeyboardInput& ensureKeyboardInput(const ecs::Entity& entity) {
+    auto& componentManager = ecs::ComponentManager::getInstance();
+    auto* keyboard = componentManager.getComponent<ecs::components::KeyboardInput>(entity);
+    if (!keyboard) {
+        componentManager.addComponent<ecs::components::KeyboardInput>(entity);
+        keyboard = componentManager.getComponent<ecs::components::KeyboardInput>(entity);
+    }
+    return *keyboard;
+}
+
+uint8_t readPlayerInput(const ecs::components::KeyboardInput& keyboard) {
+    uint8_t input = 0;
+    for (int bit = 0; bit < 5; ++bit) {
+        if (keyboard.isPressed(KEY_NAMES[bit]) || keyboard.isPressed(ALTERNATE_KEY_NAMES[bit])) {
+            input |= static_cast<uint8_t>(1 << bit);
+        }
+    }
+    return input;
+}
+
+} // namespace net
+} // namespace game
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+namespace game {
+namespace ecs {
+class Entity;
+namespace components {
+class KeyboardInput;
+}
+} // namespace ecs
+
+namespace net {
+
+/**
+ * One tick of player input as sent over the network: a bit per key that
+ * PlayerControlSystem reacts to (same bit order as Bot::Key).
+ */
+enum PlayerInput : uint8_t {
+    INPUT_LEFT = 1 << 0,
+    INPUT_RIGHT = 1 << 1,
+    INPUT_UP = 1 << 2,
+    INPUT_DOWN = 1 << 3,
+    INPUT_FIRE = 1 << 4,
+    INPUT_ALL = 0x1F
+};
+
+/**
+ * Press and release keys on a KeyboardInput so exactly the keys in input are
+ * held.
+ * @param previous Input applied last time (only changed keys are touched)
+ */
+void applyPlayerInput(uint8_t previous, uint8_t input, ecs::components::KeyboardInput& keyboard);
+
+/**
+ * Give an entity a KeyboardInput (registered with the systems) if it has
+ * none, so inputs can be applied to it.
+ */
+ecs::components::KeyboardInput& ensureKeyboardInput(const ecs::Entity& entity);
+
+/**
+ * @return The input bits for the keys currently held on a KeyboardInput
+ *         (arrow keys, WASD and space)
+ */
+uint8_t readPlayerInput(const ecs::components::KeyboardInput& keyboard);
+
+} // namespace net
+} // namespace game
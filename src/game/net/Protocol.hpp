@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace game {
+namespace net {
+
+/**
+ * Wire format shared by SnapshotServer and SnapshotClient.
+ *
+ * Every datagram starts with a 4-byte header (magic, version, packet type).
+ * Multi-byte fields are little-endian.
+ *
+ *   HELLO     client -> server  header
+ *   ACK       client -> server  header, u32 tick of the newest snapshot decoded
+ *   INPUT     client -> server  header, u32 newest input tick, u8 count,
+ *                               count PlayerInput bytes (oldest first)
+ *   BYE       either way        header
+ *   SNAPSHOT  server -> client  header, u32 tick, u32 baseline tick (0 = full),
+ *                               u32 newest input tick of this client applied,
+ *                               u8 fragment, u8 fragment count, payload
+ *   REGION    region -> region  header, u8 sender region, u32 tick,
+ *                               u32 newest in-order sequence received, items
+ *                               (see RegionNode)
+ *
+ * INPUT repeats the last few inputs so a lost packet rarely loses one.
+ *
+ * A snapshot payload larger than MAX_FRAGMENT_PAYLOAD is split into up to
+ * MAX_FRAGMENTS datagrams; the client decodes it once all have arrived.
+ */
+namespace protocol {
+
+constexpr uint16_t MAGIC = 0x4B44; // "DK"
+constexpr uint8_t VERSION = 2;
+constexpr uint16_t DEFAULT_PORT = 27015;
+// Region i of a multi-process world listens on DEFAULT_REGION_PORT + i
+constexpr uint16_t DEFAULT_REGION_PORT = 27100;
+
+enum PacketType : uint8_t { HELLO = 1, ACK = 2, BYE = 3, SNAPSHOT = 4, INPUT = 5, REGION = 6 };
+
+constexpr size_t HEADER_SIZE = 4;
+constexpr size_t SNAPSHOT_HEADER_SIZE = HEADER_SIZE + 14;
+constexpr size_t REGION_HEADER_SIZE = HEADER_SIZE + 9;
+// Keep datagrams under common path MTUs
+constexpr size_t MAX_PACKET_SIZE = 1200;
+constexpr size_t MAX_FRAGMENT_PAYLOAD = MAX_PACKET_SIZE - SNAPSHOT_HEADER_SIZE;
+constexpr size_t MAX_FRAGMENTS = 64;
+
+// Inputs repeated in every INPUT packet
+constexpr size_t INPUT_REDUNDANCY = 8;
+
+// Snapshots both sides keep for delta baselines (about a second at 60 Hz)
+constexpr uint32_t HISTORY_SIZE = 64;
+
+inline void writeHeader(uint8_t* out, PacketType type) {
+    out[0] = static_cast<uint8_t>(MAGIC & 0xFF);
+    out[1] = static_cast<uint8_t>(MAGIC >> 8);
+    out[2] = VERSION;
+    out[3] = type;
+}
+
+/**
+ * @return Packet type, or 0 if the datagram is not ours
+ */
+inline uint8_t readHeader(const uint8_t* data, size_t size) {
+    if (size < HEADER_SIZE || data[0] != (MAGIC & 0xFF) || data[1] != (MAGIC >> 8) ||
+        data[2] != VERSION) {
+        return 0;
+    }
+    return data[3];
+}
+
+inline void writeU32(uint8_t* out, uint32_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+    out[2] = static_cast<uint8_t>(value >> 16);
+    out[3] = static_cast<uint8_t>(value >> 24);
+}
+
+inline uint32_t readU32(const uint8_t* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+} // namespace protocol
+
+} // namespace net
+} // namespace game
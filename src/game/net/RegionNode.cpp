@@ -0,0 +1,686 @@
+#include "RegionNode.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/SystemManager.hpp"
+#include "../ecs/components/Collision.hpp"
+#include "../ecs/components/CollisionResult.hpp"
+#include "../ecs/components/Expirable.hpp"
+#include "../ecs/components/Images.hpp"
+#include "../ecs/components/Movement.hpp"
+#include "../ecs/components/Projectile.hpp"
+#include "../ecs/components/Sprite.hpp"
+#include "../ecs/components/Tags.hpp"
+#include "../ecs/components/Target.hpp"
+#include "../ecs/components/Transform.hpp"
+#include "Snapshot.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <typeinfo>
+#include <utility>
+
+namespace game {
+namespace net {
+
+namespace {
+
+using ecs::ComponentManager;
+using ecs::Entity;
+using ecs::SystemManager;
+using ecs::Vector2;
+namespace components = ecs::components;
+
+// Items in a REGION packet. Handoffs and hits follow the type with a u32
+// sequence number; ghosts are unsequenced.
+enum ItemType : uint8_t { GHOST = 1, HANDOFF_TARGET = 2, HANDOFF_PROJECTILE = 3, HIT = 4 };
+
+// type, u64 ID, kind, x, y, rotation, width, height, RGBA
+constexpr size_t GHOST_ITEM_SIZE = 1 + 8 + 1 + 5 * 4 + 4;
+// Keeps the largest handoff well under one packet
+constexpr size_t MAX_STRING = 64;
+constexpr size_t MAX_IMAGES = 8;
+
+void putU8(std::vector<uint8_t>& out, uint8_t value) { out.push_back(value); }
+
+void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    const size_t at = out.size();
+    out.resize(at + 4);
+    protocol::writeU32(out.data() + at, value);
+}
+
+void putU64(std::vector<uint8_t>& out, uint64_t value) {
+    putU32(out, static_cast<uint32_t>(value));
+    putU32(out, static_cast<uint32_t>(value >> 32));
+}
+
+void putF32(std::vector<uint8_t>& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    putU32(out, bits);
+}
+
+void putString(std::vector<uint8_t>& out, const std::string& value) {
+    const size_t length = std::min(value.size(), MAX_STRING);
+    putU8(out, static_cast<uint8_t>(length));
+    out.insert(out.end(), value.begin(), value.begin() + length);
+}
+
+void putColor(std::vector<uint8_t>& out, const SDL_Color& color) {
+    putU8(out, color.r);
+    putU8(out, color.g);
+    putU8(out, color.b);
+    putU8(out, color.a);
+}
+
+// Bounds-checked reads; ok turns false at the first read past the end
+struct Reader {
+    const uint8_t* data;
+    const uint8_t* end;
+    bool ok = true;
+
+    bool has(size_t count) {
+        ok = ok && static_cast<size_t>(end - data) >= count;
+        return ok;
+    }
+
+    uint8_t u8() { return has(1) ? *data++ : 0; }
+
+    uint32_t u32() {
+        if (!has(4)) {
+            return 0;
+        }
+        const uint32_t value = protocol::readU32(data);
+        data += 4;
+        return value;
+    }
+
+    uint64_t u64() {
+        const uint64_t low = u32();
+        return low | (static_cast<uint64_t>(u32()) << 32);
+    }
+
+    float f32() {
+        const uint32_t bits = u32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string string() {
+        const uint8_t length = u8();
+        if (!has(length)) {
+            return {};
+        }
+        std::string value(reinterpret_cast<const char*>(data), length);
+        data += length;
+        return value;
+    }
+
+    SDL_Color color() {
+        SDL_Color value;
+        value.r = u8();
+        value.g = u8();
+        value.b = u8();
+        value.a = u8();
+        return value;
+    }
+};
+
+// Everything needed to recreate a duck or projectile in another region
+struct EntityCopy {
+    uint64_t id = 0;
+    uint8_t kind = EntityState::KIND_OTHER;
+    std::string name;
+    float x = 0.0f, y = 0.0f, rotation = 0.0f;
+    float scaleX = 1.0f, scaleY = 1.0f;
+    float velocityX = 0.0f, velocityY = 0.0f;
+    float width = 0.0f, height = 0.0f;
+    SDL_Color color = {255, 255, 255, 255};
+    int32_t pointValue = 0; // Ducks
+    std::string targetType;
+    std::vector<std::string> images;
+    float speed = 0.0f, maxRange = 0.0f, traveledDistance = 0.0f; // Projectiles
+};
+
+void capture(const Entity& entity, uint8_t kind, EntityCopy& copy) {
+    auto& cm = ComponentManager::getInstance();
+    copy = EntityCopy();
+    copy.id = entity.getId();
+    copy.kind = kind;
+    copy.name = entity.getName();
+    if (auto* transform = cm.getComponent<components::Transform>(entity)) {
+        copy.x = transform->getPosition().x;
+        copy.y = transform->getPosition().y;
+        copy.rotation = transform->getRotation();
+        copy.scaleX = transform->getScale().x;
+        copy.scaleY = transform->getScale().y;
+    }
+    if (auto* movement = cm.getComponent<components::Movement>(entity)) {
+        copy.velocityX = movement->getVelocity().x;
+        copy.velocityY = movement->getVelocity().y;
+    }
+    if (auto* sprite = cm.getComponent<components::Sprite>(entity)) {
+        copy.width = sprite->getWidth();
+        copy.height = sprite->getHeight();
+        copy.color = sprite->getColor();
+    }
+    if (auto* target = cm.getComponent<components::Target>(entity)) {
+        copy.pointValue = target->getPointValue();
+        copy.targetType = target->getTargetType();
+    }
+    if (auto* images = cm.getComponent<components::Images>(entity)) {
+        const auto& names = images->getImageNames();
+        copy.images.assign(names.begin(),
+                           names.begin() + std::min(names.size(), MAX_IMAGES));
+    }
+    if (auto* projectile = cm.getComponent<components::Projectile>(entity)) {
+        copy.speed = projectile->getSpeed();
+        copy.maxRange = projectile->getMaxRange();
+        copy.traveledDistance = projectile->getTraveledDistance();
+    }
+}
+
+// Handoff item with a zero sequence number; queueReliable() fills it in
+void writeHandoff(const EntityCopy& copy, std::vector<uint8_t>& out) {
+    const bool projectile = copy.kind == EntityState::KIND_PROJECTILE;
+    putU8(out, projectile ? HANDOFF_PROJECTILE : HANDOFF_TARGET);
+    putU32(out, 0);
+    putU64(out, copy.id);
+    putString(out, copy.name);
+    for (float value : {copy.x, copy.y, copy.rotation, copy.scaleX, copy.scaleY,
+                        copy.velocityX, copy.velocityY, copy.width, copy.height}) {
+        putF32(out, value);
+    }
+    putColor(out, copy.color);
+    if (projectile) {
+        putF32(out, copy.speed);
+        putF32(out, copy.maxRange);
+        putF32(out, copy.traveledDistance);
+        return;
+    }
+    putU32(out, static_cast<uint32_t>(copy.pointValue));
+    putString(out, copy.targetType);
+    putU8(out, static_cast<uint8_t>(copy.images.size()));
+    for (const auto& image : copy.images) {
+        putString(out, image);
+    }
+}
+
+void readHandoff(Reader& reader, bool projectile, EntityCopy& copy) {
+    copy = EntityCopy();
+    copy.kind = projectile ? EntityState::KIND_PROJECTILE : EntityState::KIND_TARGET;
+    copy.id = reader.u64();
+    copy.name = reader.string();
+    for (float* value : {&copy.x, &copy.y, &copy.rotation, &copy.scaleX, &copy.scaleY,
+                         &copy.velocityX, &copy.velocityY, &copy.width, &copy.height}) {
+        *value = reader.f32();
+    }
+    copy.color = reader.color();
+    if (projectile) {
+        copy.speed = reader.f32();
+        copy.maxRange = reader.f32();
+        copy.traveledDistance = reader.f32();
+        return;
+    }
+    copy.pointValue = static_cast<int32_t>(reader.u32());
+    copy.targetType = reader.string();
+    const uint8_t imageCount = reader.u8();
+    for (uint8_t i = 0; i < imageCount && reader.ok; ++i) {
+        copy.images.push_back(reader.string());
+    }
+}
+
+template <typename T, typename... Args>
+void attach(const Entity& entity, Args&&... args) {
+    ComponentManager::getInstance().addComponent<T>(entity, std::forward<Args>(args)...);
+}
+
+/**
+ * Create a handed-off entity, or a ghost: Transform and Sprite only, plus
+ * what a projectile needs to collide.
+ */
+Entity spawn(const EntityCopy& copy, bool ghost) {
+    Entity entity = Entity::create(ghost ? "region_ghost" : copy.name);
+    SystemManager::getInstance().onEntityCreated(entity);
+    ComponentManager::Batch batch(ComponentManager::getInstance());
+    attach<components::Transform>(entity, Vector2(copy.x, copy.y), copy.rotation,
+                                  Vector2(copy.scaleX, copy.scaleY));
+    attach<components::Sprite>(entity, copy.width, copy.height, copy.color);
+
+    if (copy.kind == EntityState::KIND_PROJECTILE) {
+        if (!ghost) {
+            attach<components::Movement>(entity, Vector2(copy.velocityX, copy.velocityY));
+        }
+        attach<components::Projectile>(entity, copy.speed, copy.maxRange,
+                                       copy.traveledDistance);
+        attach<components::Collision>(entity);
+        attach<components::CollisionResult>(entity);
+        attach<components::Expirable>(entity);
+    } else if (!ghost) {
+        if (!copy.images.empty()) {
+            attach<components::Images>(entity, copy.images);
+        }
+        attach<components::Movement>(entity, Vector2(copy.velocityX, copy.velocityY));
+        attach<components::Target>(entity, copy.pointValue, copy.targetType);
+        if (copy.targetType == "boss") {
+            ComponentManager::getInstance().addTag<components::BossTarget>(entity);
+        }
+        attach<components::Collision>(entity);
+        attach<components::Expirable>(entity);
+    }
+    return entity;
+}
+
+void destroy(const Entity& entity) {
+    SystemManager::getInstance().onEntityDestroyed(entity);
+    ComponentManager::getInstance().removeAllComponents(entity);
+}
+
+bool isExpired(ComponentManager& cm, Entity::ID id) {
+    auto* expirable = cm.getComponent<components::Expirable>(id);
+    return expirable && expirable->isExpired();
+}
+
+} // namespace
+
+size_t RegionLayout::columnAt(float x) const {
+    if (x <= 0.0f || worldWidth <= 0.0f) {
+        return 0;
+    }
+    const size_t column = static_cast<size_t>(x / worldWidth * columns);
+    return std::min(column, columns - 1);
+}
+
+size_t RegionLayout::rowAt(float y) const {
+    if (y <= 0.0f || worldHeight <= 0.0f) {
+        return 0;
+    }
+    const size_t row = static_cast<size_t>(y / worldHeight * rows);
+    return std::min(row, rows - 1);
+}
+
+size_t RegionLayout::regionAt(float x, float y) const {
+    return rowAt(y) * columns + columnAt(x);
+}
+
+void RegionLayout::getBounds(size_t region, float& left, float& top, float& right,
+                             float& bottom) const {
+    const size_t column = region % columns;
+    const size_t row = region / columns;
+    left = worldWidth * column / columns;
+    right = worldWidth * (column + 1) / columns;
+    top = worldHeight * row / rows;
+    bottom = worldHeight * (row + 1) / rows;
+}
+
+bool RegionLayout::parse(const std::string& text, RegionLayout& out) {
+    const size_t separator = text.find('x');
+    if (separator == std::string::npos) {
+        return false;
+    }
+    const long columns = std::atol(text.substr(0, separator).c_str());
+    const long rows = std::atol(text.substr(separator + 1).c_str());
+    if (columns < 1 || rows < 1 ||
+        static_cast<size_t>(columns) * static_cast<size_t>(rows) > MAX_REGIONS) {
+        return false;
+    }
+    out.columns = static_cast<size_t>(columns);
+    out.rows = static_cast<size_t>(rows);
+    return true;
+}
+
+RegionNode::RegionNode(const RegionLayout& layout, size_t region, const Config& config)
+    : layout_(layout), region_(region), config_(config), peers_(layout.getRegionCount()) {}
+
+bool RegionNode::start(uint16_t port) {
+    if (region_ >= layout_.getRegionCount() || layout_.getRegionCount() > RegionLayout::MAX_REGIONS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[RegionNode] Region %zu is not in a %zux%zu grid",
+                     region_, layout_.columns, layout_.rows);
+        return false;
+    }
+    if (!socket_.open(port, true)) {
+        return false;
+    }
+    float left, top, right, bottom;
+    layout_.getBounds(region_, left, top, right, bottom);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[RegionNode] Region %zu of %zu (%.0f,%.0f)-(%.0f,%.0f) on UDP port %u",
+                region_, layout_.getRegionCount(), left, top, right, bottom,
+                socket_.getLocalPort());
+    return true;
+}
+
+void RegionNode::stop() {
+    socket_.close();
+}
+
+void RegionNode::setPeerPort(size_t region, uint16_t port) {
+    if (region < peers_.size() && region != region_) {
+        peers_[region].port = port;
+    }
+}
+
+size_t RegionNode::getGhostCount() const {
+    size_t count = 0;
+    for (const Peer& peer : peers_) {
+        for (const auto& entry : peer.ghosts) {
+            count += entry.second.consumed ? 0 : 1;
+        }
+    }
+    return count;
+}
+
+size_t RegionNode::getPendingCount() const {
+    size_t count = 0;
+    for (const Peer& peer : peers_) {
+        count += peer.pending.size();
+    }
+    return count;
+}
+
+void RegionNode::tick() {
+    if (!socket_.isOpen()) {
+        return;
+    }
+    ++tick_;
+    reportConsumedGhosts();
+    receivePackets();
+    removeStaleGhosts();
+    scanOwned();
+    flush();
+}
+
+void RegionNode::reportConsumedGhosts() {
+    auto& cm = ComponentManager::getInstance();
+    for (size_t from = 0; from < peers_.size(); ++from) {
+        for (auto& entry : peers_[from].ghosts) {
+            Ghost& ghost = entry.second;
+            if (!ghost.projectile || ghost.consumed) {
+                continue;
+            }
+            // Only a hit removes or expires a ghost projectile
+            const Entity::ID id = ghost.entity.getId();
+            if (cm.getComponent<components::Transform>(id) && !isExpired(cm, id)) {
+                continue;
+            }
+            ghost.consumed = true;
+            std::vector<uint8_t> item;
+            putU8(item, HIT);
+            putU32(item, 0);
+            putU64(item, entry.first);
+            queueReliable(from, std::move(item));
+            stats_.hitsSent++;
+        }
+    }
+}
+
+void RegionNode::receivePackets() {
+    Address from;
+    int size;
+    while ((size = socket_.receive(packet_, sizeof(packet_), from)) >= 0) {
+        if (protocol::readHeader(packet_, static_cast<size_t>(size)) != protocol::REGION ||
+            static_cast<size_t>(size) < protocol::REGION_HEADER_SIZE) {
+            continue;
+        }
+        const size_t sender = packet_[protocol::HEADER_SIZE];
+        if (sender >= peers_.size() || sender == region_) {
+            continue;
+        }
+        Peer& peer = peers_[sender];
+        const uint32_t acked = protocol::readU32(packet_ + protocol::HEADER_SIZE + 5);
+        peer.pending.erase(std::remove_if(peer.pending.begin(), peer.pending.end(),
+                                          [acked](const Pending& pending) {
+                                              return pending.sequence <= acked;
+                                          }),
+                           peer.pending.end());
+        receiveItems(sender, packet_ + protocol::REGION_HEADER_SIZE,
+                     static_cast<size_t>(size) - protocol::REGION_HEADER_SIZE);
+    }
+}
+
+void RegionNode::receiveItems(size_t from, const uint8_t* data, size_t size) {
+    auto& cm = ComponentManager::getInstance();
+    Peer& peer = peers_[from];
+    Reader reader{data, data + size};
+    EntityCopy copy;
+    while (reader.ok && reader.data < reader.end) {
+        const uint8_t type = reader.u8();
+        if (type == GHOST) {
+            copy = EntityCopy();
+            copy.id = reader.u64();
+            copy.kind = reader.u8();
+            copy.x = reader.f32();
+            copy.y = reader.f32();
+            copy.rotation = reader.f32();
+            copy.width = reader.f32();
+            copy.height = reader.f32();
+            copy.color = reader.color();
+            if (!reader.ok) {
+                break;
+            }
+            auto it = peer.ghosts.find(copy.id);
+            if (it == peer.ghosts.end()) {
+                Ghost ghost;
+                ghost.entity = spawn(copy, true);
+                ghost.projectile = copy.kind == EntityState::KIND_PROJECTILE;
+                ghost.refreshedTick = tick_;
+                peer.ghosts.emplace(copy.id, ghost);
+                continue;
+            }
+            it->second.refreshedTick = tick_;
+            auto* transform =
+                it->second.consumed
+                    ? nullptr
+                    : cm.getComponent<components::Transform>(it->second.entity.getId());
+            if (transform) {
+                transform->setPosition(copy.x, copy.y);
+                transform->setRotation(copy.rotation);
+            }
+            continue;
+        }
+        if (type != HANDOFF_TARGET && type != HANDOFF_PROJECTILE && type != HIT) {
+            break; // Unknown item: the rest of the packet cannot be parsed
+        }
+
+        const uint32_t sequence = reader.u32();
+        uint64_t hitId = 0;
+        if (type == HIT) {
+            hitId = reader.u64();
+        } else {
+            readHandoff(reader, type == HANDOFF_PROJECTILE, copy);
+        }
+        if (!reader.ok) {
+            break;
+        }
+        peer.ackDue = true;
+        // In order and once: duplicates and items after a gap wait for the resend
+        if (sequence != peer.received + 1) {
+            continue;
+        }
+        peer.received = sequence;
+
+        if (type == HIT) {
+            auto* expirable = cm.getComponent<components::Expirable>(hitId);
+            if (expirable && cm.getComponent<components::Movement>(hitId) &&
+                cm.getComponent<components::Projectile>(hitId)) {
+                expirable->markExpired();
+            }
+            stats_.hitsReceived++;
+            continue;
+        }
+
+        auto ghost = peer.ghosts.find(copy.id);
+        if (ghost != peer.ghosts.end()) {
+            const bool spent = ghost->second.consumed;
+            if (!spent) {
+                destroy(ghost->second.entity);
+            }
+            peer.ghosts.erase(ghost);
+            if (spent) {
+                continue; // Its ghost already hit a duck here
+            }
+        }
+        spawn(copy, false);
+        stats_.handoffsReceived++;
+    }
+}
+
+void RegionNode::removeStaleGhosts() {
+    for (Peer& peer : peers_) {
+        for (auto it = peer.ghosts.begin(); it != peer.ghosts.end();) {
+            if (tick_ - it->second.refreshedTick <= config_.ghostTimeoutTicks) {
+                ++it;
+                continue;
+            }
+            if (!it->second.consumed) {
+                destroy(it->second.entity);
+            }
+            it = peer.ghosts.erase(it);
+        }
+    }
+}
+
+void RegionNode::scanOwned() {
+    auto& cm = ComponentManager::getInstance();
+    leaving_.clear();
+    ownedCount_ = 0;
+
+    // Ghosts have no Movement, so only owned entities are visited
+    auto visit = [&](Entity::ID id, const Entity& entity, uint8_t kind) {
+        auto* transform = cm.getComponent<components::Transform>(id);
+        if (!transform || !cm.getComponent<components::Movement>(id) || isExpired(cm, id)) {
+            return;
+        }
+        const Vector2& position = transform->getPosition();
+        if (layout_.regionAt(position.x, position.y) != region_) {
+            leaving_.push_back(entity);
+            return;
+        }
+        ++ownedCount_;
+        queueGhost(entity, kind, position.x, position.y);
+    };
+    cm.forEachComponent<components::Target>([&](Entity::ID id, components::Target& target) {
+        visit(id, target.getEntity(), EntityState::KIND_TARGET);
+    });
+    cm.forEachComponent<components::Projectile>(
+        [&](Entity::ID id, components::Projectile& projectile) {
+            visit(id, projectile.getEntity(), EntityState::KIND_PROJECTILE);
+        });
+
+    for (const Entity& entity : leaving_) {
+        const Vector2& position = cm.getComponent<components::Transform>(entity)->getPosition();
+        handOff(entity, layout_.regionAt(position.x, position.y));
+    }
+}
+
+void RegionNode::handOff(const Entity& entity, size_t to) {
+    auto& cm = ComponentManager::getInstance();
+    EntityCopy copy;
+    capture(entity,
+            cm.getComponent<components::Projectile>(entity) ? EntityState::KIND_PROJECTILE
+                                                            : EntityState::KIND_TARGET,
+            copy);
+    std::vector<uint8_t> item;
+    writeHandoff(copy, item);
+    queueReliable(to, std::move(item));
+    destroy(entity);
+    stats_.handoffsSent++;
+}
+
+void RegionNode::queueGhost(const Entity& entity, uint8_t kind, float x, float y) {
+    const float margin = config_.ghostMargin;
+    const size_t firstColumn = layout_.columnAt(x - margin);
+    const size_t lastColumn = layout_.columnAt(x + margin);
+    const size_t firstRow = layout_.rowAt(y - margin);
+    const size_t lastRow = layout_.rowAt(y + margin);
+    if (firstColumn == lastColumn && firstRow == lastRow) {
+        return; // Nowhere near a border
+    }
+
+    auto& cm = ComponentManager::getInstance();
+    const auto* transform = cm.getComponent<components::Transform>(entity);
+    const auto* sprite = cm.getComponent<components::Sprite>(entity);
+    for (size_t row = firstRow; row <= lastRow; ++row) {
+        for (size_t column = firstColumn; column <= lastColumn; ++column) {
+            const size_t to = row * layout_.columns + column;
+            if (to == region_) {
+                continue;
+            }
+            std::vector<uint8_t>& out = peers_[to].ghostItems;
+            putU8(out, GHOST);
+            putU64(out, entity.getId());
+            putU8(out, kind);
+            putF32(out, x);
+            putF32(out, y);
+            putF32(out, transform->getRotation());
+            putF32(out, sprite ? sprite->getWidth() : 0.0f);
+            putF32(out, sprite ? sprite->getHeight() : 0.0f);
+            putColor(out, sprite ? sprite->getColor() : SDL_Color{255, 255, 255, 255});
+        }
+    }
+}
+
+void RegionNode::queueReliable(size_t to, std::vector<uint8_t>&& item) {
+    Peer& peer = peers_[to];
+    Pending pending;
+    pending.sequence = peer.nextSequence++;
+    pending.item = std::move(item);
+    protocol::writeU32(pending.item.data() + 1, pending.sequence);
+    peer.pending.push_back(std::move(pending));
+}
+
+void RegionNode::flush() {
+    for (size_t to = 0; to < peers_.size(); ++to) {
+        Peer& peer = peers_[to];
+        if (to == region_ || peer.port == 0) {
+            peer.ghostItems.clear();
+            continue;
+        }
+        size_t size = protocol::REGION_HEADER_SIZE;
+        auto append = [&](const uint8_t* item, size_t itemSize) {
+            if (size + itemSize > sizeof(packet_)) {
+                sendPacket(to, size);
+                size = protocol::REGION_HEADER_SIZE;
+            }
+            std::memcpy(packet_ + size, item, itemSize);
+            size += itemSize;
+        };
+
+        for (Pending& pending : peer.pending) {
+            if (pending.sentTick != 0 && tick_ - pending.sentTick < config_.resendTicks) {
+                continue;
+            }
+            if (pending.sentTick != 0) {
+                stats_.resends++;
+            }
+            pending.sentTick = tick_;
+            append(pending.item.data(), pending.item.size());
+        }
+        for (size_t at = 0; at < peer.ghostItems.size(); at += GHOST_ITEM_SIZE) {
+            append(peer.ghostItems.data() + at, GHOST_ITEM_SIZE);
+            stats_.ghostsSent++;
+        }
+        if (size > protocol::REGION_HEADER_SIZE || peer.ackDue) {
+            sendPacket(to, size);
+        }
+        peer.ackDue = false;
+        peer.ghostItems.clear();
+    }
+}
+
+void RegionNode::sendPacket(size_t to, size_t size) {
+    // Header and ack are written last so every packet carries the newest ack
+    protocol::writeHeader(packet_, protocol::REGION);
+    packet_[protocol::HEADER_SIZE] = static_cast<uint8_t>(region_);
+    protocol::writeU32(packet_ + protocol::HEADER_SIZE + 1, tick_);
+    protocol::writeU32(packet_ + protocol::HEADER_SIZE + 5, peers_[to].received);
+    if (socket_.sendTo(Address::loopback(peers_[to].port), packet_, size)) {
+        stats_.bytesSent += size;
+        stats_.packetsSent++;
+    } else {
+        stats_.sendFailures++;
+    }
+}
+
+} // namespace net
+} // namespace game
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "../ecs/Entity.hpp"
+#include "Protocol.hpp"
+#include "UdpSocket.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace game {
+namespace net {
+
+/**
+ * RegionLayout - the world cut into a columns x rows grid of equal regions,
+ * numbered row by row from the top left.
+ */
+struct RegionLayout {
+    static constexpr size_t MAX_REGIONS = 255; // Packets name their region in a byte
+
+    size_t columns = 1;
+    size_t rows = 1;
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+
+    size_t getRegionCount() const { return columns * rows; }
+
+    /**
+     * @return Region containing the point; points outside the world belong
+     *         to the nearest edge region
+     */
+    size_t regionAt(float x, float y) const;
+
+    size_t columnAt(float x) const;
+    size_t rowAt(float y) const;
+
+    /**
+     * Bounds of a region in world pixels.
+     */
+    void getBounds(size_t region, float& left, float& top, float& right, float& bottom) const;
+
+    /**
+     * Parse a grid size such as "2x2" (world size is left alone).
+     * @return false unless both numbers are at least 1 and there are at most
+     *         MAX_REGIONS regions
+     */
+    static bool parse(const std::string& text, RegionLayout& out);
+};
+
+/**
+ * RegionNode - one region of a world simulated by several processes.
+ *
+ * Every region process runs the whole GameWorld but owns only the ducks and
+ * projectiles inside its region. After each world update, tick():
+ *  - hands every owned duck or projectile that left the region to the region
+ *    it is in now, and destroys it here;
+ *  - sends each neighbouring region a ghost of every owned duck and
+ *    projectile within ghostMargin of its border. Ghosts are Transform and
+ *    Sprite copies that do not move by themselves and disappear once they
+ *    stop being refreshed. Ghost projectiles also collide, so a projectile
+ *    near a border hits ducks on the other side;
+ *  - lets the duck's owner decide hits: a ghost projectile that hits a local
+ *    duck scores here like a local one, and the projectile's owner is told to
+ *    expire the original.
+ *
+ * Regions on one machine talk over loopback UDP, one socket per region.
+ * Handoffs and hits are numbered per peer, acknowledged, resent until
+ * acknowledged and applied in order exactly once, so a migrating entity is
+ * never lost or duplicated. Ghosts are sent every tick and never resent.
+ *
+ * Players, spawning and the round stay per region. Single-threaded; call
+ * tick() after each world update with the region's world bound.
+ */
+class RegionNode {
+public:
+    struct Config {
+        float ghostMargin = 64.0f; // Ghost owned entities this close to a neighbour
+        uint32_t ghostTimeoutTicks = 3; // Drop ghosts not refreshed for this long
+        uint32_t resendTicks = 4; // Resend unacknowledged handoffs and hits
+    };
+
+    struct Stats {
+        uint64_t handoffsSent = 0;
+        uint64_t handoffsReceived = 0;
+        uint64_t hitsSent = 0; // Ghost projectile hits reported to their owner
+        uint64_t hitsReceived = 0;
+        uint64_t ghostsSent = 0;
+        uint64_t resends = 0; // Handoffs and hits sent again
+        uint64_t bytesSent = 0; // UDP payload bytes
+        uint64_t packetsSent = 0;
+        uint64_t sendFailures = 0;
+    };
+
+    RegionNode(const RegionLayout& layout, size_t region, const Config& config);
+    RegionNode(const RegionLayout& layout, size_t region)
+        : RegionNode(layout, region, Config()) {}
+
+    /**
+     * Bind this region's loopback socket.
+     * @param port UDP port, or 0 for any free port (see getPort())
+     */
+    bool start(uint16_t port);
+    void stop();
+
+    bool isRunning() const { return socket_.isOpen(); }
+    uint16_t getPort() const { return socket_.getLocalPort(); }
+
+    /**
+     * Tell the node where another region listens on this machine.
+     */
+    void setPeerPort(size_t region, uint16_t port);
+
+    /**
+     * Apply what the other regions sent, then hand off, ghost and report
+     * hits for this tick.
+     */
+    void tick();
+
+    size_t getRegion() const { return region_; }
+    const RegionLayout& getLayout() const { return layout_; }
+
+    // Ducks and projectiles this region owned at the end of the last tick
+    size_t getOwnedCount() const { return ownedCount_; }
+    size_t getGhostCount() const;
+    // Handoffs and hits sent but not yet acknowledged
+    size_t getPendingCount() const;
+    const Stats& getStats() const { return stats_; }
+
+private:
+    // A handoff or hit waiting for its acknowledgement
+    struct Pending {
+        uint32_t sequence = 0;
+        uint32_t sentTick = 0; // 0 = not sent yet
+        std::vector<uint8_t> item;
+    };
+
+    struct Ghost {
+        ecs::Entity entity;
+        uint32_t refreshedTick = 0;
+        bool projectile = false;
+        bool consumed = false; // Hit a local duck; kept so refreshes do not revive it
+    };
+
+    struct Peer {
+        uint16_t port = 0;
+        uint32_t nextSequence = 1;
+        uint32_t received = 0; // Newest sequence applied from this peer
+        bool ackDue = false;
+        std::vector<Pending> pending;
+        std::vector<uint8_t> ghostItems; // Built this tick
+        std::unordered_map<ecs::Entity::ID, Ghost> ghosts; // By the peer's entity ID
+    };
+
+    void reportConsumedGhosts();
+    void receivePackets();
+    void receiveItems(size_t from, const uint8_t* data, size_t size);
+    void removeStaleGhosts();
+    void scanOwned();
+    void handOff(const ecs::Entity& entity, size_t to);
+    void queueGhost(const ecs::Entity& entity, uint8_t kind, float x, float y);
+    void queueReliable(size_t to, std::vector<uint8_t>&& item);
+    void flush();
+    void sendPacket(size_t to, size_t size);
+
+    RegionLayout layout_;
+    size_t region_;
+    Config config_;
+    UdpSocket socket_;
+    std::vector<Peer> peers_; // Indexed by region; our own entry is unused
+    uint32_t tick_ = 0;
+    size_t ownedCount_ = 0;
+
+    std::vector<ecs::Entity> leaving_; // Reused by scanOwned()
+    uint8_t packet_[protocol::MAX_PACKET_SIZE];
+    Stats stats_;
+};
+
+} // namespace net
+} // namespace game
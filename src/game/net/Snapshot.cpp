@@ -0,0 +1,311 @@
+#include "Snapshot.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/components/Player.hpp"
+#include "../ecs/components/Projectile.hpp"
+#include "../ecs/components/ShootingGalleryState.hpp"
+#include "../ecs/components/Target.hpp"
+#include "../ecs/components/Transform.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace game {
+namespace net {
+
+namespace {
+
+using ecs::Component;
+using ecs::ComponentManager;
+
+void writeVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+// Difference as a zigzag-coded unsigned value: small changes in either
+// direction take one byte. Wraps instead of overflowing.
+uint32_t zigzagDelta(int32_t current, int32_t baseline) {
+    const int32_t delta =
+        static_cast<int32_t>(static_cast<uint32_t>(current) - static_cast<uint32_t>(baseline));
+    return (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+}
+
+int32_t applyZigzagDelta(int32_t baseline, uint32_t zigzag) {
+    const uint32_t delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+    return static_cast<int32_t>(static_cast<uint32_t>(baseline) + delta);
+}
+
+/**
+ * Write a change mask followed by the changed fields.
+ */
+void writeFields(std::vector<uint8_t>& out, const int32_t* baseline, const int32_t* current,
+                 int count) {
+    uint8_t mask = 0;
+    for (int i = 0; i < count; ++i) {
+        if (current[i] != baseline[i]) {
+            mask |= static_cast<uint8_t>(1u << i);
+        }
+    }
+    out.push_back(mask);
+    for (int i = 0; i < count; ++i) {
+        if (mask & (1u << i)) {
+            writeVarint(out, zigzagDelta(current[i], baseline[i]));
+        }
+    }
+}
+
+struct Reader {
+    const uint8_t* data;
+    const uint8_t* end;
+
+    bool readByte(uint8_t& value) {
+        if (data == end) {
+            return false;
+        }
+        value = *data++;
+        return true;
+    }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte;
+            if (!readByte(byte)) {
+                return false;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Inverse of writeFields: fields holds the baseline on entry
+    bool readFields(int32_t* fields, int count) {
+        uint8_t mask;
+        if (!readByte(mask) || (mask >> count) != 0) {
+            return false;
+        }
+        for (int i = 0; i < count; ++i) {
+            if (mask & (1u << i)) {
+                uint64_t zigzag;
+                if (!readVarint(zigzag) || zigzag > std::numeric_limits<uint32_t>::max()) {
+                    return false;
+                }
+                fields[i] = applyZigzagDelta(fields[i], static_cast<uint32_t>(zigzag));
+            }
+        }
+        return true;
+    }
+
+    // Next entry of an ID list (0-terminated gaps); false at the terminator
+    bool readId(uint64_t& next, uint64_t& id, bool& ok) {
+        uint64_t gap;
+        if (!readVarint(gap)) {
+            ok = false;
+            return false;
+        }
+        if (gap == 0) {
+            return false;
+        }
+        id = next + gap - 1;
+        next = id + 1;
+        return true;
+    }
+};
+
+} // namespace
+
+bool EntityState::operator==(const EntityState& other) const {
+    return id == other.id && std::memcmp(fields, other.fields, sizeof(fields)) == 0;
+}
+
+bool WorldSnapshot::operator==(const WorldSnapshot& other) const {
+    return tick == other.tick && std::memcmp(game, other.game, sizeof(game)) == 0 &&
+           entities == other.entities;
+}
+
+int32_t WorldSnapshot::quantizePosition(float value) {
+    const double scaled = std::round(static_cast<double>(value) * POSITION_SCALE);
+    if (!(scaled > std::numeric_limits<int32_t>::min())) {
+        return std::numeric_limits<int32_t>::min();
+    }
+    if (scaled >= std::numeric_limits<int32_t>::max()) {
+        return std::numeric_limits<int32_t>::max();
+    }
+    return static_cast<int32_t>(scaled);
+}
+
+int32_t WorldSnapshot::quantizeRotation(float degrees) {
+    if (!std::isfinite(degrees)) {
+        return 0;
+    }
+    double turns = std::fmod(static_cast<double>(degrees) / 360.0, 1.0);
+    if (turns < 0.0) {
+        turns += 1.0;
+    }
+    return static_cast<int32_t>(std::lround(turns * 65536.0)) & 0xFFFF;
+}
+
+void WorldSnapshot::capture(uint32_t captureTick) {
+    ComponentManager& cm = ComponentManager::getInstance();
+    const size_t transformBit =
+        cm.getComponentTypeIndex(Component::getTypeId<ecs::components::Transform>());
+    const size_t playerBit =
+        cm.getComponentTypeIndex(Component::getTypeId<ecs::components::Player>());
+    const size_t targetBit =
+        cm.getComponentTypeIndex(Component::getTypeId<ecs::components::Target>());
+    const size_t projectileBit =
+        cm.getComponentTypeIndex(Component::getTypeId<ecs::components::Projectile>());
+
+    tick = captureTick;
+    entities.clear();
+    for (ecs::Entity::ID id : cm.getLiveEntities()) {
+        const ecs::Signature signature = cm.getSignature(id);
+        if (!signature.test(transformBit)) {
+            continue;
+        }
+        auto* transform =
+            static_cast<ecs::components::Transform*>(cm.getComponent(id, transformBit));
+        EntityState state;
+        state.id = id;
+        state.fields[EntityState::KIND] = signature.test(playerBit)       ? EntityState::KIND_PLAYER
+                                          : signature.test(targetBit)     ? EntityState::KIND_TARGET
+                                          : signature.test(projectileBit) ? EntityState::KIND_PROJECTILE
+                                                                          : EntityState::KIND_OTHER;
+        state.fields[EntityState::X] = quantizePosition(transform->getPosition().x);
+        state.fields[EntityState::Y] = quantizePosition(transform->getPosition().y);
+        state.fields[EntityState::ROTATION] = quantizeRotation(transform->getRotation());
+        entities.push_back(state);
+    }
+    std::sort(entities.begin(), entities.end(),
+              [](const EntityState& a, const EntityState& b) { return a.id < b.id; });
+
+    std::fill(std::begin(game), std::end(game), 0);
+    if (ecs::components::ShootingGalleryState::hasInstance()) {
+        auto& state = ecs::components::ShootingGalleryState::getInstance();
+        game[STATE] = static_cast<int32_t>(state.state);
+        game[SCORE] = state.score;
+        game[SHOTS_FIRED] = state.shotsFired;
+        game[TARGETS_HIT] = state.targetsHit;
+        game[TIME_REMAINING_MS] = static_cast<int32_t>(std::lround(state.timeRemaining * 1000.0f));
+    }
+}
+
+void encodeSnapshot(const WorldSnapshot* baseline, const WorldSnapshot& current,
+                    std::vector<uint8_t>& out) {
+    static const WorldSnapshot EMPTY;
+    static const EntityState ZERO;
+    const WorldSnapshot& base = baseline ? *baseline : EMPTY;
+
+    writeFields(out, base.game, current.game, WorldSnapshot::GAME_FIELD_COUNT);
+
+    // Removed entities, then new and changed ones; both lists are sorted by
+    // ID, written as gaps and terminated by 0
+    uint64_t next = 0;
+    auto writeId = [&](uint64_t id) {
+        writeVarint(out, id - next + 1);
+        next = id + 1;
+    };
+    size_t c = 0;
+    for (const EntityState& old : base.entities) {
+        while (c < current.entities.size() && current.entities[c].id < old.id) {
+            ++c;
+        }
+        if (c == current.entities.size() || current.entities[c].id != old.id) {
+            writeId(old.id);
+        }
+    }
+    out.push_back(0);
+
+    next = 0;
+    size_t b = 0;
+    for (const EntityState& state : current.entities) {
+        while (b < base.entities.size() && base.entities[b].id < state.id) {
+            ++b;
+        }
+        const bool known = b < base.entities.size() && base.entities[b].id == state.id;
+        if (known && base.entities[b] == state) {
+            continue;
+        }
+        writeId(state.id);
+        writeFields(out, known ? base.entities[b].fields : ZERO.fields, state.fields,
+                    EntityState::FIELD_COUNT);
+    }
+    out.push_back(0);
+}
+
+bool decodeSnapshot(const WorldSnapshot* baseline, const uint8_t* data, size_t size,
+                    WorldSnapshot& out) {
+    static const WorldSnapshot EMPTY;
+    const WorldSnapshot& base = baseline ? *baseline : EMPTY;
+
+    Reader reader{data, data + size};
+    std::copy(std::begin(base.game), std::end(base.game), std::begin(out.game));
+    if (!reader.readFields(out.game, WorldSnapshot::GAME_FIELD_COUNT)) {
+        return false;
+    }
+
+    // Skip over the removed list to find the changed list, then merge both
+    // with the baseline in one pass
+    Reader removed = reader;
+    bool ok = true;
+    uint64_t next = 0;
+    uint64_t id;
+    while (reader.readId(next, id, ok)) {
+    }
+    if (!ok) {
+        return false;
+    }
+    Reader changed = reader;
+
+    uint64_t nextRemoved = 0;
+    uint64_t removedId = 0;
+    bool hasRemoved = removed.readId(nextRemoved, removedId, ok);
+    uint64_t nextChanged = 0;
+    uint64_t changedId = 0;
+    bool hasChanged = changed.readId(nextChanged, changedId, ok);
+
+    out.entities.clear();
+    for (const EntityState& old : base.entities) {
+        while (ok && hasChanged && changedId < old.id) {
+            EntityState state;
+            state.id = changedId;
+            ok = changed.readFields(state.fields, EntityState::FIELD_COUNT);
+            out.entities.push_back(state);
+            hasChanged = ok && changed.readId(nextChanged, changedId, ok);
+        }
+        while (ok && hasRemoved && removedId < old.id) {
+            hasRemoved = removed.readId(nextRemoved, removedId, ok);
+        }
+        if (!ok) {
+            return false;
+        }
+        if (hasRemoved && removedId == old.id) {
+            hasRemoved = removed.readId(nextRemoved, removedId, ok);
+            continue;
+        }
+        out.entities.push_back(old);
+        if (hasChanged && changedId == old.id) {
+            ok = changed.readFields(out.entities.back().fields, EntityState::FIELD_COUNT);
+            hasChanged = ok && changed.readId(nextChanged, changedId, ok);
+        }
+    }
+    while (ok && hasChanged) {
+        EntityState state;
+        state.id = changedId;
+        ok = changed.readFields(state.fields, EntityState::FIELD_COUNT);
+        out.entities.push_back(state);
+        hasChanged = ok && changed.readId(nextChanged, changedId, ok);
+    }
+    // Every byte must have been consumed
+    return ok && changed.data == changed.end;
+}
+
+} // namespace net
+} // namespace game
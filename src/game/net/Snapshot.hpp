@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace net {
+
+/**
+ * Replicated state of one entity, already quantized to what goes on the
+ * wire so the server and client hold bit-identical copies.
+ */
+struct EntityState {
+    enum Kind : int32_t { KIND_OTHER = 0, KIND_PLAYER = 1, KIND_TARGET = 2, KIND_PROJECTILE = 3 };
+    enum Field { KIND, X, Y, ROTATION, FIELD_COUNT };
+
+    uint64_t id = 0;
+    int32_t fields[FIELD_COUNT] = {};
+
+    bool operator==(const EntityState& other) const;
+    bool operator!=(const EntityState& other) const { return !(*this == other); }
+};
+
+/**
+ * Replicated world state for one server tick.
+ *
+ * Positions are stored in 1/POSITION_SCALE pixels, rotation in 1/65536 of a
+ * turn and the round timer in milliseconds. Entities are sorted by ID.
+ */
+struct WorldSnapshot {
+    static constexpr int32_t POSITION_SCALE = 8;
+
+    enum GameField { STATE, SCORE, SHOTS_FIRED, TARGETS_HIT, TIME_REMAINING_MS, GAME_FIELD_COUNT };
+
+    uint32_t tick = 0; // 0 = empty
+    int32_t game[GAME_FIELD_COUNT] = {};
+    std::vector<EntityState> entities;
+
+    /**
+     * Replace the contents with the current ECS world: every entity with a
+     * Transform, plus ShootingGalleryState.
+     */
+    void capture(uint32_t tick);
+
+    static int32_t quantizePosition(float value);
+    static float dequantizePosition(int32_t value) {
+        return static_cast<float>(value) / POSITION_SCALE;
+    }
+    static int32_t quantizeRotation(float degrees);
+    static float dequantizeRotation(int32_t value) { return value * (360.0f / 65536.0f); }
+
+    bool operator==(const WorldSnapshot& other) const;
+    bool operator!=(const WorldSnapshot& other) const { return !(*this == other); }
+};
+
+/**
+ * Append the delta from baseline (may be null) to current to out.
+ *
+ * Only fields that differ from the baseline are written, as zigzag varints
+ * of the difference; entities missing from the baseline are encoded against
+ * an all-zero state and entities that disappeared are listed by ID. With no
+ * baseline the result is a full snapshot. Entity IDs are written as gaps
+ * from the previous ID.
+ */
+void encodeSnapshot(const WorldSnapshot* baseline, const WorldSnapshot& current,
+                    std::vector<uint8_t>& out);
+
+/**
+ * Rebuild a snapshot from a payload made by encodeSnapshot() against the same
+ * baseline. out.tick is left for the caller to set.
+ * @return false if the payload is malformed
+ */
+bool decodeSnapshot(const WorldSnapshot* baseline, const uint8_t* data, size_t size,
+                    WorldSnapshot& out);
+
+} // namespace net
+} // namespace game
@@ -0,0 +1,193 @@
+#include "SnapshotClient.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <utility>
+
+namespace game {
+namespace net {
+
+SnapshotClient::SnapshotClient()
+    : history_(protocol::HISTORY_SIZE)
+    , pendingPayload_(protocol::MAX_FRAGMENTS * protocol::MAX_FRAGMENT_PAYLOAD)
+{
+}
+
+bool SnapshotClient::connect(const Address& server) {
+    disconnect();
+    if (!socket_.open(0)) {
+        return false;
+    }
+    server_ = server;
+    latestTick_ = 0;
+    latestInputTick_ = 0;
+    pendingTick_ = 0;
+    firstInputTick_ = 0;
+    for (WorldSnapshot& snapshot : history_) {
+        snapshot.tick = 0;
+    }
+    send(protocol::HELLO);
+    pollsSinceHello_ = 0;
+    return true;
+}
+
+void SnapshotClient::disconnect() {
+    if (socket_.isOpen()) {
+        send(protocol::BYE);
+        socket_.close();
+    }
+}
+
+const WorldSnapshot* SnapshotClient::getLatest() const {
+    return latestTick_ != 0 ? &history_[latestTick_ % protocol::HISTORY_SIZE] : nullptr;
+}
+
+int SnapshotClient::poll() {
+    if (!socket_.isOpen()) {
+        return 0;
+    }
+    int decoded = 0;
+    Address from;
+    int size;
+    while (socket_.isOpen() && (size = socket_.receive(packet_, sizeof(packet_), from)) >= 0) {
+        if (from != server_) {
+            continue;
+        }
+        const uint8_t type = protocol::readHeader(packet_, static_cast<size_t>(size));
+        if (type == 0) {
+            continue;
+        }
+        stats_.bytesReceived += static_cast<uint64_t>(size);
+        stats_.packetsReceived++;
+        if (type == protocol::BYE) {
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotClient] Server closed the connection");
+            socket_.close();
+        } else if (type == protocol::SNAPSHOT &&
+                   handleSnapshotPacket(packet_, static_cast<size_t>(size))) {
+            ++decoded;
+        }
+    }
+
+    if (decoded > 0) {
+        send(protocol::ACK, latestTick_);
+    } else if (latestTick_ == 0 && ++pollsSinceHello_ >= HELLO_RETRY_POLLS) {
+        send(protocol::HELLO);
+        pollsSinceHello_ = 0;
+    }
+    return decoded;
+}
+
+bool SnapshotClient::handleSnapshotPacket(const uint8_t* data, size_t size) {
+    if (size < protocol::SNAPSHOT_HEADER_SIZE) {
+        return false;
+    }
+    const uint32_t tick = protocol::readU32(data + protocol::HEADER_SIZE);
+    const uint32_t baseline = protocol::readU32(data + protocol::HEADER_SIZE + 4);
+    const uint32_t inputTick = protocol::readU32(data + protocol::HEADER_SIZE + 8);
+    const size_t fragment = data[protocol::HEADER_SIZE + 12];
+    const size_t fragments = data[protocol::HEADER_SIZE + 13];
+    if (tick <= latestTick_ || tick < pendingTick_ || fragments == 0 ||
+        fragments > protocol::MAX_FRAGMENTS || fragment >= fragments) {
+        return false;
+    }
+
+    if (tick != pendingTick_) {
+        if (pendingTick_ != 0) {
+            // A newer snapshot started before this one completed
+            stats_.snapshotsDropped++;
+        }
+        pendingTick_ = tick;
+        pendingBaseline_ = baseline;
+        pendingInputTick_ = inputTick;
+        pendingFragments_ = fragments;
+        pendingReceived_ = 0;
+        pendingSize_ = 0;
+    } else if (baseline != pendingBaseline_ || fragments != pendingFragments_) {
+        return false;
+    }
+
+    const uint64_t bit = uint64_t(1) << fragment;
+    const size_t chunk = size - protocol::SNAPSHOT_HEADER_SIZE;
+    if ((pendingReceived_ & bit) != 0 || chunk > protocol::MAX_FRAGMENT_PAYLOAD ||
+        (fragment + 1 < fragments && chunk != protocol::MAX_FRAGMENT_PAYLOAD)) {
+        return false;
+    }
+    pendingReceived_ |= bit;
+    std::copy_n(data + protocol::SNAPSHOT_HEADER_SIZE, chunk,
+                pendingPayload_.data() + fragment * protocol::MAX_FRAGMENT_PAYLOAD);
+    if (fragment + 1 == fragments) {
+        pendingSize_ = fragment * protocol::MAX_FRAGMENT_PAYLOAD + chunk;
+    }
+
+    const uint64_t complete = fragments == 64 ? ~uint64_t(0) : (uint64_t(1) << fragments) - 1;
+    if (pendingReceived_ != complete) {
+        return false;
+    }
+    const bool ok = decodePending();
+    pendingTick_ = 0;
+    return ok;
+}
+
+bool SnapshotClient::decodePending() {
+    const WorldSnapshot* baseline = nullptr;
+    if (pendingBaseline_ != 0) {
+        const WorldSnapshot& candidate = history_[pendingBaseline_ % protocol::HISTORY_SIZE];
+        if (candidate.tick != pendingBaseline_) {
+            stats_.snapshotsDropped++;
+            return false;
+        }
+        baseline = &candidate;
+    }
+
+    // Decode aside: the slot may still hold the latest snapshot (or the
+    // baseline), which a payload that fails halfway must not clobber
+    if (!decodeSnapshot(baseline, pendingPayload_.data(), pendingSize_, decoded_)) {
+        stats_.snapshotsDropped++;
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "[SnapshotClient] Could not decode snapshot %u (baseline %u)", pendingTick_,
+                    pendingBaseline_);
+        return false;
+    }
+    WorldSnapshot& target = history_[pendingTick_ % protocol::HISTORY_SIZE];
+    std::swap(target, decoded_); // Keeps both entity buffers allocated
+    target.tick = pendingTick_;
+    latestTick_ = pendingTick_;
+    latestInputTick_ = pendingInputTick_;
+    stats_.snapshotsDecoded++;
+    return true;
+}
+
+void SnapshotClient::sendInput(uint32_t tick, uint8_t input) {
+    if (!socket_.isOpen() || tick == 0) {
+        return;
+    }
+    if (firstInputTick_ == 0) {
+        firstInputTick_ = tick;
+    }
+    inputs_[tick % protocol::INPUT_REDUNDANCY] = input;
+
+    const uint32_t count =
+        std::min<uint32_t>(tick - firstInputTick_ + 1, protocol::INPUT_REDUNDANCY);
+    uint8_t packet[protocol::HEADER_SIZE + 5 + protocol::INPUT_REDUNDANCY];
+    protocol::writeHeader(packet, protocol::INPUT);
+    protocol::writeU32(packet + protocol::HEADER_SIZE, tick);
+    packet[protocol::HEADER_SIZE + 4] = static_cast<uint8_t>(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        packet[protocol::HEADER_SIZE + 5 + i] =
+            inputs_[(tick - count + 1 + i) % protocol::INPUT_REDUNDANCY];
+    }
+    socket_.sendTo(server_, packet, protocol::HEADER_SIZE + 5 + count);
+}
+
+void SnapshotClient::send(protocol::PacketType type, uint32_t tick) {
+    uint8_t packet[protocol::HEADER_SIZE + 4];
+    protocol::writeHeader(packet, type);
+    size_t size = protocol::HEADER_SIZE;
+    if (type == protocol::ACK) {
+        protocol::writeU32(packet + size, tick);
+        size += 4;
+    }
+    socket_.sendTo(server_, packet, size);
+}
+
+} // namespace net
+} // namespace game
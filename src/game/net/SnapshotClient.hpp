@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Protocol.hpp"
+#include "Snapshot.hpp"
+#include "UdpSocket.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace net {
+
+/**
+ * SnapshotClient - receives the world from a SnapshotServer.
+ *
+ * Reassembles snapshot fragments, decodes each snapshot against the baseline
+ * the server named and acknowledges it, so the next delta can build on it.
+ * Snapshots older than the newest one decoded are ignored. Keeps the last
+ * HISTORY_SIZE snapshots as possible baselines.
+ *
+ * sendInput() streams the local player's input for the server to apply;
+ * getLatestInputTick() says which of those inputs the newest snapshot
+ * reflects (see ClientPrediction).
+ */
+class SnapshotClient {
+public:
+    // poll() calls between HELLOs until the first snapshot arrives
+    static constexpr uint32_t HELLO_RETRY_POLLS = 30;
+
+    struct Stats {
+        uint64_t bytesReceived = 0; // UDP payload bytes
+        uint64_t packetsReceived = 0;
+        uint64_t snapshotsDecoded = 0;
+        uint64_t snapshotsDropped = 0; // Incomplete, stale baseline or malformed
+    };
+
+    SnapshotClient();
+
+    /**
+     * Open a local socket and say HELLO to the server.
+     */
+    bool connect(const Address& server);
+
+    /**
+     * Say BYE and close the socket.
+     */
+    void disconnect();
+
+    bool isConnected() const { return socket_.isOpen(); }
+
+    /**
+     * Receive everything pending, decode completed snapshots and acknowledge
+     * the newest.
+     * @return Number of snapshots decoded
+     */
+    int poll();
+
+    /**
+     * @return Newest decoded snapshot, or null before the first one
+     */
+    const WorldSnapshot* getLatest() const;
+
+    /**
+     * @return Newest of our inputs the server had applied when it captured
+     *         getLatest() (0 if none)
+     */
+    uint32_t getLatestInputTick() const { return latestInputTick_; }
+
+    /**
+     * Send the input for one tick, along with the few before it in case
+     * earlier packets were lost.
+     * @param tick Input ticks must increase by one per call
+     * @param input PlayerInput bits
+     */
+    void sendInput(uint32_t tick, uint8_t input);
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    bool handleSnapshotPacket(const uint8_t* data, size_t size);
+    bool decodePending();
+    void send(protocol::PacketType type, uint32_t tick = 0);
+
+    UdpSocket socket_;
+    Address server_;
+    std::vector<WorldSnapshot> history_; // Ring indexed by tick % HISTORY_SIZE
+    WorldSnapshot decoded_;              // Decode target until it succeeds
+    uint32_t latestTick_ = 0;
+    uint32_t latestInputTick_ = 0;
+    uint32_t pollsSinceHello_ = 0;
+
+    // Snapshot being reassembled
+    uint32_t pendingTick_ = 0;
+    uint32_t pendingBaseline_ = 0;
+    uint32_t pendingInputTick_ = 0;
+    size_t pendingFragments_ = 0;
+    uint64_t pendingReceived_ = 0; // Bit per fragment
+    size_t pendingSize_ = 0;
+    std::vector<uint8_t> pendingPayload_;
+
+    // Inputs sent, ring indexed by tick % INPUT_REDUNDANCY
+    uint8_t inputs_[protocol::INPUT_REDUNDANCY] = {};
+    uint32_t firstInputTick_ = 0;
+
+    uint8_t packet_[protocol::MAX_PACKET_SIZE];
+    Stats stats_;
+};
+
+} // namespace net
+} // namespace game
@@ -0,0 +1,267 @@
+#include "SnapshotServer.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/components/KeyboardInput.hpp"
+#include "PlayerInput.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+
+namespace game {
+namespace net {
+
+SnapshotServer::SnapshotServer(size_t maxClients)
+    : maxClients_(maxClients)
+    , history_(protocol::HISTORY_SIZE)
+{
+}
+
+bool SnapshotServer::start(uint16_t port, bool loopbackOnly) {
+    if (!socket_.open(port, loopbackOnly)) {
+        return false;
+    }
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotServer] Listening on UDP port %u%s",
+                socket_.getLocalPort(), loopbackOnly ? " (loopback only)" : "");
+    return true;
+}
+
+void SnapshotServer::stop() {
+    if (!socket_.isOpen()) {
+        return;
+    }
+    protocol::writeHeader(packet_, protocol::BYE);
+    for (const Client& client : clients_) {
+        socket_.sendTo(client.address, packet_, protocol::HEADER_SIZE);
+    }
+    clients_.clear();
+    socket_.close();
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotServer] Stopped");
+}
+
+void SnapshotServer::setPlayer(const ecs::Entity& player) {
+    ensureKeyboardInput(player);
+    player_ = player;
+    hasPlayer_ = true;
+    appliedInput_ = 0;
+}
+
+const WorldSnapshot* SnapshotServer::getSnapshot(uint32_t tick) const {
+    const WorldSnapshot& snapshot = history_[tick % protocol::HISTORY_SIZE];
+    return tick != 0 && snapshot.tick == tick ? &snapshot : nullptr;
+}
+
+void SnapshotServer::tick() {
+    if (!socket_.isOpen()) {
+        return;
+    }
+    receivePackets();
+
+    ++tick_;
+    WorldSnapshot& current = history_[tick_ % protocol::HISTORY_SIZE];
+    current.capture(tick_);
+
+    dropIdleClients();
+    encodingCount_ = 0;
+    for (const Client& client : clients_) {
+        // A baseline the history no longer holds means a full snapshot
+        const uint32_t baselineTick = getSnapshot(client.ackedTick) ? client.ackedTick : 0;
+        sendSnapshot(client, current, encodeFor(current, baselineTick));
+    }
+
+    // Input for the next world update
+    applyNextInput();
+}
+
+void SnapshotServer::receivePackets() {
+    Address from;
+    int size;
+    while ((size = socket_.receive(packet_, sizeof(packet_), from)) >= 0) {
+        const uint8_t type = protocol::readHeader(packet_, static_cast<size_t>(size));
+        if (type == 0) {
+            continue;
+        }
+        auto client = std::find_if(clients_.begin(), clients_.end(),
+                                   [&](const Client& c) { return c.address == from; });
+        if (type == protocol::BYE) {
+            if (client != clients_.end()) {
+                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotServer] %s disconnected",
+                            from.toString().c_str());
+                clients_.erase(client);
+            }
+            continue;
+        }
+        if (client == clients_.end()) {
+            if (type != protocol::HELLO) {
+                continue;
+            }
+            if (clients_.size() >= maxClients_) {
+                SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                            "[SnapshotServer] Server full (%zu clients); ignoring %s",
+                            maxClients_, from.toString().c_str());
+                continue;
+            }
+            Client added;
+            added.address = from;
+            clients_.push_back(added);
+            client = clients_.end() - 1;
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotServer] %s connected (%zu clients)",
+                        from.toString().c_str(), clients_.size());
+        }
+        client->lastHeardTick = tick_;
+        if (type == protocol::ACK && size >= static_cast<int>(protocol::HEADER_SIZE + 4)) {
+            const uint32_t acked = protocol::readU32(packet_ + protocol::HEADER_SIZE);
+            // Acks can arrive out of order; never move the baseline back
+            if (acked <= tick_ && acked > client->ackedTick) {
+                client->ackedTick = acked;
+            }
+        } else if (type == protocol::INPUT) {
+            receiveInput(*client, packet_, static_cast<size_t>(size));
+        }
+    }
+}
+
+void SnapshotServer::receiveInput(Client& client, const uint8_t* data, size_t size) {
+    if (!hasPlayer_ || size < protocol::HEADER_SIZE + 5) {
+        return;
+    }
+    const uint32_t newest = protocol::readU32(data + protocol::HEADER_SIZE);
+    const uint32_t count = data[protocol::HEADER_SIZE + 4];
+    if (count == 0 || count > protocol::INPUT_REDUNDANCY || newest < count ||
+        size < protocol::HEADER_SIZE + 5 + count) {
+        return;
+    }
+    if (!client.controlsPlayer) {
+        const bool taken = std::any_of(clients_.begin(), clients_.end(),
+                                       [](const Client& c) { return c.controlsPlayer; });
+        if (taken) {
+            return;
+        }
+        client.controlsPlayer = true;
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotServer] %s controls entity %llu",
+                    client.address.toString().c_str(),
+                    static_cast<unsigned long long>(player_.getId()));
+    }
+
+    const uint8_t* inputs = data + protocol::HEADER_SIZE + 5;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t inputTick = newest - count + 1 + i;
+        if (inputTick > client.appliedInputTick) {
+            client.inputs[inputTick % INPUT_BUFFER_SIZE] = inputs[i] & INPUT_ALL;
+            client.inputTicks[inputTick % INPUT_BUFFER_SIZE] = inputTick;
+        }
+    }
+    client.newestInputTick = std::max(client.newestInputTick, newest);
+}
+
+void SnapshotServer::applyNextInput() {
+    if (!hasPlayer_) {
+        return;
+    }
+    auto* keyboard = ecs::ComponentManager::getInstance()
+                         .getComponent<ecs::components::KeyboardInput>(player_);
+    auto controller = std::find_if(clients_.begin(), clients_.end(),
+                                   [](const Client& c) { return c.controlsPlayer; });
+    if (controller == clients_.end()) {
+        // Nobody drives the player any more: let go of the keys
+        if (keyboard && appliedInput_ != 0) {
+            applyPlayerInput(appliedInput_, 0, *keyboard);
+        }
+        appliedInput_ = 0;
+        return;
+    }
+
+    Client& client = *controller;
+    if (client.newestInputTick == 0) {
+        return;
+    }
+    uint32_t next = client.appliedInputTick + 1;
+    if (client.appliedInputTick == 0 ||
+        client.newestInputTick - client.appliedInputTick > MAX_INPUT_BACKLOG) {
+        // First input, or too far behind: start from the newest
+        next = client.newestInputTick;
+    }
+    const uint32_t slot = next % INPUT_BUFFER_SIZE;
+    if (next > client.newestInputTick || client.inputTicks[slot] != next) {
+        // Not here (yet, or lost): keep the previous keys held
+        stats_.inputsMissed++;
+        if (next <= client.newestInputTick) {
+            client.appliedInputTick = next;
+        }
+        return;
+    }
+    if (keyboard) {
+        applyPlayerInput(appliedInput_, client.inputs[slot], *keyboard);
+    }
+    appliedInput_ = client.inputs[slot];
+    client.appliedInputTick = next;
+    stats_.inputsApplied++;
+}
+
+void SnapshotServer::dropIdleClients() {
+    auto idle = std::remove_if(clients_.begin(), clients_.end(), [&](const Client& client) {
+        if (tick_ - client.lastHeardTick <= CLIENT_TIMEOUT_TICKS) {
+            return false;
+        }
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SnapshotServer] %s timed out",
+                    client.address.toString().c_str());
+        return true;
+    });
+    clients_.erase(idle, clients_.end());
+}
+
+const SnapshotServer::Encoding& SnapshotServer::encodeFor(const WorldSnapshot& current,
+                                                          uint32_t baselineTick) {
+    for (size_t i = 0; i < encodingCount_; ++i) {
+        if (encodings_[i].baselineTick == baselineTick) {
+            return encodings_[i];
+        }
+    }
+    if (encodingCount_ == encodings_.size()) {
+        encodings_.emplace_back();
+    }
+    Encoding& encoding = encodings_[encodingCount_++];
+    encoding.baselineTick = baselineTick;
+    encoding.payload.clear();
+    encodeSnapshot(getSnapshot(baselineTick), current, encoding.payload);
+    return encoding;
+}
+
+void SnapshotServer::sendSnapshot(const Client& client, const WorldSnapshot& current,
+                                  const Encoding& encoding) {
+    const size_t payloadSize = encoding.payload.size();
+    const size_t fragments = std::max<size_t>(
+        1, (payloadSize + protocol::MAX_FRAGMENT_PAYLOAD - 1) / protocol::MAX_FRAGMENT_PAYLOAD);
+    if (fragments > protocol::MAX_FRAGMENTS) {
+        if (stats_.oversizedSnapshots++ == 0) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                        "[SnapshotServer] Snapshot of %zu bytes exceeds %zu packets; not sent",
+                        payloadSize, protocol::MAX_FRAGMENTS);
+        }
+        return;
+    }
+
+    protocol::writeHeader(packet_, protocol::SNAPSHOT);
+    protocol::writeU32(packet_ + protocol::HEADER_SIZE, current.tick);
+    protocol::writeU32(packet_ + protocol::HEADER_SIZE + 4, encoding.baselineTick);
+    protocol::writeU32(packet_ + protocol::HEADER_SIZE + 8, client.appliedInputTick);
+    packet_[protocol::HEADER_SIZE + 13] = static_cast<uint8_t>(fragments);
+    for (size_t fragment = 0; fragment < fragments; ++fragment) {
+        const size_t offset = fragment * protocol::MAX_FRAGMENT_PAYLOAD;
+        const size_t chunk = std::min(protocol::MAX_FRAGMENT_PAYLOAD, payloadSize - offset);
+        packet_[protocol::HEADER_SIZE + 12] = static_cast<uint8_t>(fragment);
+        std::copy_n(encoding.payload.data() + offset, chunk,
+                    packet_ + protocol::SNAPSHOT_HEADER_SIZE);
+        const size_t packetSize = protocol::SNAPSHOT_HEADER_SIZE + chunk;
+        if (socket_.sendTo(client.address, packet_, packetSize)) {
+            stats_.bytesSent += packetSize;
+            stats_.packetsSent++;
+        } else {
+            stats_.sendFailures++;
+        }
+    }
+    stats_.snapshotsSent++;
+    if (encoding.baselineTick == 0) {
+        stats_.fullSnapshots++;
+    }
+}
+
+} // namespace net
+} // namespace game
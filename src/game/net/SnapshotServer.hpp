@@ -0,0 +1,141 @@
+#pragma once
+
+#include "../ecs/Entity.hpp"
+#include "Protocol.hpp"
+#include "Snapshot.hpp"
+#include "UdpSocket.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game {
+namespace net {
+
+/**
+ * SnapshotServer - streams the authoritative world to clients over UDP.
+ *
+ * Each tick() captures the ECS world into a WorldSnapshot and sends every
+ * connected client the delta against the newest snapshot that client has
+ * acknowledged, or a full snapshot if it has not acknowledged one the
+ * server still remembers. Clients sharing a baseline share the encoding.
+ * Nothing is retransmitted: a lost snapshot is simply superseded by the
+ * next one.
+ *
+ * Clients connect by sending HELLO and are dropped after CLIENT_TIMEOUT_TICKS
+ * without a packet. Single-threaded; call tick() after each world update.
+ *
+ * With setPlayer(), the first client to send INPUT drives that player: each
+ * tick() applies its next input to the player's KeyboardInput for the
+ * following world update, and every snapshot tells the client which of its
+ * inputs the world reflects, so it can reconcile its prediction.
+ */
+class SnapshotServer {
+public:
+    static constexpr uint32_t CLIENT_TIMEOUT_TICKS = 300;
+    // Inputs a client may run ahead before the server skips to its newest
+    static constexpr uint32_t MAX_INPUT_BACKLOG = 8;
+
+    struct Stats {
+        uint64_t bytesSent = 0; // UDP payload bytes
+        uint64_t packetsSent = 0;
+        uint64_t snapshotsSent = 0;
+        uint64_t fullSnapshots = 0; // Sent without a baseline
+        uint64_t sendFailures = 0;
+        uint64_t oversizedSnapshots = 0; // More than MAX_FRAGMENTS packets; not sent
+        uint64_t inputsApplied = 0;
+        uint64_t inputsMissed = 0; // Ticks the controlling client had no input for
+    };
+
+    /**
+     * @param maxClients Connections beyond this are ignored
+     */
+    explicit SnapshotServer(size_t maxClients = 64);
+
+    /**
+     * Bind the server socket.
+     * @param port UDP port, or 0 for any free port (see getPort())
+     * @param loopbackOnly Only accept clients on this machine
+     */
+    bool start(uint16_t port, bool loopbackOnly = false);
+
+    /**
+     * Say goodbye to every client and close the socket.
+     */
+    void stop();
+
+    bool isRunning() const { return socket_.isOpen(); }
+    uint16_t getPort() const { return socket_.getLocalPort(); }
+
+    /**
+     * Let a client control an entity (normally the player). Gives it a
+     * KeyboardInput if it has none.
+     */
+    void setPlayer(const ecs::Entity& player);
+
+    /**
+     * Handle client packets, capture the world as the next tick and send the
+     * snapshots.
+     */
+    void tick();
+
+    /**
+     * @return Tick of the last captured snapshot (0 before the first tick)
+     */
+    uint32_t getTick() const { return tick_; }
+
+    size_t getClientCount() const { return clients_.size(); }
+
+    /**
+     * @return Snapshot captured at the given tick, or null if it is no longer
+     *         in the history
+     */
+    const WorldSnapshot* getSnapshot(uint32_t tick) const;
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    static constexpr uint32_t INPUT_BUFFER_SIZE = 32;
+
+    struct Client {
+        Address address;
+        uint32_t ackedTick = 0;
+        uint32_t lastHeardTick = 0;
+        // Inputs received, ring indexed by input tick % INPUT_BUFFER_SIZE
+        uint8_t inputs[INPUT_BUFFER_SIZE] = {};
+        uint32_t inputTicks[INPUT_BUFFER_SIZE] = {};
+        uint32_t newestInputTick = 0; // Newest input received
+        uint32_t appliedInputTick = 0; // Newest input applied to the world
+        bool controlsPlayer = false;
+    };
+
+    // A payload encoded this tick, shared by all clients with that baseline
+    struct Encoding {
+        uint32_t baselineTick = 0;
+        std::vector<uint8_t> payload;
+    };
+
+    void receivePackets();
+    void receiveInput(Client& client, const uint8_t* data, size_t size);
+    void applyNextInput();
+    void dropIdleClients();
+    const Encoding& encodeFor(const WorldSnapshot& current, uint32_t baselineTick);
+    void sendSnapshot(const Client& client, const WorldSnapshot& current, const Encoding& encoding);
+
+    UdpSocket socket_;
+    size_t maxClients_;
+    std::vector<Client> clients_;
+    std::vector<WorldSnapshot> history_; // Ring indexed by tick % HISTORY_SIZE
+    uint32_t tick_ = 0;
+
+    bool hasPlayer_ = false;
+    ecs::Entity player_;
+    uint8_t appliedInput_ = 0;
+
+    std::vector<Encoding> encodings_; // Reused; the first encodingCount_ are valid
+    size_t encodingCount_ = 0;
+    uint8_t packet_[protocol::MAX_PACKET_SIZE];
+    Stats stats_;
+};
+
+} // namespace net
+} // namespace game
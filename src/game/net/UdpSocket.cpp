@@ -0,0 +1,174 @@
+#include "UdpSocket.hpp"
+#include <SDL3/SDL.h>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace game {
+namespace net {
+
+namespace {
+
+#ifdef _WIN32
+// Winsock must be started once per process before the first socket
+bool startNetworking() {
+    static const bool started = [] {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return started;
+}
+
+void closeHandle(intptr_t handle) {
+    closesocket(static_cast<SOCKET>(handle));
+}
+#else
+bool startNetworking() {
+    return true;
+}
+
+void closeHandle(intptr_t handle) {
+    ::close(static_cast<int>(handle));
+}
+#endif
+
+sockaddr_in toSockaddr(const Address& address) {
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(address.host);
+    addr.sin_port = htons(address.port);
+    return addr;
+}
+
+} // namespace
+
+bool Address::parse(const std::string& text, uint16_t defaultPort, Address& out) {
+    unsigned a, b, c, d, port = defaultPort;
+    char tail;
+    int fields = std::sscanf(text.c_str(), "%u.%u.%u.%u:%u%c", &a, &b, &c, &d, &port, &tail);
+    if ((fields != 4 && fields != 5) || a > 255 || b > 255 || c > 255 || d > 255 ||
+        port > 65535) {
+        return false;
+    }
+    out.host = (a << 24) | (b << 16) | (c << 8) | d;
+    out.port = static_cast<uint16_t>(port);
+    return true;
+}
+
+std::string Address::toString() const {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%u.%u.%u.%u:%u", host >> 24, (host >> 16) & 0xFF,
+                  (host >> 8) & 0xFF, host & 0xFF, port);
+    return text;
+}
+
+UdpSocket::~UdpSocket() {
+    close();
+}
+
+bool UdpSocket::open(uint16_t port, bool loopbackOnly) {
+    close();
+    if (!startNetworking()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[UdpSocket] Cannot start networking");
+        return false;
+    }
+
+    Handle handle = static_cast<Handle>(socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+#ifdef _WIN32
+    if (static_cast<SOCKET>(handle) == INVALID_SOCKET) {
+        handle = INVALID_HANDLE;
+    }
+#endif
+    if (handle == INVALID_HANDLE) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[UdpSocket] Cannot create socket");
+        return false;
+    }
+
+    sockaddr_in addr = toSockaddr(Address{loopbackOnly ? 0x7F000001u : 0u, port});
+    if (bind(handle, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[UdpSocket] Cannot bind port %u", port);
+        closeHandle(handle);
+        return false;
+    }
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    bool ok = ioctlsocket(static_cast<SOCKET>(handle), FIONBIO, &nonBlocking) == 0;
+#else
+    int flags = fcntl(static_cast<int>(handle), F_GETFL, 0);
+    bool ok = flags >= 0 && fcntl(static_cast<int>(handle), F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+    if (!ok) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[UdpSocket] Cannot make socket non-blocking");
+        closeHandle(handle);
+        return false;
+    }
+
+    sockaddr_in bound{};
+    socklen_t length = sizeof(bound);
+    getsockname(handle, reinterpret_cast<sockaddr*>(&bound), &length);
+    handle_ = handle;
+    localPort_ = ntohs(bound.sin_port);
+    return true;
+}
+
+void UdpSocket::close() {
+    if (handle_ != INVALID_HANDLE) {
+        closeHandle(handle_);
+        handle_ = INVALID_HANDLE;
+        localPort_ = 0;
+    }
+}
+
+bool UdpSocket::sendTo(const Address& to, const void* data, size_t size) {
+    if (!isOpen()) {
+        return false;
+    }
+    sockaddr_in addr = toSockaddr(to);
+    auto sent = sendto(handle_, static_cast<const char*>(data), static_cast<int>(size), 0,
+                       reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
+    return sent == static_cast<decltype(sent)>(size);
+}
+
+int UdpSocket::receive(void* buffer, size_t capacity, Address& from) {
+    if (!isOpen()) {
+        return -1;
+    }
+    for (;;) {
+        sockaddr_in addr{};
+        socklen_t length = sizeof(addr);
+        auto received = recvfrom(handle_, static_cast<char*>(buffer), static_cast<int>(capacity),
+                                 0, reinterpret_cast<sockaddr*>(&addr), &length);
+        if (received >= 0) {
+            from.host = ntohl(addr.sin_addr.s_addr);
+            from.port = ntohs(addr.sin_port);
+            return static_cast<int>(received);
+        }
+#ifdef _WIN32
+        // An ICMP "port unreachable" from an earlier send shows up here as
+        // WSAECONNRESET; a truncated datagram as WSAEMSGSIZE. Skip both.
+        int error = WSAGetLastError();
+        if (error == WSAECONNRESET || error == WSAEMSGSIZE) {
+            continue;
+        }
+#else
+        if (errno == EINTR) {
+            continue;
+        }
+#endif
+        return -1;
+    }
+}
+
+} // namespace net
+} // namespace game
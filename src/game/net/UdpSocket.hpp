@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace game {
+namespace net {
+
+/**
+ * IPv4 address and port, both in host byte order.
+ */
+struct Address {
+    uint32_t host = 0;
+    uint16_t port = 0;
+
+    static Address loopback(uint16_t port) { return Address{0x7F000001u, port}; }
+
+    /**
+     * Parse "a.b.c.d:port" (or "a.b.c.d" with the given default port).
+     * @return false if the text is not a numeric IPv4 address
+     */
+    static bool parse(const std::string& text, uint16_t defaultPort, Address& out);
+
+    std::string toString() const;
+
+    bool operator==(const Address& other) const {
+        return host == other.host && port == other.port;
+    }
+    bool operator!=(const Address& other) const { return !(*this == other); }
+};
+
+/**
+ * Non-blocking IPv4 UDP socket (BSD sockets, Winsock on Windows).
+ *
+ * Sends and receives whole datagrams; nothing is buffered on our side, so a
+ * datagram that does not fit the receive buffer is truncated and dropped.
+ */
+class UdpSocket {
+public:
+    UdpSocket() = default;
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    /**
+     * Bind a socket.
+     * @param port Local port, or 0 for any free port
+     * @param loopbackOnly Bind to 127.0.0.1 instead of every interface
+     * @return true if the socket is ready
+     */
+    bool open(uint16_t port, bool loopbackOnly = false);
+    void close();
+    bool isOpen() const { return handle_ != INVALID_HANDLE; }
+
+    /**
+     * @return Port the socket is bound to (useful after open(0))
+     */
+    uint16_t getLocalPort() const { return localPort_; }
+
+    /**
+     * Send one datagram.
+     * @return false if it could not be queued (e.g. the send buffer is full)
+     */
+    bool sendTo(const Address& to, const void* data, size_t size);
+
+    /**
+     * Receive one pending datagram.
+     * @return Size of the datagram, or -1 if none is waiting
+     */
+    int receive(void* buffer, size_t capacity, Address& from);
+
+private:
+    // SOCKET is an unsigned pointer-sized integer on Windows, int elsewhere
+    using Handle = intptr_t;
+    static constexpr Handle INVALID_HANDLE = -1;
+
+    Handle handle_ = INVALID_HANDLE;
+    uint16_t localPort_ = 0;
+};
+
+} // namespace net
+} // namespace game
@@ -9,10 +9,24 @@ namespace game {
 namespace resources {
 
 Image::Image(const std::string &path, SDL_Renderer *renderer)
-    : texture(nullptr), path(path) {
+    : texture(nullptr), scaleMode(SDL_SCALEMODE_LINEAR), path(path) {
   load(path, renderer);
 }
 
+Image::Image(const std::string &path, SDL_Surface *surface,
+             SDL_Renderer *renderer)
+    : texture(nullptr), scaleMode(SDL_SCALEMODE_LINEAR), path(path) {
+  if (!surface || !renderer) {
+    throw std::runtime_error("Failed to load image: " + path);
+  }
+  texture = SDL_CreateTextureFromSurface(renderer, surface);
+  if (!texture) {
+    std::cerr << "Failed to load image: " << path << " - " << SDL_GetError()
+              << std::endl;
+    throw std::runtime_error("Failed to load image: " + path);
+  }
+}
+
 Image::~Image() {
   if (texture) {
     SDL_DestroyTexture(texture);
@@ -52,6 +66,15 @@ void Image::render(SDL_Renderer *renderer, int x, int y, int width, int height,
                            &center, SDL_FLIP_NONE);
 }
 
+void Image::setScaleMode(SDL_ScaleMode mode) {
+  if (!texture || mode == scaleMode)
+    return;
+
+  if (SDL_SetTextureScaleMode(texture, mode)) {
+    scaleMode = mode;
+  }
+}
+
 void Image::renderScaled(SDL_Renderer *renderer, int x, int y, int width,
                          int height, ScalingMode mode) {
   if (!texture || !renderer)
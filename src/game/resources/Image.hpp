@@ -21,6 +21,13 @@ public:
    */
   Image(const std::string &path, SDL_Renderer *renderer);
 
+  /**
+   * Construct an Image from pixels already decoded (e.g. on a worker
+   * thread); the caller keeps ownership of the surface
+   * @throws std::runtime_error if the texture cannot be created
+   */
+  Image(const std::string &path, SDL_Surface *surface, SDL_Renderer *renderer);
+
   // Rule of five
   ~Image();
   Image(const Image &) = delete;
@@ -71,8 +78,16 @@ public:
    */
   SDL_Texture *getTexture() const { return texture; }
 
+  /**
+   * Set the texture filtering used when the image is scaled.
+   * No-op if the texture already uses this mode.
+   * @param mode SDL_SCALEMODE_LINEAR (smooth) or SDL_SCALEMODE_NEAREST
+   */
+  void setScaleMode(SDL_ScaleMode mode);
+
 private:
   SDL_Texture *texture;
+  SDL_ScaleMode scaleMode;
   std::string path;
 };
 
@@ -1,8 +1,11 @@
 #include "ResourceManager.hpp"
+#include "../diagnostics/StartupProfiler.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
+#include <algorithm>
 #include <stdexcept>
 #include <filesystem>
+#include <thread>
 
 namespace fs = std::filesystem;
 
@@ -139,5 +142,94 @@ void ResourceManager::clearCache() {
     imageCache.clear();
 }
 
+void ResourceManager::preloadImages(const std::vector<std::string>& imageNames) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> names;
+    for (const auto& imageName : imageNames) {
+        bool pending = std::find(names.begin(), names.end(), imageName) != names.end() ||
+            std::any_of(pendingChunks.begin(), pendingChunks.end(),
+                [&imageName](const PendingChunk& chunk) {
+                    return std::find(chunk.names.begin(), chunk.names.end(), imageName) !=
+                           chunk.names.end();
+                });
+        if (pending || imageCache.count(imageName) != 0) {
+            continue;
+        }
+        names.push_back(imageName);
+    }
+    if (names.empty()) {
+        return;
+    }
+
+    // One task per chunk keeps the thread count bounded however many
+    // images the game data lists
+    const size_t workers = std::min<size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), names.size());
+    const size_t chunkSize = (names.size() + workers - 1) / workers;
+    for (size_t first = 0; first < names.size(); first += chunkSize) {
+        const size_t last = std::min(first + chunkSize, names.size());
+        PendingChunk chunk;
+        chunk.names.assign(names.begin() + first, names.begin() + last);
+        for (const auto& imageName : chunk.names) {
+            chunk.paths.push_back(resolveImagePath(imageName));
+        }
+
+        // Decoding needs no renderer; only the texture upload does
+        chunk.surfaces = std::async(std::launch::async, [paths = chunk.paths] {
+            diagnostics::StartupProfiler::Scope phase("decode images");
+            std::vector<SDL_Surface*> surfaces;
+            surfaces.reserve(paths.size());
+            for (const auto& path : paths) {
+                surfaces.push_back(IMG_Load(path.c_str()));
+            }
+            return surfaces;
+        });
+        pendingChunks.push_back(std::move(chunk));
+    }
+}
+
+size_t ResourceManager::finishPreload(SDL_Renderer* renderer) {
+    std::vector<PendingChunk> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.swap(pendingChunks);
+    }
+
+    size_t loaded = 0;
+    for (auto& chunk : pending) {
+        std::vector<SDL_Surface*> surfaces = chunk.surfaces.get();
+        for (size_t i = 0; i < surfaces.size(); ++i) {
+            SDL_Surface* surface = surfaces[i];
+            if (!surface) {
+                // loadImage() reports it and falls back to the missing texture
+                continue;
+            }
+            try {
+                auto texture = std::make_shared<Image>(chunk.paths[i], surface, renderer);
+                std::lock_guard<std::mutex> lock(mutex);
+                imageCache.emplace(chunk.names[i], std::move(texture));
+                ++loaded;
+            } catch (const std::exception&) {
+                // Not cached, so loadImage() retries it from disk
+            }
+            SDL_DestroySurface(surface);
+        }
+    }
+    return loaded;
+}
+
+void ResourceManager::cancelPreload() {
+    std::vector<PendingChunk> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.swap(pendingChunks);
+    }
+    for (auto& chunk : pending) {
+        for (SDL_Surface* surface : chunk.surfaces.get()) {
+            SDL_DestroySurface(surface);
+        }
+    }
+}
+
 } // namespace resources
 } // namespace game 
\ No newline at end of file
@@ -2,10 +2,12 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <mutex>
+#include <vector>
 #include "Image.hpp"
 
 namespace game {
@@ -24,6 +26,29 @@ public:
     std::shared_ptr<Image> loadImage(const std::string& imageName, SDL_Renderer* renderer);
     std::shared_ptr<Image> getMissingTexture(SDL_Renderer* renderer) const;
     void clearCache();
+
+    /**
+     * Start decoding images on worker threads, before a renderer exists, so
+     * the first draw does not wait on the disk. The images are split into
+     * chunks, one per hardware thread at most. Images already cached or
+     * pending are skipped.
+     * @param imageNames Names as passed to loadImage()
+     */
+    void preloadImages(const std::vector<std::string>& imageNames);
+
+    /**
+     * Wait for the images started by preloadImages() and upload them as
+     * textures into the cache. Must run on the renderer's thread.
+     * @return Number of images added to the cache
+     */
+    size_t finishPreload(SDL_Renderer* renderer);
+
+    /**
+     * Wait for the images started by preloadImages() and free them without
+     * caching, e.g. when startup fails before a renderer exists. Does
+     * nothing once finishPreload() has run.
+     */
+    void cancelPreload();
     
     // Make destructor public but prevent direct deletion
     ~ResourceManager() = default;
@@ -43,6 +68,14 @@ private:
     
     std::string assetsDirectory;
     std::unordered_map<std::string, std::shared_ptr<Image>> imageCache;
+
+    // Images one worker decodes, in order; surfaces are parallel to names
+    struct PendingChunk {
+        std::vector<std::string> names;
+        std::vector<std::string> paths;
+        std::future<std::vector<SDL_Surface*>> surfaces;
+    };
+    std::vector<PendingChunk> pendingChunks;
     mutable std::shared_ptr<Image> missingTexture;  // Made mutable for const methods
 };
 
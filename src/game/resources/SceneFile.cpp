@@ -0,0 +1,208 @@
+#include "SceneFile.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace game {
+namespace resources {
+
+namespace {
+
+const std::string EMPTY_NAME;
+
+uint32_t cellCount(float extent, float cellSize) {
+    return std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(extent / cellSize)));
+}
+
+} // namespace
+
+bool SceneFile::write(const std::string& path, float worldWidth, float worldHeight,
+                      float cellSize, const std::vector<SceneEntity>& entities) {
+    if (worldWidth <= 0.0f || worldHeight <= 0.0f || cellSize <= 0.0f) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Invalid world %.0fx%.0f or cell size %.0f",
+                     worldWidth, worldHeight, cellSize);
+        return false;
+    }
+
+    SceneFileHeader header;
+    header.worldWidth = worldWidth;
+    header.worldHeight = worldHeight;
+    header.cellSize = cellSize;
+    header.cellsX = cellCount(worldWidth, cellSize);
+    header.cellsY = cellCount(worldHeight, cellSize);
+
+    // Intern image names and bucket records by cell
+    std::vector<std::string> imageNames;
+    std::unordered_map<std::string, int32_t> imageIndices;
+    std::vector<std::vector<SceneEntityRecord>> buckets(static_cast<size_t>(header.cellsX) * header.cellsY);
+    for (const SceneEntity& entity : entities) {
+        SceneEntityRecord record = entity.record;
+        record.imageIndex = -1;
+        if (!entity.imageName.empty()) {
+            if (entity.imageName.size() >= SceneFileHeader::NAME_LENGTH) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Image name too long: %s",
+                             entity.imageName.c_str());
+                return false;
+            }
+            auto it = imageIndices.find(entity.imageName);
+            if (it == imageIndices.end()) {
+                it = imageIndices.emplace(entity.imageName, static_cast<int32_t>(imageNames.size())).first;
+                imageNames.push_back(entity.imageName);
+            }
+            record.imageIndex = it->second;
+        }
+
+        float centerX = std::max(0.0f, std::min(worldWidth - 1.0f, record.x + record.width * 0.5f));
+        float centerY = std::max(0.0f, std::min(worldHeight - 1.0f, record.y + record.height * 0.5f));
+        uint32_t cellX = std::min(header.cellsX - 1, static_cast<uint32_t>(centerX / cellSize));
+        uint32_t cellY = std::min(header.cellsY - 1, static_cast<uint32_t>(centerY / cellSize));
+        buckets[static_cast<size_t>(cellY) * header.cellsX + cellX].push_back(record);
+    }
+    header.imageCount = static_cast<uint32_t>(imageNames.size());
+
+    // Lay out the cell table, then the record blocks in cell order
+    std::vector<SceneCellEntry> cells(buckets.size());
+    uint64_t offset = sizeof(SceneFileHeader) +
+                      static_cast<uint64_t>(imageNames.size()) * SceneFileHeader::NAME_LENGTH +
+                      cells.size() * sizeof(SceneCellEntry);
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        cells[i].offset = offset;
+        cells[i].count = static_cast<uint32_t>(buckets[i].size());
+        offset += buckets[i].size() * sizeof(SceneEntityRecord);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Cannot write %s", path.c_str());
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const std::string& name : imageNames) {
+        char buffer[SceneFileHeader::NAME_LENGTH] = {};
+        std::memcpy(buffer, name.data(), name.size());
+        out.write(buffer, sizeof(buffer));
+    }
+    out.write(reinterpret_cast<const char*>(cells.data()), cells.size() * sizeof(SceneCellEntry));
+    for (const auto& bucket : buckets) {
+        out.write(reinterpret_cast<const char*>(bucket.data()), bucket.size() * sizeof(SceneEntityRecord));
+    }
+    if (!out.good()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Write to %s failed", path.c_str());
+        return false;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Wrote %zu entities in %ux%u cells to %s",
+                entities.size(), header.cellsX, header.cellsY, path.c_str());
+    return true;
+}
+
+bool SceneFile::open(const std::string& path) {
+    close();
+    file.open(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Cannot open %s", path.c_str());
+        return false;
+    }
+
+    // Every count in the header and cell table is checked against the file
+    // size before it sizes a buffer or a seek
+    file.seekg(0, std::ios::end);
+    const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != SceneFileHeader::MAGIC || header.version != SceneFileHeader::VERSION ||
+        header.cellsX == 0 || header.cellsY == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] %s is not a version %u scene file",
+                     path.c_str(), SceneFileHeader::VERSION);
+        close();
+        return false;
+    }
+
+    const uint64_t cellCount = static_cast<uint64_t>(header.cellsX) * header.cellsY;
+    const uint64_t tablesEnd = sizeof(SceneFileHeader) +
+                               static_cast<uint64_t>(header.imageCount) * SceneFileHeader::NAME_LENGTH +
+                               cellCount * sizeof(SceneCellEntry);
+    if (tablesEnd > fileSize) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                     "[SceneFile] %s is truncated: %u images and %ux%u cells need %llu bytes, file has %llu",
+                     path.c_str(), header.imageCount, header.cellsX, header.cellsY,
+                     static_cast<unsigned long long>(tablesEnd), static_cast<unsigned long long>(fileSize));
+        close();
+        return false;
+    }
+
+    imageNames.reserve(header.imageCount);
+    for (uint32_t i = 0; i < header.imageCount; ++i) {
+        char buffer[SceneFileHeader::NAME_LENGTH] = {};
+        file.read(buffer, sizeof(buffer));
+        imageNames.emplace_back(buffer, std::find(buffer, buffer + sizeof(buffer), '\0'));
+    }
+
+    cells.resize(static_cast<size_t>(header.cellsX) * header.cellsY);
+    file.read(reinterpret_cast<char*>(cells.data()), cells.size() * sizeof(SceneCellEntry));
+    if (!file) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] %s is truncated", path.c_str());
+        close();
+        return false;
+    }
+    for (const SceneCellEntry& cell : cells) {
+        const uint64_t blockSize = static_cast<uint64_t>(cell.count) * sizeof(SceneEntityRecord);
+        if (cell.offset < tablesEnd || cell.offset > fileSize || blockSize > fileSize - cell.offset) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                         "[SceneFile] %s has a cell block outside the file (offset %llu, %u records)",
+                         path.c_str(), static_cast<unsigned long long>(cell.offset), cell.count);
+            close();
+            return false;
+        }
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Opened %s: world %.0fx%.0f, %ux%u cells of %.0f",
+                path.c_str(), header.worldWidth, header.worldHeight, header.cellsX, header.cellsY,
+                header.cellSize);
+    return true;
+}
+
+void SceneFile::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+    file.clear();
+    header = SceneFileHeader();
+    imageNames.clear();
+    cells.clear();
+}
+
+bool SceneFile::readCell(uint32_t cellX, uint32_t cellY, std::vector<SceneEntityRecord>& records) {
+    records.clear();
+    if (!isOpen() || cellX >= header.cellsX || cellY >= header.cellsY) {
+        return false;
+    }
+
+    const SceneCellEntry& cell = cells[static_cast<size_t>(cellY) * header.cellsX + cellX];
+    if (cell.count == 0) {
+        return true;
+    }
+    records.resize(cell.count);
+    file.seekg(static_cast<std::streamoff>(cell.offset));
+    file.read(reinterpret_cast<char*>(records.data()), cell.count * sizeof(SceneEntityRecord));
+    if (!file) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[SceneFile] Failed to read cell (%u, %u)", cellX, cellY);
+        file.clear();
+        records.clear();
+        return false;
+    }
+    return true;
+}
+
+const std::string& SceneFile::getImageName(int32_t index) const {
+    if (index < 0 || static_cast<size_t>(index) >= imageNames.size()) {
+        return EMPTY_NAME;
+    }
+    return imageNames[index];
+}
+
+} // namespace resources
+} // namespace game
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace game {
+namespace resources {
+
+/**
+ * Binary layout of a scene file:
+ *   SceneFileHeader
+ *   imageCount image names, NAME_LENGTH bytes each (zero padded)
+ *   cellsX * cellsY SceneCellEntry, row-major
+ *   SceneEntityRecord blocks, one contiguous block per non-empty cell
+ *
+ * Entities belong to the cell containing their center. All structs are
+ * written as-is, so files are only portable between machines with the same
+ * endianness (the reader checks the magic).
+ */
+struct SceneFileHeader {
+    static constexpr uint32_t MAGIC = 0x4E435346; // "FSCN" little-endian
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int NAME_LENGTH = 32;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    float cellSize = 0.0f;
+    uint32_t cellsX = 0;
+    uint32_t cellsY = 0;
+    uint32_t imageCount = 0;
+};
+
+struct SceneCellEntry {
+    uint64_t offset = 0;   // File offset of the cell's first record
+    uint32_t count = 0;    // Number of records in the cell
+    uint32_t reserved = 0;
+};
+
+struct SceneEntityRecord {
+    float x = 0.0f;
+    float y = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+    float rotation = 0.0f;
+    uint8_t r = 255;
+    uint8_t g = 255;
+    uint8_t b = 255;
+    uint8_t a = 255;
+    int32_t imageIndex = -1;  // Index into the image name table, -1 = none
+};
+
+/**
+ * An entity to be written into a scene (see SceneFile::write).
+ */
+struct SceneEntity {
+    SceneEntityRecord record;
+    std::string imageName;  // Empty = plain sprite
+};
+
+/**
+ * Reader and writer for cell-partitioned binary scenes.
+ *
+ * Only the header, the image table and the cell table are kept in memory;
+ * readCell() seeks to a cell's block and reads just its records, so the
+ * resident size does not depend on how many entities the scene holds.
+ */
+class SceneFile {
+public:
+    SceneFile() = default;
+
+    /**
+     * Partition entities into cells and write a scene file.
+     * @param path Output file
+     * @param worldWidth Width of the world the scene covers
+     * @param worldHeight Height of the world the scene covers
+     * @param cellSize Edge length of a square cell in world units
+     * @param entities Entities to store (positions are clamped into the world)
+     * @return true on success
+     */
+    static bool write(const std::string& path, float worldWidth, float worldHeight,
+                      float cellSize, const std::vector<SceneEntity>& entities);
+
+    /**
+     * Open a scene and read its header, image table and cell table.
+     * @param path Scene file
+     * @return true on success
+     */
+    bool open(const std::string& path);
+
+    void close();
+    bool isOpen() const { return file.is_open(); }
+
+    const SceneFileHeader& getHeader() const { return header; }
+
+    /**
+     * Read every record stored in one cell.
+     * @param cellX Cell column
+     * @param cellY Cell row
+     * @param records Receives the records (cleared first)
+     * @return false on a read error or an out-of-range cell
+     */
+    bool readCell(uint32_t cellX, uint32_t cellY, std::vector<SceneEntityRecord>& records);
+
+    /**
+     * @param index Image index from a SceneEntityRecord
+     * @return The image name, or an empty string for -1 / bad indices
+     */
+    const std::string& getImageName(int32_t index) const;
+
+private:
+    std::ifstream file;
+    SceneFileHeader header;
+    std::vector<std::string> imageNames;
+    std::vector<SceneCellEntry> cells;
+};
+
+} // namespace resources
+} // namespace game
@@ -44,6 +44,11 @@ void DebugOverlay::onEvent(const events::Event& event) {
         const events::KeyboardEvent& keyEvent = static_cast<const events::KeyboardEvent&>(event);
         if (keyEvent.isPressed()) {
             std::string key = keyEvent.getKeyText();
+
+            // The inspector gets first pick of keys while it is on screen
+            if (visible && entityInfoVisible && entityInspector.handleKey(key)) {
+                return;
+            }
             
             if (key == "f1") {
                 toggleVisibility();
@@ -67,6 +72,11 @@ void DebugOverlay::onEvent(const events::Event& event) {
 
 void DebugOverlay::update(float deltaTime) {
     // No local tracking needed - Timer provides all performance data
+
+    // Only spend the inspector's scan budget while it is on screen
+    if (visible && entityInfoVisible) {
+        entityInspector.update(deltaTime);
+    }
 }
 
 void DebugOverlay::render(SDL_Renderer* renderer) {
@@ -140,6 +150,10 @@ bool DebugOverlay::isVisible() const {
     return visible;
 }
 
+bool DebugOverlay::isCapturingText() const {
+    return visible && entityInfoVisible && entityInspector.isEditingName();
+}
+
 void DebugOverlay::toggleCollisionInfo() {
     collisionInfoVisible = !collisionInfoVisible;
 }
@@ -152,6 +166,10 @@ void DebugOverlay::toggleEntityInfo() {
     entityInfoVisible = !entityInfoVisible;
 }
 
+EntityInspector& DebugOverlay::getEntityInspector() {
+    return entityInspector;
+}
+
 TextRenderer& DebugOverlay::getTextRenderer() {
     return *textRenderer;
 }
@@ -175,7 +193,8 @@ void DebugOverlay::renderDebugHelp(SDL_Renderer* renderer) {
         "F1: Toggle Debug Overlay",
         "F2: Toggle Collision Info",
         "F3: Toggle Performance Info",
-        "F4: Toggle Entity Info"
+        "F4: Toggle Entity Inspector",
+        "F5: Log World Report"
     };
     
     int yOffset = 10;
@@ -214,23 +233,8 @@ void DebugOverlay::renderPerformanceInfo(SDL_Renderer* renderer) {
 }
 
 void DebugOverlay::renderEntityInfo(SDL_Renderer* renderer) {
-    // Position entity info on the right side, below performance
-    int xPos = screenWidth - 250;
-    int yOffset = 150;
-    
-    std::vector<std::string> entityText = {
-        "=== ENTITY INFO ===",
-        "Total Entities: N/A",
-        "Active Systems: N/A",
-        "Components: N/A"
-    };
-    
-    for (const std::string& line : entityText) {
-        GameColor* color = line.find("===") != std::string::npos ? &secondaryTextColor : &primaryTextColor;
-        int fontSize = line.find("===") != std::string::npos ? 22 : 16;
-        textRenderer->renderText(renderer, line, xPos, yOffset, fontSize, color);
-        yOffset += 20;
-    }
+    // Position entity inspector on the right side, below performance
+    entityInspector.render(renderer, *textRenderer, screenWidth - 420, 80);
 }
 
 } // namespace ui
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include "TextRenderer.hpp"
+#include "EntityInspector.hpp"
 #include "../events/EventListener.hpp"
 #include "../GameColor.hpp"
 #include "../Timer.hpp"
@@ -27,7 +28,7 @@ namespace ui {
  * - F1: Toggle debug overlay visibility
  * - F2: Toggle collision information
  * - F3: Toggle performance information
- * - F4: Toggle entity information
+ * - F4: Toggle entity inspector (see EntityInspector for its controls)
  * 
  * Based on: Lesson-40-WorldState/Documentation/NewHudDesign.md
  * Follows: Professional 4-component HUD architecture
@@ -99,6 +100,19 @@ public:
      */
     void toggleEntityInfo();
 
+    /**
+     * Get the entity inspector shown by F4
+     * @return Reference to the EntityInspector
+     */
+    EntityInspector& getEntityInspector();
+
+    /**
+     * Check if typed keys currently go to the overlay (the entity
+     * inspector's name filter), so the game should not treat them as hotkeys
+     * @return true while the inspector is shown and editing its name filter
+     */
+    bool isCapturingText() const;
+
     /**
      * Handle events (EventListener interface)
      * @param event The event to handle
@@ -124,6 +138,7 @@ private:
     
     // Components
     std::unique_ptr<TextRenderer> textRenderer;
+    EntityInspector entityInspector;
     
     // No local performance tracking needed - Timer provides FPS
     
@@ -154,7 +169,7 @@ private:
     void renderPerformanceInfo(SDL_Renderer* renderer);
     
     /**
-     * Render entity count and system information
+     * Render the paged entity inspector
      * @param renderer SDL renderer
      */
     void renderEntityInfo(SDL_Renderer* renderer);
@@ -0,0 +1,312 @@
+#include "EntityInspector.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cctype>
+
+namespace game {
+namespace ui {
+
+namespace {
+
+constexpr int LINE_HEIGHT = 16;
+constexpr int HEADER_FONT_SIZE = 18;
+constexpr int ROW_FONT_SIZE = 14;
+
+std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+} // namespace
+
+EntityInspector::EntityInspector()
+    : componentFilter_(-1)
+    , editingName_(false)
+    , scanCursor_(0)
+    , scanning_(false)
+    , sinceRefresh_(REFRESH_INTERVAL)
+    , page_(0)
+    , selectedRow_(0)
+    , rowsDirty_(true)
+    , headerDirty_(true)
+    , headerColor_(0, 0, 0)
+    , rowColor_(0, 0, 0)
+    , selectedColor_(0, 0, 160)
+{
+    detailLines_.reserve(MAX_DETAIL_LINES);
+}
+
+void EntityInspector::update(float deltaTime) {
+    sinceRefresh_ += deltaTime;
+    if (!scanning_ && sinceRefresh_ >= REFRESH_INTERVAL) {
+        restartScan();
+    }
+    if (!scanning_) {
+        return;
+    }
+
+    // Entities removed mid-scan can shift the dense list; any entity missed
+    // or seen twice is corrected by the next scan
+    const auto& live = ecs::ComponentManager::getInstance().getLiveEntities();
+    size_t end = std::min(live.size(), scanCursor_ + SCAN_BUDGET);
+    for (; scanCursor_ < end; ++scanCursor_) {
+        if (matches(live[scanCursor_])) {
+            pending_.push_back(live[scanCursor_]);
+        }
+    }
+
+    if (scanCursor_ >= live.size()) {
+        std::sort(pending_.begin(), pending_.end());
+        pending_.erase(std::unique(pending_.begin(), pending_.end()), pending_.end());
+        matches_.swap(pending_);
+        pending_.clear();
+        scanning_ = false;
+
+        page_ = std::min(page_, getPageCount() - 1);
+        rowsDirty_ = true;
+        headerDirty_ = true;
+    }
+}
+
+void EntityInspector::restartScan() {
+    pending_.clear();
+    scanCursor_ = 0;
+    scanning_ = true;
+    sinceRefresh_ = 0.0f;
+}
+
+bool EntityInspector::matches(ecs::Entity::ID id) const {
+    auto& componentManager = ecs::ComponentManager::getInstance();
+    if (componentFilter_ >= 0 &&
+        !componentManager.getSignature(id).test(static_cast<size_t>(componentFilter_))) {
+        return false;
+    }
+    if (!nameFilter_.empty()) {
+        std::string name = toLower(componentManager.findEntity(id).getName());
+        if (name.find(nameFilter_) == std::string::npos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int EntityInspector::getPageCount() const {
+    return std::max(1, static_cast<int>((matches_.size() + ROWS_PER_PAGE - 1) / ROWS_PER_PAGE));
+}
+
+bool EntityInspector::getSelectedEntity(ecs::Entity::ID& id) const {
+    size_t index = static_cast<size_t>(page_) * ROWS_PER_PAGE + selectedRow_;
+    if (index >= matches_.size()) {
+        return false;
+    }
+    id = matches_[index];
+    return true;
+}
+
+void EntityInspector::nextPage() {
+    if (page_ + 1 < getPageCount()) {
+        page_++;
+        selectedRow_ = 0;
+        rowsDirty_ = true;
+        headerDirty_ = true;
+    }
+}
+
+void EntityInspector::previousPage() {
+    if (page_ > 0) {
+        page_--;
+        selectedRow_ = 0;
+        rowsDirty_ = true;
+        headerDirty_ = true;
+    }
+}
+
+void EntityInspector::selectNext() {
+    size_t pageStart = static_cast<size_t>(page_) * ROWS_PER_PAGE;
+    if (selectedRow_ + 1 < ROWS_PER_PAGE && pageStart + selectedRow_ + 1 < matches_.size()) {
+        selectedRow_++;
+    } else if (page_ + 1 < getPageCount()) {
+        nextPage();
+    }
+}
+
+void EntityInspector::selectPrevious() {
+    if (selectedRow_ > 0) {
+        selectedRow_--;
+    } else if (page_ > 0) {
+        previousPage();
+        selectedRow_ = ROWS_PER_PAGE - 1;
+    }
+}
+
+void EntityInspector::cycleComponentFilter() {
+    int typeCount = static_cast<int>(
+        ecs::ComponentManager::getInstance().getComponentTypeNames().size());
+    setComponentFilter(componentFilter_ + 1 < typeCount ? componentFilter_ + 1 : -1);
+}
+
+void EntityInspector::setComponentFilter(int typeIndex) {
+    componentFilter_ = typeIndex;
+    page_ = 0;
+    selectedRow_ = 0;
+    headerDirty_ = true;
+    restartScan();
+}
+
+void EntityInspector::setNameFilter(const std::string& filter) {
+    nameFilter_ = toLower(filter);
+    page_ = 0;
+    selectedRow_ = 0;
+    headerDirty_ = true;
+    restartScan();
+}
+
+bool EntityInspector::handleKey(const std::string& key) {
+    if (editingName_) {
+        if (key == "return" || key == "f9") {
+            editingName_ = false;
+            headerDirty_ = true;
+        } else if (key == "backspace") {
+            if (!nameFilter_.empty()) {
+                setNameFilter(nameFilter_.substr(0, nameFilter_.size() - 1));
+            }
+        } else if (key.size() == 1) {
+            setNameFilter(nameFilter_ + key);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    if (key == "pagedown") {
+        nextPage();
+    } else if (key == "pageup") {
+        previousPage();
+    } else if (key == "f6") {
+        cycleComponentFilter();
+    } else if (key == "f7") {
+        selectPrevious();
+    } else if (key == "f8") {
+        selectNext();
+    } else if (key == "f9") {
+        editingName_ = true;
+        headerDirty_ = true;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string EntityInspector::formatRow(ecs::Entity::ID id, const ecs::Signature& signature) const {
+    auto& componentManager = ecs::ComponentManager::getInstance();
+    const auto& typeNames = componentManager.getComponentTypeNames();
+
+    std::string text = "#" + std::to_string(id) + " " + componentManager.findEntity(id).getName() + " [";
+    bool first = true;
+    for (size_t bit = 0; bit < typeNames.size(); ++bit) {
+        if (signature.test(bit)) {
+            if (!first) {
+                text += ' ';
+            }
+            text += typeNames[bit];
+            first = false;
+        }
+    }
+    text += ']';
+    return text;
+}
+
+void EntityInspector::refreshRows() {
+    auto& componentManager = ecs::ComponentManager::getInstance();
+    size_t pageStart = static_cast<size_t>(page_) * ROWS_PER_PAGE;
+
+    for (int i = 0; i < ROWS_PER_PAGE; ++i) {
+        Row& row = rows_[i];
+        size_t index = pageStart + i;
+        if (index >= matches_.size()) {
+            row.used = false;
+            continue;
+        }
+
+        // Only re-format when the row shows a different entity or the
+        // entity's component set changed since it was formatted
+        ecs::Entity::ID id = matches_[index];
+        ecs::Signature signature = componentManager.getSignature(id);
+        if (rowsDirty_ || !row.used || row.id != id || row.signature != signature) {
+            row.id = id;
+            row.signature = signature;
+            row.text = signature.none() ? "#" + std::to_string(id) + " (destroyed)"
+                                        : formatRow(id, signature);
+        }
+        row.used = true;
+    }
+    rowsDirty_ = false;
+
+    int usedRows = static_cast<int>(std::min<size_t>(ROWS_PER_PAGE, matches_.size() - std::min(matches_.size(), pageStart)));
+    if (selectedRow_ >= usedRows) {
+        selectedRow_ = std::max(0, usedRows - 1);
+    }
+}
+
+void EntityInspector::refreshHeader() {
+    headerText_ = "=== ENTITIES (" + std::to_string(matches_.size()) + ") page " +
+                  std::to_string(page_ + 1) + "/" + std::to_string(getPageCount()) + " ===";
+
+    const auto& typeNames = ecs::ComponentManager::getInstance().getComponentTypeNames();
+    std::string component = componentFilter_ >= 0 && componentFilter_ < static_cast<int>(typeNames.size())
+                                ? typeNames[componentFilter_]
+                                : "any";
+    filterText_ = "F6 type: " + component + "  F9 name: " + nameFilter_ + (editingName_ ? "_" : "");
+    headerDirty_ = false;
+}
+
+void EntityInspector::render(SDL_Renderer* renderer, TextRenderer& text, int x, int y) {
+    refreshRows();
+    if (headerDirty_) {
+        refreshHeader();
+    }
+
+    text.renderCachedText(renderer, headerText_, x, y, HEADER_FONT_SIZE, &headerColor_);
+    y += LINE_HEIGHT + 6;
+    text.renderCachedText(renderer, filterText_, x, y, ROW_FONT_SIZE, &headerColor_);
+    y += LINE_HEIGHT + 4;
+
+    for (int i = 0; i < ROWS_PER_PAGE; ++i) {
+        if (!rows_[i].used) {
+            break;
+        }
+        const GameColor* color = i == selectedRow_ ? &selectedColor_ : &rowColor_;
+        text.renderCachedText(renderer, i == selectedRow_ ? "> " + rows_[i].text : rows_[i].text,
+                              x, y, ROW_FONT_SIZE, color);
+        y += LINE_HEIGHT;
+    }
+
+    // Live view of the selected entity's components
+    ecs::Entity::ID selected;
+    if (!getSelectedEntity(selected)) {
+        return;
+    }
+    auto& componentManager = ecs::ComponentManager::getInstance();
+    const auto& typeNames = componentManager.getComponentTypeNames();
+    ecs::Signature signature = componentManager.getSignature(selected);
+
+    detailLines_.clear();
+    for (size_t bit = 0; bit < typeNames.size() && detailLines_.size() < MAX_DETAIL_LINES; ++bit) {
+        if (!signature.test(bit)) {
+            continue;
+        }
+        const ecs::Component* component = componentManager.getComponent(selected, bit);
+        std::string summary = component ? component->toString() : std::string();
+        detailLines_.push_back(summary.empty() ? typeNames[bit] : typeNames[bit] + ": " + summary);
+    }
+
+    y += 6;
+    for (const std::string& line : detailLines_) {
+        text.renderText(renderer, line, x, y, ROW_FONT_SIZE, &selectedColor_);
+        y += LINE_HEIGHT;
+    }
+}
+
+} // namespace ui
+} // namespace game
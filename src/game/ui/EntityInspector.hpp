@@ -0,0 +1,151 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <array>
+#include <string>
+#include <vector>
+#include "TextRenderer.hpp"
+#include "../GameColor.hpp"
+#include "../ecs/ComponentManager.hpp"
+#include "../ecs/Entity.hpp"
+
+namespace game {
+namespace ui {
+
+/**
+ * EntityInspector - paged, filterable entity browser for the DebugOverlay (F4).
+ *
+ * Its per-frame cost does not grow with the size of the world:
+ * - Filtering is a budgeted scan over ComponentManager's live entity list.
+ *   At most SCAN_BUDGET entities are tested per frame, and the scan restarts
+ *   every REFRESH_INTERVAL seconds or when a filter changes.
+ * - Only the ROWS_PER_PAGE visible rows are formatted. A row is re-formatted
+ *   only when its entity or that entity's component signature changes, and
+ *   it is drawn through TextRenderer's text texture cache.
+ * - The selected entity's components are formatted live each frame, up to
+ *   MAX_DETAIL_LINES lines.
+ *
+ * Controls (while the entity panel is shown):
+ * - PageUp / PageDown: previous / next page
+ * - F6: cycle the component-type filter
+ * - F7 / F8: select previous / next row
+ * - F9: start or stop editing the name filter (type to filter, Backspace
+ *   deletes, Return finishes)
+ *
+ * The engine's own hotkeys (time controls P, -, =, HUD toggle H, quit Q)
+ * avoid F6-F9 and are ignored while the name filter is being edited.
+ */
+class EntityInspector {
+public:
+    static constexpr int ROWS_PER_PAGE = 12;
+    static constexpr int MAX_DETAIL_LINES = 8;
+    static constexpr size_t SCAN_BUDGET = 2048;
+    static constexpr float REFRESH_INTERVAL = 0.25f;
+
+    EntityInspector();
+
+    /**
+     * Advance the filter scan by up to SCAN_BUDGET entities.
+     * @param deltaTime Time elapsed since last frame
+     */
+    void update(float deltaTime);
+
+    /**
+     * Draw the inspector panel.
+     * @param renderer SDL renderer
+     * @param text Text renderer used for all output
+     * @param x Left edge of the panel
+     * @param y Top edge of the panel
+     */
+    void render(SDL_Renderer* renderer, TextRenderer& text, int x, int y);
+
+    /**
+     * Handle a key press (lowercase SDL key name).
+     * @param key Key name as published in KeyboardEvent
+     * @return true if the inspector consumed the key
+     */
+    bool handleKey(const std::string& key);
+
+    void nextPage();
+    void previousPage();
+    void selectNext();
+    void selectPrevious();
+
+    /**
+     * Advance the component filter to the next known component type
+     * (wrapping back to "all").
+     */
+    void cycleComponentFilter();
+
+    /**
+     * Only list entities that have the given component type.
+     * @param typeIndex Index from ComponentManager::getComponentTypeIndex(),
+     *                  or -1 for no component filter
+     */
+    void setComponentFilter(int typeIndex);
+
+    /**
+     * Only list entities whose name contains the text (case-insensitive).
+     * @param filter Substring to match; empty disables the name filter
+     */
+    void setNameFilter(const std::string& filter);
+
+    /**
+     * @return true while typed keys go into the name filter
+     */
+    bool isEditingName() const { return editingName_; }
+
+    size_t getMatchCount() const { return matches_.size(); }
+    int getPage() const { return page_; }
+    int getPageCount() const;
+
+    /**
+     * @return ID of the selected entity, or false if the page is empty
+     */
+    bool getSelectedEntity(ecs::Entity::ID& id) const;
+
+private:
+    struct Row {
+        ecs::Entity::ID id = 0;
+        ecs::Signature signature;
+        std::string text;
+        bool used = false;
+    };
+
+    void restartScan();
+    bool matches(ecs::Entity::ID id) const;
+    void refreshRows();
+    void refreshHeader();
+    std::string formatRow(ecs::Entity::ID id, const ecs::Signature& signature) const;
+
+    // Filter state
+    int componentFilter_;
+    std::string nameFilter_;
+    bool editingName_;
+
+    // Completed and in-progress scan results (sorted by ID when complete)
+    std::vector<ecs::Entity::ID> matches_;
+    std::vector<ecs::Entity::ID> pending_;
+    size_t scanCursor_;
+    bool scanning_;
+    float sinceRefresh_;
+
+    // Paging and selection
+    int page_;
+    int selectedRow_;
+    bool rowsDirty_;
+    bool headerDirty_;
+
+    // Formatted text for the visible page
+    std::array<Row, ROWS_PER_PAGE> rows_;
+    std::string headerText_;
+    std::string filterText_;
+    std::vector<std::string> detailLines_;
+
+    GameColor headerColor_;
+    GameColor rowColor_;
+    GameColor selectedColor_;
+};
+
+} // namespace ui
+} // namespace game
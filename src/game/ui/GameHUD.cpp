@@ -1,4 +1,5 @@
 #include "GameHUD.hpp"
+#include "../ecs/Tweener.hpp"
 #include "../ecs/components/ShootingGalleryState.hpp"
 #include <format>
 #include <sstream>
@@ -18,11 +19,16 @@ GameHUD::GameHUD(int screenWidth, int screenHeight)
     , warningColor(255, 255, 0)    // Yellow
     , criticalColor(255, 0, 0)     // Red
     , goodColor(0, 255, 0)         // Green
+    , refreshInterval(0.0f)
+    , sinceRefresh(0.0f)
+    , scorePopOffset(0.0f)
+    , shownScore(0)
 {
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "GameHUD initialized");
 }
 
 GameHUD::~GameHUD() {
+    ecs::Tweener::getInstance().cancelTarget(&scorePopOffset);
     cleanup();
 }
 
@@ -36,6 +42,17 @@ void GameHUD::update(float deltaTime) {
             return;
         }
     }
+
+    // Re-format gameplay text at the configured rate
+    sinceRefresh += deltaTime;
+    if (gameState->isPlaying() && sinceRefresh >= refreshInterval) {
+        refreshGameplayText();
+        sinceRefresh = 0.0f;
+    }
+}
+
+void GameHUD::setRefreshInterval(float seconds) {
+    refreshInterval = seconds;
 }
 
 void GameHUD::render(SDL_Renderer* renderer) {
@@ -58,19 +75,44 @@ void GameHUD::render(SDL_Renderer* renderer) {
 }
 
 void GameHUD::renderGameplayHUD(SDL_Renderer* renderer) {
+    if (gameplayLines.empty()) {
+        refreshGameplayText();
+    }
+
+    // Unchanged lines reuse their cached textures; the score line (first)
+    // is drawn at its pop offset, which only moves the texture
+    for (size_t i = 0; i < gameplayLines.size(); ++i) {
+        const HudLine& line = gameplayLines[i];
+        int y = i == 0 ? line.y + static_cast<int>(scorePopOffset) : line.y;
+        textRenderer->renderCachedText(renderer, line.text, line.x, y, line.fontSize, &line.color);
+    }
+}
+
+void GameHUD::refreshGameplayText() {
+    gameplayLines.clear();
+
+    // Pop the score when a hit raised it since the last refresh
+    if (gameState->score > shownScore) {
+        ecs::Tweener& tweener = ecs::Tweener::getInstance();
+        tweener.cancelTarget(&scorePopOffset);
+        tweener.tween(&scorePopOffset, -SCORE_POP_HEIGHT, 0.0f, SCORE_POP_DURATION,
+                      ecs::Easing::OutBounce);
+    } else if (gameState->score < shownScore) {
+        scorePopOffset = 0.0f;  // New game; the world cleared the tweens
+    }
+    shownScore = gameState->score;
+
     // Score (top left)
     std::ostringstream scoreStream;
     scoreStream.imbue(std::locale::classic()); // Use classic locale to avoid locale errors
     scoreStream << "Score: " << gameState->score;
-    std::string scoreText = scoreStream.str();
-    textRenderer->renderText(renderer, scoreText, 20, 20, 32, &normalColor);
+    gameplayLines.push_back({scoreStream.str(), 20, 20, 32, normalColor});
     
     // High Score (top left, below score)
     std::ostringstream highScoreStream;
     highScoreStream.imbue(std::locale::classic());
     highScoreStream << "High Score: " << gameState->highScore;
-    std::string highScoreText = highScoreStream.str();
-    textRenderer->renderText(renderer, highScoreText, 20, 60, 24, &goodColor);
+    gameplayLines.push_back({highScoreStream.str(), 20, 60, 24, goodColor});
     
     // Time remaining (top center)
     GameColor timeColor = getTimeColor(gameState->timeRemaining);
@@ -78,24 +120,24 @@ void GameHUD::renderGameplayHUD(SDL_Renderer* renderer) {
     timeStream << std::fixed << std::setprecision(1) << "Time: " << gameState->timeRemaining << "s";
     std::string timeText = timeStream.str();
     int timeX = (screenWidth - textRenderer->getTextWidth(timeText, 36)) / 2;
-    textRenderer->renderText(renderer, timeText, timeX, 20, 36, &timeColor);
+    gameplayLines.push_back({timeText, timeX, 20, 36, timeColor});
     
     // Shots fired and accuracy (top right)
     std::string shotsText = "Shots: " + std::to_string(gameState->shotsFired);
     int shotsWidth = textRenderer->getTextWidth(shotsText, 24);
-    textRenderer->renderText(renderer, shotsText, screenWidth - shotsWidth - 20, 20, 24, &normalColor);
+    gameplayLines.push_back({shotsText, screenWidth - shotsWidth - 20, 20, 24, normalColor});
     
     std::ostringstream accuracyStream;
     accuracyStream << std::fixed << std::setprecision(1) << "Accuracy: " << gameState->getAccuracy() << "%";
     std::string accuracyText = accuracyStream.str();
     int accuracyWidth = textRenderer->getTextWidth(accuracyText, 24);
     GameColor accuracyColor = getAccuracyColor(gameState->getAccuracy());
-    textRenderer->renderText(renderer, accuracyText, screenWidth - accuracyWidth - 20, 50, 24, &accuracyColor);
+    gameplayLines.push_back({accuracyText, screenWidth - accuracyWidth - 20, 50, 24, accuracyColor});
     
     // Targets hit (top right, below accuracy)
     std::string hitsText = "Hits: " + std::to_string(gameState->targetsHit);
     int hitsWidth = textRenderer->getTextWidth(hitsText, 24);
-    textRenderer->renderText(renderer, hitsText, screenWidth - hitsWidth - 20, 80, 24, &normalColor);
+    gameplayLines.push_back({hitsText, screenWidth - hitsWidth - 20, 80, 24, normalColor});
 }
 
 void GameHUD::renderGameOverHUD(SDL_Renderer* renderer) {
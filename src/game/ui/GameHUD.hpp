@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 #include <SDL3/SDL.h>
 #include "TextRenderer.hpp"
 #include "../GameColor.hpp"
@@ -83,6 +85,14 @@ public:
      * @return Reference to the text renderer
      */
     TextRenderer& getTextRenderer();
+
+    /**
+     * Set how often the gameplay HUD text is re-formatted.
+     * Between refreshes the previous text (and its cached textures) is reused.
+     * 
+     * @param seconds Refresh interval in seconds (0 = every frame)
+     */
+    void setRefreshInterval(float seconds);
     
     /**
      * Cleanup resources
@@ -105,6 +115,30 @@ private:
     GameColor warningColor;  // Yellow
     GameColor criticalColor; // Red
     GameColor goodColor;     // Green
+
+    // One line of gameplay HUD text, formatted by refreshGameplayText()
+    struct HudLine {
+        std::string text;
+        int x;
+        int y;
+        int fontSize;
+        GameColor color;
+    };
+    std::vector<HudLine> gameplayLines;
+    float refreshInterval;   // Seconds between gameplay text refreshes
+    float sinceRefresh;      // Seconds since the last refresh
+
+    // Score pop: the score line jumps up and bounces back when it changes,
+    // driven by a Tweener tween on scorePopOffset
+    static constexpr float SCORE_POP_HEIGHT = 12.0f;   // Pixels
+    static constexpr float SCORE_POP_DURATION = 0.4f;  // Seconds
+    float scorePopOffset;    // Added to the score line's y
+    int shownScore;          // Score in the current gameplay text
+
+    /**
+     * Re-format the gameplay HUD lines from the current game state.
+     */
+    void refreshGameplayText();
     
     /**
      * Render HUD elements during gameplay.
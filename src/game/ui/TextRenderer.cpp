@@ -7,7 +7,8 @@ namespace game {
 namespace ui {
 
 TextRenderer::TextRenderer()
-    : defaultFontSize(24)
+    : textCacheClock(0)
+    , defaultFontSize(24)
     , defaultColor(255, 255, 255)  // White
 {
     // Initialize SDL_ttf if not already initialized
@@ -21,6 +22,7 @@ TextRenderer::TextRenderer()
 }
 
 TextRenderer::~TextRenderer() {
+    clearTextCache();
     clearCache();
 }
 
@@ -103,6 +105,49 @@ SDL_FRect TextRenderer::renderText(SDL_Renderer* renderer, const std::string& te
     return destRect;
 }
 
+SDL_FRect TextRenderer::renderCachedText(SDL_Renderer* renderer, const std::string& text, int x, int y,
+                                        int fontSize, const GameColor* color) {
+    if (text.empty()) {
+        return {static_cast<float>(x), static_cast<float>(y), 0.0f, 0.0f};
+    }
+
+    int actualFontSize = fontSize > 0 ? fontSize : defaultFontSize;
+    const GameColor& actualColor = color ? *color : defaultColor;
+
+    // Key: size, color and text packed into one string
+    std::string key;
+    key.reserve(text.size() + 8);
+    key.push_back(static_cast<char>(actualFontSize));
+    key.push_back(static_cast<char>(actualColor.r));
+    key.push_back(static_cast<char>(actualColor.g));
+    key.push_back(static_cast<char>(actualColor.b));
+    key.push_back(static_cast<char>(actualColor.a));
+    key += text;
+
+    auto it = textCache.find(key);
+    if (it == textCache.end() || it->second.renderer != renderer) {
+        SDL_Texture* texture = createTextTexture(renderer, text, getFont(actualFontSize), actualColor);
+        if (!texture) {
+            return {static_cast<float>(x), static_cast<float>(y), 0.0f, 0.0f};
+        }
+        if (it != textCache.end()) {
+            SDL_DestroyTexture(it->second.texture);
+            textCache.erase(it);
+        }
+        if (textCache.size() >= TEXT_CACHE_CAPACITY) {
+            evictTextCache();
+        }
+        float width, height;
+        SDL_GetTextureSize(texture, &width, &height);
+        it = textCache.emplace(std::move(key), CachedText{texture, renderer, width, height, 0}).first;
+    }
+
+    it->second.lastUse = ++textCacheClock;
+    SDL_FRect destRect = {static_cast<float>(x), static_cast<float>(y), it->second.width, it->second.height};
+    SDL_RenderTexture(renderer, it->second.texture, nullptr, &destRect);
+    return destRect;
+}
+
 SDL_FRect TextRenderer::renderText(SDL_Renderer* renderer, const std::string& text, int x, int y) {
     return renderText(renderer, text, x, y, 0, nullptr, false, false);
 }
@@ -169,6 +214,37 @@ size_t TextRenderer::getFontCacheSize() const {
     return fontCache.size();
 }
 
+void TextRenderer::clearTextCache() {
+    for (auto& [key, cached] : textCache) {
+        SDL_DestroyTexture(cached.texture);
+    }
+    textCache.clear();
+}
+
+size_t TextRenderer::getTextCacheSize() const {
+    return textCache.size();
+}
+
+void TextRenderer::evictTextCache() {
+    std::vector<uint64_t> uses;
+    uses.reserve(textCache.size());
+    for (const auto& [key, cached] : textCache) {
+        uses.push_back(cached.lastUse);
+    }
+    size_t cut = uses.size() / 4;
+    std::nth_element(uses.begin(), uses.begin() + cut, uses.end());
+    uint64_t threshold = uses[cut];
+
+    for (auto it = textCache.begin(); it != textCache.end();) {
+        if (it->second.lastUse <= threshold) {
+            SDL_DestroyTexture(it->second.texture);
+            it = textCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 SDL_Texture* TextRenderer::createTextTexture(SDL_Renderer* renderer, const std::string& text,
                                             TTF_Font* font, const GameColor& color) {
     SDL_Color sdlColor = {color.r, color.g, color.b, color.a};
@@ -3,6 +3,7 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <cstdint>
 #include <tuple>
 #include <vector>
 #include <SDL3/SDL.h>
@@ -56,6 +57,24 @@ public:
                         int fontSize = 0, const GameColor* color = nullptr,
                         bool centerX = false, bool centerY = false);
     
+    /**
+     * Render text through the text texture cache.
+     *
+     * Use this for strings that repeat from frame to frame (labels, table
+     * rows): the rasterized texture is reused until it falls out of the
+     * bounded LRU cache, so unchanged text costs one texture copy.
+     *
+     * @param renderer SDL renderer to render to
+     * @param text Text to render
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param fontSize Font size (uses default if 0)
+     * @param color RGB color (uses default if nullptr)
+     * @return Rectangle representing the rendered text bounds
+     */
+    SDL_FRect renderCachedText(SDL_Renderer* renderer, const std::string& text, int x, int y,
+                               int fontSize = 0, const GameColor* color = nullptr);
+
     /**
      * Render text with default font size and color.
      * 
@@ -128,6 +147,18 @@ public:
      * Clear the font cache.
      */
     void clearCache();
+
+    /**
+     * Destroy all cached text textures.
+     */
+    void clearTextCache();
+
+    /**
+     * Get the number of textures in the text cache.
+     *
+     * @return Number of cached text textures
+     */
+    size_t getTextCacheSize() const;
     
     /**
      * Get the number of fonts in the cache.
@@ -141,9 +172,26 @@ private:
     // Font cache to improve performance
     std::unordered_map<int, std::unique_ptr<TTF_Font, decltype(&TTF_CloseFont)>> fontCache;
     
+    // Rasterized text reused by renderCachedText
+    struct CachedText {
+        SDL_Texture* texture;
+        SDL_Renderer* renderer;
+        float width;
+        float height;
+        uint64_t lastUse;
+    };
+    static constexpr size_t TEXT_CACHE_CAPACITY = 256;
+    std::unordered_map<std::string, CachedText> textCache;
+    uint64_t textCacheClock;
+
     // Default settings
     int defaultFontSize;
     GameColor defaultColor;
+
+    /**
+     * Drop the least recently used quarter of the text cache.
+     */
+    void evictTextCache();
     
     /**
      * Create a texture from text
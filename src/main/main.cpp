@@ -3,6 +3,7 @@
 #include <iostream>
 #include <filesystem>
 #include <sstream>
+#include <cstdlib>
 #include "game/GameEngine.hpp"
 
 namespace fs = std::filesystem;
@@ -54,8 +55,93 @@ int main(int argc, char *argv[])
         verifyAssetsDirectory(assetsDir);
         std::cout << "Assets directory verified successfully" << std::endl;
 
+        // Optional per-frame metrics capture: --metrics <file>
+        // Optional gameplay event journal: --journal <file>
+        // Optional startup timeline trace: --startup-trace <file>
+        // Optional fixed quality level: --quality <0-3>
+        // Optional world seed for reproducible runs: --seed <n>
+        // Optional bot player (soak and load tests): --bot
+        // Optional simulation speed: --time-scale <0|0.25|1|8|uncapped>
+        // Optional session recording: --record-replay <file>
+        // Optional replay playback: --replay <file> [--replay-seek <seconds>]
+        std::string metricsPath;
+        std::string journalPath;
+        std::string startupTracePath;
+        int qualityLevel = -1;
+        std::string seed;
+        bool bot = false;
+        std::string timeScale;
+        std::string recordReplayPath;
+        std::string replayPath;
+        double replaySeek = 0.0;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::string(argv[i]) == "--metrics" && i + 1 < argc)
+            {
+                metricsPath = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--journal" && i + 1 < argc)
+            {
+                journalPath = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--startup-trace" && i + 1 < argc)
+            {
+                startupTracePath = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--quality" && i + 1 < argc)
+            {
+                qualityLevel = std::atoi(argv[++i]);
+            }
+            else if (std::string(argv[i]) == "--seed" && i + 1 < argc)
+            {
+                seed = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--bot")
+            {
+                bot = true;
+            }
+            else if (std::string(argv[i]) == "--time-scale" && i + 1 < argc)
+            {
+                timeScale = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--record-replay" && i + 1 < argc)
+            {
+                recordReplayPath = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--replay" && i + 1 < argc)
+            {
+                replayPath = argv[++i];
+            }
+            else if (std::string(argv[i]) == "--replay-seek" && i + 1 < argc)
+            {
+                replaySeek = std::strtod(argv[++i], nullptr);
+            }
+        }
+
         std::cout << "Creating game engine instance..." << std::endl;
         GameEngine engine(windowTitle, assetsDir.string());
+        engine.setMetricsOutput(metricsPath);
+        engine.setJournalOutput(journalPath);
+        engine.setStartupTraceOutput(startupTracePath);
+        engine.setFixedQualityLevel(qualityLevel);
+        if (!seed.empty())
+        {
+            engine.setRandomSeed(std::strtoull(seed.c_str(), nullptr, 10));
+        }
+        engine.setBotEnabled(bot);
+        engine.setReplayOutput(recordReplayPath);
+        if (!replayPath.empty())
+        {
+            engine.setReplayInput(replayPath, replaySeek);
+        }
+        if (timeScale == "uncapped")
+        {
+            engine.setTimeScale(GameEngine::TIME_SCALE_UNCAPPED);
+        }
+        else if (!timeScale.empty())
+        {
+            engine.setTimeScale(std::strtof(timeScale.c_str(), nullptr));
+        }
 
         std::cout << "Initializing game engine..." << std::endl;
         if (!engine.init())
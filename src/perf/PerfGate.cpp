@@ -0,0 +1,396 @@
+/**
+ * PerfGate - performance regression gate.
+ *
+ * Runs the headless stress scenarios and microbenchmarks from
+ * PerfScenarios.cpp and compares ticks/sec, allocations per frame and p99
+ * frame time against the checked-in baseline (perf_baseline.json). Any metric
+ * outside its tolerance fails the run with a non-zero exit code, so CTest
+ * reports the regression. A per-system timing diff is always printed so a
+ * reviewer can see where time moved.
+ *
+ * Usage:
+ *   PerfGate [--scenario NAME]... [--baseline FILE] [--assets DIR]
+ *            [--ticks N] [--repeat N] [--update-baseline] [--list]
+ *
+ * --ticks overrides the measured tick count of every selected scenario, e.g.
+ * "--scenario soak_bot --ticks 2000000" for an hours-long soak run. Soak
+ * scenarios also report heap growth and frame-time drift over the run.
+ * Scenarios may also report extra counters (printed, not gated) and fail
+ * outright on a functional error, e.g. a network client that desynced.
+ * A scenario runs Scenario::repeats times (--repeat overrides it for every
+ * selected scenario) and each gated metric is the median over those runs,
+ * so a single run slowed by other work on a shared CI host does not fail
+ * the gate.
+ * --update-baseline rewrites the measured numbers for the selected scenarios
+ * (tolerances are preserved). Baselines are machine-specific for the timing
+ * metrics; regenerate them on the CI host after intentional changes.
+ */
+
+#include "PerfScenarios.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#ifndef PERF_BASELINE_FILE
+#define PERF_BASELINE_FILE "src/perf/perf_baseline.json"
+#endif
+#ifndef PERF_ASSETS_DIR
+#define PERF_ASSETS_DIR "GameAssets"
+#endif
+
+using json = nlohmann::json;
+
+namespace {
+
+struct Options {
+  std::vector<std::string> scenarios;
+  std::string baselinePath = PERF_BASELINE_FILE;
+  std::string assetsDir = PERF_ASSETS_DIR;
+  int ticks = 0;   // Measured tick override (0 = scenario default)
+  int repeats = 0; // Run count override (0 = scenario default)
+  bool updateBaseline = false;
+  bool list = false;
+};
+
+struct Tolerances {
+  double ticksPerSecond = 0.20;      // Allowed relative drop
+  double allocationsPerFrame = 0.10; // Allowed relative rise
+  double allocationSlack = 1.0;      // Absolute allocs/frame always allowed
+  double p99FrameMs = 0.35;          // Allowed relative rise
+};
+
+void readTolerances(const json &node, Tolerances &t) {
+  if (!node.is_object()) {
+    return;
+  }
+  t.ticksPerSecond = node.value("ticksPerSecond", t.ticksPerSecond);
+  t.allocationsPerFrame =
+      node.value("allocationsPerFrame", t.allocationsPerFrame);
+  t.allocationSlack = node.value("allocationSlack", t.allocationSlack);
+  t.p99FrameMs = node.value("p99FrameMs", t.p99FrameMs);
+}
+
+double percentChange(double baseline, double current) {
+  return baseline != 0.0 ? (current - baseline) / baseline * 100.0 : 0.0;
+}
+
+/**
+ * Print one gated metric and return whether it is within its limit.
+ */
+bool checkMetric(const char *label, double baseline, double current,
+                 double limit, bool higherIsBetter) {
+  bool ok = higherIsBetter ? current >= limit : current <= limit;
+  std::printf("  %-16s %12.3f %12.3f %+8.1f%%   %s %-10.3f %s\n", label,
+              baseline, current, percentChange(baseline, current),
+              higherIsBetter ? ">=" : "<=", limit, ok ? "ok" : "REGRESSED");
+  return ok;
+}
+
+/**
+ * Compare a result against its baseline entry.
+ * @return true if every gated metric is within tolerance
+ */
+bool compare(const perf::ScenarioResult &result, const json &entry,
+             Tolerances tolerances) {
+  readTolerances(entry.value("tolerances", json::object()), tolerances);
+
+  double baseTps = entry.value("ticksPerSecond", 0.0);
+  double baseAllocs = entry.value("allocationsPerFrame", 0.0);
+  double baseP99 = entry.value("p99FrameMs", 0.0);
+
+  std::printf("  %-16s %12s %12s %9s   %s\n", "metric", "baseline", "current",
+              "delta", "limit");
+  bool ok = true;
+  ok &= checkMetric("ticks/sec", baseTps, result.ticksPerSecond,
+                    baseTps * (1.0 - tolerances.ticksPerSecond), true);
+  ok &= checkMetric("allocs/frame", baseAllocs, result.allocationsPerFrame,
+                    baseAllocs * (1.0 + tolerances.allocationsPerFrame) +
+                        tolerances.allocationSlack,
+                    false);
+  ok &= checkMetric("p99 frame (ms)", baseP99, result.p99FrameMs,
+                    baseP99 * (1.0 + tolerances.p99FrameMs), false);
+
+  if (!result.systemMeanMs.empty()) {
+    const json baseSystems = entry.value("systems", json::object());
+    std::printf("  per-system mean update time (ms):\n");
+    for (const auto &[name, ms] : result.systemMeanMs) {
+      if (baseSystems.contains(name)) {
+        double base = baseSystems[name].get<double>();
+        std::printf("    %-26s %9.4f %9.4f %+8.1f%%\n", name.c_str(), base, ms,
+                    percentChange(base, ms));
+      } else {
+        std::printf("    %-26s %9s %9.4f      new\n", name.c_str(), "-", ms);
+      }
+    }
+  }
+  return ok;
+}
+
+double median(std::vector<double> values) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  auto middle = values.begin() + values.size() / 2;
+  std::nth_element(values.begin(), middle, values.end());
+  return *middle;
+}
+
+/**
+ * Run a scenario several times and combine the runs: every timing and
+ * allocation metric becomes the median over the runs, counters come from the
+ * last run and any run's functional error fails the result.
+ */
+perf::ScenarioResult runRepeated(const perf::Scenario &scenario, int repeats) {
+  std::vector<perf::ScenarioResult> runs;
+  for (int i = 0; i < std::max(repeats, 1); ++i) {
+    runs.push_back(perf::runScenario(scenario));
+  }
+  perf::ScenarioResult result = runs.back();
+  if (runs.size() == 1) {
+    return result;
+  }
+
+  auto medianOf = [&runs](auto member) {
+    std::vector<double> values;
+    for (const auto &run : runs) {
+      values.push_back(member(run));
+    }
+    return median(std::move(values));
+  };
+  using Result = perf::ScenarioResult;
+  result.ticksPerSecond = medianOf([](const Result &r) { return r.ticksPerSecond; });
+  result.allocationsPerFrame =
+      medianOf([](const Result &r) { return r.allocationsPerFrame; });
+  result.meanFrameMs = medianOf([](const Result &r) { return r.meanFrameMs; });
+  result.p99FrameMs = medianOf([](const Result &r) { return r.p99FrameMs; });
+  for (size_t s = 0; s < result.systemMeanMs.size(); ++s) {
+    result.systemMeanMs[s].second = medianOf([s](const Result &r) {
+      return s < r.systemMeanMs.size() ? r.systemMeanMs[s].second : 0.0;
+    });
+  }
+  for (const auto &run : runs) {
+    if (result.error.empty()) {
+      result.error = run.error;
+    }
+  }
+  return result;
+}
+
+json toBaselineEntry(const perf::ScenarioResult &result, const json &previous) {
+  json entry = previous.is_object() ? previous : json::object();
+  entry["ticksPerSecond"] = result.ticksPerSecond;
+  entry["allocationsPerFrame"] = result.allocationsPerFrame;
+  entry["p99FrameMs"] = result.p99FrameMs;
+  entry["meanFrameMs"] = result.meanFrameMs;
+  json systems = json::object();
+  for (const auto &[name, ms] : result.systemMeanMs) {
+    systems[name] = ms;
+  }
+  if (!systems.empty()) {
+    entry["systems"] = systems;
+  }
+  return entry;
+}
+
+bool parseArgs(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto next = [&](std::string &out) {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << arg << std::endl;
+        return false;
+      }
+      out = argv[++i];
+      return true;
+    };
+    if (arg == "--scenario") {
+      std::string name;
+      if (!next(name)) {
+        return false;
+      }
+      options.scenarios.push_back(name);
+    } else if (arg == "--baseline") {
+      if (!next(options.baselinePath)) {
+        return false;
+      }
+    } else if (arg == "--assets") {
+      if (!next(options.assetsDir)) {
+        return false;
+      }
+    } else if (arg == "--ticks") {
+      std::string ticks;
+      if (!next(ticks)) {
+        return false;
+      }
+      options.ticks = std::atoi(ticks.c_str());
+      if (options.ticks <= 0) {
+        std::cerr << "--ticks must be positive" << std::endl;
+        return false;
+      }
+    } else if (arg == "--repeat") {
+      std::string repeats;
+      if (!next(repeats)) {
+        return false;
+      }
+      options.repeats = std::atoi(repeats.c_str());
+      if (options.repeats <= 0) {
+        std::cerr << "--repeat must be positive" << std::endl;
+        return false;
+      }
+    } else if (arg == "--update-baseline") {
+      options.updateBaseline = true;
+    } else if (arg == "--list") {
+      options.list = true;
+    } else {
+      std::cerr << "Unknown argument: " << arg << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  if (!parseArgs(argc, argv, options)) {
+    return 2;
+  }
+
+  const auto &scenarios = perf::getScenarios();
+  if (options.list) {
+    for (const auto &scenario : scenarios) {
+      std::printf("%-24s %s\n", scenario.name.c_str(),
+                  scenario.description.c_str());
+    }
+    return 0;
+  }
+
+  std::vector<const perf::Scenario *> selected;
+  for (const auto &scenario : scenarios) {
+    bool wanted = options.scenarios.empty();
+    for (const auto &name : options.scenarios) {
+      wanted |= (name == scenario.name);
+    }
+    if (wanted) {
+      selected.push_back(&scenario);
+    }
+  }
+  if (selected.size() <
+      (options.scenarios.empty() ? scenarios.size() : options.scenarios.size())) {
+    std::cerr << "[PerfGate] Unknown scenario requested; use --list"
+              << std::endl;
+    return 2;
+  }
+
+  json baseline = json::object();
+  {
+    std::ifstream file(options.baselinePath);
+    if (file.is_open()) {
+      try {
+        baseline = json::parse(file);
+      } catch (const std::exception &e) {
+        std::cerr << "[PerfGate] Failed to parse " << options.baselinePath
+                  << ": " << e.what() << std::endl;
+        return 2;
+      }
+    } else if (!options.updateBaseline) {
+      std::cerr << "[PerfGate] Baseline not found: " << options.baselinePath
+                << std::endl;
+      return 2;
+    }
+  }
+  if (!baseline.contains("scenarios")) {
+    baseline["scenarios"] = json::object();
+  }
+  Tolerances defaults;
+  readTolerances(baseline.value("tolerances", json::object()), defaults);
+  if (!baseline.contains("tolerances")) {
+    baseline["tolerances"] = {
+        {"ticksPerSecond", defaults.ticksPerSecond},
+        {"allocationsPerFrame", defaults.allocationsPerFrame},
+        {"allocationSlack", defaults.allocationSlack},
+        {"p99FrameMs", defaults.p99FrameMs}};
+  }
+
+  // The game logs heavily, some of it at ERROR (CollisionSystem reports every
+  // player-duck contact); keep the gate output readable and the log calls
+  // out of the frame times. Scenarios report failures through
+  // ScenarioResult::error.
+  SDL_SetLogPriorities(SDL_LOG_PRIORITY_CRITICAL);
+  if (!perf::initializeHeadlessWorld(options.assetsDir)) {
+    std::cerr << "[PerfGate] Failed to initialize world from "
+              << options.assetsDir << std::endl;
+    return 2;
+  }
+
+  bool allPassed = true;
+  for (const perf::Scenario *selectedScenario : selected) {
+    perf::Scenario scenario = *selectedScenario;
+    if (options.ticks > 0) {
+      scenario.measuredTicks = options.ticks;
+    }
+    const int repeats =
+        options.repeats > 0 ? options.repeats : scenario.repeats;
+    perf::ScenarioResult result = runRepeated(scenario, repeats);
+    std::printf("[PerfGate] %s: %d ticks, %.1f ticks/sec, %.2f allocs/frame, "
+                "p99 %.3f ms%s\n",
+                result.name.c_str(), result.ticks, result.ticksPerSecond,
+                result.allocationsPerFrame, result.p99FrameMs,
+                repeats > 1 ? (" (median of " + std::to_string(repeats) +
+                               " runs)").c_str()
+                            : "");
+    if (scenario.soak) {
+      std::printf("  soak: %+lld live allocations, frame time drift %+.1f%% "
+                  "(last vs first 10%% of ticks)\n",
+                  static_cast<long long>(result.liveAllocations),
+                  result.frameDriftPercent);
+    }
+    for (const auto &[name, value] : result.counters) {
+      std::printf("  %-26s %12.3f\n", name.c_str(), value);
+    }
+    if (!result.error.empty()) {
+      std::printf("  FAILED: %s\n", result.error.c_str());
+      allPassed = false;
+      if (options.updateBaseline) {
+        continue;
+      }
+    }
+
+    json &entries = baseline["scenarios"];
+    if (options.updateBaseline) {
+      entries[result.name] =
+          toBaselineEntry(result, entries.value(result.name, json::object()));
+      continue;
+    }
+    if (!entries.contains(result.name)) {
+      std::printf("  no baseline entry; run with --update-baseline to record "
+                  "one\n");
+      continue;
+    }
+    allPassed &= compare(result, entries[result.name], defaults);
+  }
+
+  if (options.updateBaseline) {
+    std::ofstream out(options.baselinePath);
+    if (!out.is_open()) {
+      std::cerr << "[PerfGate] Cannot write " << options.baselinePath
+                << std::endl;
+      return 2;
+    }
+    out << baseline.dump(2) << std::endl;
+    std::printf("[PerfGate] Baseline written to %s\n",
+                options.baselinePath.c_str());
+    return allPassed ? 0 : 1;
+  }
+
+  std::printf("[PerfGate] %s\n", allPassed ? "PASSED" : "FAILED");
+  return allPassed ? 0 : 1;
+}
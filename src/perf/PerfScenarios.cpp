@@ -0,0 +1,1648 @@
+#include "PerfScenarios.hpp"
+#include "game/GameWorld.hpp"
+#include "game/Timer.hpp"
+#include "game/RoomHost.hpp"
+#include "game/WorldStreamer.hpp"
+#include "game/audio/AudioMixer.hpp"
+#include "game/diagnostics/AllocationCounter.hpp"
+#include "game/diagnostics/GameplayJournal.hpp"
+#include "game/diagnostics/MetricsRecorder.hpp"
+#include "game/diagnostics/Replay.hpp"
+#include "game/diagnostics/StartupProfiler.hpp"
+#include "game/ecs/components/Expirable.hpp"
+#include "game/ecs/components/Hierarchy.hpp"
+#include "game/ecs/components/Projectile.hpp"
+#include "game/ecs/components/ShootRequest.hpp"
+#include "game/ecs/components/Tags.hpp"
+#include "game/ecs/Random.hpp"
+#include "game/ecs/SimulationLod.hpp"
+#include "game/ecs/SpatialQuery.hpp"
+#include "game/ecs/Tweener.hpp"
+#include "game/ecs/components/Target.hpp"
+#include "game/ecs/ParticleEmitter.hpp"
+#include "game/events/KeyboardEvent.hpp"
+#include "game/net/ClientPrediction.hpp"
+#include "game/net/PlayerInput.hpp"
+#include "game/net/RegionNode.hpp"
+#include "game/net/SnapshotClient.hpp"
+#include "game/net/SnapshotServer.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+namespace perf {
+
+using namespace game;
+using namespace game::ecs;
+
+namespace {
+
+constexpr float FIXED_DT = 1.0f / 60.0f;
+constexpr uint64_t WORLD_SEED = 1234; // Same spawns in every run
+
+SDL_Surface *offscreenSurface = nullptr;
+SDL_Renderer *offscreenRenderer = nullptr;
+std::string headlessAssetsDir; // Rooms load their own copy of the world
+
+// Starting state of an entity loaded from GameData.json
+struct LoadedPose {
+  Entity entity;
+  Vector2 position;
+  float rotation = 0.0f;
+  Vector2 velocity;
+};
+std::vector<LoadedPose> loadedPoses;
+
+/**
+ * Create a duck the same way TargetSpawnSystem does, at a fixed position so
+ * every run sees the same workload.
+ */
+Entity spawnDuck(float x, float y) {
+  auto &cm = ComponentManager::getInstance();
+  auto &sm = SystemManager::getInstance();
+
+  Entity duck = Entity::create("perf_duck");
+  sm.onEntityCreated(duck);
+  ComponentManager::Batch batch(cm);
+
+  cm.addComponent<components::Transform>(duck, Vector2(x, y));
+  cm.addComponent<components::Sprite>(duck, 48.0f, 48.0f,
+                                      SDL_Color{255, 255, 0, 255});
+  cm.addComponent<components::Images>(duck,
+                                      std::vector<std::string>{"pawn1.png"});
+  cm.addComponent<components::Movement>(duck, Vector2(30.0f, 0.0f));
+  cm.addComponent<components::Target>(duck, 10, "duck");
+  cm.addComponent<components::Collision>(duck);
+  cm.addComponent<components::Expirable>(duck);
+  return duck;
+}
+
+/**
+ * Lay ducks out on a grid inside [x0,x1]x[y0,y1].
+ */
+void spawnDuckGrid(int count, float x0, float y0, float x1, float y1) {
+  int columns = static_cast<int>(std::ceil(std::sqrt(count)));
+  int rows = (count + columns - 1) / columns;
+  for (int i = 0; i < count; ++i) {
+    float u = columns > 1 ? static_cast<float>(i % columns) / (columns - 1) : 0.5f;
+    float v = rows > 1 ? static_cast<float>(i / columns) / (rows - 1) : 0.5f;
+    spawnDuck(x0 + u * (x1 - x0), y0 + v * (y1 - y0));
+  }
+}
+
+/**
+ * Keep a benchmark result alive so the optimizer cannot drop the loop that
+ * computed it.
+ */
+template <typename T> void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(value) : "memory");
+#else
+  static volatile T sink;
+  sink = value;
+  static_cast<void>(sink);
+#endif
+}
+
+Entity findPlayer() {
+  auto players =
+      ComponentManager::getInstance().getEntitiesWithComponent<components::Player>();
+  return players.empty() ? Entity() : players.front();
+}
+
+std::vector<Entity> microEntities;
+WorldStreamer sceneStreamer;
+std::vector<float> tweenValues;
+audio::AudioMixer benchMixer(64);
+std::vector<float> mixBuffer;
+std::vector<float> randomValues;
+
+// Boxes for the spatial query scenarios: a 2400x1600 field of 24x24 boxes
+constexpr size_t SPATIAL_BOXES = 4096;
+constexpr int SPATIAL_QUERIES = 256;
+std::vector<Entity> spatialEntities;
+std::vector<float> spatialLeft, spatialTop, spatialRight, spatialBottom;
+std::vector<uint32_t> spatialLayers;
+
+void setupSpatialBoxes() {
+  RandomStream &random = RandomService::getInstance().stream("PerfGate");
+  random.reseed(90);
+  spatialEntities.assign(SPATIAL_BOXES, Entity());
+  spatialLeft.resize(SPATIAL_BOXES);
+  spatialTop.resize(SPATIAL_BOXES);
+  spatialRight.resize(SPATIAL_BOXES);
+  spatialBottom.resize(SPATIAL_BOXES);
+  spatialLayers.resize(SPATIAL_BOXES);
+  for (size_t i = 0; i < SPATIAL_BOXES; ++i) {
+    spatialLeft[i] = random.range(0.0f, 2400.0f);
+    spatialTop[i] = random.range(0.0f, 1600.0f);
+    spatialRight[i] = spatialLeft[i] + 24.0f;
+    spatialBottom[i] = spatialTop[i] + 24.0f;
+    spatialLayers[i] = i % 4 == 0 ? SpatialQuery::LAYER_PROJECTILE
+                                  : SpatialQuery::LAYER_TARGET;
+  }
+  SpatialQuery::getInstance().rebuild(
+      spatialEntities.data(), spatialLeft.data(), spatialTop.data(),
+      spatialRight.data(), spatialBottom.data(), spatialLayers.data(),
+      SPATIAL_BOXES);
+}
+
+// Query point i of a tick, the same for the grid and the linear scan
+Vector2 spatialQueryPoint(int tick, int i) {
+  return Vector2(static_cast<float>((tick * 37 + i * 613) % 2400),
+                 static_cast<float>((tick * 53 + i * 389) % 1600));
+}
+
+// Loopback server and clients for the net_clients_* scenarios
+constexpr int NET_WARMUP_TICKS = 30;
+std::unique_ptr<net::SnapshotServer> netServer;
+std::vector<std::unique_ptr<net::SnapshotClient>> netClients;
+net::SnapshotServer::Stats netWarmupStats;
+double netServerNs = 0.0;
+uint64_t netMismatches = 0;
+
+/**
+ * Server and clients exchanging snapshots of a busy match (64 ducks, bot
+ * firing) over 127.0.0.1. Each tick the clients receive and acknowledge the
+ * previous snapshot, check it against the server's copy and the server sends
+ * the next one. Bandwidth and server tick time cover the measured ticks.
+ */
+Scenario makeNetScenario(int clients) {
+  Scenario scenario;
+  scenario.name = "net_clients_" + std::to_string(clients);
+  scenario.description = "Snapshot server streaming a 64-duck match to " +
+                         std::to_string(clients) + " loopback UDP client" +
+                         (clients == 1 ? "" : "s");
+  scenario.warmupTicks = NET_WARMUP_TICKS;
+  scenario.measuredTicks = 300;
+  scenario.setup = [clients] {
+    spawnDuckGrid(64, 40.0f, 20.0f, 760.0f, 300.0f);
+    GameWorld::getInstance().enableBot();
+    netServer = std::make_unique<net::SnapshotServer>(clients);
+    netServer->start(0, true);
+    netClients.clear();
+    for (int i = 0; i < clients; ++i) {
+      netClients.push_back(std::make_unique<net::SnapshotClient>());
+      netClients.back()->connect(net::Address::loopback(netServer->getPort()));
+    }
+    netServerNs = 0.0;
+    netMismatches = 0;
+  };
+  scenario.tick = [](int tick) {
+    for (const auto &client : netClients) {
+      if (client->poll() > 0) {
+        const net::WorldSnapshot *received = client->getLatest();
+        const net::WorldSnapshot *sent = netServer->getSnapshot(received->tick);
+        if (!sent || *sent != *received) {
+          ++netMismatches;
+        }
+      }
+    }
+    if (tick == NET_WARMUP_TICKS) {
+      netWarmupStats = netServer->getStats();
+      netServerNs = 0.0;
+    }
+    auto start = std::chrono::steady_clock::now();
+    netServer->tick();
+    netServerNs += std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  };
+  scenario.finish = [clients](ScenarioResult &result) {
+    const auto &stats = netServer->getStats();
+    const double clientTicks = static_cast<double>(clients) * result.ticks;
+    const double bytesPerClientTick =
+        (stats.bytesSent - netWarmupStats.bytesSent) / clientTicks;
+    uint64_t decoded = 0;
+    for (const auto &client : netClients) {
+      decoded += client->getStats().snapshotsDecoded;
+    }
+    result.counters.emplace_back("connected clients",
+                                 static_cast<double>(netServer->getClientCount()));
+    result.counters.emplace_back("bytes/client/tick", bytesPerClientTick);
+    result.counters.emplace_back("kbit/s per client at 60Hz",
+                                 bytesPerClientTick * 8.0 * 60.0 / 1000.0);
+    result.counters.emplace_back(
+        "full snapshots", static_cast<double>(stats.fullSnapshots -
+                                              netWarmupStats.fullSnapshots));
+    result.counters.emplace_back("server tick ms",
+                                 netServerNs / result.ticks / 1.0e6);
+    result.counters.emplace_back("snapshots decoded",
+                                 static_cast<double>(decoded));
+
+    if (netServer->getClientCount() != static_cast<size_t>(clients)) {
+      result.error = "only " + std::to_string(netServer->getClientCount()) +
+                     " of " + std::to_string(clients) + " clients connected";
+    } else if (netMismatches > 0) {
+      result.error = std::to_string(netMismatches) +
+                     " decoded snapshots differ from the server's";
+    } else if (decoded < static_cast<uint64_t>(clients) * result.ticks) {
+      result.error = "clients decoded " + std::to_string(decoded) +
+                     " snapshots, expected at least " +
+                     std::to_string(clients * result.ticks);
+    }
+
+    for (const auto &client : netClients) {
+      client->disconnect();
+    }
+    netClients.clear();
+    netServer->stop();
+    netServer.reset();
+  };
+  return scenario;
+}
+
+// Client prediction for the rollback_resim scenario
+constexpr uint32_t ROLLBACK_TICKS = 16;
+std::unique_ptr<net::ClientPrediction> prediction;
+
+/**
+ * Worst case for ClientPrediction: every tick the "server" disagrees about
+ * the player ROLLBACK_TICKS ticks back, so 1024 ducks, their movement and
+ * the player are rewound and re-simulated that many ticks, on top of the
+ * normal world update.
+ */
+Scenario makeRollbackScenario() {
+  Scenario scenario;
+  scenario.name = "rollback_resim";
+  scenario.description = "1024 ducks rewound and re-simulated " +
+                         std::to_string(ROLLBACK_TICKS) +
+                         " ticks every tick (client prediction worst case)";
+  scenario.warmupTicks = 20;
+  scenario.measuredTicks = 120;
+  scenario.setup = [] {
+    spawnDuckGrid(1024, 10.0f, 10.0f, 790.0f, 420.0f);
+    auto &sm = SystemManager::getInstance();
+    net::ClientPrediction::Config config;
+    config.tickSeconds = FIXED_DT;
+    config.maxRollbackTicks = ROLLBACK_TICKS;
+    config.budgetMs = 1000.0 * FIXED_DT; // A whole frame
+    // Predict the whole dynamic world, not just the player
+    prediction = std::make_unique<net::ClientPrediction>(
+        findPlayer(),
+        std::vector<System *>{sm.getSystem<systems::PlayerControlSystem>(),
+                              sm.getSystem<systems::DuckMovementSystem>(),
+                              sm.getSystem<systems::MovementSystem>()},
+        config);
+    prediction->getRollbackBuffer().registerComponent<components::Movement>();
+  };
+  scenario.tick = [](int tick) {
+    // Client tick n is the world update that follows scenario tick n - 1
+    const uint32_t current = static_cast<uint32_t>(tick);
+    if (current > 0) {
+      prediction->saveState();
+    }
+    if (current > ROLLBACK_TICKS) {
+      const net::EntityState *predicted =
+          prediction->getPredicted(current - ROLLBACK_TICKS);
+      if (predicted) {
+        net::EntityState authoritative = *predicted;
+        authoritative.fields[net::EntityState::X] +=
+            net::WorldSnapshot::POSITION_SCALE;
+        prediction->reconcile(current - ROLLBACK_TICKS, authoritative);
+      }
+    }
+    const uint8_t input =
+        ((tick / 60) % 2 ? net::INPUT_LEFT : net::INPUT_RIGHT) |
+        ((tick / 45) % 2 ? net::INPUT_UP : net::INPUT_DOWN);
+    prediction->applyInput(current + 1, input);
+  };
+  scenario.finish = [](ScenarioResult &result) {
+    const auto &stats = prediction->getStats();
+    const uint64_t replays = stats.corrections - stats.snaps;
+    result.counters.emplace_back("corrections",
+                                 static_cast<double>(stats.corrections));
+    result.counters.emplace_back("snaps", static_cast<double>(stats.snaps));
+    result.counters.emplace_back("worst resim ticks",
+                                 static_cast<double>(stats.worstResimulatedTicks));
+    result.counters.emplace_back(
+        "mean resim ms",
+        replays > 0 ? stats.totalResimulationMs / replays : 0.0);
+    result.counters.emplace_back("worst resim ms", stats.worstResimulationMs);
+    result.counters.emplace_back(
+        "components saved/tick",
+        static_cast<double>(prediction->getRollbackBuffer().getLastSaveSize()));
+    if (replays == 0) {
+      result.error = "no correction was re-simulated";
+    }
+    prediction.reset();
+  };
+  return scenario;
+}
+
+// Room host for the rooms_16 scenario
+constexpr size_t HOSTED_ROOMS = 16;
+std::unique_ptr<RoomHost> roomHost;
+
+/**
+ * A multi-room server's tick: 16 independent worlds, each with a bot playing,
+ * stepped together on up to four shard threads. Frame time is the wall time
+ * of one step of every room.
+ */
+Scenario makeRoomsScenario() {
+  Scenario scenario;
+  scenario.name = "rooms_" + std::to_string(HOSTED_ROOMS);
+  scenario.description = std::to_string(HOSTED_ROOMS) +
+                         " bot-played rooms stepped on up to 4 shard threads";
+  scenario.runsWorld = false;
+  scenario.warmupTicks = 20;
+  scenario.measuredTicks = 300;
+  scenario.setup = [] {
+    RoomHost::Config config;
+    config.shardCount =
+        std::min(4u, std::max(1u, std::thread::hardware_concurrency()));
+    config.tickRateHz = 0.0; // Stepped by the scenario
+    roomHost = std::make_unique<RoomHost>(config);
+    for (size_t i = 0; i < HOSTED_ROOMS; ++i) {
+      RoomHost::RoomId id = roomHost->createRoom(headlessAssetsDir);
+      roomHost->withRoom(id, [i](WorldInstance &room) {
+        RandomService::getInstance().setSeed(WORLD_SEED + i);
+        room.getGameWorld().enableBot();
+      });
+    }
+    roomHost->start();
+  };
+  scenario.tick = [](int) { roomHost->step(); };
+  scenario.finish = [](ScenarioResult &result) {
+    roomHost->stop();
+    const auto rooms = roomHost->getRoomStats();
+    uint64_t overruns = 0;
+    uint64_t fewestTicks = rooms.empty() ? 0 : rooms.front().ticks;
+    double meanMs = 0.0;
+    double worstMs = 0.0;
+    for (const auto &room : rooms) {
+      overruns += room.overruns;
+      fewestTicks = std::min(fewestTicks, room.ticks);
+      meanMs += room.meanTickMs / rooms.size();
+      worstMs = std::max(worstMs, room.worstTickMs);
+    }
+    result.counters.emplace_back(
+        "shards", static_cast<double>(roomHost->getShardCount()));
+    result.counters.emplace_back("room overruns",
+                                 static_cast<double>(overruns));
+    result.counters.emplace_back("mean room ms", meanMs);
+    result.counters.emplace_back("worst room ms", worstMs);
+    result.counters.emplace_back("migrations",
+                                 static_cast<double>(roomHost->rebalance()));
+    if (rooms.size() != HOSTED_ROOMS) {
+      result.error = std::to_string(rooms.size()) + " of " +
+                     std::to_string(HOSTED_ROOMS) + " rooms loaded";
+    } else if (fewestTicks < static_cast<uint64_t>(result.ticks)) {
+      result.error = "a room missed a step";
+    }
+    roomHost.reset();
+  };
+  return scenario;
+}
+
+// Region worlds for the regions_2x2 scenario, one node each
+constexpr size_t REGION_DUCKS = 64;
+std::vector<std::unique_ptr<WorldInstance>> regionWorlds;
+std::vector<std::unique_ptr<net::RegionNode>> regionNodes;
+
+/**
+ * A world split into a 2x2 grid of regions, each simulated by its own world
+ * and talking to the others over loopback UDP as separate processes would.
+ * Every region's ducks home on its own player, so they keep crossing
+ * borders, and bots shoot across them. Frame time covers all four world
+ * updates and node ticks.
+ */
+Scenario makeRegionsScenario() {
+  Scenario scenario;
+  scenario.name = "regions_2x2";
+  scenario.description = "World split over 4 region worlds with " +
+                         std::to_string(REGION_DUCKS) +
+                         " ducks each, handed off across borders";
+  scenario.runsWorld = false;
+  scenario.warmupTicks = 20;
+  scenario.measuredTicks = 300;
+  scenario.setup = [] {
+    for (size_t i = 0; i < 4; ++i) {
+      regionWorlds.push_back(std::make_unique<WorldInstance>());
+      WorldInstance &world = *regionWorlds.back();
+      if (!world.initialize(headlessAssetsDir)) {
+        continue;
+      }
+      WorldInstance::Scope scope(world);
+      RandomService::getInstance().setSeed(WORLD_SEED + i);
+      world.getGameWorld().enableBot();
+
+      net::RegionLayout layout;
+      layout.columns = 2;
+      layout.rows = 2;
+      layout.worldWidth = static_cast<float>(world.getGameWorld().getWorldWidth());
+      layout.worldHeight =
+          static_cast<float>(world.getGameWorld().getWorldHeight());
+      regionNodes.push_back(std::make_unique<net::RegionNode>(layout, i));
+      regionNodes.back()->start(0);
+
+      // This region's ducks, spread over its quarter of the world
+      float left, top, right, bottom;
+      layout.getBounds(i, left, top, right, bottom);
+      spawnDuckGrid(static_cast<int>(REGION_DUCKS), left + 30.0f, top + 30.0f,
+                    right - 30.0f, bottom - 30.0f);
+    }
+    for (auto &node : regionNodes) {
+      for (const auto &peer : regionNodes) {
+        node->setPeerPort(peer->getRegion(), peer->getPort());
+      }
+    }
+  };
+  scenario.tick = [](int) {
+    for (size_t i = 0; i < regionNodes.size(); ++i) {
+      WorldInstance::Scope scope(*regionWorlds[i]);
+      regionWorlds[i]->update(FIXED_DT);
+      regionNodes[i]->tick();
+    }
+  };
+  scenario.finish = [](ScenarioResult &result) {
+    // Let every handoff and hit in flight be delivered and acknowledged;
+    // without world updates nothing new leaves a region
+    for (int round = 0; round < 20; ++round) {
+      size_t pending = 0;
+      for (size_t i = 0; i < regionNodes.size(); ++i) {
+        WorldInstance::Scope scope(*regionWorlds[i]);
+        regionNodes[i]->tick();
+        pending += regionNodes[i]->getPendingCount();
+      }
+      if (pending == 0) {
+        break;
+      }
+    }
+
+    net::RegionNode::Stats total;
+    size_t owned = 0, ghosts = 0, pending = 0;
+    for (const auto &node : regionNodes) {
+      const auto &stats = node->getStats();
+      total.handoffsSent += stats.handoffsSent;
+      total.handoffsReceived += stats.handoffsReceived;
+      total.hitsSent += stats.hitsSent;
+      total.ghostsSent += stats.ghostsSent;
+      total.resends += stats.resends;
+      total.bytesSent += stats.bytesSent;
+      owned += node->getOwnedCount();
+      ghosts += node->getGhostCount();
+      pending += node->getPendingCount();
+    }
+    const double ticks = static_cast<double>(result.ticks);
+    result.counters.emplace_back("handoffs/tick", total.handoffsSent / ticks);
+    result.counters.emplace_back("ghosts/tick", total.ghostsSent / ticks);
+    result.counters.emplace_back("cross-border hits",
+                                 static_cast<double>(total.hitsSent));
+    result.counters.emplace_back("resends", static_cast<double>(total.resends));
+    result.counters.emplace_back("bytes/region/tick",
+                                 total.bytesSent / ticks / 4.0);
+    result.counters.emplace_back("owned at end", static_cast<double>(owned));
+    result.counters.emplace_back("ghosts at end", static_cast<double>(ghosts));
+
+    if (regionNodes.size() != 4) {
+      result.error = "region worlds failed to start";
+    } else if (total.handoffsSent == 0) {
+      result.error = "no entity crossed a border";
+    } else if (pending != 0 || total.handoffsReceived != total.handoffsSent) {
+      result.error = std::to_string(total.handoffsSent) + " handoffs sent, " +
+                     std::to_string(total.handoffsReceived) + " received";
+    }
+    regionNodes.clear();
+    regionWorlds.clear();
+  };
+  return scenario;
+}
+
+// Replay for the replay_seek scenario: two recorded minutes of bot play
+constexpr uint32_t REPLAY_TICKS = 60 * 120;
+const uint32_t REPLAY_CHECK_TICKS[] = {1, 1799, 4321, 7199};
+std::string replayPath;
+std::unique_ptr<WorldInstance> replayWorld;
+std::unique_ptr<diagnostics::ReplayPlayer> replayPlayer;
+std::vector<std::vector<uint8_t>> replayChecks; // Recorded at the check ticks
+bool replayOpen = false;
+
+/**
+ * Random seeks into a two-minute replay of a bot match: each tick restores
+ * the nearest keyframe and fast-simulates to the target. Frame time is seek
+ * latency; the counters give file size per minute and the worst seek. The
+ * world after seeking to a few ticks must match the recording byte for byte.
+ */
+Scenario makeReplayScenario() {
+  Scenario scenario;
+  scenario.name = "replay_seek";
+  scenario.description = "Random seeks into a 2 minute bot replay (keyframe "
+                         "restore plus fast-forward)";
+  scenario.runsWorld = false;
+  scenario.warmupTicks = 2;
+  scenario.measuredTicks = 60;
+  scenario.setup = [] {
+    replayPath = (std::filesystem::temp_directory_path() /
+                  "perfgate_replay_seek.rpl")
+                     .string();
+    replayChecks.assign(std::size(REPLAY_CHECK_TICKS), {});
+    {
+      WorldInstance recording;
+      if (!recording.initialize(headlessAssetsDir)) {
+        return;
+      }
+      WorldInstance::Scope scope(recording);
+      RandomService::getInstance().setSeed(WORLD_SEED);
+      recording.getGameWorld().enableBot();
+      diagnostics::ReplayRecorder recorder(replayPath, FIXED_DT);
+      for (uint32_t tick = 1; tick <= REPLAY_TICKS; ++tick) {
+        recording.update(FIXED_DT);
+        recorder.recordTick();
+        for (size_t i = 0; i < std::size(REPLAY_CHECK_TICKS); ++i) {
+          if (REPLAY_CHECK_TICKS[i] == tick) {
+            diagnostics::captureKeyframe(replayChecks[i]);
+          }
+        }
+      }
+    }
+    replayWorld = std::make_unique<WorldInstance>();
+    if (!replayWorld->initialize(headlessAssetsDir)) {
+      return;
+    }
+    WorldInstance::Scope scope(*replayWorld);
+    replayPlayer = std::make_unique<diagnostics::ReplayPlayer>();
+    replayOpen = replayPlayer->open(replayPath);
+  };
+  scenario.tick = [](int tick) {
+    if (!replayOpen) {
+      return;
+    }
+    WorldInstance::Scope scope(*replayWorld);
+    // Same spread of targets every run
+    const uint32_t target =
+        static_cast<uint32_t>((tick + 1) * 2654435761u) % REPLAY_TICKS;
+    replayPlayer->seek(target);
+  };
+  scenario.finish = [](ScenarioResult &result) {
+    size_t mismatches = 0;
+    if (replayOpen) {
+      WorldInstance::Scope scope(*replayWorld);
+      const auto &stats = replayPlayer->getStats();
+      result.counters.emplace_back("KB/minute",
+                                   replayPlayer->getBytesPerMinute() / 1024.0);
+      result.counters.emplace_back(
+          "keyframes", static_cast<double>(replayPlayer->getKeyframeCount()));
+      result.counters.emplace_back("worst seek ms", stats.worstSeekMs);
+      result.counters.emplace_back("worst seek ticks",
+                                   static_cast<double>(stats.worstSeekTicks));
+
+      std::vector<uint8_t> state;
+      for (size_t i = 0; i < std::size(REPLAY_CHECK_TICKS); ++i) {
+        replayPlayer->seek(REPLAY_CHECK_TICKS[i]);
+        state.clear();
+        diagnostics::captureKeyframe(state);
+        mismatches += state != replayChecks[i] ? 1 : 0;
+      }
+    }
+
+    if (!replayOpen) {
+      result.error = "replay could not be recorded or opened";
+    } else if (mismatches != 0) {
+      result.error = std::to_string(mismatches) +
+                     " seeks did not reproduce the recorded world";
+    }
+    replayPlayer.reset();
+    replayWorld.reset();
+    replayChecks.clear();
+    replayOpen = false;
+    std::error_code ignored;
+    std::filesystem::remove(replayPath, ignored);
+  };
+  return scenario;
+}
+
+// Extra ducks on top of TargetSpawnSystem's so the bot is always busy
+void keepBotBusy(int tick) {
+  if (tick % 45 != 0) {
+    return;
+  }
+  RandomStream &random = RandomService::getInstance().stream("PerfGate");
+  auto &world = GameWorld::getInstance();
+  spawnDuck(random.range(0.0f, world.getWorldWidth() - 48.0f),
+            random.range(0.0f, world.getWorldHeight() * 0.6f));
+}
+
+size_t tagMatches = 0; // Bosses found by micro_tag_filter's last tick
+
+// Journal files for the journal_* scenarios
+constexpr uint64_t JOURNAL_RECORDS = 1000000;
+std::string journalPath;
+uint64_t journalAnalyzed = 0; // Records read by journal_analyze_1m
+bool journalAnalyzeOk = true;
+
+std::string tempJournalPath(const char *name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+/**
+ * The bot plays with the gameplay journal open, so the frame time includes
+ * recording every spawn, shot, hit, miss and expiry. The journal is then
+ * read back: nothing may have been dropped, and every shot must be
+ * accounted for as a hit, a miss or a projectile still in flight.
+ */
+Scenario makeJournalBotScenario() {
+  Scenario scenario;
+  scenario.name = "journal_bot";
+  scenario.description = "Bot plays full rounds with the gameplay journal "
+                         "recording";
+  scenario.measuredTicks = 3600;
+  scenario.setup = [] {
+    auto &world = GameWorld::getInstance();
+    world.enableBot();
+    journalPath = tempJournalPath("perfgate_journal_bot.gjr");
+    diagnostics::GameplayJournal::getInstance().open(
+        journalPath, static_cast<float>(world.getWorldWidth()),
+        static_cast<float>(world.getWorldHeight()));
+  };
+  scenario.tick = keepBotBusy;
+  scenario.finish = [](ScenarioResult &result) {
+    auto &journal = diagnostics::GameplayJournal::getInstance();
+    const bool opened = journal.isOpen();
+    journal.close();
+    const uint64_t dropped = journal.getDroppedCount();
+
+    diagnostics::JournalReport report;
+    std::string error;
+    const bool analyzed = opened && diagnostics::GameplayJournal::analyze(
+                                        journalPath, 8, 6, report, &error);
+    auto count = [&report](diagnostics::JournalEvent event) {
+      return report.counts[static_cast<size_t>(event)];
+    };
+    const uint64_t shots = count(diagnostics::JournalEvent::SHOT);
+    const uint64_t hits = count(diagnostics::JournalEvent::HIT);
+    const uint64_t misses = count(diagnostics::JournalEvent::MISS);
+    const size_t inFlight = ComponentManager::getInstance()
+                                .getEntitiesWithComponent<
+                                    components::Projectile>()
+                                .size();
+    result.counters.emplace_back("records/tick",
+                                 report.records /
+                                     static_cast<double>(result.ticks));
+    result.counters.emplace_back("hits", static_cast<double>(hits));
+    result.counters.emplace_back("misses", static_cast<double>(misses));
+    result.counters.emplace_back("waves",
+                                 static_cast<double>(report.waves.size()));
+
+    if (!opened) {
+      result.error = "journal could not be opened";
+    } else if (!analyzed) {
+      result.error = error;
+    } else if (dropped != 0) {
+      result.error = std::to_string(dropped) + " journal records dropped";
+    } else if (hits == 0) {
+      result.error = "the bot hit nothing";
+    } else if (shots != hits + misses + inFlight) {
+      result.error = std::to_string(shots) + " shots journaled, " +
+                     std::to_string(hits + misses) + " resolved, " +
+                     std::to_string(inFlight) + " in flight";
+    }
+    std::error_code ignored;
+    std::filesystem::remove(journalPath, ignored);
+  };
+  return scenario;
+}
+
+/**
+ * Offline analysis throughput: each tick runs GameplayJournal::analyze()
+ * (what JournalAnalyzer does) over a synthetic journal of a million
+ * records shaped like a long session: rounds of spawns, shots and hits
+ * spread across the world.
+ */
+Scenario makeJournalAnalyzeScenario() {
+  Scenario scenario;
+  scenario.name = "journal_analyze_1m";
+  scenario.description = "Analyze a 1M record gameplay journal (heatmap, "
+                         "time-to-kill, per-wave)";
+  scenario.runsWorld = false;
+  scenario.warmupTicks = 1;
+  scenario.measuredTicks = 10;
+  scenario.setup = [] {
+    using diagnostics::JournalEvent;
+    journalPath = tempJournalPath("perfgate_journal_1m.gjr");
+    journalAnalyzed = 0;
+    journalAnalyzeOk = true;
+
+    // Written directly rather than through GameplayJournal so the file does
+    // not depend on a world running
+    std::FILE *file = std::fopen(journalPath.c_str(), "wb");
+    if (!file) {
+      journalAnalyzeOk = false;
+      return;
+    }
+    diagnostics::JournalFileHeader header;
+    header.recordSize = sizeof(diagnostics::JournalRecord);
+    header.worldWidth = 800.0f;
+    header.worldHeight = 600.0f;
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    RandomStream random(WORLD_SEED);
+    std::vector<diagnostics::JournalRecord> records(4096);
+    diagnostics::JournalRecord record;
+    uint64_t nextDuck = 1;
+    bool duckHit = false;
+    uint64_t written = 0;
+    while (written < JOURNAL_RECORDS) {
+      for (auto &slot : records) {
+        // A new wave every 2000 records; each duck draws two shots and is
+        // hit by one of them or flies off
+        const uint64_t index = written + (&slot - records.data());
+        record.time += 0.05;
+        record.wave = static_cast<uint16_t>(index / 2000 + 1);
+        record.x = random.range(0.0f, header.worldWidth);
+        record.y = random.range(0.0f, header.worldHeight);
+        record.detail = 0;
+        switch (index % 6) {
+        case 0:
+          record.event = static_cast<uint8_t>(JournalEvent::SPAWN);
+          record.entity = nextDuck++;
+          duckHit = false;
+          break;
+        case 1:
+        case 3:
+          record.event = static_cast<uint8_t>(JournalEvent::SHOT);
+          break;
+        case 5:
+          record.event = static_cast<uint8_t>(duckHit ? JournalEvent::SHOT
+                                                      : JournalEvent::EXPIRE);
+          record.entity = nextDuck - 1;
+          break;
+        default: {
+          const bool hit = !duckHit && random.range(0.0f, 1.0f) < 0.4f;
+          duckHit = duckHit || hit;
+          record.event = static_cast<uint8_t>(hit ? JournalEvent::HIT
+                                                  : JournalEvent::MISS);
+          record.entity = nextDuck - 1;
+          break;
+        }
+        }
+        slot = record;
+      }
+      std::fwrite(records.data(), sizeof(diagnostics::JournalRecord),
+                  records.size(), file);
+      written += records.size();
+    }
+    std::fclose(file);
+  };
+  scenario.tick = [](int) {
+    if (!journalAnalyzeOk) {
+      return;
+    }
+    diagnostics::JournalReport report;
+    journalAnalyzeOk =
+        diagnostics::GameplayJournal::analyze(journalPath, 8, 6, report);
+    journalAnalyzed += report.records;
+  };
+  scenario.finish = [](ScenarioResult &result) {
+    result.counters.emplace_back("M records/s",
+                                 result.meanFrameMs > 0.0
+                                     ? JOURNAL_RECORDS / result.meanFrameMs /
+                                           1000.0
+                                     : 0.0);
+    if (!journalAnalyzeOk || journalAnalyzed == 0) {
+      result.error = "journal could not be written or analyzed";
+    }
+    std::error_code ignored;
+    std::filesystem::remove(journalPath, ignored);
+  };
+  return scenario;
+}
+
+std::unique_ptr<diagnostics::MetricsRecorder> metricsRecorder;
+std::unique_ptr<Timer> metricsTimer;
+std::string metricsPath;
+double metricsOffNs = 0.0;    // World updates without a recorded frame
+double metricsOnNs = 0.0;     // World updates followed by recordFrame()
+double metricsRecordNs = 0.0; // recordFrame() alone
+
+/**
+ * Cost of --metrics: every tick runs two world updates, one followed by
+ * MetricsRecorder::recordFrame() and one without, in alternating order so
+ * both see the same caches and the same load on the host. Fails if
+ * recordFrame() takes more than 1% of a frame.
+ */
+Scenario makeMetricsOverheadScenario() {
+  Scenario scenario;
+  scenario.name = "metrics_overhead";
+  scenario.description = "World frames with and without the per-frame "
+                         "metrics recorder, interleaved";
+  scenario.runsWorld = false;
+  scenario.setup = [] {
+    metricsOffNs = metricsOnNs = metricsRecordNs = 0.0;
+    metricsPath = tempJournalPath("perfgate_metrics.fmet");
+    metricsTimer = std::make_unique<Timer>(60);
+    metricsRecorder =
+        std::make_unique<diagnostics::MetricsRecorder>(metricsPath);
+  };
+  scenario.tick = [](int tick) {
+    using Clock = std::chrono::steady_clock;
+    auto nanoseconds = [](Clock::duration d) {
+      return static_cast<double>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    };
+    auto &world = GameWorld::getInstance();
+    const bool measured = tick >= 30;
+    for (int pass = 0; pass < 2; ++pass) {
+      const bool record = (pass + tick) % 2 == 0;
+      auto start = Clock::now();
+      metricsTimer->startFrame();
+      world.update(FIXED_DT);
+      auto updated = Clock::now();
+      if (record) {
+        metricsRecorder->recordFrame(*metricsTimer);
+      }
+      auto end = Clock::now();
+      if (!measured) {
+        continue;
+      }
+      (record ? metricsOnNs : metricsOffNs) += nanoseconds(end - start);
+      if (record) {
+        metricsRecordNs += nanoseconds(end - updated);
+      }
+    }
+  };
+  scenario.finish = [](ScenarioResult &result) {
+    const bool recording = metricsRecorder && metricsRecorder->isRecording();
+    metricsRecorder.reset();
+    metricsTimer.reset();
+    const double frames = static_cast<double>(result.ticks);
+    const double recordShare =
+        metricsOffNs > 0.0 ? metricsRecordNs / metricsOffNs * 100.0 : 0.0;
+    result.counters.emplace_back("recordFrame ns",
+                                 frames > 0.0 ? metricsRecordNs / frames : 0.0);
+    result.counters.emplace_back("recordFrame % of frame", recordShare);
+    result.counters.emplace_back(
+        "frame overhead %",
+        metricsOffNs > 0.0 ? (metricsOnNs / metricsOffNs - 1.0) * 100.0 : 0.0);
+    if (!recording) {
+      result.error = "metrics capture could not be opened";
+    } else if (recordShare > 1.0) {
+      result.error = "recordFrame() took more than 1% of a frame";
+    }
+    std::error_code ignored;
+    std::filesystem::remove(metricsPath, ignored);
+  };
+  return scenario;
+}
+
+size_t startupWorlds = 0;   // Worlds that initialized
+size_t startupPhases = 0;   // Phases the profiler saw in the last tick
+
+/**
+ * The world half of startup: parse GameData.json and load its entities into a
+ * fresh world, once per tick, with the StartupProfiler recording as it does
+ * during GameEngine::init(). Window, renderer, font and image upload need a
+ * display and stay out of the measurement.
+ */
+Scenario makeStartupWorldScenario() {
+  Scenario scenario;
+  scenario.name = "startup_world_init";
+  scenario.description =
+      "Parse GameData.json and load the world into a fresh WorldInstance";
+  scenario.runsWorld = false;
+  scenario.warmupTicks = 2;
+  scenario.measuredTicks = 30;
+  scenario.tick = [](int) {
+    auto &startup = diagnostics::StartupProfiler::getInstance();
+    startup.start();
+    {
+      WorldInstance world;
+      if (world.initialize(headlessAssetsDir)) {
+        ++startupWorlds;
+      }
+    }
+    startup.finishFirstFrame();
+    startupPhases = startup.getPhases().size();
+  };
+  scenario.finish = [](ScenarioResult &result) {
+    result.counters.emplace_back("phases", static_cast<double>(startupPhases));
+    if (startupWorlds == 0 || startupPhases == 0) {
+      result.error = "world did not initialize or no phases were recorded";
+    }
+  };
+  return scenario;
+}
+
+ParticleEmitter benchParticles;
+bool particlesOverCap = false;
+
+// One-shot float tween that starts over from its completion callback
+void startValueTween(size_t index) {
+  auto &tweener = Tweener::getInstance();
+  Tweener::TweenId id =
+      tweener.tween(&tweenValues[index], 0.0f, 1.0f,
+                    0.25f + (index % 5) * 0.1f, Easing::OutBack);
+  tweener.onComplete(id, [index](Tweener::TweenId) { startValueTween(index); });
+}
+
+std::vector<Scenario> buildScenarios() {
+  std::vector<Scenario> scenarios;
+
+  Scenario idle;
+  idle.name = "world_idle";
+  idle.description = "GameData.json world with no extra entities";
+  // Ticks are ~0.1 ms, so a single run is at the mercy of the scheduler
+  idle.repeats = 5;
+  scenarios.push_back(idle);
+
+  Scenario ducks256;
+  ducks256.name = "ducks_256";
+  ducks256.description = "256 ducks homing on the player across the world";
+  ducks256.warmupTicks = 10;
+  ducks256.measuredTicks = 120;
+  ducks256.setup = [] { spawnDuckGrid(256, 20.0f, 20.0f, 780.0f, 400.0f); };
+  scenarios.push_back(ducks256);
+
+  Scenario ducks1024;
+  ducks1024.name = "ducks_1024";
+  ducks1024.description = "1024 ducks; stresses the pairwise collision pass";
+  ducks1024.warmupTicks = 5;
+  ducks1024.measuredTicks = 30;
+  ducks1024.setup = [] { spawnDuckGrid(1024, 10.0f, 10.0f, 790.0f, 420.0f); };
+  scenarios.push_back(ducks1024);
+
+  Scenario barrage;
+  barrage.name = "projectile_barrage";
+  barrage.description =
+      "64 ducks in the top band while the player fires every tick";
+  barrage.setup = [] { spawnDuckGrid(64, 40.0f, 20.0f, 760.0f, 120.0f); };
+  barrage.tick = [](int tick) {
+    Entity player = findPlayer();
+    auto &cm = ComponentManager::getInstance();
+    auto *transform = cm.getComponent<components::Transform>(player);
+    if (!transform || cm.getComponent<components::ShootRequest>(player)) {
+      return;
+    }
+    float spread = static_cast<float>(tick % 9 - 4) * 0.08f;
+    cm.addComponent<components::ShootRequest>(
+        player, transform->getPosition().x + 25.0f, transform->getPosition().y,
+        spread, -1.0f);
+  };
+  scenarios.push_back(barrage);
+
+  Scenario lookup;
+  lookup.name = "micro_component_lookup";
+  lookup.description = "getComponent<Transform> over 4096 entities";
+  lookup.runsWorld = false;
+  lookup.measuredTicks = 2000;
+  lookup.setup = [] {
+    auto &cm = ComponentManager::getInstance();
+    microEntities.clear();
+    for (int i = 0; i < 4096; ++i) {
+      Entity e = Entity::create("perf_lookup");
+      cm.addComponent<components::Transform>(
+          e, Vector2(static_cast<float>(i), 0.0f));
+      microEntities.push_back(e);
+    }
+  };
+  lookup.tick = [](int) {
+    auto &cm = ComponentManager::getInstance();
+    float sum = 0.0f;
+    for (const Entity &e : microEntities) {
+      sum += cm.getComponent<components::Transform>(e)->getPosition().x;
+    }
+    doNotOptimize(sum);
+  };
+  scenarios.push_back(lookup);
+
+  // Every fourth entity is a boss: presence through the tag bit, and the
+  // same set found by a signature filter over all entities
+  Scenario tags;
+  tags.name = "micro_tag_filter";
+  tags.description = "has<BossTarget> over 4096 ducks plus a BossTarget "
+                     "signature filter";
+  tags.runsWorld = false;
+  tags.measuredTicks = 2000;
+  tags.setup = [] {
+    auto &cm = ComponentManager::getInstance();
+    microEntities.clear();
+    for (int i = 0; i < 4096; ++i) {
+      const bool boss = i % 4 == 0;
+      Entity e = Entity::create("perf_tag");
+      cm.addComponent<components::Transform>(
+          e, Vector2(static_cast<float>(i), 0.0f));
+      cm.addComponent<components::Target>(e, boss ? 50 : 10,
+                                          boss ? "boss" : "regular");
+      if (boss) {
+        cm.addTag<components::BossTarget>(e);
+      }
+      microEntities.push_back(e);
+    }
+    tagMatches = 0;
+  };
+  tags.tick = [](int) {
+    auto &cm = ComponentManager::getInstance();
+    size_t bosses = 0;
+    for (const Entity &e : microEntities) {
+      bosses += cm.has<components::BossTarget>(e) ? 1 : 0;
+    }
+    size_t filtered = 0;
+    cm.forEachEntityWith(
+        cm.makeSignature<components::Target, components::BossTarget>(),
+        [&filtered](Entity::ID) { ++filtered; });
+    tagMatches = bosses == filtered ? bosses : 0;
+  };
+  tags.finish = [](ScenarioResult &result) {
+    result.counters.emplace_back("bosses", static_cast<double>(tagMatches));
+    if (tagMatches != 1024) {
+      result.error = "tag lookup and signature filter disagree";
+    }
+  };
+  scenarios.push_back(tags);
+
+  Scenario dispatch;
+  dispatch.name = "micro_event_dispatch";
+  dispatch.description =
+      "held-key auto-repeat: 255 presses + 1 release per tick to the real "
+      "keyboard subscribers";
+  dispatch.runsWorld = false;
+  dispatch.measuredTicks = 2000;
+  dispatch.tick = [](int) {
+    auto &em = events::EventManager::getInstance();
+    for (int i = 0; i < 255; ++i) {
+      em.publish(events::KeyboardEvent::create("Left", true));
+    }
+    em.publish(events::KeyboardEvent::create("Left", false));
+    em.update();
+  };
+  scenarios.push_back(dispatch);
+
+  Scenario churn;
+  churn.name = "micro_entity_churn";
+  churn.description = "create and destroy 64 ducks per tick";
+  churn.runsWorld = false;
+  churn.measuredTicks = 500;
+  churn.tick = [](int) {
+    auto &cm = ComponentManager::getInstance();
+    auto &sm = SystemManager::getInstance();
+    microEntities.clear();
+    for (int i = 0; i < 64; ++i) {
+      microEntities.push_back(spawnDuck(100.0f + i, 100.0f));
+    }
+    for (const Entity &e : microEntities) {
+      sm.onEntityDestroyed(e);
+      cm.removeAllComponents(e);
+    }
+  };
+  scenarios.push_back(churn);
+
+  Scenario observers;
+  observers.name = "micro_component_observers";
+  observers.description =
+      "toggle a tag no system requires on 1024 ducks per tick (component "
+      "change notification overhead)";
+  observers.runsWorld = false;
+  observers.setup = [] {
+    microEntities.clear();
+    for (int i = 0; i < 1024; ++i) {
+      microEntities.push_back(spawnDuck((i % 32) * 20.0f, (i / 32) * 20.0f));
+    }
+  };
+  observers.tick = [](int) {
+    auto &cm = ComponentManager::getInstance();
+    for (const Entity &e : microEntities) {
+      cm.addTag<components::BossTarget>(e);
+    }
+    for (const Entity &e : microEntities) {
+      cm.removeTag<components::BossTarget>(e);
+    }
+  };
+  scenarios.push_back(observers);
+
+  Scenario offscreen;
+  offscreen.name = "micro_offscreen_lod";
+  offscreen.description =
+      "MovementSystem over 4096 targets outside the viewport (staggered "
+      "reduced-rate updates)";
+  offscreen.runsWorld = false;
+  offscreen.setup = [] {
+    auto &cm = ComponentManager::getInstance();
+    auto &sm = SystemManager::getInstance();
+    microEntities.clear();
+    for (int i = 0; i < 4096; ++i) {
+      Entity e = Entity::create("perf_far_target");
+      sm.onEntityCreated(e);
+      cm.addComponent<components::Transform>(
+          e, Vector2(2000.0f + (i % 64) * 10.0f, 2000.0f + (i / 64) * 10.0f));
+      cm.addComponent<components::Sprite>(e, 48.0f, 48.0f,
+                                          SDL_Color{255, 255, 0, 255});
+      cm.addComponent<components::Movement>(e, Vector2(-30.0f, 0.0f));
+      cm.addComponent<components::Target>(e, 10, "duck");
+      microEntities.push_back(e);
+    }
+  };
+  offscreen.tick = [](int) {
+    auto &lod = SimulationLod::getInstance();
+    lod.beginFrame();
+    lod.setViewport(0.0f, 0.0f, 800.0f, 600.0f);
+    SystemManager::getInstance().getSystem<systems::MovementSystem>()->update(
+        FIXED_DT);
+  };
+  scenarios.push_back(offscreen);
+
+  Scenario streaming;
+  streaming.name = "micro_scene_streaming";
+  streaming.description =
+      "800x600 view panning across a 16384x16384 scene of 16384 sprites in "
+      "1024px cells";
+  streaming.runsWorld = false;
+  streaming.setup = [] {
+    const float worldSize = 16384.0f;
+    std::vector<resources::SceneEntity> scenery;
+    scenery.reserve(16384);
+    for (int i = 0; i < 16384; ++i) {
+      resources::SceneEntity entity;
+      entity.record.x = (i % 128) * (worldSize / 128.0f);
+      entity.record.y = (i / 128) * (worldSize / 128.0f);
+      entity.record.width = 32.0f;
+      entity.record.height = 32.0f;
+      entity.imageName = i % 2 ? "yellow.png" : "red.png";
+      scenery.push_back(entity);
+    }
+    std::string path =
+        (std::filesystem::temp_directory_path() / "perf_streaming.scene")
+            .string();
+    resources::SceneFile::write(path, worldSize, worldSize, 1024.0f, scenery);
+    sceneStreamer.open(path);
+  };
+  streaming.tick = [](int tick) {
+    // Diagonal pan at 16px per tick, bouncing off the far corner
+    const float travel = 16384.0f - 800.0f;
+    float distance = std::fmod(tick * 16.0f, 2.0f * travel);
+    float x = distance < travel ? distance : 2.0f * travel - distance;
+    sceneStreamer.update(x, x * 0.75f, 800.0f, 600.0f);
+  };
+  scenarios.push_back(streaming);
+
+  Scenario hierarchy;
+  hierarchy.name = "micro_transform_hierarchy";
+  hierarchy.description =
+      "64 roots with 63-node attachment trees; one root moves per tick";
+  hierarchy.runsWorld = false;
+  hierarchy.setup = [] {
+    auto &cm = ComponentManager::getInstance();
+    auto &sm = SystemManager::getInstance();
+    microEntities.clear();
+    for (int r = 0; r < 64; ++r) {
+      Entity root = Entity::create("perf_hierarchy_root");
+      sm.onEntityCreated(root);
+      cm.addComponent<components::Transform>(
+          root, Vector2((r % 8) * 100.0f, (r / 8) * 100.0f));
+      microEntities.push_back(root);
+
+      // Binary tree below the root: node n hangs off node (n - 1) / 2
+      size_t first = microEntities.size() - 1;
+      for (int n = 1; n < 64; ++n) {
+        Entity node = Entity::create("perf_hierarchy_node");
+        sm.onEntityCreated(node);
+        cm.addComponent<components::Transform>(node);
+        cm.addComponent<components::Hierarchy>(
+            node, microEntities[first + (n - 1) / 2], Vector2(8.0f, 4.0f),
+            5.0f);
+        microEntities.push_back(node);
+      }
+    }
+    // Initial propagation is not part of the measurement
+    SystemManager::getInstance()
+        .getSystem<systems::TransformHierarchySystem>()
+        ->update(FIXED_DT);
+  };
+  hierarchy.tick = [](int tick) {
+    auto &cm = ComponentManager::getInstance();
+    const Entity &root = microEntities[(tick % 64) * 64];
+    auto *transform = cm.getComponent<components::Transform>(root);
+    transform->setRotation(transform->getRotation() + 1.0f);
+    SystemManager::getInstance()
+        .getSystem<systems::TransformHierarchySystem>()
+        ->update(FIXED_DT);
+  };
+  scenarios.push_back(hierarchy);
+
+  Scenario tweens;
+  tweens.name = "micro_tween_batch";
+  tweens.description = "2048 looping entity rotation tweens and 2048 float "
+                       "tweens restarted from completion callbacks";
+  tweens.runsWorld = false;
+  tweens.setup = [] {
+    auto &cm = ComponentManager::getInstance();
+    auto &sm = SystemManager::getInstance();
+    auto &tweener = Tweener::getInstance();
+    microEntities.clear();
+    tweenValues.assign(2048, 0.0f);
+    for (int i = 0; i < 2048; ++i) {
+      Entity e = Entity::create("perf_tween");
+      sm.onEntityCreated(e);
+      cm.addComponent<components::Transform>(e);
+      microEntities.push_back(e);
+      tweener.tween(e, TweenProperty::Rotation, 0.0f, 360.0f,
+                    0.5f + (i % 7) * 0.25f, Easing::InOutQuad,
+                    TweenRepeat::PingPong);
+      startValueTween(i);
+    }
+  };
+  tweens.tick = [](int) { Tweener::getInstance().update(FIXED_DT); };
+  scenarios.push_back(tweens);
+
+  Scenario audioMix;
+  audioMix.name = "micro_audio_mix";
+  audioMix.description = "64-voice mixer on the dummy audio driver: 200 "
+                         "triggers (voice stealing) and 800 frames per tick";
+  audioMix.runsWorld = false;
+  audioMix.setup = [] {
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    SDL_InitSubSystem(SDL_INIT_AUDIO);
+    auto &bank = benchMixer.getSoundBank();
+    if (bank.getSoundCount() == 0) {
+      bank.addTone("low", 220.0f, 1.0f, 0.5f, 0);
+      bank.addTone("mid", 440.0f, 0.5f, 0.5f, 1);
+      bank.addTone("high", 880.0f, 0.25f, 0.5f, 2);
+    }
+    // Paused: the scenario renders with mix() instead of SDL's thread
+    benchMixer.open(false);
+    mixBuffer.resize(800 * audio::SoundBank::CHANNELS);
+  };
+  audioMix.tick = [](int tick) {
+    for (int i = 0; i < 200; ++i) {
+      benchMixer.play(static_cast<audio::SoundId>((tick + i) % 3), 1.0f,
+                      (i % 21) * 0.1f - 1.0f);
+    }
+    benchMixer.mix(mixBuffer.data(), 800);
+  };
+  scenarios.push_back(audioMix);
+
+  Scenario particles;
+  particles.name = "micro_particles";
+  particles.description = "Hit sparks: 32 bursts of 16 per tick against the "
+                          "1024 particle cap, simulated and drawn offscreen";
+  particles.runsWorld = false;
+  particles.setup = [] {
+    benchParticles.clear();
+    benchParticles.setMaxParticles(ParticleEmitter::CAPACITY);
+    particlesOverCap = false;
+  };
+  particles.tick = [](int tick) {
+    for (int i = 0; i < 32; ++i) {
+      benchParticles.emit(Vector2(static_cast<float>((tick * 37 + i * 53) % 800),
+                                  static_cast<float>((tick * 11 + i * 29) % 600)),
+                          systems::ProjectileSystem::HIT_PARTICLES,
+                          SDL_Color{255, 200, 40, 255});
+    }
+    benchParticles.update(FIXED_DT);
+    benchParticles.draw(offscreenRenderer, nullptr, Vector2());
+    particlesOverCap |=
+        benchParticles.getLiveCount() > benchParticles.getMaxParticles();
+  };
+  particles.finish = [](ScenarioResult &result) {
+    result.counters.emplace_back(
+        "live particles", static_cast<double>(benchParticles.getLiveCount()));
+    result.counters.emplace_back(
+        "dropped", static_cast<double>(benchParticles.getDroppedCount()));
+    if (particlesOverCap) {
+      result.error = "live particles exceeded the cap";
+    } else if (benchParticles.getDroppedCount() == 0) {
+      result.error = "bursts never reached the cap";
+    }
+  };
+  scenarios.push_back(particles);
+
+  Scenario rng;
+  rng.name = "micro_rng";
+  rng.description = "World RNG: batch fill of 65536 floats and 16384 "
+                    "single range() draws per tick";
+  rng.runsWorld = false;
+  rng.setup = [] {
+    RandomService::getInstance().stream("PerfGate").reseed(86);
+    randomValues.resize(65536);
+  };
+  rng.tick = [](int) {
+    RandomStream &random = RandomService::getInstance().stream("PerfGate");
+    random.fill(randomValues.data(), randomValues.size(), -1.0f, 1.0f);
+    float sum = 0.0f;
+    for (int i = 0; i < 16384; ++i) {
+      sum += random.range(0.0f, 800.0f);
+    }
+    doNotOptimize(sum + randomValues[sum > 0.0f ? 1 : 0]);
+  };
+  scenarios.push_back(rng);
+
+  // Same queries as micro_spatial_linear, answered from the grid
+  Scenario spatialQuery;
+  spatialQuery.name = "micro_spatial_query";
+  spatialQuery.description = "SpatialQuery over 4096 boxes: 256 radius, "
+                             "nearest-4 and raycast queries per tick";
+  spatialQuery.runsWorld = false;
+  spatialQuery.setup = setupSpatialBoxes;
+  spatialQuery.tick = [](int tick) {
+    const SpatialQuery &query = SpatialQuery::getInstance();
+    Entity found[64];
+    SpatialQuery::Hit hits[4];
+    SpatialQuery::Hit rayHit;
+    size_t total = 0;
+    for (int i = 0; i < SPATIAL_QUERIES; ++i) {
+      Vector2 point = spatialQueryPoint(tick, i);
+      total += query.queryRadius(point, 80.0f, SpatialQuery::LAYER_TARGET,
+                                 found, 64);
+      total += query.nearest(point, 4, SpatialQuery::LAYER_TARGET, hits);
+      total += query.raycast(point, Vector2(1.0f, -0.5f), 600.0f,
+                             SpatialQuery::LAYER_ALL, rayHit);
+    }
+    doNotOptimize(total);
+  };
+  scenarios.push_back(spatialQuery);
+
+  // Reference for micro_spatial_query: every query scans every box
+  Scenario spatialLinear;
+  spatialLinear.name = "micro_spatial_linear";
+  spatialLinear.description = "Linear-scan reference for micro_spatial_query "
+                              "(same boxes and queries)";
+  spatialLinear.runsWorld = false;
+  spatialLinear.setup = setupSpatialBoxes;
+  spatialLinear.tick = [](int tick) {
+    size_t total = 0;
+    for (int i = 0; i < SPATIAL_QUERIES; ++i) {
+      Vector2 point = spatialQueryPoint(tick, i);
+      float nearest[4];
+      size_t nearestCount = 0;
+      float rayBest = 600.0f;
+      bool rayHit = false;
+      for (size_t b = 0; b < SPATIAL_BOXES; ++b) {
+        float dx = std::max({spatialLeft[b] - point.x, 0.0f,
+                             point.x - spatialRight[b]});
+        float dy = std::max({spatialTop[b] - point.y, 0.0f,
+                             point.y - spatialBottom[b]});
+        float d2 = dx * dx + dy * dy;
+        if (spatialLayers[b] & SpatialQuery::LAYER_TARGET) {
+          if (d2 <= 80.0f * 80.0f) {
+            ++total;
+          }
+          if (nearestCount < 4 || d2 < nearest[3]) {
+            size_t slot = nearestCount < 4 ? nearestCount++ : 3;
+            while (slot > 0 && nearest[slot - 1] > d2) {
+              nearest[slot] = nearest[slot - 1];
+              --slot;
+            }
+            nearest[slot] = d2;
+          }
+        }
+        // Slab test against the ray (1, -0.5) normalized
+        const float dirX = 0.894427f, dirY = -0.447214f;
+        float t0 = (spatialLeft[b] - point.x) / dirX;
+        float t1 = (spatialRight[b] - point.x) / dirX;
+        float t2 = (spatialBottom[b] - point.y) / dirY;
+        float t3 = (spatialTop[b] - point.y) / dirY;
+        float tNear = std::max({0.0f, std::min(t0, t1), std::min(t2, t3)});
+        float tFar = std::min(std::max(t0, t1), std::max(t2, t3));
+        if (tNear <= tFar && tNear <= rayBest) {
+          rayBest = tNear;
+          rayHit = true;
+        }
+      }
+      total += nearestCount + (rayHit ? 1 : 0);
+    }
+    doNotOptimize(total);
+  };
+  scenarios.push_back(spatialLinear);
+
+  for (int clients : {1, 8, 64}) {
+    scenarios.push_back(makeNetScenario(clients));
+  }
+
+  scenarios.push_back(makeRollbackScenario());
+  scenarios.push_back(makeRoomsScenario());
+  scenarios.push_back(makeRegionsScenario());
+  scenarios.push_back(makeReplayScenario());
+
+  Scenario fastForward;
+  fastForward.name = "fast_forward_8x";
+  fastForward.description = "8x time scale: seven undrawn world steps plus "
+                            "one drawn step per tick";
+  fastForward.measuredTicks = 150;
+  fastForward.tick = [](int) {
+    for (int i = 0; i < 7; ++i) {
+      GameWorld::getInstance().update(FIXED_DT, false);
+    }
+  };
+  scenarios.push_back(fastForward);
+
+  Scenario soak;
+  soak.name = "soak_bot";
+  soak.description = "Bot plays full rounds (aiming, firing, restarts); use "
+                     "--ticks for long soak runs";
+  soak.measuredTicks = 7200;
+  soak.soak = true;
+  soak.setup = [] { GameWorld::getInstance().enableBot(); };
+  soak.tick = keepBotBusy;
+  scenarios.push_back(soak);
+  scenarios.push_back(makeJournalBotScenario());
+  scenarios.push_back(makeJournalAnalyzeScenario());
+  scenarios.push_back(makeMetricsOverheadScenario());
+  scenarios.push_back(makeStartupWorldScenario());
+
+  return scenarios;
+}
+
+double percentile(std::vector<double> values, double p) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(std::ceil(p * values.size())) - 1;
+  index = std::min(index, values.size() - 1);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+} // namespace
+
+bool initializeHeadlessWorld(const std::string &assetsDir) {
+  auto &world = GameWorld::getInstance();
+  world.setAssetsDirectory(assetsDir);
+  if (!world.initialize()) {
+    return false;
+  }
+  headlessAssetsDir = assetsDir;
+
+  offscreenSurface = SDL_CreateSurface(world.getWorldWidth(),
+                                       world.getWorldHeight(),
+                                       SDL_PIXELFORMAT_RGBA32);
+  if (offscreenSurface) {
+    offscreenRenderer = SDL_CreateSoftwareRenderer(offscreenSurface);
+  }
+  if (!offscreenRenderer) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                "[PerfGate] No software renderer (%s); RenderSystem will be "
+                "skipped",
+                SDL_GetError());
+  }
+  world.setRenderer(offscreenRenderer);
+
+  // Where the GameData.json entities start; resetWorld() puts them back
+  auto &cm = ComponentManager::getInstance();
+  for (const Entity &e : world.getEntities()) {
+    LoadedPose pose;
+    pose.entity = e;
+    if (auto *transform = cm.getComponent<components::Transform>(e)) {
+      pose.position = transform->getPosition();
+      pose.rotation = transform->getRotation();
+    }
+    if (auto *movement = cm.getComponent<components::Movement>(e)) {
+      pose.velocity = movement->getVelocity();
+    }
+    loadedPoses.push_back(pose);
+  }
+  return true;
+}
+
+void resetWorld() {
+  auto &world = GameWorld::getInstance();
+  auto &cm = ComponentManager::getInstance();
+  auto &sm = SystemManager::getInstance();
+
+  std::unordered_set<Entity::ID> keep;
+  for (const Entity &e : world.getEntities()) {
+    keep.insert(e.getId());
+  }
+
+  std::unordered_set<Entity> spawned;
+  for (const auto &system : sm.getSystems()) {
+    for (const Entity &e : system->getEntities()) {
+      if (keep.count(e.getId()) == 0) {
+        spawned.insert(e);
+      }
+    }
+  }
+  for (const Entity &e : spawned) {
+    sm.onEntityDestroyed(e);
+    cm.removeAllComponents(e);
+  }
+  for (const Entity &e : microEntities) {
+    cm.removeAllComponents(e);
+  }
+  microEntities.clear();
+  Tweener::getInstance().clear();
+  world.disableBot();
+  // A bot-played scenario leaves the player wherever it walked to, which
+  // changes what the next scenario's ducks home on and collide with
+  for (const LoadedPose &pose : loadedPoses) {
+    if (auto *transform = cm.getComponent<components::Transform>(pose.entity)) {
+      transform->setPosition(pose.position);
+      transform->setRotation(pose.rotation);
+    }
+    if (auto *movement = cm.getComponent<components::Movement>(pose.entity)) {
+      movement->setVelocity(pose.velocity);
+    }
+  }
+  RandomService::getInstance().setSeed(WORLD_SEED);
+
+  if (components::ShootingGalleryState::hasInstance()) {
+    components::ShootingGalleryState::getInstance().startGame();
+  }
+  // A duck reaching the player in the last scenario must not freeze the next
+  if (auto *gameState = sm.getSystem<systems::GameStateSystem>()) {
+    gameState->reset();
+  }
+}
+
+const std::vector<Scenario> &getScenarios() {
+  static const std::vector<Scenario> scenarios = buildScenarios();
+  return scenarios;
+}
+
+ScenarioResult runScenario(const Scenario &scenario) {
+  using Clock = std::chrono::steady_clock;
+  auto &world = GameWorld::getInstance();
+  auto &sm = SystemManager::getInstance();
+
+  resetWorld();
+  if (scenario.setup) {
+    scenario.setup();
+  }
+
+  auto runTick = [&](int tick) {
+    if (scenario.tick) {
+      scenario.tick(tick);
+    }
+    if (scenario.runsWorld) {
+      world.update(FIXED_DT);
+    }
+  };
+
+  for (int i = 0; i < scenario.warmupTicks; ++i) {
+    runTick(i);
+  }
+
+  const size_t systemCount = sm.getSystems().size();
+  std::vector<double> systemTotalNs(systemCount, 0.0);
+  std::vector<double> frameMs;
+  frameMs.reserve(scenario.measuredTicks);
+
+  auto allocBefore = diagnostics::AllocationCounter::snapshot();
+  auto start = Clock::now();
+  for (int i = 0; i < scenario.measuredTicks; ++i) {
+    auto frameStart = Clock::now();
+    runTick(scenario.warmupTicks + i);
+    auto frameEnd = Clock::now();
+    frameMs.push_back(
+        std::chrono::duration<double, std::milli>(frameEnd - frameStart)
+            .count());
+    if (scenario.runsWorld) {
+      const auto &times = sm.getLastUpdateTimes();
+      for (size_t s = 0; s < systemCount; ++s) {
+        systemTotalNs[s] += static_cast<double>(times[s]);
+      }
+    }
+  }
+  double totalSeconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  auto allocAfter = diagnostics::AllocationCounter::snapshot();
+
+  // frameMs itself was reserved up front, so the measurement loop above does
+  // not contribute to the allocation count.
+  ScenarioResult result;
+  result.name = scenario.name;
+  result.ticks = scenario.measuredTicks;
+  result.ticksPerSecond =
+      totalSeconds > 0.0 ? scenario.measuredTicks / totalSeconds : 0.0;
+  result.allocationsPerFrame =
+      static_cast<double>(allocAfter.allocations - allocBefore.allocations) /
+      scenario.measuredTicks;
+  result.liveAllocations =
+      static_cast<int64_t>(allocAfter.allocations - allocBefore.allocations) -
+      static_cast<int64_t>(allocAfter.frees - allocBefore.frees);
+  double sum = 0.0;
+  for (double ms : frameMs) {
+    sum += ms;
+  }
+  result.meanFrameMs = frameMs.empty() ? 0.0 : sum / frameMs.size();
+  result.p99FrameMs = percentile(frameMs, 0.99);
+  const size_t window = frameMs.size() / 10;
+  if (window > 0) {
+    double first = 0.0;
+    double last = 0.0;
+    for (size_t i = 0; i < window; ++i) {
+      first += frameMs[i];
+      last += frameMs[frameMs.size() - window + i];
+    }
+    result.frameDriftPercent = first > 0.0 ? (last / first - 1.0) * 100.0 : 0.0;
+  }
+
+  if (scenario.runsWorld) {
+    const auto &names = sm.getSystemNames();
+    for (size_t s = 0; s < systemCount; ++s) {
+      result.systemMeanMs.emplace_back(
+          names[s], systemTotalNs[s] / scenario.measuredTicks / 1.0e6);
+    }
+  }
+  if (scenario.finish) {
+    scenario.finish(result);
+  }
+  return result;
+}
+
+} // namespace perf
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace perf {
+
+/**
+ * Measurements for one scenario run.
+ *
+ * Frame times cover a single tick (a GameWorld::update for world scenarios,
+ * one batch of work for microbenchmarks). Allocation counts come from the
+ * process-wide AllocationCounter and cover the measured ticks only.
+ */
+struct ScenarioResult {
+    std::string name;
+    int ticks = 0;
+    double ticksPerSecond = 0.0;
+    double allocationsPerFrame = 0.0;
+    double meanFrameMs = 0.0;
+    double p99FrameMs = 0.0;
+    // Allocations minus frees over the measured ticks; steady growth on a
+    // long run points at a leak
+    int64_t liveAllocations = 0;
+    // Mean frame time of the last 10% of ticks relative to the first 10%
+    double frameDriftPercent = 0.0;
+    // Mean update time per system in milliseconds, in system update order
+    std::vector<std::pair<std::string, double>> systemMeanMs;
+    // Scenario-specific measurements (reported, not gated)
+    std::vector<std::pair<std::string, double>> counters;
+    // Set when the scenario detected a functional failure; fails the gate
+    std::string error;
+};
+
+/**
+ * A deterministic, headless workload.
+ *
+ * World scenarios run GameWorld::update with a fixed 60 Hz step after
+ * calling tick(); microbenchmarks only time tick().
+ */
+struct Scenario {
+    std::string name;
+    std::string description;
+    int warmupTicks = 30;
+    int measuredTicks = 600;
+    // Runs of setup, warmup and measured ticks; the gate compares the median
+    // of each metric, so one run disturbed by a busy host does not fail it
+    int repeats = 1;
+    bool runsWorld = true;
+    bool soak = false;                   // Report heap growth and frame drift
+    std::function<void()> setup;         // Populate the world before warmup
+    std::function<void(int tick)> tick;  // Per-tick driver (may be empty)
+    // Fill counters/error and release resources after the measured ticks
+    std::function<void(ScenarioResult&)> finish;
+};
+
+/**
+ * Bring up GameWorld without a window: loads GameData.json from assetsDir and
+ * renders into an offscreen software renderer so RenderSystem does real work.
+ *
+ * @param assetsDir Directory containing GameData.json and images/
+ * @return true if the world initialized successfully
+ */
+bool initializeHeadlessWorld(const std::string& assetsDir);
+
+/**
+ * Destroy every entity that was not loaded from GameData.json and restart the
+ * round, so scenarios can run back to back in one process.
+ */
+void resetWorld();
+
+/**
+ * All registered scenarios, in the order they are run by default.
+ * @return Scenario list
+ */
+const std::vector<Scenario>& getScenarios();
+
+/**
+ * Run one scenario (setup, warmup, measured ticks) and collect metrics.
+ * @param scenario The scenario to run
+ * @return Collected measurements
+ */
+ScenarioResult runScenario(const Scenario& scenario);
+
+} // namespace perf
@@ -0,0 +1,354 @@
+/**
+ * GameServer - headless authoritative game server.
+ *
+ * Runs GameWorld at a fixed 60 Hz without a window or renderer and streams
+ * the world to SnapshotClients as delta-compressed UDP snapshots.
+ *
+ * Usage:
+ *   GameServer [--port N] [--assets DIR] [--max-clients N] [--loopback]
+ *              [--seed N] [--bot] [--ticks N] [--rooms N] [--shards N]
+ *              [--region I --region-grid CxR [--region-port N]]
+ *              [--replay FILE] [--journal FILE]
+ *
+ * --loopback only accepts clients on this machine. --bot lets
+ * BotControlSystem play so the snapshots carry a live match; without it the
+ * first client to send input controls the player. --ticks stops
+ * the server after N ticks (0 = run until interrupted). Every five seconds
+ * the server logs its client count, bandwidth per client and tick cost.
+ *
+ * --rooms N hosts N independent matches in one process through RoomHost,
+ * room i listening on port + i and seeded with seed + i. Rooms are spread
+ * over --shards threads (default: one per hardware thread); every five
+ * seconds the server logs each shard's load and its rooms' budget overruns,
+ * then rebalances the shards.
+ *
+ * --region I --region-grid CxR makes this process region I of a world cut
+ * into C x R regions, one GameServer process each on this machine. Ducks and
+ * projectiles crossing into another region are handed off to that process
+ * (RegionNode); region j listens on --region-port + j (default 27100).
+ *
+ * --replay FILE records the match to a replay file (ReplayRecorder) that the
+ * game plays back with --replay. Handoffs are not input, so it cannot be
+ * combined with --rooms or --region.
+ *
+ * --journal FILE writes a gameplay journal (GameplayJournal) for
+ * JournalAnalyzer; with --rooms only the first room is journaled.
+ */
+
+#include "game/GameWorld.hpp"
+#include "game/RoomHost.hpp"
+#include "game/diagnostics/GameplayJournal.hpp"
+#include "game/diagnostics/Replay.hpp"
+#include "game/ecs/Random.hpp"
+#include "game/net/RegionNode.hpp"
+#include "game/net/SnapshotServer.hpp"
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t TICK_NS = 1000000000ull / 60;
+constexpr uint32_t STATS_INTERVAL_TICKS = 60 * 5;
+constexpr uint32_t ROOM_POLL_MS = 100;
+
+std::atomic<bool> running(true);
+
+void handleSignal(int) { running = false; }
+
+struct Options {
+  uint16_t port = game::net::protocol::DEFAULT_PORT;
+  std::string assetsDir = "GameAssets";
+  size_t maxClients = 64;
+  bool loopbackOnly = false;
+  bool bot = false;
+  bool hasSeed = false;
+  uint64_t seed = 0;
+  uint64_t ticks = 0;
+  size_t rooms = 0;
+  size_t shards = 0;
+  bool hasRegion = false;
+  size_t region = 0;
+  game::net::RegionLayout regionLayout;
+  uint16_t regionPort = game::net::protocol::DEFAULT_REGION_PORT;
+  std::string replayPath;
+  std::string journalPath;
+};
+
+bool parseArgs(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--port" && hasValue) {
+      options.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+    } else if (arg == "--assets" && hasValue) {
+      options.assetsDir = argv[++i];
+    } else if (arg == "--max-clients" && hasValue) {
+      options.maxClients = static_cast<size_t>(std::atoi(argv[++i]));
+    } else if (arg == "--seed" && hasValue) {
+      options.hasSeed = true;
+      options.seed = std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--ticks" && hasValue) {
+      options.ticks = std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--rooms" && hasValue) {
+      options.rooms = static_cast<size_t>(std::atoi(argv[++i]));
+    } else if (arg == "--shards" && hasValue) {
+      options.shards = static_cast<size_t>(std::atoi(argv[++i]));
+    } else if (arg == "--region" && hasValue) {
+      options.hasRegion = true;
+      options.region = static_cast<size_t>(std::atoi(argv[++i]));
+    } else if (arg == "--region-grid" && hasValue) {
+      if (!game::net::RegionLayout::parse(argv[++i], options.regionLayout)) {
+        std::cerr << "Bad region grid: " << argv[i] << std::endl;
+        return false;
+      }
+    } else if (arg == "--region-port" && hasValue) {
+      options.regionPort = static_cast<uint16_t>(std::atoi(argv[++i]));
+    } else if (arg == "--replay" && hasValue) {
+      options.replayPath = argv[++i];
+    } else if (arg == "--journal" && hasValue) {
+      options.journalPath = argv[++i];
+    } else if (arg == "--loopback") {
+      options.loopbackOnly = true;
+    } else if (arg == "--bot") {
+      options.bot = true;
+    } else {
+      std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+      return false;
+    }
+  }
+  if (options.hasRegion && options.rooms > 0) {
+    std::cerr << "--region and --rooms cannot be combined" << std::endl;
+    return false;
+  }
+  if (!options.replayPath.empty() &&
+      (options.rooms > 0 || options.hasRegion)) {
+    std::cerr << "--replay needs a single, whole world" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Give the player to the first client to send input
+void bindPlayer(game::net::SnapshotServer &server) {
+  auto players = game::ecs::ComponentManager::getInstance()
+                     .getEntitiesWithComponent<game::ecs::components::Player>();
+  if (!players.empty()) {
+    server.setPlayer(players.front());
+  }
+}
+
+int runRooms(const Options &options) {
+  using namespace game;
+
+  RoomHost::Config config;
+  config.shardCount = options.shards;
+  RoomHost host(config);
+
+  std::vector<std::unique_ptr<net::SnapshotServer>> servers;
+  for (size_t i = 0; i < options.rooms; ++i) {
+    auto server = std::make_unique<net::SnapshotServer>(options.maxClients);
+    if (!server->start(static_cast<uint16_t>(options.port + i),
+                       options.loopbackOnly)) {
+      return 1;
+    }
+    net::SnapshotServer *roomServer = server.get();
+    RoomHost::RoomId id = host.createRoom(
+        options.assetsDir, 0.0,
+        [roomServer](RoomHost::RoomId, WorldInstance &) { roomServer->tick(); });
+    if (id == 0) {
+      return 1;
+    }
+    host.withRoom(id, [&](WorldInstance &room) {
+      if (options.hasSeed) {
+        ecs::RandomService::getInstance().setSeed(options.seed + i);
+      }
+      if (i == 0 && !options.journalPath.empty()) {
+        // Resolves to the room's own journal, closed with the room
+        diagnostics::GameplayJournal::getInstance().open(
+            options.journalPath,
+            static_cast<float>(room.getGameWorld().getWorldWidth()),
+            static_cast<float>(room.getGameWorld().getWorldHeight()));
+      }
+      if (options.bot) {
+        room.getGameWorld().enableBot();
+      } else {
+        bindPlayer(*roomServer);
+      }
+    });
+    servers.push_back(std::move(server));
+  }
+  std::signal(SIGINT, handleSignal);
+  std::signal(SIGTERM, handleSignal);
+
+  host.start();
+  const uint32_t statsIntervalPolls =
+      STATS_INTERVAL_TICKS * 1000 / 60 / ROOM_POLL_MS;
+  uint32_t polls = 0;
+  while (running) {
+    SDL_Delay(ROOM_POLL_MS);
+    const auto rooms = host.getRoomStats();
+    if (options.ticks != 0 && !rooms.empty() &&
+        rooms.front().ticks >= options.ticks) {
+      break;
+    }
+    if (++polls % statsIntervalPolls != 0) {
+      continue;
+    }
+    for (const auto &shard : host.getShardStats()) {
+      uint64_t overruns = 0;
+      for (const auto &room : rooms) {
+        overruns += room.shard == shard.index ? room.overruns : 0;
+      }
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                  "[GameServer] shard %zu (core %d): %zu rooms, %.3f ms per "
+                  "tick, %llu late passes, %llu room overruns",
+                  shard.index, shard.core, shard.rooms, shard.loadMs,
+                  static_cast<unsigned long long>(shard.latePasses),
+                  static_cast<unsigned long long>(overruns));
+    }
+    host.rebalance();
+  }
+
+  host.stop();
+  for (auto &server : servers) {
+    server->stop();
+  }
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  using namespace game;
+
+  Options options;
+  if (!parseArgs(argc, argv, options)) {
+    return 2;
+  }
+  if (options.rooms > 0) {
+    return runRooms(options);
+  }
+
+  GameWorld &world = GameWorld::getInstance();
+  world.setAssetsDirectory(options.assetsDir);
+  if (!world.initialize()) {
+    std::cerr << "[GameServer] Failed to initialize world from "
+              << options.assetsDir << std::endl;
+    return 1;
+  }
+  if (options.hasSeed) {
+    ecs::RandomService::getInstance().setSeed(options.seed);
+  }
+  if (options.bot) {
+    world.enableBot();
+  }
+  diagnostics::GameplayJournal &journal =
+      diagnostics::GameplayJournal::getInstance();
+  if (!options.journalPath.empty() &&
+      !journal.open(options.journalPath,
+                    static_cast<float>(world.getWorldWidth()),
+                    static_cast<float>(world.getWorldHeight()))) {
+    return 1;
+  }
+
+  net::SnapshotServer server(options.maxClients);
+  if (!server.start(options.port, options.loopbackOnly)) {
+    return 1;
+  }
+  if (!options.bot) {
+    bindPlayer(server);
+  }
+
+  std::unique_ptr<net::RegionNode> region;
+  if (options.hasRegion) {
+    net::RegionLayout layout = options.regionLayout;
+    layout.worldWidth = static_cast<float>(world.getWorldWidth());
+    layout.worldHeight = static_cast<float>(world.getWorldHeight());
+    region = std::make_unique<net::RegionNode>(layout, options.region);
+    if (!region->start(static_cast<uint16_t>(options.regionPort +
+                                             options.region))) {
+      return 1;
+    }
+    for (size_t i = 0; i < layout.getRegionCount(); ++i) {
+      region->setPeerPort(i, static_cast<uint16_t>(options.regionPort + i));
+    }
+  }
+  std::signal(SIGINT, handleSignal);
+  std::signal(SIGTERM, handleSignal);
+
+  const float deltaTime = static_cast<float>(TICK_NS) / 1.0e9f;
+  std::unique_ptr<diagnostics::ReplayRecorder> replay;
+  if (!options.replayPath.empty()) {
+    replay = std::make_unique<diagnostics::ReplayRecorder>(options.replayPath,
+                                                           deltaTime);
+    if (!replay->isRecording()) {
+      return 1;
+    }
+  }
+
+  uint64_t nextTickNs = SDL_GetTicksNS();
+  uint64_t busyNs = 0;
+  net::SnapshotServer::Stats lastStats;
+  while (running && (options.ticks == 0 || server.getTick() < options.ticks)) {
+    uint64_t start = SDL_GetTicksNS();
+    world.update(deltaTime, false);
+    if (replay) {
+      replay->recordTick();
+    }
+    if (region) {
+      region->tick();
+    }
+    server.tick();
+    busyNs += SDL_GetTicksNS() - start;
+
+    if (server.getTick() % STATS_INTERVAL_TICKS == 0) {
+      const auto &stats = server.getStats();
+      const double seconds = STATS_INTERVAL_TICKS * deltaTime;
+      const size_t clients = server.getClientCount();
+      SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                  "[GameServer] tick %u: %zu clients, %.1f kbit/s per client, "
+                  "%.3f ms per tick",
+                  server.getTick(), clients,
+                  clients ? (stats.bytesSent - lastStats.bytesSent) * 8.0 /
+                                1000.0 / seconds / clients
+                          : 0.0,
+                  busyNs / 1.0e6 / STATS_INTERVAL_TICKS);
+      if (region) {
+        const auto &regionStats = region->getStats();
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                    "[GameServer] region %zu: %zu owned, %zu ghosts, %llu "
+                    "handoffs out, %llu in, %llu cross-border hits",
+                    region->getRegion(), region->getOwnedCount(),
+                    region->getGhostCount(),
+                    static_cast<unsigned long long>(regionStats.handoffsSent),
+                    static_cast<unsigned long long>(
+                        regionStats.handoffsReceived),
+                    static_cast<unsigned long long>(regionStats.hitsSent));
+      }
+      lastStats = stats;
+      busyNs = 0;
+    }
+
+    // Fixed rate; if a tick overran, catch up without sleeping
+    nextTickNs += TICK_NS;
+    uint64_t now = SDL_GetTicksNS();
+    if (nextTickNs > now) {
+      SDL_DelayNS(nextTickNs - now);
+    } else if (now - nextTickNs > TICK_NS * 10) {
+      nextTickNs = now; // Far behind (debugger, suspend): do not spiral
+    }
+  }
+
+  if (region) {
+    region->stop();
+  }
+  server.stop();
+  journal.close();
+  return 0;
+}
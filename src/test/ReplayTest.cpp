@@ -0,0 +1,261 @@
+#include "game/GameWorld.hpp"
+#include "game/WorldInstance.hpp"
+#include "game/diagnostics/Replay.hpp"
+#include "game/ecs/Random.hpp"
+#include <SDL3/SDL.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#ifndef TEST_ASSETS_DIR
+#define TEST_ASSETS_DIR "GameAssets"
+#endif
+
+using game::WorldInstance;
+using game::diagnostics::captureKeyframe;
+using game::diagnostics::ReplayPlayer;
+using game::diagnostics::ReplayRecorder;
+using game::diagnostics::restoreKeyframe;
+
+namespace {
+
+constexpr float TICK = 1.0f / 60.0f;
+constexpr uint32_t RECORDED_TICKS = 150;
+constexpr uint32_t KEYFRAME_INTERVAL = 60;
+
+std::vector<uint8_t> capture() {
+  std::vector<uint8_t> state;
+  captureKeyframe(state);
+  return state;
+}
+
+std::vector<uint8_t> readFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string &path, const std::vector<uint8_t> &data) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+}
+
+/**
+ * Records a short bot match once, then gives every test a fresh world to
+ * restore it into.
+ */
+class ReplayTest : public ::testing::Test {
+protected:
+  static void SetUpTestSuite() {
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_CRITICAL);
+    path_ = (std::filesystem::temp_directory_path() / "replay_test.rpl")
+                .string();
+    WorldInstance recording;
+    ASSERT_TRUE(recording.initialize(TEST_ASSETS_DIR));
+    WorldInstance::Scope scope(recording);
+    game::ecs::RandomService::getInstance().setSeed(42);
+    recording.getGameWorld().enableBot();
+    ReplayRecorder::Config config;
+    config.keyframeInterval = KEYFRAME_INTERVAL;
+    ReplayRecorder recorder(path_, TICK, config);
+    for (uint32_t tick = 1; tick <= RECORDED_TICKS; ++tick) {
+      recording.update(TICK);
+      recorder.recordTick();
+    }
+    keyframe_ = capture();
+    recorder.close();
+    file_ = readFile(path_);
+  }
+
+  static void TearDownTestSuite() {
+    std::error_code error;
+    std::filesystem::remove(path_, error);
+    std::filesystem::remove(path_ + ".bad", error);
+  }
+
+  void SetUp() override {
+    ASSERT_TRUE(world_.initialize(TEST_ASSETS_DIR));
+    // One update moves the game clock off wall time, so captures of an
+    // untouched world compare equal
+    world_.update(TICK);
+    scope_ = std::make_unique<WorldInstance::Scope>(world_);
+  }
+
+  void TearDown() override { scope_.reset(); }
+
+  // Restore must either succeed or fail without touching the world
+  void expectCleanRestore(const std::vector<uint8_t> &keyframe,
+                          const char *what, size_t at) {
+    const std::vector<uint8_t> before = capture();
+    bool restored = true;
+    EXPECT_NO_THROW(restored = restoreKeyframe(keyframe.data(), keyframe.size()))
+        << what << " at " << at;
+    if (!restored) {
+      EXPECT_EQ(capture(), before) << what << " at " << at;
+    }
+  }
+
+  // Open a modified copy of the recording
+  bool openVariant(ReplayPlayer &player, const std::vector<uint8_t> &data) {
+    writeFile(path_ + ".bad", data);
+    bool opened = false;
+    EXPECT_NO_THROW(opened = player.open(path_ + ".bad"));
+    return opened;
+  }
+
+  static std::string path_;
+  static std::vector<uint8_t> keyframe_;
+  static std::vector<uint8_t> file_;
+
+  WorldInstance world_;
+  std::unique_ptr<WorldInstance::Scope> scope_;
+};
+
+std::string ReplayTest::path_;
+std::vector<uint8_t> ReplayTest::keyframe_;
+std::vector<uint8_t> ReplayTest::file_;
+
+} // namespace
+
+TEST_F(ReplayTest, KeyframeRoundTrips) {
+  ASSERT_TRUE(restoreKeyframe(keyframe_.data(), keyframe_.size()));
+  EXPECT_EQ(capture(), keyframe_);
+}
+
+TEST_F(ReplayTest, RejectsEveryTruncatedKeyframe) {
+  const std::vector<uint8_t> before = capture();
+  for (size_t size = 0; size < keyframe_.size(); ++size) {
+    bool restored = true;
+    EXPECT_NO_THROW(restored = restoreKeyframe(keyframe_.data(), size));
+    EXPECT_FALSE(restored) << size << " bytes";
+  }
+  EXPECT_EQ(capture(), before);
+}
+
+TEST_F(ReplayTest, RejectsTrailingBytes) {
+  std::vector<uint8_t> keyframe = keyframe_;
+  keyframe.push_back(0);
+  const std::vector<uint8_t> before = capture();
+  EXPECT_FALSE(restoreKeyframe(keyframe.data(), keyframe.size()));
+  EXPECT_EQ(capture(), before);
+}
+
+TEST_F(ReplayTest, CorruptedKeyframesRestoreCleanlyOrNotAtAll) {
+  // Flipped bytes may still decode (e.g. inside a float); those are fine as
+  // long as nothing throws, and a rejected keyframe must leave no trace
+  for (size_t at = 0; at < keyframe_.size(); ++at) {
+    std::vector<uint8_t> keyframe = keyframe_;
+    keyframe[at] ^= 0xFF;
+    expectCleanRestore(keyframe, "flipped byte", at);
+  }
+}
+
+TEST_F(ReplayTest, RejectsMalformedRandomState) {
+  // Layout: f64 clock, u64 LOD phase, varint length, CBOR random state
+  const size_t lengthAt = 16;
+  size_t length = 0;
+  size_t lengthBytes = 0;
+  for (int shift = 0;; shift += 7, ++lengthBytes) {
+    const uint8_t byte = keyframe_[lengthAt + lengthBytes];
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      ++lengthBytes;
+      break;
+    }
+  }
+  const auto cborBegin = keyframe_.begin() + lengthAt + lengthBytes;
+  nlohmann::json random =
+      nlohmann::json::from_cbor(cborBegin, cborBegin + length);
+  ASSERT_TRUE(random.contains("streams"));
+  ASSERT_FALSE(random["streams"].empty());
+
+  auto withRandom = [&](const nlohmann::json &state) {
+    const std::vector<uint8_t> cbor = nlohmann::json::to_cbor(state);
+    std::vector<uint8_t> keyframe(keyframe_.begin(),
+                                  keyframe_.begin() + lengthAt);
+    for (size_t value = cbor.size(); ; value >>= 7) {
+      keyframe.push_back(static_cast<uint8_t>(value & 0x7F) |
+                         (value >= 0x80 ? 0x80 : 0));
+      if (value < 0x80) {
+        break;
+      }
+    }
+    keyframe.insert(keyframe.end(), cbor.begin(), cbor.end());
+    keyframe.insert(keyframe.end(), cborBegin + length, keyframe_.end());
+    return keyframe;
+  };
+  ASSERT_EQ(withRandom(random), keyframe_);
+
+  const std::string stream = random["streams"].begin().key();
+  nlohmann::json notANumber = random;
+  notANumber["streams"][stream][0] = "seven";
+  nlohmann::json allZero = random;
+  allZero["streams"][stream] = {0, 0, 0, 0};
+  nlohmann::json tooWide = random;
+  tooWide["streams"][stream][1] = 1ull << 32;
+  nlohmann::json noSeed = random;
+  noSeed.erase("seed");
+
+  const std::vector<uint8_t> before = capture();
+  for (const nlohmann::json &state : {notANumber, allZero, tooWide, noSeed}) {
+    const std::vector<uint8_t> keyframe = withRandom(state);
+    bool restored = true;
+    EXPECT_NO_THROW(restored = restoreKeyframe(keyframe.data(), keyframe.size()))
+        << state.dump();
+    EXPECT_FALSE(restored) << state.dump();
+    EXPECT_EQ(capture(), before) << state.dump();
+  }
+}
+
+TEST_F(ReplayTest, PlaysTheRecordingBack) {
+  ReplayPlayer player;
+  ASSERT_TRUE(player.open(path_));
+  EXPECT_EQ(player.getTickCount(), RECORDED_TICKS);
+  EXPECT_EQ(player.getKeyframeCount(), 3u);
+  ASSERT_TRUE(player.seek(RECORDED_TICKS));
+  EXPECT_EQ(capture(), keyframe_);
+}
+
+TEST_F(ReplayTest, FileCutShortKeepsTheCompleteSegments) {
+  // Cut inside the last segment: the first two still play
+  ReplayPlayer player;
+  std::vector<uint8_t> data(file_.begin(), file_.end() - 1);
+  ASSERT_TRUE(openVariant(player, data));
+  EXPECT_EQ(player.getKeyframeCount(), 2u);
+  EXPECT_EQ(player.getTickCount(), 2 * KEYFRAME_INTERVAL);
+}
+
+TEST_F(ReplayTest, RejectsEveryTruncatedHeader) {
+  for (size_t size = 0; size < 40 && size < file_.size(); ++size) {
+    ReplayPlayer player;
+    const bool opened = openVariant(
+        player, std::vector<uint8_t>(file_.begin(), file_.begin() + size));
+    EXPECT_FALSE(opened) << size << " bytes";
+    EXPECT_FALSE(player.isOpen());
+  }
+}
+
+TEST_F(ReplayTest, CorruptedFilesFailCleanly) {
+  // Flip a spread of bytes across the file (every one would take long);
+  // opening and seeking either works or returns false
+  const size_t stride = std::max<size_t>(1, file_.size() / 400);
+  for (size_t at = 0; at < file_.size(); at += stride) {
+    std::vector<uint8_t> data = file_;
+    data[at] ^= 0xFF;
+    ReplayPlayer player;
+    if (!openVariant(player, data)) {
+      EXPECT_FALSE(player.isOpen()) << "flipped byte " << at;
+      continue;
+    }
+    EXPECT_NO_THROW(player.seek(RECORDED_TICKS)) << "flipped byte " << at;
+    EXPECT_NO_THROW(player.seek(0)) << "flipped byte " << at;
+  }
+}
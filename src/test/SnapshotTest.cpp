@@ -0,0 +1,324 @@
+#include "game/net/Protocol.hpp"
+#include "game/net/Snapshot.hpp"
+#include "game/net/SnapshotClient.hpp"
+#include "game/net/UdpSocket.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace game::net;
+
+namespace {
+
+EntityState makeEntity(uint64_t id, int32_t kind, int32_t x, int32_t y, int32_t rotation) {
+    EntityState state;
+    state.id = id;
+    state.fields[EntityState::KIND] = kind;
+    state.fields[EntityState::X] = x;
+    state.fields[EntityState::Y] = y;
+    state.fields[EntityState::ROTATION] = rotation;
+    return state;
+}
+
+WorldSnapshot makeSnapshot(uint32_t tick, std::vector<EntityState> entities) {
+    WorldSnapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.game[WorldSnapshot::STATE] = 1;
+    snapshot.game[WorldSnapshot::SCORE] = 120;
+    snapshot.game[WorldSnapshot::TIME_REMAINING_MS] = 45000;
+    snapshot.entities = std::move(entities);
+    return snapshot;
+}
+
+std::vector<uint8_t> encode(const WorldSnapshot* baseline, const WorldSnapshot& current) {
+    std::vector<uint8_t> out;
+    encodeSnapshot(baseline, current, out);
+    return out;
+}
+
+// Decode and stamp the tick, which the payload does not carry
+bool decode(const WorldSnapshot* baseline, const std::vector<uint8_t>& payload, uint32_t tick,
+            WorldSnapshot& out) {
+    if (!decodeSnapshot(baseline, payload.data(), payload.size(), out)) {
+        return false;
+    }
+    out.tick = tick;
+    return true;
+}
+
+// Plays the server side of a SnapshotClient over loopback
+class FakeServer {
+public:
+    bool start(SnapshotClient& client) {
+        if (!socket_.open(0, true) || !client.connect(Address::loopback(socket_.getLocalPort()))) {
+            return false;
+        }
+        // The client's HELLO tells us where to send
+        uint8_t packet[protocol::MAX_PACKET_SIZE];
+        for (int attempt = 0; attempt < 1000; ++attempt) {
+            if (socket_.receive(packet, sizeof(packet), client_) >= 0) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    void sendFragment(uint32_t tick, uint32_t baseline, uint8_t fragment, uint8_t fragments,
+                      const uint8_t* payload, size_t size) {
+        std::vector<uint8_t> packet(protocol::SNAPSHOT_HEADER_SIZE + size);
+        protocol::writeHeader(packet.data(), protocol::SNAPSHOT);
+        protocol::writeU32(packet.data() + protocol::HEADER_SIZE, tick);
+        protocol::writeU32(packet.data() + protocol::HEADER_SIZE + 4, baseline);
+        protocol::writeU32(packet.data() + protocol::HEADER_SIZE + 8, 0);
+        packet[protocol::HEADER_SIZE + 12] = fragment;
+        packet[protocol::HEADER_SIZE + 13] = fragments;
+        std::copy_n(payload, size, packet.data() + protocol::SNAPSHOT_HEADER_SIZE);
+        socket_.sendTo(client_, packet.data(), packet.size());
+    }
+
+    // Split a payload into fragments and send them in the given order
+    void sendSnapshot(uint32_t tick, uint32_t baseline, const std::vector<uint8_t>& payload,
+                      const std::vector<uint8_t>& order = {}) {
+        const size_t fragments =
+            std::max<size_t>(1, (payload.size() + protocol::MAX_FRAGMENT_PAYLOAD - 1) /
+                                    protocol::MAX_FRAGMENT_PAYLOAD);
+        std::vector<uint8_t> sequence = order;
+        for (size_t i = 0; sequence.empty() && i < fragments; ++i) {
+            sequence.push_back(static_cast<uint8_t>(i));
+        }
+        for (uint8_t fragment : sequence) {
+            const size_t offset = fragment * protocol::MAX_FRAGMENT_PAYLOAD;
+            const size_t size = std::min(protocol::MAX_FRAGMENT_PAYLOAD, payload.size() - offset);
+            sendFragment(tick, baseline, fragment, static_cast<uint8_t>(fragments),
+                         payload.data() + offset, size);
+        }
+    }
+
+private:
+    UdpSocket socket_;
+    Address client_;
+};
+
+// Poll until the datagrams sent so far have arrived; loopback delivery is
+// quick but not synchronous
+int pollAll(SnapshotClient& client, uint64_t packets) {
+    int decoded = 0;
+    for (int attempt = 0; attempt < 1000 && client.getStats().packetsReceived < packets; ++attempt) {
+        decoded += client.poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return decoded + client.poll();
+}
+
+// Enough entities that the full snapshot needs three fragments
+WorldSnapshot makeLargeSnapshot(uint32_t tick) {
+    std::vector<EntityState> entities;
+    for (uint64_t id = 1; id <= 250; ++id) {
+        entities.push_back(makeEntity(id * 3, EntityState::KIND_TARGET,
+                                      static_cast<int32_t>(id * 997),
+                                      -static_cast<int32_t>(id * 1013),
+                                      static_cast<int32_t>(id * 131) & 0xFFFF));
+    }
+    return makeSnapshot(tick, std::move(entities));
+}
+
+} // namespace
+
+TEST(SnapshotTest, FullSnapshotRoundTrips) {
+    const WorldSnapshot snapshot =
+        makeSnapshot(7, {makeEntity(1, EntityState::KIND_PLAYER, 800, 3600, 0),
+                         makeEntity(4, EntityState::KIND_TARGET, -16, 240, 16384),
+                         makeEntity(1000000, EntityState::KIND_PROJECTILE, 123456, -7, 65535)});
+    WorldSnapshot decoded;
+    ASSERT_TRUE(decode(nullptr, encode(nullptr, snapshot), 7, decoded));
+    EXPECT_EQ(decoded, snapshot);
+}
+
+TEST(SnapshotTest, DeltaAddsChangesAndRemovesEntities) {
+    const WorldSnapshot baseline =
+        makeSnapshot(10, {makeEntity(2, EntityState::KIND_PLAYER, 100, 100, 0),
+                          makeEntity(5, EntityState::KIND_TARGET, 200, 50, 0),
+                          makeEntity(9, EntityState::KIND_TARGET, 300, 60, 0)});
+    WorldSnapshot current =
+        makeSnapshot(11, {makeEntity(2, EntityState::KIND_PLAYER, 100, 100, 0),
+                          makeEntity(3, EntityState::KIND_PROJECTILE, 110, 90, 0),
+                          makeEntity(9, EntityState::KIND_TARGET, 290, 64, 512),
+                          makeEntity(40, EntityState::KIND_TARGET, 0, 0, 0)});
+    current.game[WorldSnapshot::SCORE] = 130;
+
+    WorldSnapshot decoded;
+    ASSERT_TRUE(decode(&baseline, encode(&baseline, current), 11, decoded));
+    EXPECT_EQ(decoded, current);
+}
+
+TEST(SnapshotTest, UnchangedSnapshotEncodesToMasksAndTerminators) {
+    const WorldSnapshot snapshot = makeSnapshot(3, {makeEntity(1, 1, 2, 3, 4)});
+    const std::vector<uint8_t> payload = encode(&snapshot, snapshot);
+    EXPECT_EQ(payload, (std::vector<uint8_t>{0, 0, 0}));
+
+    WorldSnapshot decoded;
+    ASSERT_TRUE(decode(&snapshot, payload, 3, decoded));
+    EXPECT_EQ(decoded, snapshot);
+}
+
+TEST(SnapshotTest, ExtremeDeltasWrapAround) {
+    const int32_t min = std::numeric_limits<int32_t>::min();
+    const int32_t max = std::numeric_limits<int32_t>::max();
+    const WorldSnapshot baseline = makeSnapshot(1, {makeEntity(1, 0, min, max, 0)});
+    const WorldSnapshot current = makeSnapshot(2, {makeEntity(1, 0, max, min, 65535)});
+
+    WorldSnapshot decoded;
+    ASSERT_TRUE(decode(&baseline, encode(&baseline, current), 2, decoded));
+    EXPECT_EQ(decoded, current);
+}
+
+TEST(SnapshotTest, RejectsEveryTruncation) {
+    const WorldSnapshot baseline = makeSnapshot(1, {makeEntity(1, 1, 10, 10, 0),
+                                                    makeEntity(2, 2, 20, 20, 0)});
+    const WorldSnapshot current = makeSnapshot(2, {makeEntity(2, 2, 25, 20, 0),
+                                                   makeEntity(6, 3, 30, 30, 100)});
+    const std::vector<uint8_t> payload = encode(&baseline, current);
+    for (size_t size = 0; size < payload.size(); ++size) {
+        WorldSnapshot decoded;
+        EXPECT_FALSE(decodeSnapshot(&baseline, payload.data(), size, decoded)) << size << " bytes";
+    }
+}
+
+TEST(SnapshotTest, RejectsTrailingBytes) {
+    const WorldSnapshot snapshot = makeSnapshot(1, {makeEntity(1, 1, 10, 10, 0)});
+    std::vector<uint8_t> payload = encode(nullptr, snapshot);
+    payload.push_back(0);
+    WorldSnapshot decoded;
+    EXPECT_FALSE(decode(nullptr, payload, 1, decoded));
+}
+
+TEST(SnapshotTest, RejectsMaskBitsPastTheFieldCount) {
+    // Game fields: only GAME_FIELD_COUNT mask bits exist
+    const std::vector<uint8_t> payload = {1u << WorldSnapshot::GAME_FIELD_COUNT, 0, 0};
+    WorldSnapshot decoded;
+    EXPECT_FALSE(decode(nullptr, payload, 1, decoded));
+}
+
+TEST(SnapshotTest, RejectsZigzagValuesWiderThan32Bits) {
+    // Field 0 changed by a delta of 2^32, which no int32 difference encodes to
+    const std::vector<uint8_t> payload = {0x01, 0x80, 0x80, 0x80, 0x80, 0x10, 0, 0};
+    WorldSnapshot decoded;
+    EXPECT_FALSE(decode(nullptr, payload, 1, decoded));
+}
+
+TEST(SnapshotTest, RejectsUnterminatedVarint) {
+    std::vector<uint8_t> payload = {0x00};
+    payload.insert(payload.end(), 10, 0xFF);
+    payload.push_back(0x01);
+    WorldSnapshot decoded;
+    EXPECT_FALSE(decode(nullptr, payload, 1, decoded));
+}
+
+TEST(SnapshotTest, RejectsEntityWithBadFieldMask) {
+    // No removals, then entity 1 with a mask naming a fifth field
+    const std::vector<uint8_t> payload = {0x00, 0x00, 0x02, 1u << EntityState::FIELD_COUNT, 0x00};
+    WorldSnapshot decoded;
+    EXPECT_FALSE(decode(nullptr, payload, 1, decoded));
+}
+
+TEST(SnapshotClientTest, ReassemblesFragmentsInAnyOrder) {
+    SnapshotClient client;
+    FakeServer server;
+    ASSERT_TRUE(server.start(client));
+
+    const WorldSnapshot snapshot = makeLargeSnapshot(5);
+    const std::vector<uint8_t> payload = encode(nullptr, snapshot);
+    ASSERT_GT(payload.size(), 2 * protocol::MAX_FRAGMENT_PAYLOAD);
+    ASSERT_LE(payload.size(), 3 * protocol::MAX_FRAGMENT_PAYLOAD);
+    server.sendSnapshot(5, 0, payload, {2, 0, 1});
+
+    EXPECT_EQ(pollAll(client, 3), 1);
+    ASSERT_NE(client.getLatest(), nullptr);
+    EXPECT_EQ(*client.getLatest(), snapshot);
+}
+
+TEST(SnapshotClientTest, IgnoresDuplicateFragments) {
+    SnapshotClient client;
+    FakeServer server;
+    ASSERT_TRUE(server.start(client));
+
+    const WorldSnapshot snapshot = makeLargeSnapshot(5);
+    const std::vector<uint8_t> payload = encode(nullptr, snapshot);
+    server.sendSnapshot(5, 0, payload, {0, 0, 1, 1});
+    EXPECT_EQ(pollAll(client, 4), 0);
+    EXPECT_EQ(client.getLatest(), nullptr);
+
+    server.sendSnapshot(5, 0, payload, {2, 2});
+    EXPECT_EQ(pollAll(client, 6), 1);
+    ASSERT_NE(client.getLatest(), nullptr);
+    EXPECT_EQ(*client.getLatest(), snapshot);
+    EXPECT_EQ(client.getStats().snapshotsDecoded, 1u);
+}
+
+TEST(SnapshotClientTest, RejectsFragmentsThatDisagreeOnTheCount) {
+    SnapshotClient client;
+    FakeServer server;
+    ASSERT_TRUE(server.start(client));
+
+    const std::vector<uint8_t> payload = encode(nullptr, makeLargeSnapshot(5));
+    const uint8_t* data = payload.data();
+    const size_t chunk = protocol::MAX_FRAGMENT_PAYLOAD;
+    server.sendFragment(5, 0, 0, 3, data, chunk);
+    server.sendFragment(5, 0, 1, 2, data + chunk, chunk); // Claims two fragments
+    server.sendFragment(5, 0, 2, 3, data + 2 * chunk, payload.size() - 2 * chunk);
+    EXPECT_EQ(pollAll(client, 3), 0);
+    EXPECT_EQ(client.getLatest(), nullptr);
+}
+
+TEST(SnapshotClientTest, IgnoresSnapshotsOlderThanTheLatest) {
+    SnapshotClient client;
+    FakeServer server;
+    ASSERT_TRUE(server.start(client));
+
+    const WorldSnapshot newer = makeSnapshot(9, {makeEntity(1, 1, 10, 10, 0)});
+    const WorldSnapshot older = makeSnapshot(8, {makeEntity(1, 1, 20, 20, 0)});
+    server.sendSnapshot(9, 0, encode(nullptr, newer));
+    EXPECT_EQ(pollAll(client, 1), 1);
+    server.sendSnapshot(8, 0, encode(nullptr, older));
+    EXPECT_EQ(pollAll(client, 2), 0);
+    ASSERT_NE(client.getLatest(), nullptr);
+    EXPECT_EQ(*client.getLatest(), newer);
+}
+
+TEST(SnapshotClientTest, MalformedSnapshotKeepsTheLatest) {
+    SnapshotClient client;
+    FakeServer server;
+    ASSERT_TRUE(server.start(client));
+
+    const WorldSnapshot first = makeSnapshot(1, {makeEntity(1, 1, 10, 10, 0),
+                                                 makeEntity(2, 2, 20, 20, 0)});
+    server.sendSnapshot(1, 0, encode(nullptr, first));
+    EXPECT_EQ(pollAll(client, 1), 1);
+
+    // Tick 1 + HISTORY_SIZE lands in the latest snapshot's history slot;
+    // its payload decodes a few entities before it turns out truncated
+    const WorldSnapshot next = makeSnapshot(1 + protocol::HISTORY_SIZE,
+                                            {makeEntity(7, 2, 70, 70, 0),
+                                             makeEntity(8, 2, 80, 80, 0)});
+    std::vector<uint8_t> payload = encode(nullptr, next);
+    payload.pop_back();
+    server.sendSnapshot(next.tick, 0, payload);
+    EXPECT_EQ(pollAll(client, 2), 0);
+
+    ASSERT_NE(client.getLatest(), nullptr);
+    EXPECT_EQ(*client.getLatest(), first);
+    EXPECT_EQ(client.getStats().snapshotsDropped, 1u);
+
+    // It stays a valid baseline for the next delta
+    const WorldSnapshot delta = makeSnapshot(70, {makeEntity(1, 1, 12, 10, 0),
+                                                  makeEntity(2, 2, 20, 20, 0)});
+    server.sendSnapshot(70, 1, encode(&first, delta));
+    EXPECT_EQ(pollAll(client, 3), 1);
+    ASSERT_NE(client.getLatest(), nullptr);
+    EXPECT_EQ(*client.getLatest(), delta);
+}
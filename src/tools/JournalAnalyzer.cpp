@@ -0,0 +1,185 @@
+/**
+ * JournalAnalyzer - summarizes a gameplay journal.
+ *
+ * Usage:
+ *   JournalAnalyzer <journal.bin> [--grid CxR] [--waves N]
+ *
+ * The journal is produced by running the game with --journal <file> (or
+ * GameServer --journal). Prints event totals, an accuracy heatmap (hits out
+ * of resolved shots in each cell of a C x R grid over the world, default
+ * 8x6), the time-to-kill distribution and one line per wave (the last N
+ * waves with --waves).
+ */
+
+#include "game/diagnostics/GameplayJournal.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace {
+
+using game::diagnostics::JournalEvent;
+using game::diagnostics::JournalReport;
+
+uint64_t count(const JournalReport &report, JournalEvent event) {
+  return report.counts[static_cast<size_t>(event)];
+}
+
+double percent(uint64_t part, uint64_t whole) {
+  return whole ? 100.0 * part / whole : 0.0;
+}
+
+void printHeatmap(const JournalReport &report) {
+  std::printf("\nAccuracy by cell (%% of shots resolved there that hit; "
+              "world %.0fx%.0f in %zux%zu cells):\n",
+              report.worldWidth, report.worldHeight, report.gridColumns,
+              report.gridRows);
+  for (size_t row = 0; row < report.gridRows; ++row) {
+    for (size_t column = 0; column < report.gridColumns; ++column) {
+      const size_t cell = row * report.gridColumns + column;
+      const uint64_t resolved = report.cellHits[cell] + report.cellMisses[cell];
+      if (resolved == 0) {
+        std::printf("     -");
+      } else {
+        std::printf(" %5.1f", percent(report.cellHits[cell], resolved));
+      }
+    }
+    std::printf("\n");
+  }
+}
+
+void printTimeToKill(const JournalReport &report) {
+  if (report.timeToKillCount == 0) {
+    std::printf("\nTime to kill: no duck spawned in the journal was hit\n");
+    return;
+  }
+  std::printf("\nTime to kill (%llu kills): mean %.2f s, p50 %.1f s, p90 "
+              "%.1f s, p99 %.1f s, max %.2f s\n",
+              static_cast<unsigned long long>(report.timeToKillCount),
+              report.timeToKillSum / report.timeToKillCount,
+              report.timeToKillPercentile(0.5),
+              report.timeToKillPercentile(0.9),
+              report.timeToKillPercentile(0.99), report.timeToKillMax);
+
+  // Histogram in half-second rows, bars scaled to the fullest row
+  constexpr size_t BINS_PER_ROW = 5;
+  constexpr size_t ROWS = JournalReport::TTK_BINS / BINS_PER_ROW;
+  uint64_t rows[ROWS] = {};
+  uint64_t fullest = 0;
+  size_t lastRow = 0;
+  for (size_t i = 0; i < report.timeToKill.size(); ++i) {
+    rows[i / BINS_PER_ROW] += report.timeToKill[i];
+  }
+  for (size_t row = 0; row < ROWS; ++row) {
+    fullest = std::max(fullest, rows[row]);
+    lastRow = rows[row] ? row : lastRow;
+  }
+  for (size_t row = 0; row <= lastRow; ++row) {
+    const float from = row * BINS_PER_ROW * JournalReport::TTK_BIN_SECONDS;
+    const int bar = static_cast<int>(40 * rows[row] / fullest);
+    std::printf("  %5.1f s %8llu %s\n", from,
+                static_cast<unsigned long long>(rows[row]),
+                std::string(bar, '#').c_str());
+  }
+}
+
+void printWaves(const JournalReport &report, size_t limit) {
+  const size_t first =
+      limit && report.waves.size() > limit ? report.waves.size() - limit : 0;
+  std::printf("\n%6s %8s %7s %7s %7s %7s %8s %9s %8s %7s\n", "wave",
+              "seconds", "spawns", "shots", "hits", "misses", "expired",
+              "accuracy", "mean ttk", "score");
+  for (size_t i = first; i < report.waves.size(); ++i) {
+    const JournalReport::Wave &wave = report.waves[i];
+    std::printf("%6u %8.1f %7llu %7llu %7llu %7llu %8llu %8.1f%% %7.2fs "
+                "%7lld\n",
+                wave.wave, wave.endTime - wave.startTime,
+                static_cast<unsigned long long>(wave.spawns),
+                static_cast<unsigned long long>(wave.shots),
+                static_cast<unsigned long long>(wave.hits),
+                static_cast<unsigned long long>(wave.misses),
+                static_cast<unsigned long long>(wave.expiries),
+                percent(wave.hits, wave.hits + wave.misses),
+                wave.timeToKillCount
+                    ? wave.timeToKillSum / wave.timeToKillCount
+                    : 0.0,
+                static_cast<long long>(wave.score));
+  }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0]
+              << " <journal.bin> [--grid CxR] [--waves N]" << std::endl;
+    return 2;
+  }
+  std::string input = argv[1];
+  size_t columns = 8;
+  size_t rows = 6;
+  size_t waveLimit = 0;
+  for (int i = 2; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--grid" && i + 1 < argc) {
+      const std::string grid = argv[++i];
+      const size_t x = grid.find('x');
+      columns = static_cast<size_t>(std::atoi(grid.substr(0, x).c_str()));
+      rows = x == std::string::npos
+                 ? 0
+                 : static_cast<size_t>(std::atoi(grid.c_str() + x + 1));
+      if (columns == 0 || rows == 0) {
+        std::cerr << "[JournalAnalyzer] Bad grid: " << grid << std::endl;
+        return 2;
+      }
+    } else if (arg == "--waves" && i + 1 < argc) {
+      waveLimit = static_cast<size_t>(std::atoi(argv[++i]));
+    } else {
+      std::cerr << "[JournalAnalyzer] Unknown or incomplete argument: " << arg
+                << std::endl;
+      return 2;
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  JournalReport report;
+  std::string error;
+  if (!game::diagnostics::GameplayJournal::analyze(input, columns, rows,
+                                                   report, &error)) {
+    std::cerr << "[JournalAnalyzer] " << error << std::endl;
+    return 1;
+  }
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+  std::error_code ignored;
+  std::printf("[JournalAnalyzer] %s: %llu records (%.1f MB) in %.0f ms, "
+              "%.1f M records/s\n",
+              input.c_str(), static_cast<unsigned long long>(report.records),
+              std::filesystem::file_size(input, ignored) / 1.0e6,
+              seconds * 1000.0,
+              seconds > 0.0 ? report.records / seconds / 1.0e6 : 0.0);
+
+  const uint64_t hits = count(report, JournalEvent::HIT);
+  const uint64_t misses = count(report, JournalEvent::MISS);
+  std::printf("Spawns %llu, shots %llu, hits %llu, misses %llu, expired "
+              "%llu, accuracy %.1f%%\n",
+              static_cast<unsigned long long>(count(report,
+                                                    JournalEvent::SPAWN)),
+              static_cast<unsigned long long>(count(report,
+                                                    JournalEvent::SHOT)),
+              static_cast<unsigned long long>(hits),
+              static_cast<unsigned long long>(misses),
+              static_cast<unsigned long long>(count(report,
+                                                    JournalEvent::EXPIRE)),
+              percent(hits, hits + misses));
+  printHeatmap(report);
+  printTimeToKill(report);
+  printWaves(report, waveLimit);
+  return 0;
+}
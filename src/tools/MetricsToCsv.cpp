@@ -0,0 +1,38 @@
+/**
+ * MetricsToCsv - converts a per-frame metrics capture to CSV.
+ *
+ * Usage:
+ *   MetricsToCsv <capture.bin> [output.csv]
+ *
+ * The capture is produced by running the game with --metrics <file>. When no
+ * output path is given, the CSV is written next to the capture with a .csv
+ * extension.
+ */
+
+#include "game/diagnostics/MetricsRecorder.hpp"
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+int main(int argc, char *argv[]) {
+  if (argc < 2 || argc > 3) {
+    std::cerr << "Usage: " << argv[0] << " <capture.bin> [output.csv]"
+              << std::endl;
+    return 2;
+  }
+
+  std::string input = argv[1];
+  std::string output =
+      argc == 3
+          ? std::string(argv[2])
+          : std::filesystem::path(input).replace_extension(".csv").string();
+
+  std::string error;
+  if (!game::diagnostics::MetricsRecorder::convertToCsv(input, output,
+                                                        &error)) {
+    std::cerr << "[MetricsToCsv] " << error << std::endl;
+    return 1;
+  }
+  std::cout << "[MetricsToCsv] Wrote " << output << std::endl;
+  return 0;
+}